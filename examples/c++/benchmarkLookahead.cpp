@@ -0,0 +1,228 @@
+/**
+ * @file    benchmarkLookahead.cpp
+ * @brief   Measures the lookahead of XMLInputStream on large MathML
+ *
+ * <!--------------------------------------------------------------------------
+ * This sample program is distributed under a different license than the rest
+ * of libSBML.  This program uses the open-source MIT license, as follows:
+ *
+ * Copyright (c) 2013-2018 by the California Institute of Technology
+ * (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+ * and the University of Heidelberg (Germany), with support from the National
+ * Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Neither the name of the California Institute of Technology (Caltech), nor
+ * of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+ * of Heidelberg, nor the names of any contributors, may be used to endorse
+ * or promote products derived from this software without specific prior
+ * written permission.
+ * ------------------------------------------------------------------------ -->
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <sbml/SBMLTypes.h>
+#include <sbml/common/extern.h>
+#include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLParser.h>
+#include "util.h"
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+#ifdef __BORLANDC__
+typedef unsigned long      millis_t;
+#else
+typedef unsigned long long millis_t;
+#endif
+
+
+/*
+ * Returns a MathML document with the given number of nested apply
+ * elements, each adding the given number of identifiers to the apply
+ * nested in it.
+ */
+static string
+createMath (unsigned int depth, unsigned int width)
+{
+  ostringstream math;
+  math << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n";
+
+  for (unsigned int d = 0; d < depth; ++d)
+  {
+    math << "<apply><plus/>\n";
+    for (unsigned int w = 0; w < width; ++w)
+    {
+      math << "  <ci> x" << d << "_" << w << " </ci>\n";
+    }
+  }
+
+  for (unsigned int d = 0; d < depth; ++d)
+  {
+    math << "</apply>\n";
+  }
+
+  math << "</math>\n";
+  return math.str();
+}
+
+
+/*
+ * Opens a stream on the content and reads it up to and including the
+ * outermost apply element.
+ */
+static XMLInputStream*
+openAtApply (const string& content)
+{
+  XMLInputStream* stream = new XMLInputStream(content.c_str(), false);
+
+  while (stream->isGood() && stream->next().getName() != "apply")
+  {
+  }
+
+  return stream;
+}
+
+
+/*
+ * Counts the children of the outermost apply element in content the given
+ * number of times and prints the fastest times, next to the time needed
+ * to read the content as an ASTNode.
+ */
+static int
+benchmark (const char* label, unsigned int depth, unsigned int width,
+           unsigned int repeats)
+{
+  const string content = createMath(depth, width);
+  const unsigned int children = width + ((depth > 1) ? 1 : 0);
+
+  millis_t bestChildren = 0;
+  millis_t bestSpecific = 0;
+  millis_t bestRead     = 0;
+  unsigned int errors   = 0;
+
+  for (unsigned int n = 0; n < repeats; ++n)
+  {
+    XMLInputStream* stream = openAtApply(content);
+    millis_t start = getCurrentMillis();
+    unsigned int num = stream->determineNumberChildren();
+    millis_t stop = getCurrentMillis();
+    delete stream;
+
+    if (num != children) ++errors;
+    if (n == 0 || stop - start < bestChildren) bestChildren = stop - start;
+
+    stream = openAtApply(content);
+    start = getCurrentMillis();
+    num = stream->determineNumSpecificChildren("ci", "apply");
+    stop = getCurrentMillis();
+    delete stream;
+
+    if (num != width) ++errors;
+    if (n == 0 || stop - start < bestSpecific) bestSpecific = stop - start;
+
+    start = getCurrentMillis();
+    ASTNode* math = readMathMLFromString(content.c_str());
+    stop = getCurrentMillis();
+
+    if (math == NULL) ++errors;
+    delete math;
+    if (n == 0 || stop - start < bestRead) bestRead = stop - start;
+  }
+
+  cout << "                             math: " << label << " (depth " << depth
+       << ", width " << width << ")" << endl;
+  cout << "                        size (kB): " << content.size() / 1024 << endl;
+  cout << "     determineNumberChildren (ms): " << bestChildren << endl;
+  cout << "determineNumSpecificChildren (ms): " << bestSpecific << endl;
+  cout << "        readMathMLFromString (ms): " << bestRead << endl;
+  cout << "                         error(s): " << errors << endl;
+  cout << endl;
+
+  return (errors > 0) ? 1 : 0;
+}
+
+
+BEGIN_C_DECLS
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int repeats = 3;
+  unsigned int width   = 50000;
+  unsigned int depth   = 200;
+  int          first   = 1;
+
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-n") == 0)
+    {
+      repeats = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-w") == 0)
+    {
+      width = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-d") == 0)
+    {
+      depth = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-c") == 0)
+    {
+      XMLParser::setChunkSize((unsigned int) atoi(argv[first + 1]));
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if (first < argc || repeats == 0 || width == 0 || depth == 0)
+  {
+    cout << endl
+         << "Usage: benchmarkLookahead [-n repeats] [-w width] [-d depth]"
+         << " [-c chunk]" << endl << endl
+         << "Counts the children of a very wide MathML apply element with"
+         << endl
+         << "the given number of arguments, and of deeply nested apply"
+         << endl
+         << "elements with the given depth, without consuming the tokens."
+         << endl << endl;
+    return 1;
+  }
+
+  cout << endl;
+
+  int result = 0;
+  result |= benchmark("wide", 1, width, repeats);
+  result |= benchmark("nested", depth, width / depth + 1, repeats);
+
+  return result;
+}
+
+END_C_DECLS
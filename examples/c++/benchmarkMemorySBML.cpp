@@ -0,0 +1,395 @@
+/**
+ * @file    benchmarkMemorySBML.cpp
+ * @brief   Measures the memory taken by the elements of SBML documents
+ *
+ * <!--------------------------------------------------------------------------
+ * This sample program is distributed under a different license than the rest
+ * of libSBML.  This program uses the open-source MIT license, as follows:
+ *
+ * Copyright (c) 2013-2018 by the California Institute of Technology
+ * (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+ * and the University of Heidelberg (Germany), with support from the National
+ * Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Neither the name of the California Institute of Technology (Caltech), nor
+ * of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+ * of Heidelberg, nor the names of any contributors, may be used to endorse
+ * or promote products derived from this software without specific prior
+ * written permission.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+
+#include <sbml/SBMLTypes.h>
+#include <sbml/common/extern.h>
+#include <sbml/util/ElementFilter.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+/*
+ * Counts the bytes allocated with operator new and not yet deleted, which
+ * are stored in a header before each allocation.  Allocations made by
+ * libSBML are only counted when the library is linked statically, or on
+ * systems where a shared library uses the operator new of the program.
+ * Neither are those made with malloc(), such as those of the XML parser.
+ */
+union AllocationHeader
+{
+  size_t      size;
+  long double align;
+};
+
+static size_t sLiveBytes = 0;
+
+void*
+operator new (size_t size)
+{
+  AllocationHeader* header =
+    (AllocationHeader*) malloc(sizeof(AllocationHeader) + size);
+  if (header == NULL) throw std::bad_alloc();
+
+  header->size = size;
+  sLiveBytes += size;
+  return header + 1;
+}
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+void
+operator delete (void* p) noexcept
+#else
+void
+operator delete (void* p) throw()
+#endif
+{
+  if (p == NULL) return;
+
+  AllocationHeader* header = (AllocationHeader*) p - 1;
+  sLiveBytes -= header->size;
+  free(header);
+}
+
+
+/*
+ * Returns an SBML Level 3 document with the given number of reactions,
+ * each converting one species into the next at a mass-action rate.
+ */
+static SBMLDocument*
+createModel (unsigned int numReactions)
+{
+  SBMLDocument* document = new SBMLDocument(3, 1);
+  Model* model = document->createModel();
+  model->setId("benchmark");
+
+  Compartment* c = model->createCompartment();
+  c->setId("cell");
+  c->setSize(1);
+  c->setConstant(true);
+
+  for (unsigned int n = 0; n <= numReactions; ++n)
+  {
+    ostringstream id;
+    id << "S" << n;
+
+    Species* s = model->createSpecies();
+    s->setId(id.str());
+    s->setName("species " + id.str());
+    s->setCompartment("cell");
+    s->setInitialConcentration(n / 7.0);
+    s->setHasOnlySubstanceUnits(false);
+    s->setBoundaryCondition(false);
+    s->setConstant(false);
+  }
+
+  for (unsigned int n = 0; n < numReactions; ++n)
+  {
+    ostringstream id, reactant, product, k;
+    id << "J" << n;
+    reactant << "S" << n;
+    product << "S" << n + 1;
+    k << "k" << n;
+
+    Parameter* p = model->createParameter();
+    p->setId(k.str());
+    p->setValue(0.1 + n);
+    p->setConstant(true);
+
+    Reaction* r = model->createReaction();
+    r->setId(id.str());
+    r->setReversible(false);
+    r->setFast(false);
+
+    SpeciesReference* sr = r->createReactant();
+    sr->setSpecies(reactant.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    sr = r->createProduct();
+    sr->setSpecies(product.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    KineticLaw* kl = r->createKineticLaw();
+    ASTNode* math = SBML_parseL3Formula(
+      (k.str() + " * cell * " + reactant.str()).c_str());
+    kl->setMath(math);
+    delete math;
+  }
+
+  return document;
+}
+
+
+/* selects the children of an element, but not their descendants */
+class ChildFilter : public ElementFilter
+{
+public:
+  ChildFilter (const SBase* parent) : mParent(parent) {}
+
+  virtual bool filter (const SBase* element)
+  {
+    return element->getParentSBMLObject() == mParent;
+  }
+
+private:
+  const SBase* mParent;
+};
+
+
+/* the memory measured for the elements of one kind */
+struct ElementMemory
+{
+  unsigned long count;
+  unsigned long sampled;
+  size_t        bytes;
+};
+
+
+/*
+ * Returns the bytes taken by a copy of the element.
+ */
+static size_t
+bytesOf (const SBase* element)
+{
+  size_t before = sLiveBytes;
+  SBase* copy = element->clone();
+  size_t bytes = sLiveBytes - before;
+  delete copy;
+  return bytes;
+}
+
+
+/*
+ * Returns the bytes taken by the element without its child elements, or
+ * 0 if it has more than maxElements descendants to copy.
+ */
+static size_t
+ownBytesOf (SBase* element, unsigned int maxElements)
+{
+  List* descendants = element->getAllElements();
+  unsigned int numDescendants = descendants->getSize();
+  delete descendants;
+
+  if (numDescendants > maxElements) return 0;
+
+  size_t bytes = bytesOf(element);
+
+  ChildFilter filter(element);
+  List* children = element->getAllElements(&filter);
+  for (ListIterator it = children->begin(); it != children->end(); ++it)
+  {
+    bytes -= bytesOf(static_cast<SBase*>(*it));
+  }
+  delete children;
+
+  return bytes;
+}
+
+
+/*
+ * Prints the bytes taken by the document, and the bytes taken by the
+ * elements of each kind, measured by copying up to the given number of
+ * them.
+ */
+static void
+measure (const char* label, SBMLDocument* document, size_t documentBytes,
+         unsigned int samples)
+{
+  map<string, ElementMemory> kinds;
+
+  List* elements = document->getAllElements();
+  const unsigned long numElements = elements->getSize() + 1;
+
+  for (ListIterator it = elements->begin(); it != elements->end(); ++it)
+  {
+    SBase* element = static_cast<SBase*>(*it);
+    string kind = element->getElementName();
+    if (element->getPackageName() != "core")
+    {
+      kind = element->getPackageName() + ":" + kind;
+    }
+
+    map<string, ElementMemory>::iterator found = kinds.find(kind);
+    if (found == kinds.end())
+    {
+      ElementMemory memory = { 0, 0, 0 };
+      found = kinds.insert(make_pair(kind, memory)).first;
+    }
+
+    ElementMemory& memory = found->second;
+    ++memory.count;
+
+    if (memory.sampled < samples)
+    {
+      size_t bytes = ownBytesOf(element, 1000);
+      if (bytes > 0)
+      {
+        ++memory.sampled;
+        memory.bytes += bytes;
+      }
+    }
+  }
+  delete elements;
+
+  cout << "           document: " << label << endl;
+  cout << "           elements: " << numElements << endl;
+  cout << "    total heap (MB): " << documentBytes / (1024.0 * 1024.0) << endl;
+  cout << "  bytes per element: " << documentBytes / numElements << endl;
+  cout << "      sizeof(SBase): " << sizeof(SBase) << endl;
+  cout << "  bytes per element without its children (mean of up to "
+       << samples << "):" << endl;
+
+  for (map<string, ElementMemory>::const_iterator it = kinds.begin();
+       it != kinds.end(); ++it)
+  {
+    const ElementMemory& memory = it->second;
+
+    cout << "    " << setw(30) << left << it->first << right << setw(8);
+    if (memory.sampled > 0)
+    {
+      cout << memory.bytes / memory.sampled;
+    }
+    else
+    {
+      cout << "-";
+    }
+    cout << "  (" << memory.count << ")" << endl;
+  }
+
+  cout << endl;
+}
+
+
+BEGIN_C_DECLS
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int numReactions = 20000;
+  unsigned int samples      = 100;
+  int          first        = 1;
+
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-r") == 0)
+    {
+      numReactions = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-s") == 0)
+    {
+      samples = (unsigned int) atoi(argv[first + 1]);
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if (first < argc && argv[first][0] == '-')
+  {
+    cout << endl
+         << "Usage: benchmarkMemorySBML [-r reactions] [-s samples]"
+         << " [filename ...]" << endl << endl
+         << "Reads each file, or without files creates a model with the"
+         << endl
+         << "given number of reactions, and prints the heap it takes and"
+         << endl
+         << "the bytes taken by each kind of element, without its children,"
+         << endl
+         << "measured on copies of up to the given number of them."
+         << endl << endl;
+    return 1;
+  }
+
+  cout << endl;
+
+  int result = 0;
+
+  if (first == argc)
+  {
+    ostringstream label;
+    label << "generated, " << numReactions << " reactions";
+
+    size_t before = sLiveBytes;
+    SBMLDocument* document = createModel(numReactions);
+    measure(label.str().c_str(), document, sLiveBytes - before, samples);
+    delete document;
+  }
+
+  SBMLReader reader;
+
+  for (int n = first; n < argc; ++n)
+  {
+    size_t before = sLiveBytes;
+    SBMLDocument* document = reader.readSBMLFromFile(argv[n]);
+    size_t documentBytes = sLiveBytes - before;
+
+    if (document->getNumErrors(LIBSBML_SEV_FATAL) > 0)
+    {
+      document->printErrors(cerr);
+      result = 1;
+    }
+    else
+    {
+      measure(argv[n], document, documentBytes, samples);
+    }
+
+    delete document;
+  }
+
+  return result;
+}
+
+END_C_DECLS
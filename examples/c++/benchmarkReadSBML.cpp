@@ -0,0 +1,285 @@
+/**
+ * @file    benchmarkReadSBML.cpp
+ * @brief   Measures the throughput of reading SBML documents
+ *
+ * <!--------------------------------------------------------------------------
+ * This sample program is distributed under a different license than the rest
+ * of libSBML.  This program uses the open-source MIT license, as follows:
+ *
+ * Copyright (c) 2013-2018 by the California Institute of Technology
+ * (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+ * and the University of Heidelberg (Germany), with support from the National
+ * Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Neither the name of the California Institute of Technology (Caltech), nor
+ * of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+ * of Heidelberg, nor the names of any contributors, may be used to endorse
+ * or promote products derived from this software without specific prior
+ * written permission.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#include <sbml/SBMLTypes.h>
+#include <sbml/common/extern.h>
+#include <sbml/xml/XMLParser.h>
+#include "util.h"
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+#ifdef __BORLANDC__
+typedef unsigned long      millis_t;
+#else
+typedef unsigned long long millis_t;
+#endif
+
+
+/*
+ * Counts the memory allocations made with operator new.  Allocations made
+ * by libSBML are only counted when the library is linked statically, or
+ * on systems where a shared library uses the operator new of the program.
+ */
+static unsigned long sAllocations = 0;
+
+void*
+operator new (size_t size)
+{
+  ++sAllocations;
+
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL) throw std::bad_alloc();
+  return p;
+}
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+void
+operator delete (void* p) noexcept
+#else
+void
+operator delete (void* p) throw()
+#endif
+{
+  free(p);
+}
+
+
+/*
+ * Returns an SBML Level 3 document with the given number of reactions,
+ * each converting one species into the next at a mass-action rate.
+ */
+static string
+createModel (unsigned int numReactions)
+{
+  SBMLDocument document(3, 1);
+  Model* model = document.createModel();
+  model->setId("benchmark");
+
+  Compartment* c = model->createCompartment();
+  c->setId("cell");
+  c->setSize(1);
+  c->setConstant(true);
+
+  for (unsigned int n = 0; n <= numReactions; ++n)
+  {
+    ostringstream id;
+    id << "S" << n;
+
+    Species* s = model->createSpecies();
+    s->setId(id.str());
+    s->setName("species " + id.str());
+    s->setCompartment("cell");
+    s->setInitialConcentration(n % 7);
+    s->setHasOnlySubstanceUnits(false);
+    s->setBoundaryCondition(false);
+    s->setConstant(false);
+  }
+
+  for (unsigned int n = 0; n < numReactions; ++n)
+  {
+    ostringstream id, reactant, product, k;
+    id << "J" << n;
+    reactant << "S" << n;
+    product << "S" << n + 1;
+    k << "k" << n;
+
+    Parameter* p = model->createParameter();
+    p->setId(k.str());
+    p->setValue(0.1 + n);
+    p->setConstant(true);
+
+    Reaction* r = model->createReaction();
+    r->setId(id.str());
+    r->setReversible(false);
+    r->setFast(false);
+
+    SpeciesReference* sr = r->createReactant();
+    sr->setSpecies(reactant.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    sr = r->createProduct();
+    sr->setSpecies(product.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    KineticLaw* kl = r->createKineticLaw();
+    ASTNode* math = SBML_parseL3Formula(
+      (k.str() + " * cell * " + reactant.str()).c_str());
+    kl->setMath(math);
+    delete math;
+  }
+
+  return writeSBMLToStdString(&document);
+}
+
+
+/*
+ * Reads the document in content (or, if filename is not NULL, in the
+ * file) the given number of times and prints the fastest time.
+ */
+static int
+benchmark (const char* label, const string& content, const char* filename,
+           unsigned long size, unsigned int repeats)
+{
+  SBMLReader reader;
+  millis_t best = 0;
+  unsigned long allocations = 0;
+  unsigned int errors = 0;
+
+  for (unsigned int n = 0; n < repeats; ++n)
+  {
+    unsigned long before = sAllocations;
+    millis_t start = getCurrentMillis();
+    SBMLDocument* document = (filename != NULL)
+                           ? reader.readSBMLFromFile(filename)
+                           : reader.readSBMLFromString(content);
+    millis_t stop = getCurrentMillis();
+    allocations = sAllocations - before;
+
+    errors = document->getNumErrors(LIBSBML_SEV_ERROR)
+           + document->getNumErrors(LIBSBML_SEV_FATAL);
+    if (n == 0)
+    {
+      document->printErrors(cerr);
+    }
+    delete document;
+
+    if (n == 0 || stop - start < best)
+    {
+      best = stop - start;
+    }
+  }
+
+  double mb = size / (1024.0 * 1024.0);
+
+  cout << "            document: " << label << endl;
+  cout << "           size (MB): " << mb << endl;
+  cout << " best read time (ms): " << best << " (of " << repeats << ")" << endl;
+  if (best > 0)
+  {
+    cout << "   throughput (MB/s): " << mb * 1000.0 / best << endl;
+  }
+  cout << "         allocations: " << allocations << " (per read)" << endl;
+  cout << "            error(s): " << errors << endl;
+  cout << endl;
+
+  return (errors > 0) ? 1 : 0;
+}
+
+
+BEGIN_C_DECLS
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int repeats      = 5;
+  unsigned int numReactions = 20000;
+  int          first        = 1;
+
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-n") == 0)
+    {
+      repeats = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-r") == 0)
+    {
+      numReactions = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-c") == 0)
+    {
+      XMLParser::setChunkSize((unsigned int) atoi(argv[first + 1]));
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if ((first < argc && argv[first][0] == '-') || repeats == 0)
+  {
+    cout << endl
+         << "Usage: benchmarkReadSBML [-n repeats] [-r reactions] [-c chunk]"
+         << " [filename ...]" << endl << endl
+         << "Reads each file, or without files a generated model with the"
+         << endl
+         << "given number of reactions, and prints the read throughput."
+         << endl
+         << "The chunk is the number of bytes parsed at a time when the"
+         << endl
+         << "content is in memory (0 for all of it at once)."
+         << endl << endl;
+    return 1;
+  }
+
+  cout << endl;
+
+  int result = 0;
+
+  if (first == argc)
+  {
+    ostringstream label;
+    label << "generated, " << numReactions << " reactions";
+
+    const string content = createModel(numReactions);
+    result |= benchmark(label.str().c_str(), content, NULL,
+                        (unsigned long) content.size(), repeats);
+  }
+
+  for (int n = first; n < argc; ++n)
+  {
+    result |= benchmark(argv[n], "", argv[n], getFileSize(argv[n]), repeats);
+  }
+
+  return result;
+}
+
+END_C_DECLS
@@ -0,0 +1,350 @@
+/**
+ * @file    benchmarkWriteSBML.cpp
+ * @brief   Measures the throughput of writing SBML documents
+ *
+ * <!--------------------------------------------------------------------------
+ * This sample program is distributed under a different license than the rest
+ * of libSBML.  This program uses the open-source MIT license, as follows:
+ *
+ * Copyright (c) 2013-2018 by the California Institute of Technology
+ * (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+ * and the University of Heidelberg (Germany), with support from the National
+ * Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Neither the name of the California Institute of Technology (Caltech), nor
+ * of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+ * of Heidelberg, nor the names of any contributors, may be used to endorse
+ * or promote products derived from this software without specific prior
+ * written permission.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <sbml/SBMLTypes.h>
+#include <sbml/common/extern.h>
+#include <sbml/xml/XMLOutputBuffer.h>
+#include "util.h"
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+#ifdef __BORLANDC__
+typedef unsigned long      millis_t;
+#else
+typedef unsigned long long millis_t;
+#endif
+
+
+/*
+ * Returns an SBML Level 3 document with the given number of reactions,
+ * each converting one species into the next at a mass-action rate.
+ */
+static SBMLDocument*
+createModel (unsigned int numReactions)
+{
+  SBMLDocument* document = new SBMLDocument(3, 1);
+  Model* model = document->createModel();
+  model->setId("benchmark");
+
+  Compartment* c = model->createCompartment();
+  c->setId("cell");
+  c->setSize(1);
+  c->setConstant(true);
+
+  for (unsigned int n = 0; n <= numReactions; ++n)
+  {
+    ostringstream id;
+    id << "S" << n;
+
+    Species* s = model->createSpecies();
+    s->setId(id.str());
+    s->setName("species " + id.str());
+    s->setCompartment("cell");
+    s->setInitialConcentration(n / 7.0);
+    s->setHasOnlySubstanceUnits(false);
+    s->setBoundaryCondition(false);
+    s->setConstant(false);
+  }
+
+  for (unsigned int n = 0; n < numReactions; ++n)
+  {
+    ostringstream id, reactant, product, k;
+    id << "J" << n;
+    reactant << "S" << n;
+    product << "S" << n + 1;
+    k << "k" << n;
+
+    Parameter* p = model->createParameter();
+    p->setId(k.str());
+    p->setValue(0.1 + n);
+    p->setConstant(true);
+
+    Reaction* r = model->createReaction();
+    r->setId(id.str());
+    r->setReversible(false);
+    r->setFast(false);
+
+    SpeciesReference* sr = r->createReactant();
+    sr->setSpecies(reactant.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    sr = r->createProduct();
+    sr->setSpecies(product.str());
+    sr->setStoichiometry(1);
+    sr->setConstant(true);
+
+    KineticLaw* kl = r->createKineticLaw();
+    ASTNode* math = SBML_parseL3Formula(
+      (k.str() + " * cell * " + reactant.str()).c_str());
+    kl->setMath(math);
+    delete math;
+  }
+
+  return document;
+}
+
+
+/* the destinations the document is written to */
+enum Target
+{
+  TO_STRING,
+  TO_OSTREAM,
+  TO_FILE,
+  TO_GZIP_FILE
+};
+
+
+/*
+ * Writes the document to the target once, and returns false on failure.
+ */
+static bool
+writeTo (SBMLWriter& writer, const SBMLDocument* document, Target target)
+{
+  switch (target)
+  {
+  case TO_STRING:
+    {
+      XMLMemorySink sink;
+      return writer.writeSBML(document, sink);
+    }
+
+  case TO_OSTREAM:
+    {
+      ostringstream stream;
+      return writer.writeSBML(document, stream);
+    }
+
+  case TO_FILE:
+    return writer.writeSBML(document, "benchmarkWriteSBML.out.xml");
+
+  case TO_GZIP_FILE:
+    return writer.writeSBML(document, "benchmarkWriteSBML.out.xml.gz");
+  }
+
+  return false;
+}
+
+
+/*
+ * Writes the document to the target the given number of times and prints
+ * the fastest time.
+ */
+static int
+benchmark (const char* label, const SBMLDocument* document, Target target,
+           unsigned long size, unsigned int repeats, unsigned int numThreads)
+{
+  SBMLWriter writer;
+  writer.setNumThreads(numThreads);
+  millis_t best = 0;
+  bool ok = true;
+
+  for (unsigned int n = 0; n < repeats; ++n)
+  {
+    millis_t start = getCurrentMillis();
+    ok = writeTo(writer, document, target) && ok;
+    millis_t stop = getCurrentMillis();
+
+    if (n == 0 || stop - start < best)
+    {
+      best = stop - start;
+    }
+  }
+
+  double mb = size / (1024.0 * 1024.0);
+
+  cout << "    " << label << ": " << best << " ms";
+  if (best > 0)
+  {
+    cout << ", " << mb * 1000.0 / best << " MB/s";
+  }
+  cout << (ok ? "" : " (failed)") << endl;
+
+  return ok ? 0 : 1;
+}
+
+
+/*
+ * Writes the document to each target, and prints the throughput in MB of
+ * uncompressed SBML per second.
+ */
+static int
+benchmarkAll (const char* label, const SBMLDocument* document,
+              unsigned int repeats, unsigned int numThreads)
+{
+  const string content = writeSBMLToStdString(document);
+  const unsigned long size = (unsigned long) content.size();
+
+  cout << "     document: " << label << endl;
+  cout << "    size (MB): " << size / (1024.0 * 1024.0) << endl;
+  cout << "      threads: " << numThreads << endl;
+  cout << "    kept text: " << (document->isSetOriginalText() ? "yes" : "no")
+       << endl;
+  cout << "  best write time (of " << repeats << "):" << endl;
+
+  int result = 0;
+  result |= benchmark("to memory      ", document, TO_STRING, size, repeats,
+                      numThreads);
+  result |= benchmark("to std::ostream", document, TO_OSTREAM, size, repeats,
+                      numThreads);
+  result |= benchmark("to file        ", document, TO_FILE, size, repeats,
+                      numThreads);
+  remove("benchmarkWriteSBML.out.xml");
+
+  if (SBMLWriter::hasZlib())
+  {
+    result |= benchmark("to gzip file   ", document, TO_GZIP_FILE, size,
+                        repeats, numThreads);
+    remove("benchmarkWriteSBML.out.xml.gz");
+  }
+
+  cout << endl;
+
+  return result;
+}
+
+
+BEGIN_C_DECLS
+
+int
+main (int argc, char* argv[])
+{
+  unsigned int repeats      = 5;
+  unsigned int numReactions = 20000;
+  unsigned int numThreads   = 1;
+  bool         keepText     = false;
+  int          first        = 1;
+
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-k") == 0)
+    {
+      keepText = true;
+      first += 1;
+      continue;
+    }
+    else if (strcmp(argv[first], "-n") == 0)
+    {
+      repeats = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-r") == 0)
+    {
+      numReactions = (unsigned int) atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-t") == 0)
+    {
+      numThreads = (unsigned int) atoi(argv[first + 1]);
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if ((first < argc && argv[first][0] == '-') || repeats == 0)
+  {
+    cout << endl
+         << "Usage: benchmarkWriteSBML [-n repeats] [-r reactions]"
+         << " [-t threads] [-k] [filename ...]" << endl << endl
+         << "Writes each file, or without files a generated model with the"
+         << endl
+         << "given number of reactions, to memory, to a stream, to a file"
+         << endl
+         << "and to a gzip file, and prints the write throughput.  The large"
+         << endl
+         << "lists are written by the given number of threads, or one per"
+         << endl
+         << "hardware thread if 0.  With -k, the files keep the text they"
+         << endl
+         << "are read from, and are written from it as they were read."
+         << endl << endl;
+    return 1;
+  }
+
+  cout << endl;
+
+  int result = 0;
+
+  if (first == argc)
+  {
+    ostringstream label;
+    label << "generated, " << numReactions << " reactions";
+
+    SBMLDocument* document = createModel(numReactions);
+    result |= benchmarkAll(label.str().c_str(), document, repeats,
+                           numThreads);
+    delete document;
+  }
+
+  SBMLReader reader;
+  reader.setKeepOriginalText(keepText);
+
+  for (int n = first; n < argc; ++n)
+  {
+    SBMLDocument* document = reader.readSBMLFromFile(argv[n]);
+
+    if (document->getNumErrors(LIBSBML_SEV_FATAL) > 0)
+    {
+      document->printErrors(cerr);
+      result = 1;
+    }
+    else
+    {
+      result |= benchmarkAll(argv[n], document, repeats, numThreads);
+    }
+
+    delete document;
+  }
+
+  return result;
+}
+
+END_C_DECLS
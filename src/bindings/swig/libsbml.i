@@ -152,6 +152,9 @@ LIBSBML_CPP_NAMESPACE_USE
 %ignore ASTNode::setSemanticsFlag;
 %ignore ASTNode::unsetSemanticsFlag;
 %ignore ASTNode::getSemanticsFlag;
+%ignore ASTNode::operator new;
+%ignore ASTNode::operator delete;
+%ignore SBMLDocument::getASTNodeArena;
 
 /**
  * Ignore the list that can't be wrapped
@@ -130,6 +130,7 @@ AssignmentRule::hasRequiredAttributes() const
 void
 AssignmentRule::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   Rule::renameSIdRefs(oldid, newid);
   if (isSetVariable()) {
     if (getVariable()==oldid) {
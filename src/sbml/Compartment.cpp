@@ -478,12 +478,14 @@ Compartment::isSetConstant () const
 int
 Compartment::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -496,6 +498,7 @@ Compartment::setId (const std::string& sid)
 int
 Compartment::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -507,6 +510,7 @@ Compartment::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -525,6 +529,7 @@ Compartment::setName (const std::string& name)
 int
 Compartment::setCompartmentType (const std::string& sid)
 {
+  invalidateOriginalText();
   if ( (getLevel() < 2)
     || (getLevel() == 2 && getVersion() == 1))
   {
@@ -551,6 +556,7 @@ Compartment::setCompartmentType (const std::string& sid)
 int
 Compartment::setSpatialDimensions (unsigned int value)
 {
+  invalidateOriginalText();
   return setSpatialDimensions((double) value);
 }
 
@@ -561,6 +567,7 @@ Compartment::setSpatialDimensions (unsigned int value)
 int
 Compartment::setSpatialDimensions (double value)
 {
+  invalidateOriginalText();
   bool representsInteger = true;
   if (floor(value) != value)
     representsInteger = false;
@@ -602,6 +609,7 @@ Compartment::setSpatialDimensions (double value)
 int
 Compartment::setSize (double value)
 {
+  invalidateOriginalText();
   mSize      = value;
   mIsSetSize = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -614,6 +622,7 @@ Compartment::setSize (double value)
 int
 Compartment::setVolume (double value)
 {
+  invalidateOriginalText();
   return setSize(value);
 }
 
@@ -624,6 +633,7 @@ Compartment::setVolume (double value)
 int
 Compartment::setUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalUnitSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -642,6 +652,7 @@ Compartment::setUnits (const std::string& sid)
 int
 Compartment::setOutside (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -660,6 +671,7 @@ Compartment::setOutside (const std::string& sid)
 int
 Compartment::setConstant (bool value)
 {
+  invalidateOriginalText();
   if ( getLevel() < 2 )
   {
     mConstant = value;
@@ -681,6 +693,7 @@ Compartment::setConstant (bool value)
 void
 Compartment::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (mCompartmentType==oldid) mCompartmentType = newid;
   if (mOutside==oldid) mOutside= newid; //You know, just in case.
@@ -689,6 +702,7 @@ Compartment::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Compartment::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (mUnits==oldid) mUnits = newid;
 }
@@ -699,8 +713,10 @@ Compartment::renameUnitSIdRefs(const std::string& oldid, const std::string& newi
 int
 Compartment::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -726,6 +742,7 @@ Compartment::unsetName ()
 int
 Compartment::unsetConstant ()
 {
+  invalidateOriginalText();
   if ( getLevel() == 1 )
   {
     mConstant = false;
@@ -754,6 +771,7 @@ Compartment::unsetConstant ()
 int
 Compartment::unsetCompartmentType ()
 {
+  invalidateOriginalText();
   if ( (getLevel() < 2)
     || (getLevel() == 2 && getVersion() == 1))
   {
@@ -780,6 +798,7 @@ Compartment::unsetCompartmentType ()
 int
 Compartment::unsetSize ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
     mSize = 1.0;
@@ -812,6 +831,7 @@ Compartment::unsetSize ()
 int
 Compartment::unsetVolume ()
 {
+  invalidateOriginalText();
   return unsetSize();
 }
 
@@ -822,6 +842,7 @@ Compartment::unsetVolume ()
 int
 Compartment::unsetUnits ()
 {
+  invalidateOriginalText();
   mUnits.erase();
 
   if (mUnits.empty()) 
@@ -841,6 +862,7 @@ Compartment::unsetUnits ()
 int
 Compartment::unsetOutside ()
 {
+  invalidateOriginalText();
   mOutside.erase();
 
   if (mOutside.empty()) 
@@ -859,6 +881,7 @@ Compartment::unsetOutside ()
 int
 Compartment::unsetSpatialDimensions ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3) 
   {
     mSpatialDimensions = 3;
@@ -1931,13 +1954,7 @@ ListOfCompartments::get (const std::string& sid)
 const Compartment*
 ListOfCompartments::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  {
-    result = find_if( mItems.begin(), mItems.end(), IdEq<Compartment>(sid) );
-    return (result == mItems.end()) ? NULL : 
-                                      static_cast <Compartment*> (*result);
-  }
+  return static_cast <const Compartment*> (getItemBySId(sid));
 }
 
 
@@ -1945,6 +1962,7 @@ ListOfCompartments::get (const std::string& sid) const
 Compartment*
 ListOfCompartments::remove (unsigned int n)
 {
+  invalidateOriginalText();
   return static_cast<Compartment*>(ListOf::remove(n));
 }
 
@@ -1953,6 +1971,7 @@ ListOfCompartments::remove (unsigned int n)
 Compartment*
 ListOfCompartments::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1962,6 +1981,7 @@ ListOfCompartments::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Compartment*> (item);
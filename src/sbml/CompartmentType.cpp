@@ -177,12 +177,14 @@ CompartmentType::isSetName () const
 int
 CompartmentType::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -195,6 +197,7 @@ CompartmentType::setId (const std::string& sid)
 int
 CompartmentType::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -206,6 +209,7 @@ CompartmentType::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -224,8 +228,10 @@ CompartmentType::setName (const std::string& name)
 int
 CompartmentType::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -741,11 +747,7 @@ ListOfCompartmentTypes::get (const std::string& sid)
 const CompartmentType*
 ListOfCompartmentTypes::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqCT(sid) );
-  return (result == mItems.end()) ? NULL : 
-                    static_cast <CompartmentType*> (*result);  
+  return static_cast <const CompartmentType*> (getItemBySId(sid));
 }
 
 
@@ -753,6 +755,7 @@ ListOfCompartmentTypes::get (const std::string& sid) const
 CompartmentType*
 ListOfCompartmentTypes::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<CompartmentType*>(ListOf::remove(n));
 }
 
@@ -761,6 +764,7 @@ ListOfCompartmentTypes::remove (unsigned int n)
 CompartmentType*
 ListOfCompartmentTypes::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -770,6 +774,7 @@ ListOfCompartmentTypes::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <CompartmentType*> (item);
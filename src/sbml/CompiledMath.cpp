@@ -0,0 +1,913 @@
+/**
+ * @file    CompiledMath.cpp
+ * @brief   Math compiled to bytecode for repeated evaluation.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/CompiledMath.h>
+#include <sbml/FunctionDefinition.h>
+#include <sbml/math/ASTNode.h>
+
+#include <cstring>
+#include <limits>
+#include <math.h>
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * The instructions of the stack machine.  OP_CONST pushes its value and
+ * OP_LOAD the value at index arg; OP_TIME pushes the time.  The n-ary
+ * operations pop arg values, the others the number of operands they
+ * take, and all of them push their result.
+ */
+enum MathOp
+{
+    OP_CONST
+  , OP_LOAD
+  , OP_TIME
+  , OP_ADD
+  , OP_MUL
+  , OP_SUB
+  , OP_NEG
+  , OP_DIV
+  , OP_POW
+  , OP_ROOT
+  , OP_ABS
+  , OP_ARCCOS
+  , OP_ARCCOSH
+  , OP_ARCCOT
+  , OP_ARCCOTH
+  , OP_ARCCSC
+  , OP_ARCCSCH
+  , OP_ARCSEC
+  , OP_ARCSECH
+  , OP_ARCSIN
+  , OP_ARCSINH
+  , OP_ARCTAN
+  , OP_ARCTANH
+  , OP_CEILING
+  , OP_COS
+  , OP_COSH
+  , OP_COT
+  , OP_COTH
+  , OP_CSC
+  , OP_CSCH
+  , OP_EXP
+  , OP_FACTORIAL
+  , OP_FLOOR
+  , OP_LN
+  , OP_LOG10
+  , OP_SEC
+  , OP_SECH
+  , OP_SIN
+  , OP_SINH
+  , OP_TAN
+  , OP_TANH
+  , OP_NOT
+  , OP_AND
+  , OP_OR
+  , OP_XOR
+  , OP_IMPLIES
+  , OP_REM
+  , OP_QUOTIENT
+  , OP_EQ
+  , OP_GEQ
+  , OP_GT
+  , OP_LEQ
+  , OP_LT
+  , OP_NEQ
+  , OP_MIN
+  , OP_MAX
+  , OP_PIECEWISE
+};
+
+
+/*
+ * Returns the number of values popped by an instruction.
+ */
+static unsigned int
+getNumOperands(unsigned int op, unsigned int arg)
+{
+  switch (op)
+  {
+  case OP_CONST:
+  case OP_LOAD:
+  case OP_TIME:
+    return 0;
+
+  case OP_ADD:
+  case OP_MUL:
+  case OP_EQ:
+  case OP_GEQ:
+  case OP_GT:
+  case OP_LEQ:
+  case OP_LT:
+  case OP_NEQ:
+  case OP_MIN:
+  case OP_MAX:
+  case OP_PIECEWISE:
+    return arg;
+
+  case OP_SUB:
+  case OP_DIV:
+  case OP_POW:
+  case OP_ROOT:
+  case OP_AND:
+  case OP_OR:
+  case OP_XOR:
+  case OP_IMPLIES:
+  case OP_REM:
+  case OP_QUOTIENT:
+    return 2;
+
+  default:
+    return 1;
+  }
+}
+
+
+/*
+ * The piecewise function as evaluated by SBMLTransforms::evaluateASTNode():
+ * every piece is computed, and if several conditions are true their
+ * values must agree.
+ */
+static double
+evaluatePiecewise(const double* args, unsigned int numArgs)
+{
+  double result = 0;
+  bool assigned = false;
+  unsigned int numPieces = numArgs / 2;
+
+  for (unsigned int j = 0; j < 2 * numPieces; j += 2)
+  {
+    if (args[j + 1] == 1.0)
+    {
+      if (assigned == true)
+      {
+        if (args[j] != result)
+        {
+          result = numeric_limits<double>::quiet_NaN();
+        }
+      }
+      else
+      {
+        result = args[j];
+        assigned = true;
+      }
+    }
+  }
+
+  if (!assigned)
+  {
+    result = (numArgs % 2 == 0) ? numeric_limits<double>::quiet_NaN()
+                                : args[numArgs - 1];
+  }
+
+  return result;
+}
+
+
+/*
+ * Runs the instructions from begin to end with the given stack, which
+ * must be deep enough, and returns the value left on top of it.
+ */
+static double
+execute(const CompiledMath::Instruction* begin,
+        const CompiledMath::Instruction* end,
+        const double* values, double time, double* stack)
+{
+  double* sp = stack;
+
+  for (const CompiledMath::Instruction* in = begin; in != end; ++in)
+  {
+    unsigned int n;
+    double x;
+
+    switch (in->op)
+    {
+    case OP_CONST:
+      *sp++ = in->value;
+      continue;
+
+    case OP_LOAD:
+      *sp++ = values[in->arg];
+      continue;
+
+    case OP_TIME:
+      *sp++ = time;
+      continue;
+
+    case OP_ADD:
+      n = in->arg;
+      sp -= n;
+      x = sp[0];
+      for (unsigned int j = 1; j < n; ++j)
+      {
+        x = x + sp[j];
+      }
+      *sp++ = x;
+      continue;
+
+    case OP_MUL:
+      n = in->arg;
+      sp -= n;
+      x = sp[0];
+      for (unsigned int j = 1; j < n; ++j)
+      {
+        x = x * sp[j];
+      }
+      *sp++ = x;
+      continue;
+
+    case OP_EQ:
+    case OP_GEQ:
+    case OP_GT:
+    case OP_LEQ:
+    case OP_LT:
+    case OP_NEQ:
+      n = in->arg;
+      sp -= n;
+      x = 1.0;
+      for (unsigned int j = 1; j < n; ++j)
+      {
+        bool holds;
+        switch (in->op)
+        {
+        case OP_EQ:  holds = sp[j - 1] == sp[j]; break;
+        case OP_GEQ: holds = sp[j - 1] >= sp[j]; break;
+        case OP_GT:  holds = sp[j - 1] >  sp[j]; break;
+        case OP_LEQ: holds = sp[j - 1] <= sp[j]; break;
+        case OP_LT:  holds = sp[j - 1] <  sp[j]; break;
+        default:     holds = sp[j - 1] != sp[j]; break;
+        }
+        x *= (double)(holds);
+      }
+      *sp++ = x;
+      continue;
+
+    case OP_MIN:
+    case OP_MAX:
+      n = in->arg;
+      sp -= n;
+      x = sp[0];
+      for (unsigned int j = 1; j < n; ++j)
+      {
+        if (in->op == OP_MIN ? sp[j] < x : sp[j] > x) x = sp[j];
+      }
+      *sp++ = x;
+      continue;
+
+    case OP_PIECEWISE:
+      n = in->arg;
+      sp -= n;
+      *sp++ = evaluatePiecewise(sp, n);
+      continue;
+
+    default:
+      break;
+    }
+
+    if (getNumOperands(in->op, in->arg) == 2)
+    {
+      double a = sp[-2];
+      double b = sp[-1];
+      --sp;
+
+      switch (in->op)
+      {
+      case OP_SUB:      x = a - b; break;
+      case OP_DIV:      x = a / b; break;
+      case OP_POW:      x = pow(a, b); break;
+      case OP_ROOT:     x = pow(b, (1.0 / a)); break;
+      case OP_AND:      x = (double)(a && b); break;
+      case OP_OR:       x = (double)(a || b); break;
+      case OP_XOR:      x = (double)((!a && b) || (a && !b)); break;
+      case OP_IMPLIES:  x = (double)(!a || b); break;
+      case OP_REM:      x = a - (floor(a / b) * b); break;
+      default:          x = floor(a / b); break;
+      }
+      sp[-1] = x;
+      continue;
+    }
+
+    /* the unary operations; the formulas are those of evaluateASTNode */
+    x = sp[-1];
+    switch (in->op)
+    {
+    case OP_NEG:      x = -x; break;
+    case OP_ABS:      x = fabs(x); break;
+    case OP_ARCCOS:   x = acos(x); break;
+    case OP_ARCCOSH:  x = log(x + pow((x - 1), 0.5) * pow((x + 1), 0.5)); break;
+    case OP_ARCCOT:   x = atan(1.0 / x); break;
+    case OP_ARCCOTH:  x = ((1.0 / 2.0) * log((x + 1.0) / (x - 1.0))); break;
+    case OP_ARCCSC:   x = asin(1.0 / x); break;
+    case OP_ARCCSCH:  x = log((1.0 + pow(1.0 + pow(x, 2), 0.5)) / x); break;
+    case OP_ARCSEC:   x = acos(1.0 / x); break;
+    case OP_ARCSECH:  x = log((1.0 + pow((1.0 - pow(x, 2)), 0.5)) / x); break;
+    case OP_ARCSIN:   x = asin(x); break;
+    case OP_ARCSINH:  x = log(x + pow((1.0 + pow(x, 2)), 0.5)); break;
+    case OP_ARCTAN:   x = atan(x); break;
+    case OP_ARCTANH:  x = 0.5 * log((1.0 + x) / (1.0 - x)); break;
+    case OP_CEILING:  x = ceil(x); break;
+    case OP_COS:      x = cos(x); break;
+    case OP_COSH:     x = cosh(x); break;
+    case OP_COT:      x = (1.0 / tan(x)); break;
+    case OP_COTH:     x = cosh(x) / sinh(x); break;
+    case OP_CSC:      x = (1.0 / sin(x)); break;
+    case OP_CSCH:     x = (1.0 / sinh(x)); break;
+    case OP_EXP:      x = exp(x); break;
+    case OP_FACTORIAL:
+      {
+        int i = (int)(floor(x));
+        x = 1;
+        for (; i > 1; --i)
+        {
+          x *= i;
+        }
+      }
+      break;
+    case OP_FLOOR:    x = floor(x); break;
+    case OP_LN:       x = log(x); break;
+    case OP_LOG10:    x = log10(x); break;
+    case OP_SEC:      x = 1.0 / cos(x); break;
+    case OP_SECH:     x = 1.0 / cosh(x); break;
+    case OP_SIN:      x = sin(x); break;
+    case OP_SINH:     x = sinh(x); break;
+    case OP_TAN:      x = tan(x); break;
+    case OP_TANH:     x = tanh(x); break;
+    default:          x = (double)(!x); break;
+    }
+    sp[-1] = x;
+  }
+
+  return stack[0];
+}
+
+
+/*
+ * Translates an ASTNode into the instructions of a CompiledMath.
+ *
+ * The arguments of a call of a function definition are not evaluated
+ * separately: the body of the function is compiled in a new frame, and
+ * every occurrence of one of its bvars is replaced by the code of the
+ * corresponding argument, compiled in the frame of the caller.  This
+ * gives the same result as SBMLTransforms::replaceFD() followed by
+ * evaluation, since the math has no side effects.
+ */
+class MathCompiler
+{
+public:
+
+  MathCompiler(CompiledMath& target, const CompiledMath::SlotMap& slots,
+               const CompiledMath::SlotMap* localSlots,
+               const ListOfFunctionDefinitions* lofd)
+    : mTarget(target)
+    , mSlots(slots)
+    , mLocalSlots(localSlots)
+    , mFunctions(lofd)
+    , mCurrentFrame(NO_FRAME)
+    , mDepth(0)
+    , mComplete(true)
+  {
+    mTarget.mCode.clear();
+    mTarget.mMaxDepth = 0;
+  }
+
+
+  bool compile(const ASTNode* math)
+  {
+    compileNode(math);
+    return mComplete;
+  }
+
+
+private:
+
+  static const size_t NO_FRAME = (size_t)(-1);
+
+  struct Frame
+  {
+    const FunctionDefinition* fd;
+    const ASTNode*            call;
+    size_t                    parent;
+  };
+
+
+  void emit(unsigned int op, unsigned int arg = 0, double value = 0)
+  {
+    CompiledMath::Instruction in;
+    in.op = op;
+    in.arg = arg;
+    in.value = value;
+
+    unsigned int numOperands = getNumOperands(op, arg);
+    std::vector<CompiledMath::Instruction>& code = mTarget.mCode;
+
+    /* if all the operands are constants, so is the result */
+    bool constant = (op != OP_LOAD && op != OP_TIME
+                     && code.size() >= numOperands);
+    for (size_t j = code.size() - (constant ? numOperands : 0);
+         constant && j < code.size(); ++j)
+    {
+      constant = (code[j].op == OP_CONST);
+    }
+
+    if (constant && op != OP_CONST)
+    {
+      std::vector<double> stack(numOperands + 1);
+      code.push_back(in);
+      double result = execute(&code[code.size() - numOperands - 1],
+                              &code[0] + code.size(), NULL, 0.0, &stack[0]);
+      code.resize(code.size() - numOperands - 1);
+      in.op = OP_CONST;
+      in.arg = 0;
+      in.value = result;
+      numOperands = 0;
+    }
+
+    code.push_back(in);
+    mDepth = mDepth - numOperands + 1;
+    if (mDepth > mTarget.mMaxDepth)
+    {
+      mTarget.mMaxDepth = mDepth;
+    }
+  }
+
+
+  void emitNaN()
+  {
+    emit(OP_CONST, 0, numeric_limits<double>::quiet_NaN());
+  }
+
+
+  void unsupported()
+  {
+    mComplete = false;
+    emitNaN();
+  }
+
+
+  /*
+   * Compiles child n of node, or NaN if it does not exist.
+   */
+  void compileChild(const ASTNode* node, unsigned int n)
+  {
+    if (n < node->getNumChildren())
+    {
+      compileNode(node->getChild(n));
+    }
+    else
+    {
+      emitNaN();
+    }
+  }
+
+
+  /*
+   * Compiles all the children of node followed by an n-ary operation.
+   */
+  void compileNary(const ASTNode* node, unsigned int op)
+  {
+    unsigned int numChildren = node->getNumChildren();
+    for (unsigned int n = 0; n < numChildren; ++n)
+    {
+      compileNode(node->getChild(n));
+    }
+    emit(op, numChildren);
+  }
+
+
+  void compileUnary(const ASTNode* node, unsigned int op)
+  {
+    compileChild(node, 0);
+    emit(op);
+  }
+
+
+  void compileBinary(const ASTNode* node, unsigned int op)
+  {
+    compileChild(node, 0);
+    compileChild(node, 1);
+    emit(op);
+  }
+
+
+  /*
+   * Compiles an n-ary logical operation, of which evaluateASTNode only
+   * considers the first two arguments.
+   */
+  void compileLogical(const ASTNode* node, unsigned int op, double empty)
+  {
+    if (node->getNumChildren() == 0)
+    {
+      emit(OP_CONST, 0, empty);
+    }
+    else if (node->getNumChildren() == 1)
+    {
+      compileNode(node->getChild(0));
+    }
+    else
+    {
+      compileBinary(node, op);
+    }
+  }
+
+
+  void compileArithmetic(const ASTNode* node, unsigned int op, double empty)
+  {
+    if (node->getNumChildren() == 0)
+    {
+      emit(OP_CONST, 0, empty);
+    }
+    else if (node->getNumChildren() == 1)
+    {
+      compileNode(node->getChild(0));
+    }
+    else
+    {
+      compileNary(node, op);
+    }
+  }
+
+
+  void compileRelational(const ASTNode* node, unsigned int op)
+  {
+    if (node->getNumChildren() < 2)
+    {
+      emit(OP_CONST, 0, 0.0);
+    }
+    else
+    {
+      compileNary(node, op);
+    }
+  }
+
+
+  void compileName(const ASTNode* node)
+  {
+    const char* name = node->getName();
+    if (name == NULL)
+    {
+      emitNaN();
+      return;
+    }
+
+    /* a bvar of a function being inlined stands for the argument */
+    if (mCurrentFrame != NO_FRAME)
+    {
+      const Frame frame = mFrames[mCurrentFrame];
+      for (unsigned int i = 0; i < frame.fd->getNumArguments(); ++i)
+      {
+        const ASTNode* arg = frame.fd->getArgument(i);
+        if (arg != NULL && arg->getName() != NULL
+            && strcmp(arg->getName(), name) == 0)
+        {
+          size_t current = mCurrentFrame;
+          mCurrentFrame = frame.parent;
+          compileChild(frame.call, i);
+          mCurrentFrame = current;
+          return;
+        }
+      }
+    }
+
+    CompiledMath::SlotMap::const_iterator it;
+    if (mLocalSlots != NULL
+        && (it = mLocalSlots->find(name)) != mLocalSlots->end())
+    {
+      emit(OP_LOAD, it->second);
+    }
+    else if ((it = mSlots.find(name)) != mSlots.end())
+    {
+      emit(OP_LOAD, it->second);
+    }
+    else
+    {
+      emitNaN();
+    }
+  }
+
+
+  void compileFunction(const ASTNode* node)
+  {
+    const FunctionDefinition* fd = NULL;
+    if (mFunctions != NULL && node->getName() != NULL)
+    {
+      fd = mFunctions->get(node->getName());
+    }
+
+    if (fd == NULL || !fd->isSetMath() || fd->getBody() == NULL)
+    {
+      unsupported();
+      return;
+    }
+
+    for (size_t f = mCurrentFrame; f != NO_FRAME; f = mFrames[f].parent)
+    {
+      if (mFrames[f].fd == fd)
+      {
+        unsupported();
+        return;
+      }
+    }
+
+    Frame frame;
+    frame.fd = fd;
+    frame.call = node;
+    frame.parent = mCurrentFrame;
+    mFrames.push_back(frame);
+
+    size_t current = mCurrentFrame;
+    mCurrentFrame = mFrames.size() - 1;
+    compileNode(fd->getBody());
+    mCurrentFrame = current;
+
+    mFrames.pop_back();
+  }
+
+
+  void compileNode(const ASTNode* node)
+  {
+    if (node == NULL)
+    {
+      emitNaN();
+      return;
+    }
+
+    switch (node->getType())
+    {
+    case AST_INTEGER:
+      emit(OP_CONST, 0, (double)(node->getInteger()));
+      break;
+
+    case AST_REAL:
+    case AST_REAL_E:
+    case AST_RATIONAL:
+    case AST_NAME_AVOGADRO:
+      emit(OP_CONST, 0, node->getReal());
+      break;
+
+    case AST_NAME:
+      compileName(node);
+      break;
+
+    case AST_NAME_TIME:
+      emit(OP_TIME);
+      break;
+
+    case AST_CONSTANT_E:
+      emit(OP_CONST, 0, exp(1.0));
+      break;
+
+    case AST_CONSTANT_FALSE:
+      emit(OP_CONST, 0, 0.0);
+      break;
+
+    case AST_CONSTANT_PI:
+      emit(OP_CONST, 0, 4.0*atan(1.0));
+      break;
+
+    case AST_CONSTANT_TRUE:
+      emit(OP_CONST, 0, 1.0);
+      break;
+
+    case AST_FUNCTION:
+      compileFunction(node);
+      break;
+
+    case AST_PLUS:
+      compileArithmetic(node, OP_ADD, 0.0);
+      break;
+
+    case AST_TIMES:
+      compileArithmetic(node, OP_MUL, 1.0);
+      break;
+
+    case AST_MINUS:
+      if (node->getNumChildren() == 1)
+      {
+        compileUnary(node, OP_NEG);
+      }
+      else
+      {
+        compileBinary(node, OP_SUB);
+      }
+      break;
+
+    case AST_DIVIDE:              compileBinary(node, OP_DIV); break;
+    case AST_POWER:
+    case AST_FUNCTION_POWER:      compileBinary(node, OP_POW); break;
+    case AST_FUNCTION_ROOT:       compileBinary(node, OP_ROOT); break;
+
+    case AST_FUNCTION_ABS:        compileUnary(node, OP_ABS); break;
+    case AST_FUNCTION_ARCCOS:     compileUnary(node, OP_ARCCOS); break;
+    case AST_FUNCTION_ARCCOSH:    compileUnary(node, OP_ARCCOSH); break;
+    case AST_FUNCTION_ARCCOT:     compileUnary(node, OP_ARCCOT); break;
+    case AST_FUNCTION_ARCCOTH:    compileUnary(node, OP_ARCCOTH); break;
+    case AST_FUNCTION_ARCCSC:     compileUnary(node, OP_ARCCSC); break;
+    case AST_FUNCTION_ARCCSCH:    compileUnary(node, OP_ARCCSCH); break;
+    case AST_FUNCTION_ARCSEC:     compileUnary(node, OP_ARCSEC); break;
+    case AST_FUNCTION_ARCSECH:    compileUnary(node, OP_ARCSECH); break;
+    case AST_FUNCTION_ARCSIN:     compileUnary(node, OP_ARCSIN); break;
+    case AST_FUNCTION_ARCSINH:    compileUnary(node, OP_ARCSINH); break;
+    case AST_FUNCTION_ARCTAN:     compileUnary(node, OP_ARCTAN); break;
+    case AST_FUNCTION_ARCTANH:    compileUnary(node, OP_ARCTANH); break;
+    case AST_FUNCTION_CEILING:    compileUnary(node, OP_CEILING); break;
+    case AST_FUNCTION_COS:        compileUnary(node, OP_COS); break;
+    case AST_FUNCTION_COSH:       compileUnary(node, OP_COSH); break;
+    case AST_FUNCTION_COT:        compileUnary(node, OP_COT); break;
+    case AST_FUNCTION_COTH:       compileUnary(node, OP_COTH); break;
+    case AST_FUNCTION_CSC:        compileUnary(node, OP_CSC); break;
+    case AST_FUNCTION_CSCH:       compileUnary(node, OP_CSCH); break;
+    case AST_FUNCTION_EXP:        compileUnary(node, OP_EXP); break;
+    case AST_FUNCTION_FACTORIAL:  compileUnary(node, OP_FACTORIAL); break;
+    case AST_FUNCTION_FLOOR:      compileUnary(node, OP_FLOOR); break;
+    case AST_FUNCTION_LN:         compileUnary(node, OP_LN); break;
+    case AST_FUNCTION_SEC:        compileUnary(node, OP_SEC); break;
+    case AST_FUNCTION_SECH:       compileUnary(node, OP_SECH); break;
+    case AST_FUNCTION_SIN:        compileUnary(node, OP_SIN); break;
+    case AST_FUNCTION_SINH:       compileUnary(node, OP_SINH); break;
+    case AST_FUNCTION_TAN:        compileUnary(node, OP_TAN); break;
+    case AST_FUNCTION_TANH:       compileUnary(node, OP_TANH); break;
+    case AST_LOGICAL_NOT:         compileUnary(node, OP_NOT); break;
+
+    case AST_FUNCTION_LOG:
+      /* the base is always taken to be 10 */
+      compileChild(node, 1);
+      emit(OP_LOG10);
+      break;
+
+    case AST_FUNCTION_PIECEWISE:
+      compileNary(node, OP_PIECEWISE);
+      break;
+
+    case AST_LOGICAL_AND:         compileLogical(node, OP_AND, 1.0); break;
+    case AST_LOGICAL_OR:          compileLogical(node, OP_OR, 0.0); break;
+    case AST_LOGICAL_XOR:         compileLogical(node, OP_XOR, 0.0); break;
+    case AST_LOGICAL_IMPLIES:     compileLogical(node, OP_IMPLIES, 0.0); break;
+
+    case AST_RELATIONAL_EQ:       compileRelational(node, OP_EQ); break;
+    case AST_RELATIONAL_GEQ:      compileRelational(node, OP_GEQ); break;
+    case AST_RELATIONAL_GT:       compileRelational(node, OP_GT); break;
+    case AST_RELATIONAL_LEQ:      compileRelational(node, OP_LEQ); break;
+    case AST_RELATIONAL_LT:       compileRelational(node, OP_LT); break;
+    case AST_RELATIONAL_NEQ:      compileRelational(node, OP_NEQ); break;
+
+    case AST_FUNCTION_MIN:
+    case AST_FUNCTION_MAX:
+      if (node->getNumChildren() == 0)
+      {
+        emitNaN();
+      }
+      else
+      {
+        compileNary(node, node->getType() == AST_FUNCTION_MIN ? OP_MIN : OP_MAX);
+      }
+      break;
+
+    case AST_FUNCTION_REM:
+    case AST_FUNCTION_QUOTIENT:
+      if (node->getNumChildren() < 2)
+      {
+        emit(OP_CONST, 0, 0.0);
+      }
+      else
+      {
+        compileBinary(node, node->getType() == AST_FUNCTION_REM ? OP_REM : OP_QUOTIENT);
+      }
+      break;
+
+    case AST_LAMBDA:
+      emitNaN();
+      break;
+
+    default:
+      /* delay, rateOf and the constructs of other packages */
+      unsupported();
+      break;
+    }
+  }
+
+
+  CompiledMath&                     mTarget;
+  const CompiledMath::SlotMap&      mSlots;
+  const CompiledMath::SlotMap*      mLocalSlots;
+  const ListOfFunctionDefinitions*  mFunctions;
+  std::vector<Frame>                mFrames;
+  size_t                            mCurrentFrame;
+  unsigned int                      mDepth;
+  bool                              mComplete;
+};
+
+
+CompiledMath::CompiledMath ()
+  : mMaxDepth(1)
+{
+  Instruction in;
+  in.op = OP_CONST;
+  in.arg = 0;
+  in.value = numeric_limits<double>::quiet_NaN();
+  mCode.push_back(in);
+}
+
+
+bool
+CompiledMath::compile (const ASTNode* math, const SlotMap& slots,
+                       const ListOfFunctionDefinitions* lofd,
+                       const SlotMap* localSlots)
+{
+  MathCompiler compiler(*this, slots, localSlots, lofd);
+  return compiler.compile(math);
+}
+
+
+double
+CompiledMath::evaluate (const double* values, double time) const
+{
+  if (mCode.size() == 1 && mCode[0].op == OP_CONST)
+  {
+    return mCode[0].value;
+  }
+
+  /* most expressions fit in a small fixed stack */
+  double stack[32];
+  if (mMaxDepth <= 32)
+  {
+    return execute(&mCode[0], &mCode[0] + mCode.size(), values, time, stack);
+  }
+
+  std::vector<double> deepStack(mMaxDepth);
+  return execute(&mCode[0], &mCode[0] + mCode.size(), values, time,
+                 &deepStack[0]);
+}
+
+
+void
+CompiledMath::getDependencies (std::vector<unsigned int>& indexes) const
+{
+  for (size_t i = 0; i < mCode.size(); ++i)
+  {
+    if (mCode[i].op == OP_LOAD)
+    {
+      indexes.push_back(mCode[i].arg);
+    }
+  }
+}
+
+
+unsigned int
+CompiledMath::getNumInstructions () const
+{
+  return (unsigned int)(mCode.size());
+}
+
+
+bool
+CompiledMath::isConstant () const
+{
+  return mCode.size() == 1 && mCode[0].op == OP_CONST;
+}
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_END
@@ -0,0 +1,166 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    CompiledMath.h
+ * @brief   Math compiled to bytecode for repeated evaluation.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class CompiledMath
+ * @sbmlbrief{core} An ASTNode compiled for fast repeated evaluation.
+ *
+ * SBMLTransforms::evaluateASTNode() walks the tree and looks every
+ * identifier up by name each time it is called.  A CompiledMath is built
+ * once from an ASTNode: calls of function definitions are inlined, each
+ * identifier is bound to an index into an array of values, constant
+ * subexpressions are folded, and the result is stored as a flat sequence
+ * of instructions for a small stack machine.  Evaluating it then only
+ * reads the array.
+ *
+ * The result of evaluate() is the value SBMLTransforms::evaluateASTNode()
+ * computes for the same math when every identifier has the value found
+ * in the array.  Identifiers that are not bound to an index evaluate to
+ * NaN, as do delay(), rateOf() and any construct defined by a package
+ * other than the L3V2 extended math functions.
+ *
+ * A CompiledMath does not refer to the ASTNode or Model it was compiled
+ * from, and evaluate() does not modify it, so one object can be evaluated
+ * from several threads at once.
+ */
+
+#ifndef CompiledMath_h
+#define CompiledMath_h
+
+
+#include <sbml/common/extern.h>
+
+#ifdef __cplusplus
+
+
+#include <map>
+#include <string>
+#include <vector>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class ASTNode;
+class FunctionDefinition;
+class ListOfFunctionDefinitions;
+
+class LIBSBML_EXTERN CompiledMath
+{
+public:
+
+#ifndef SWIG
+  typedef std::map<std::string, unsigned int> SlotMap;
+#endif
+
+  /**
+   * Creates a CompiledMath that evaluates to NaN.
+   */
+  CompiledMath ();
+
+
+#ifndef SWIG
+  /**
+   * Compiles @p math, replacing any previous content.
+   *
+   * Each identifier is bound to the index it has in @p localSlots, if
+   * given, or else in @p slots.  Calls of the functions defined in @p lofd
+   * are inlined.
+   *
+   * @return @c true if all of @p math could be compiled, @c false if it
+   * contains constructs that evaluate to NaN because they are not
+   * supported (such as delay(), rateOf() or a call of an undefined or
+   * recursive function).
+   */
+  bool compile (const ASTNode* math, const SlotMap& slots,
+                const ListOfFunctionDefinitions* lofd = NULL,
+                const SlotMap* localSlots = NULL);
+#endif
+
+
+  /**
+   * Evaluates the compiled math, reading the value of each identifier from
+   * @p values at the index it was bound to; @p time is the value of the
+   * csymbol time.
+   */
+  double evaluate (const double* values, double time = 0.0) const;
+
+
+  /**
+   * Appends the indexes read by evaluate() to @p indexes.
+   */
+  void getDependencies (std::vector<unsigned int>& indexes) const;
+
+
+  /**
+   * Returns the number of instructions.
+   */
+  unsigned int getNumInstructions () const;
+
+
+  /**
+   * Returns @c true if the compiled math reads neither an index nor the
+   * time, so that evaluate() always returns the same value.
+   */
+  bool isConstant () const;
+
+
+#ifndef SWIG
+  struct Instruction
+  {
+    unsigned int op;
+    unsigned int arg;
+    double       value;
+  };
+#endif
+
+
+protected:
+
+  friend class MathCompiler;
+
+  std::vector<Instruction> mCode;
+  unsigned int             mMaxDepth;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* CompiledMath_h */
+/** @endcond */
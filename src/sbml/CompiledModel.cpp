@@ -0,0 +1,502 @@
+/**
+ * @file    CompiledModel.cpp
+ * @brief   The math of a Model compiled for repeated evaluation.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/CompiledModel.h>
+#include <sbml/Model.h>
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/** @cond doxygenLibsbmlInternal */
+
+CompiledModel::CompiledModel ()
+{
+}
+
+
+CompiledModel::CompiledModel (const Model* m)
+{
+  compile(m);
+}
+
+
+unsigned int
+CompiledModel::addValue (const std::string& id, double value)
+{
+  mIds.push_back(id);
+  mInitialValues.push_back(value);
+  return (unsigned int)(mIds.size() - 1);
+}
+
+
+/*
+ * Adds the value of a species reference with an id, which only exists
+ * when it has one.
+ */
+static void
+addStoichiometry(const SpeciesReference* sr, unsigned int level,
+                 CompiledMath::SlotMap& slots, std::vector<std::string>& ids,
+                 std::vector<double>& values)
+{
+  if (sr == NULL || !sr->isSetId() || slots.find(sr->getId()) != slots.end())
+  {
+    return;
+  }
+
+  double value = numeric_limits<double>::quiet_NaN();
+  if (sr->isSetStoichiometry() || level < 3)
+  {
+    value = sr->getStoichiometry();
+  }
+
+  slots[sr->getId()] = (unsigned int)(ids.size());
+  ids.push_back(sr->getId());
+  values.push_back(value);
+}
+
+
+bool
+CompiledModel::compile (const Model* m)
+{
+  mSlots.clear();
+  mIds.clear();
+  mInitialValues.clear();
+  mLocalSlots.clear();
+  mReactions.clear();
+  mInitialAssignments.clear();
+  mRateAssignments.clear();
+  mRules.clear();
+
+  if (m == NULL)
+  {
+    return true;
+  }
+
+  const double nan = numeric_limits<double>::quiet_NaN();
+  const ListOfFunctionDefinitions* lofd = m->getListOfFunctionDefinitions();
+  bool complete = true;
+  unsigned int i, j;
+
+  for (i = 0; i < m->getNumCompartments(); ++i)
+  {
+    const Compartment* c = m->getCompartment(i);
+    if (mSlots.find(c->getId()) == mSlots.end())
+    {
+      mSlots[c->getId()] = addValue(c->getId(),
+                                    c->isSetSize() ? c->getSize() : nan);
+    }
+  }
+
+  for (i = 0; i < m->getNumSpecies(); ++i)
+  {
+    const Species* s = m->getSpecies(i);
+    if (mSlots.find(s->getId()) != mSlots.end())
+    {
+      continue;
+    }
+
+    double size = nan;
+    CompiledMath::SlotMap::const_iterator it = mSlots.find(s->getCompartment());
+    if (it != mSlots.end())
+    {
+      size = mInitialValues[it->second];
+    }
+
+    /* the id stands for the concentration unless hasOnlySubstanceUnits */
+    double value = nan;
+    if (s->getHasOnlySubstanceUnits())
+    {
+      if (s->isSetInitialAmount())
+        value = s->getInitialAmount();
+      else if (s->isSetInitialConcentration())
+        value = s->getInitialConcentration() * size;
+    }
+    else
+    {
+      if (s->isSetInitialConcentration())
+        value = s->getInitialConcentration();
+      else if (s->isSetInitialAmount())
+        value = s->getInitialAmount() / size;
+    }
+
+    mSlots[s->getId()] = addValue(s->getId(), value);
+  }
+
+  for (i = 0; i < m->getNumParameters(); ++i)
+  {
+    const Parameter* p = m->getParameter(i);
+    if (mSlots.find(p->getId()) == mSlots.end())
+    {
+      mSlots[p->getId()] = addValue(p->getId(),
+                                    p->isSetValue() ? p->getValue() : nan);
+    }
+  }
+
+  for (i = 0; i < m->getNumReactions(); ++i)
+  {
+    const Reaction* rn = m->getReaction(i);
+
+    for (j = 0; j < rn->getNumReactants(); ++j)
+    {
+      addStoichiometry(rn->getReactant(j), m->getLevel(), mSlots, mIds,
+                       mInitialValues);
+    }
+    for (j = 0; j < rn->getNumProducts(); ++j)
+    {
+      addStoichiometry(rn->getProduct(j), m->getLevel(), mSlots, mIds,
+                       mInitialValues);
+    }
+
+    if (rn->isSetId() && mSlots.find(rn->getId()) == mSlots.end())
+    {
+      mSlots[rn->getId()] = addValue(rn->getId(), nan);
+      mReactions.push_back(mSlots[rn->getId()]);
+    }
+    else
+    {
+      /* the rate of a reaction without an id has nowhere else to go */
+      mReactions.push_back(addValue(rn->getId(), nan));
+    }
+  }
+
+  /* the local parameters come after all the ids of the model */
+  for (i = 0; i < m->getNumReactions(); ++i)
+  {
+    const Reaction* rn = m->getReaction(i);
+    if (!rn->isSetKineticLaw())
+    {
+      continue;
+    }
+
+    const KineticLaw* kl = rn->getKineticLaw();
+    CompiledMath::SlotMap& local = mLocalSlots[rn->getId()];
+    for (j = 0; j < kl->getNumParameters(); ++j)
+    {
+      const Parameter* p = kl->getParameter(j);
+      if (local.find(p->getId()) == local.end())
+      {
+        local[p->getId()] = addValue(p->getId(),
+                                     p->isSetValue() ? p->getValue() : nan);
+      }
+    }
+  }
+
+  /* the assignment rules and stoichiometry math */
+  std::vector<Assignment> rules;
+  for (i = 0; i < m->getNumRules(); ++i)
+  {
+    const Rule* r = m->getRule(i);
+    CompiledMath::SlotMap::const_iterator it = mSlots.find(r->getVariable());
+    if (r->getTypeCode() != SBML_ASSIGNMENT_RULE || !r->isSetMath()
+        || it == mSlots.end())
+    {
+      continue;
+    }
+
+    rules.push_back(Assignment());
+    rules.back().index = it->second;
+    complete = rules.back().math.compile(r->getMath(), mSlots, lofd) && complete;
+  }
+
+  for (i = 0; i < m->getNumReactions(); ++i)
+  {
+    const Reaction* rn = m->getReaction(i);
+    for (j = 0; j < rn->getNumReactants() + rn->getNumProducts(); ++j)
+    {
+      const SpeciesReference* sr = (j < rn->getNumReactants())
+        ? rn->getReactant(j) : rn->getProduct(j - rn->getNumReactants());
+      if (!sr->isSetId() || !sr->isSetStoichiometryMath()
+          || !sr->getStoichiometryMath()->isSetMath())
+      {
+        continue;
+      }
+
+      rules.push_back(Assignment());
+      rules.back().index = mSlots[sr->getId()];
+      complete = rules.back().math.compile(sr->getStoichiometryMath()->getMath(),
+                                           mSlots, lofd) && complete;
+    }
+  }
+
+  /* the kinetic laws */
+  std::vector<Assignment> kineticLaws;
+  for (i = 0; i < m->getNumReactions(); ++i)
+  {
+    const Reaction* rn = m->getReaction(i);
+
+    kineticLaws.push_back(Assignment());
+    kineticLaws.back().index = mReactions[i];
+    if (rn->isSetKineticLaw() && rn->getKineticLaw()->isSetMath())
+    {
+      complete = kineticLaws.back().math.compile(
+        rn->getKineticLaw()->getMath(), mSlots, lofd,
+        &mLocalSlots[rn->getId()]) && complete;
+    }
+  }
+
+  /* the initial assignments */
+  std::vector<Assignment> initialAssignments;
+  for (i = 0; i < m->getNumInitialAssignments(); ++i)
+  {
+    const InitialAssignment* ia = m->getInitialAssignment(i);
+    CompiledMath::SlotMap::const_iterator it = mSlots.find(ia->getSymbol());
+    if (!ia->isSetMath() || it == mSlots.end())
+    {
+      continue;
+    }
+
+    initialAssignments.push_back(Assignment());
+    initialAssignments.back().index = it->second;
+    complete = initialAssignments.back().math.compile(ia->getMath(), mSlots,
+                                                      lofd) && complete;
+  }
+
+  mRules = rules;
+  order(mRules);
+
+  mRateAssignments = rules;
+  mRateAssignments.insert(mRateAssignments.end(), kineticLaws.begin(),
+                          kineticLaws.end());
+  order(mRateAssignments);
+
+  mInitialAssignments = initialAssignments;
+  mInitialAssignments.insert(mInitialAssignments.end(), rules.begin(),
+                             rules.end());
+  mInitialAssignments.insert(mInitialAssignments.end(), kineticLaws.begin(),
+                             kineticLaws.end());
+  order(mInitialAssignments);
+
+  return complete;
+}
+
+
+/*
+ * Sorts the assignments so that each one comes after those computing the
+ * values it reads, keeping the document order where there is a choice.
+ * Assignments caught in a cycle are left at the end in document order.
+ */
+void
+CompiledModel::order (std::vector<Assignment>& assignments) const
+{
+  size_t n = assignments.size();
+  std::map<unsigned int, std::vector<size_t> > producers;
+  size_t a;
+
+  for (a = 0; a < n; ++a)
+  {
+    producers[assignments[a].index].push_back(a);
+  }
+
+  std::vector<std::vector<size_t> > dependents(n);
+  std::vector<size_t> numPending(n, 0);
+
+  for (a = 0; a < n; ++a)
+  {
+    std::vector<unsigned int> reads;
+    assignments[a].math.getDependencies(reads);
+    std::sort(reads.begin(), reads.end());
+    reads.erase(std::unique(reads.begin(), reads.end()), reads.end());
+
+    for (size_t r = 0; r < reads.size(); ++r)
+    {
+      std::map<unsigned int, std::vector<size_t> >::const_iterator it =
+        producers.find(reads[r]);
+      if (it == producers.end())
+      {
+        continue;
+      }
+
+      for (size_t p = 0; p < it->second.size(); ++p)
+      {
+        if (it->second[p] != a)
+        {
+          dependents[it->second[p]].push_back(a);
+          ++numPending[a];
+        }
+      }
+    }
+  }
+
+  std::set<size_t> ready;
+  for (a = 0; a < n; ++a)
+  {
+    if (numPending[a] == 0)
+    {
+      ready.insert(a);
+    }
+  }
+
+  std::vector<bool> done(n, false);
+  std::vector<Assignment> ordered;
+  ordered.reserve(n);
+
+  while (!ready.empty())
+  {
+    a = *ready.begin();
+    ready.erase(ready.begin());
+
+    ordered.push_back(assignments[a]);
+    done[a] = true;
+
+    for (size_t d = 0; d < dependents[a].size(); ++d)
+    {
+      if (--numPending[dependents[a][d]] == 0)
+      {
+        ready.insert(dependents[a][d]);
+      }
+    }
+  }
+
+  for (a = 0; a < n; ++a)
+  {
+    if (!done[a])
+    {
+      ordered.push_back(assignments[a]);
+    }
+  }
+
+  assignments.swap(ordered);
+}
+
+
+void
+CompiledModel::run (const std::vector<Assignment>& assignments,
+                    double* values, double time) const
+{
+  for (size_t a = 0; a < assignments.size(); ++a)
+  {
+    values[assignments[a].index] = assignments[a].math.evaluate(values, time);
+  }
+}
+
+
+unsigned int
+CompiledModel::getNumValues () const
+{
+  return (unsigned int)(mIds.size());
+}
+
+
+int
+CompiledModel::getIndex (const std::string& id) const
+{
+  CompiledMath::SlotMap::const_iterator it = mSlots.find(id);
+  return (it == mSlots.end()) ? -1 : (int)(it->second);
+}
+
+
+int
+CompiledModel::getLocalParameterIndex (const std::string& reactionId,
+                                       const std::string& id) const
+{
+  std::map<std::string, CompiledMath::SlotMap>::const_iterator rn =
+    mLocalSlots.find(reactionId);
+  if (rn == mLocalSlots.end())
+  {
+    return -1;
+  }
+
+  CompiledMath::SlotMap::const_iterator it = rn->second.find(id);
+  return (it == rn->second.end()) ? -1 : (int)(it->second);
+}
+
+
+const std::string&
+CompiledModel::getId (unsigned int index) const
+{
+  static const std::string empty;
+  return (index < mIds.size()) ? mIds[index] : empty;
+}
+
+
+unsigned int
+CompiledModel::getNumReactions () const
+{
+  return (unsigned int)(mReactions.size());
+}
+
+
+unsigned int
+CompiledModel::getReactionIndex (unsigned int n) const
+{
+  return mReactions.at(n);
+}
+
+
+void
+CompiledModel::getInitialValues (std::vector<double>& values) const
+{
+  values = mInitialValues;
+  if (!values.empty())
+  {
+    run(mInitialAssignments, &values[0], 0.0);
+  }
+}
+
+
+void
+CompiledModel::applyAssignmentRules (double* values, double time) const
+{
+  run(mRules, values, time);
+}
+
+
+void
+CompiledModel::evaluateReactionRates (double* values, double* rates,
+                                      double time) const
+{
+  run(mRateAssignments, values, time);
+
+  for (size_t r = 0; r < mReactions.size(); ++r)
+  {
+    rates[r] = values[mReactions[r]];
+  }
+}
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_END
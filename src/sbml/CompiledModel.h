@@ -0,0 +1,216 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    CompiledModel.h
+ * @brief   The math of a Model compiled for repeated evaluation.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class CompiledModel
+ * @sbmlbrief{core} The rate laws and rules of a Model compiled for fast
+ * repeated evaluation.
+ *
+ * A CompiledModel gives every compartment, species, parameter, species
+ * reference with an id, reaction and local parameter of a Model an index
+ * into an array of values, and compiles the kinetic laws, assignment
+ * rules, initial assignments and stoichiometry math of the model into
+ * CompiledMath objects bound to those indexes.  As in
+ * SBMLTransforms::evaluateASTNode(), the value of a species is its
+ * concentration unless it has only substance units, and the value of a
+ * reaction is its rate.
+ *
+ * The array is owned by the caller, who can change any value (for
+ * instance to scan a parameter) and then have all the reaction rates
+ * computed in a single call to evaluateReactionRates().  The rules and
+ * kinetic laws are evaluated in an order in which every value is computed
+ * before it is used.  Events, algebraic rules and rate rules are not
+ * taken into account.
+ *
+ * The CompiledModel does not refer to the Model once it has been compiled,
+ * and its evaluation methods are const, so several threads can evaluate
+ * the same CompiledModel with arrays of their own.
+ */
+
+#ifndef CompiledModel_h
+#define CompiledModel_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/CompiledMath.h>
+
+#ifdef __cplusplus
+
+
+#include <map>
+#include <string>
+#include <vector>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class Model;
+
+class LIBSBML_EXTERN CompiledModel
+{
+public:
+
+  /**
+   * Creates an empty CompiledModel.
+   */
+  CompiledModel ();
+
+
+  /**
+   * Creates a CompiledModel for the given Model.
+   */
+  explicit CompiledModel (const Model* m);
+
+
+  /**
+   * Compiles the given Model, replacing any previous content.
+   *
+   * @return @c true if all the math of the model could be compiled,
+   * @c false if some of it uses constructs that evaluate to NaN because
+   * they are not supported (see CompiledMath::compile()).
+   */
+  bool compile (const Model* m);
+
+
+  /**
+   * Returns the size of the array of values.
+   */
+  unsigned int getNumValues () const;
+
+
+  /**
+   * Returns the index of the value of the compartment, species, parameter,
+   * species reference or reaction with the given @p id, or @c -1 if there
+   * is none.
+   */
+  int getIndex (const std::string& id) const;
+
+
+  /**
+   * Returns the index of the value of the local parameter with the given
+   * @p id in the kinetic law of the reaction @p reactionId, or @c -1 if
+   * there is none.
+   */
+  int getLocalParameterIndex (const std::string& reactionId,
+                              const std::string& id) const;
+
+
+  /**
+   * Returns the id of the element whose value has the given @p index.
+   */
+  const std::string& getId (unsigned int index) const;
+
+
+  /**
+   * Returns the number of reactions, which is the size of the array of
+   * rates filled by evaluateReactionRates().
+   */
+  unsigned int getNumReactions () const;
+
+
+  /**
+   * Returns the index of the value of reaction @p n.
+   */
+  unsigned int getReactionIndex (unsigned int n) const;
+
+
+  /**
+   * Fills @p values with the initial values of the model: those given by
+   * the attributes of its elements, updated by the initial assignments,
+   * assignment rules, stoichiometry math and kinetic laws.  Values that
+   * cannot be determined are NaN.
+   */
+  void getInitialValues (std::vector<double>& values) const;
+
+
+  /**
+   * Evaluates the assignment rules and stoichiometry math at the given
+   * @p time, storing the results in @p values.
+   */
+  void applyAssignmentRules (double* values, double time = 0.0) const;
+
+
+  /**
+   * Evaluates the rates of all the reactions at the given @p time, after
+   * the assignment rules they depend on, and stores them in @p rates, in
+   * the order of the reactions in the model.  The values of the reactions
+   * and of the variables of the assignment rules are also updated in
+   * @p values.  A reaction without a kinetic law has a rate of NaN.
+   */
+  void evaluateReactionRates (double* values, double* rates,
+                              double time = 0.0) const;
+
+
+protected:
+
+  struct Assignment
+  {
+    unsigned int index;
+    CompiledMath math;
+  };
+
+  unsigned int addValue (const std::string& id, double value);
+
+  void order (std::vector<Assignment>& assignments) const;
+
+  void run (const std::vector<Assignment>& assignments, double* values,
+            double time) const;
+
+  CompiledMath::SlotMap       mSlots;
+  std::vector<std::string>    mIds;
+  std::vector<double>         mInitialValues;
+  std::map<std::string, CompiledMath::SlotMap> mLocalSlots;
+  std::vector<unsigned int>   mReactions;
+
+  /* the initial assignments, rules and kinetic laws, in order */
+  std::vector<Assignment>     mInitialAssignments;
+
+  /* the rules and kinetic laws, in order */
+  std::vector<Assignment>     mRateAssignments;
+
+  /* the rules only, in order */
+  std::vector<Assignment>     mRules;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* CompiledModel_h */
+/** @endcond */
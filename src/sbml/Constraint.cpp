@@ -234,6 +234,7 @@ Constraint::isSetMath () const
 int
 Constraint::setMessage (const XMLNode* xhtml)
 {
+  invalidateOriginalText();
   if (mMessage == xhtml)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -299,6 +300,7 @@ int
 Constraint::setMessage (const std::string& message, 
                         bool addXHTMLMarkup)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
   if (message.empty())
   {
@@ -365,6 +367,7 @@ Constraint::setMessage (const std::string& message,
 int
 Constraint::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -395,6 +398,7 @@ Constraint::setMath (const ASTNode* math)
 int 
 Constraint::unsetMessage ()
 {
+  invalidateOriginalText();
   delete mMessage;
   mMessage = NULL;
   
@@ -412,6 +416,7 @@ Constraint::unsetMessage ()
 void
 Constraint::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -421,6 +426,7 @@ Constraint::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Constraint::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -431,6 +437,7 @@ Constraint::renameUnitSIdRefs(const std::string& oldid, const std::string& newid
 void 
 Constraint::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -1041,6 +1048,7 @@ ListOfConstraints::get(unsigned int n) const
 Constraint*
 ListOfConstraints::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Constraint*>(ListOf::remove(n));
 }
 
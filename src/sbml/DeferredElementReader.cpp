@@ -0,0 +1,505 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    DeferredElementReader.cpp
+ * @brief   Leaves the notes and annotations of a document to be read later.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <sbml/DeferredElementReader.h>
+#include <sbml/SBMLNamespaces.h>
+#include <sbml/xml/XMLElementFilter.h>
+#include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLMappedFileBuffer.h>
+#include <sbml/xml/XMLToken.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+/*
+ * the name of the elements left in the place of the elements to be read
+ * later, and of the element declaring their namespaces when they are
+ */
+static const char* const PLACEHOLDER = "libsbmlDeferred";
+
+/*
+ * an element on a single line must be long enough to be replaced by a
+ * placeholder, <libsbmlDeferred n="..."/>
+ */
+static const size_t MIN_CUT_LENGTH = 34;
+
+/* deeper documents are read as usual */
+static const size_t MAX_DEPTH = 256;
+
+
+/*
+ * @return true if the element [begin, end) of content spans several lines,
+ * or is long enough to be replaced by a placeholder on its line.
+ */
+static bool
+fitsPlaceholder (const char* content, size_t begin, size_t end)
+{
+  size_t characters = 0;
+  for (size_t n = begin; n < end; ++n)
+  {
+    unsigned char c = (unsigned char)content[n];
+    if (c == '\n' || c == '\r') return true;
+    if ((c & 0xC0) != 0x80) ++characters;
+  }
+
+  return characters >= MIN_CUT_LENGTH;
+}
+
+
+static bool
+isNamespaceDeclaration (const XMLElementScanner::Attribute& attribute)
+{
+  return (attribute.qnameLength == 5
+          || (attribute.qnameLength > 6 && attribute.qname[5] == ':'))
+      && strncmp(attribute.qname, "xmlns", 5) == 0;
+}
+
+
+/*
+ * Scans the document for the elements to leave unread.
+ */
+DeferredElementReader::DeferredElementReader (const char* content,
+                                              bool isFile, bool defer,
+                                              const XMLElementFilter* filter)
+  : mFilter (filter)
+{
+  if (!defer || content == NULL) return;
+
+  if (isFile)
+  {
+    // only regular files are scanned; compressed ones are read as usual
+    XMLMappedFileBuffer file(content);
+    if (file.error()) return;
+
+    unsigned int length = UINT_MAX;
+    const char* data = file.readInPlace(length);
+    scan(data, length);
+  }
+  else
+  {
+    scan(content, strlen(content));
+  }
+}
+
+
+bool
+DeferredElementReader::isBefore (const Cut& a, const Cut& b)
+{
+  return a.begin < b.begin;
+}
+
+
+/*
+ * Finds the notes and annotations of the components, and replaces them by
+ * placeholders.
+ */
+void
+DeferredElementReader::scan (const char* content, size_t length)
+{
+  typedef XMLElementScanner Scanner;
+
+  Scanner scanner(content, length);
+  Scanner::Tag root;
+
+  if (!scanner.skipProlog() || !scanner.nextChild(root)
+      || root.empty || root.hasPrefix() || !root.hasName("sbml"))
+  {
+    return;
+  }
+
+  // the components are in the default namespace, which must be that of SBML
+  size_t offset = root.begin + 1 + root.qnameLength;
+  Scanner::Attribute attribute;
+  while (scanner.nextAttribute(root, offset, attribute))
+  {
+    if (attribute.qnameLength == 5 && isNamespaceDeclaration(attribute))
+    {
+      mDefaultNamespace.assign(attribute.value, attribute.valueLength);
+    }
+  }
+  if (!SBMLNamespaces::isSBMLNamespace(mDefaultNamespace)) return;
+
+  std::vector<Scanner::Tag> ancestors(1, root);
+  std::vector<Cut> cuts;
+
+  if (!scanChildren(content, scanner, ancestors, cuts) || cuts.empty())
+  {
+    mNamespaces.clear();
+    return;
+  }
+
+  // the elements of a component are found after those it contains
+  std::sort(cuts.begin(), cuts.end(), isBefore);
+
+  Scanner::Position original = Scanner::startOf();
+  size_t copied = 0;
+
+  mElements.resize(cuts.size());
+  mContent.reserve(length);
+
+  for (size_t n = 0; n < cuts.size(); ++n)
+  {
+    const Cut& cut = cuts[n];
+
+    mContent.append(content + copied, cut.begin - copied);
+    Scanner::advance(content, length, cut.begin, original);
+
+    string start = string("<") + PLACEHOLDER + mNamespaces[cut.namespaces]
+                   + ">";
+    Scanner::Position inner = Scanner::startOf();
+    Scanner::advance(start.c_str(), start.size(), start.size(), inner);
+
+    DeferredElement& element = mElements[n];
+    element.content.reserve(start.size() + cut.end - cut.begin
+                            + strlen(PLACEHOLDER) + 3);
+    element.content  = start;
+    element.content.append(content + cut.begin, cut.end - cut.begin);
+    element.content += "</";
+    element.content += PLACEHOLDER;
+    element.content += ">";
+    element.line     = inner.line;
+    element.column   = inner.column;
+    element.toLine   = original.line;
+    element.toColumn = original.column;
+
+    char placeholder[64];
+    sprintf(placeholder, "<%s n=\"%lu\"/>", PLACEHOLDER, (unsigned long)n);
+    mContent += placeholder;
+
+    // what follows the placeholder keeps its position
+    Scanner::Position end = original;
+    Scanner::advance(content, length, cut.end, end);
+
+    if (end.line > original.line)
+    {
+      mContent.append(end.line - original.line, '\n');
+      mContent.append(end.column - 1, ' ');
+    }
+    else
+    {
+      mContent.append(end.column - original.column - strlen(placeholder), ' ');
+    }
+
+    original = end;
+    copied   = cut.end;
+  }
+
+  mContent.append(content + copied, length - copied);
+  mNamespaces.clear();
+}
+
+
+/*
+ * Scans the children of the last of the ancestors.  The notes and
+ * annotation of an element are either all left unread, or none.
+ */
+bool
+DeferredElementReader::scanChildren (const char* content,
+                                     XMLElementScanner& scanner,
+                                     std::vector<XMLElementScanner::Tag>& ancestors,
+                                     std::vector<Cut>& cuts)
+{
+  typedef XMLElementScanner Scanner;
+
+  // these read their notes and annotation differently
+  const Scanner::Tag parent = ancestors.back();
+  bool cutsChildren = ancestors.size() > 1
+                      && !parent.hasName("model")
+                      && !parent.hasName("speciesReference")
+                      && !parent.hasName("modifierSpeciesReference");
+
+  std::vector<Cut> children;
+  Scanner::Tag child;
+
+  while (scanner.nextChild(child))
+  {
+    bool isNotesOrAnnotation =
+      child.hasName("notes") || child.hasName("annotation");
+
+    if (isPlaceholderName(child.name, child.nameLength))
+    {
+      return false;
+    }
+    else if (child.hasPrefix() || declaresOtherNamespace(scanner, child))
+    {
+      // the elements of other namespaces, such as those of packages
+      cutsChildren = cutsChildren && !isNotesOrAnnotation;
+      if (!scanner.skipElement(child)) return false;
+    }
+    else if (isSkipped(child))
+    {
+      // the parser leaves it out, and nothing inside it is read
+      if (!scanner.skipElement(child)) return false;
+    }
+    else if (isNotesOrAnnotation)
+    {
+      if (!scanner.skipElement(child)) return false;
+
+      Cut cut = { child.begin, scanner.offset(), 0 };
+      cutsChildren = cutsChildren
+                     && fitsPlaceholder(content, cut.begin, cut.end);
+      children.push_back(cut);
+    }
+    else if (child.empty || child.hasName("math"))
+    {
+      if (!scanner.skipElement(child)) return false;
+    }
+    else
+    {
+      if (ancestors.size() == MAX_DEPTH) return false;
+
+      ancestors.push_back(child);
+      bool scanned = scanChildren(content, scanner, ancestors, cuts);
+      ancestors.pop_back();
+
+      if (!scanned) return false;
+    }
+  }
+  if (scanner.failed()) return false;
+
+  if (cutsChildren && !children.empty())
+  {
+    string namespaces = getNamespaces(scanner, ancestors);
+    if (mNamespaces.empty() || mNamespaces.back() != namespaces)
+    {
+      mNamespaces.push_back(namespaces);
+    }
+
+    for (size_t n = 0; n < children.size(); ++n)
+    {
+      children[n].namespaces = mNamespaces.size() - 1;
+      cuts.push_back(children[n]);
+    }
+  }
+
+  return true;
+}
+
+
+/*
+ * @return true if the parser is to leave out the element of tag, which is
+ * in the default namespace of the document.
+ */
+bool
+DeferredElementReader::isSkipped (const XMLElementScanner::Tag& tag) const
+{
+  return mFilter != NULL
+         && mFilter->skips(string(tag.name, tag.nameLength).c_str(),
+                           mDefaultNamespace.c_str());
+}
+
+
+/*
+ * @return true if tag puts its element in a default namespace other than
+ * that of the document.
+ */
+bool
+DeferredElementReader::declaresOtherNamespace (
+  const XMLElementScanner& scanner,
+  const XMLElementScanner::Tag& tag) const
+{
+  size_t offset = tag.begin + 1 + tag.qnameLength;
+  XMLElementScanner::Attribute attribute;
+
+  while (scanner.nextAttribute(tag, offset, attribute))
+  {
+    if (attribute.qnameLength == 5 && isNamespaceDeclaration(attribute)
+        && mDefaultNamespace.compare(0, string::npos, attribute.value,
+                                     attribute.valueLength) != 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * @return the declarations of the namespaces in scope inside the last of
+ * the ancestors, as attributes.
+ */
+string
+DeferredElementReader::getNamespaces (const XMLElementScanner& scanner,
+                  const std::vector<XMLElementScanner::Tag>& ancestors) const
+{
+  // the prefixes declared, with their declarations
+  std::vector< pair<string, string> > declarations;
+
+  for (size_t n = 0; n < ancestors.size(); ++n)
+  {
+    const XMLElementScanner::Tag& tag = ancestors[n];
+    size_t offset = tag.begin + 1 + tag.qnameLength;
+    XMLElementScanner::Attribute attribute;
+
+    while (scanner.nextAttribute(tag, offset, attribute))
+    {
+      if (!isNamespaceDeclaration(attribute)) continue;
+
+      string prefix(attribute.qname, attribute.qnameLength);
+      string declaration = " " + prefix + "=" + attribute.value[-1]
+        + string(attribute.value, attribute.valueLength)
+        + attribute.value[-1];
+
+      size_t d = 0;
+      while (d < declarations.size() && declarations[d].first != prefix) ++d;
+
+      if (d < declarations.size())
+      {
+        declarations[d].second = declaration;
+      }
+      else
+      {
+        declarations.push_back(make_pair(prefix, declaration));
+      }
+    }
+  }
+
+  string namespaces;
+  for (size_t d = 0; d < declarations.size(); ++d)
+  {
+    namespaces += declarations[d].second;
+  }
+
+  return namespaces;
+}
+
+
+/*
+ * @return true if the document has elements left to be read later.
+ */
+bool
+DeferredElementReader::isActive () const
+{
+  return !mElements.empty();
+}
+
+
+/*
+ * @return the content of the document with the elements left unread
+ * replaced by placeholders.
+ */
+const char*
+DeferredElementReader::getContent () const
+{
+  return mContent.c_str();
+}
+
+
+/*
+ * Prepares the stream reading getContent() to have its placeholders read
+ * by this object.
+ */
+void
+DeferredElementReader::attach (XMLInputStream& stream)
+{
+  if (isActive())
+  {
+    stream.setDeferredElementReader(this);
+  }
+}
+
+
+/*
+ * @return true if token is the start of a placeholder.
+ */
+bool
+DeferredElementReader::isPlaceholder (const XMLToken& token)
+{
+  return token.isStart() && token.getPrefix().empty()
+      && token.getName() == PLACEHOLDER;
+}
+
+
+/*
+ * @return true if the given name is that of the placeholders.
+ */
+bool
+DeferredElementReader::isPlaceholderName (const char* name, size_t length)
+{
+  return length == strlen(PLACEHOLDER)
+      && strncmp(name, PLACEHOLDER, length) == 0;
+}
+
+
+/*
+ * Reads the placeholder that is the next token of the stream, and moves
+ * the element it replaces into element.
+ */
+bool
+DeferredElementReader::read (XMLInputStream& stream, DeferredElement& element)
+{
+  const XMLToken& next = stream.peek();
+  if (!isPlaceholder(next)) return false;
+
+  const string value = next.getAttrValue("n");
+  char* end = NULL;
+  unsigned long n = strtoul(value.c_str(), &end, 10);
+
+  if (value.empty() || *end != '\0' || n >= mElements.size()
+      || mElements[n].content.empty())
+  {
+    return false;
+  }
+
+  element.content.swap(mElements[n].content);
+  element.line     = mElements[n].line;
+  element.column   = mElements[n].column;
+  element.toLine   = mElements[n].toLine;
+  element.toColumn = mElements[n].toColumn;
+
+  stream.skipPastEnd(stream.next());
+  return true;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
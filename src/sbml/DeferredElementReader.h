@@ -0,0 +1,199 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    DeferredElementReader.h
+ * @brief   Leaves the notes and annotations of a document to be read later.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class DeferredElementReader
+ * @sbmlbrief{core} Leaves the notes and annotations of a document to be
+ * read when they are first used.
+ *
+ * The document is first scanned for the <code>&lt;notes&gt;</code> and
+ * <code>&lt;annotation&gt;</code> elements of the SBML components, which
+ * are cut out of it and replaced by placeholder elements before it is
+ * given to the XML parser.  The placeholders are followed by as many line
+ * breaks and spaces as needed for the rest of the document to keep its
+ * positions.  When SBase::read() comes to a placeholder, the text of the
+ * element it replaces is kept by the component, and read by
+ * SBase::readDeferredElements() when its notes, annotation, CVTerms or
+ * history are first asked for.
+ *
+ * Only the elements of core components in the default namespace of the
+ * document are left unread, and not those of the
+ * <code>&lt;sbml&gt;</code>, <code>&lt;model&gt;</code> and species
+ * reference elements, which are read differently.
+ */
+
+#ifndef DeferredElementReader_h
+#define DeferredElementReader_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+#include <sbml/xml/XMLElementScanner.h>
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class XMLElementFilter;
+class XMLInputStream;
+class XMLToken;
+
+
+/*
+ * The text of a <notes> or <annotation> element left to be read later,
+ * inside an element declaring the namespaces in scope where it was.
+ */
+struct DeferredElement
+{
+  std::string   content;
+  unsigned int  line;       /* where the element starts in the content */
+  unsigned int  column;
+  unsigned int  toLine;     /* and in the document it was taken from */
+  unsigned int  toColumn;
+};
+
+
+class LIBSBML_EXTERN DeferredElementReader
+{
+public:
+
+  /**
+   * Scans the document in @p content, the name of a file if @p isFile is
+   * @c true, for the elements to leave unread, if @p defer is @c true.
+   * The elements the parser is to leave out by @p filter are not scanned.
+   */
+  DeferredElementReader (const char* content, bool isFile, bool defer,
+                         const XMLElementFilter* filter = NULL);
+
+
+  /**
+   * Returns @c true if the document has elements left to be read later.
+   * Otherwise it is read as usual, and the other methods do nothing.
+   */
+  bool isActive () const;
+
+
+  /**
+   * Returns the content of the document with the elements left unread
+   * replaced by placeholders.
+   */
+  const char* getContent () const;
+
+
+  /**
+   * Prepares the @p stream reading getContent() to have its placeholders
+   * read by this object.
+   */
+  void attach (XMLInputStream& stream);
+
+
+  /**
+   * Returns @c true if @p token is the start of a placeholder.
+   */
+  static bool isPlaceholder (const XMLToken& token);
+
+
+  /**
+   * Returns @c true if the name @p name of @p length characters is that
+   * of the placeholders.
+   */
+  static bool isPlaceholderName (const char* name, size_t length);
+
+
+  /**
+   * Reads the placeholder that is the next token of @p stream, and moves
+   * the element it replaces into @p element.
+   *
+   * @return @c false if the placeholder is not one of this object.
+   */
+  bool read (XMLInputStream& stream, DeferredElement& element);
+
+
+protected:
+
+  /* a notes or annotation element to cut out, with the namespaces in scope */
+  struct Cut
+  {
+    size_t  begin;
+    size_t  end;
+    size_t  namespaces;
+  };
+
+
+  static bool isBefore (const Cut& a, const Cut& b);
+
+  void scan (const char* content, size_t length);
+
+  bool scanChildren (const char* content, XMLElementScanner& scanner,
+                     std::vector<XMLElementScanner::Tag>& ancestors,
+                     std::vector<Cut>& cuts);
+
+  bool isSkipped (const XMLElementScanner::Tag& tag) const;
+
+  bool declaresOtherNamespace (const XMLElementScanner& scanner,
+                               const XMLElementScanner::Tag& tag) const;
+
+  std::string getNamespaces (const XMLElementScanner& scanner,
+                  const std::vector<XMLElementScanner::Tag>& ancestors) const;
+
+
+  std::string                   mContent;
+  std::vector<DeferredElement>  mElements;
+  std::vector<std::string>      mNamespaces;
+  std::string                   mDefaultNamespace;
+  const XMLElementFilter*       mFilter;
+
+
+private:
+
+  DeferredElementReader (const DeferredElementReader&);
+  DeferredElementReader& operator= (const DeferredElementReader&);
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* DeferredElementReader_h */
+/** @endcond */
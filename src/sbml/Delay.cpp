@@ -188,6 +188,7 @@ Delay::isSetMath () const
 int
 Delay::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -419,6 +420,7 @@ int Delay::removeFromParentAndDelete()
 void
 Delay::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -428,6 +430,7 @@ Delay::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Delay::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -438,6 +441,7 @@ Delay::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Delay::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
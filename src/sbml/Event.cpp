@@ -511,12 +511,14 @@ Event::isSetUseValuesFromTriggerTime () const
 int
 Event::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -529,6 +531,7 @@ Event::setId (const std::string& sid)
 int
 Event::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -540,6 +543,7 @@ Event::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -558,6 +562,7 @@ Event::setName (const std::string& name)
 int
 Event::setTrigger (const Trigger* trigger)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(trigger));
   
   if (returnValue == LIBSBML_OPERATION_FAILED && trigger == NULL)
@@ -594,6 +599,7 @@ Event::setTrigger (const Trigger* trigger)
 int
 Event::setDelay (const Delay* delay)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(delay));
   
   if (returnValue == LIBSBML_OPERATION_FAILED && delay == NULL)
@@ -629,6 +635,7 @@ Event::setDelay (const Delay* delay)
 int
 Event::setPriority (const Priority* priority)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -676,6 +683,7 @@ Event::setPriority (const Priority* priority)
 int
 Event::setTimeUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   if (getLevel() == 2 && getVersion() > 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -698,6 +706,7 @@ Event::setTimeUnits (const std::string& sid)
 int 
 Event::setUseValuesFromTriggerTime (bool value)
 {
+  invalidateOriginalText();
   if (getLevel() == 2 && getVersion() < 4)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -718,6 +727,8 @@ Event::setUseValuesFromTriggerTime (bool value)
 int
 Event::unsetId ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
@@ -737,8 +748,10 @@ Event::unsetId ()
 int
 Event::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -764,6 +777,7 @@ Event::unsetName ()
 int 
 Event::unsetUseValuesFromTriggerTime ()
 {
+  invalidateOriginalText();
   if (getLevel() == 2 && getVersion() < 4)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -791,6 +805,7 @@ Event::unsetUseValuesFromTriggerTime ()
 int
 Event::unsetDelay ()
 {
+  invalidateOriginalText();
   delete mDelay;
   mDelay = NULL;
 
@@ -811,6 +826,7 @@ Event::unsetDelay ()
 int
 Event::unsetPriority ()
 {
+  invalidateOriginalText();
   delete mPriority;
   mPriority = NULL;
 
@@ -831,6 +847,7 @@ Event::unsetPriority ()
 int
 Event::unsetTrigger ()
 {
+  invalidateOriginalText();
   delete mTrigger;
   mTrigger = NULL;
 
@@ -857,6 +874,7 @@ Event::unsetTrigger ()
 int
 Event::unsetTimeUnits ()
 {
+  invalidateOriginalText();
   if (getLevel() == 2 && getVersion() > 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -881,6 +899,7 @@ Event::unsetTimeUnits ()
 int
 Event::addEventAssignment (const EventAssignment* ea)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(ea));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -907,6 +926,7 @@ Event::addEventAssignment (const EventAssignment* ea)
 EventAssignment*
 Event::createEventAssignment ()
 {
+  invalidateOriginalText();
   EventAssignment* ea = NULL;
 
   try
@@ -936,6 +956,7 @@ Event::createEventAssignment ()
 Trigger*
 Event::createTrigger ()
 {
+  invalidateOriginalText();
   delete mTrigger;
   mTrigger = NULL;
   
@@ -969,6 +990,7 @@ Event::createTrigger ()
 Delay*
 Event::createDelay ()
 {
+  invalidateOriginalText();
   delete mDelay;
   mDelay = 0;
   
@@ -1002,6 +1024,7 @@ Event::createDelay ()
 Priority*
 Event::createPriority ()
 {
+  invalidateOriginalText();
   delete mPriority;
   mPriority = NULL;
   
@@ -1107,6 +1130,7 @@ Event::getNumEventAssignments () const
 EventAssignment* 
 Event::removeEventAssignment (unsigned int n)
 {
+  invalidateOriginalText();
   return mEventAssignments.remove(n);  
 }
 
@@ -1118,6 +1142,7 @@ Event::removeEventAssignment (unsigned int n)
 EventAssignment* 
 Event::removeEventAssignment (const std::string& variable)
 {
+  invalidateOriginalText();
   return mEventAssignments.remove(variable);
 }
 
@@ -2228,10 +2253,7 @@ ListOfEvents::get (const std::string& sid)
 const Event*
 ListOfEvents::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqE(sid) );
-  return (result == mItems.end()) ? NULL : static_cast <Event*> (*result);
+  return static_cast <const Event*> (getItemBySId(sid));
 }
 
 
@@ -2239,6 +2261,7 @@ ListOfEvents::get (const std::string& sid) const
 Event*
 ListOfEvents::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Event*>(ListOf::remove(n));
 }
 
@@ -2247,6 +2270,7 @@ ListOfEvents::remove (unsigned int n)
 Event*
 ListOfEvents::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -2256,6 +2280,7 @@ ListOfEvents::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Event*> (item);
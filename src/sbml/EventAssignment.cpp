@@ -207,12 +207,14 @@ EventAssignment::isSetMath () const
 int
 EventAssignment::setVariable (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mVariable = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -222,6 +224,8 @@ EventAssignment::setVariable (const std::string& sid)
 int
 EventAssignment::unsetVariable ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mVariable.erase();
 
   if (mVariable.empty())
@@ -241,6 +245,7 @@ EventAssignment::unsetVariable ()
 int
 EventAssignment::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -730,6 +735,7 @@ EventAssignment::unsetAttribute(const std::string& attributeName)
 void
 EventAssignment::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (mVariable == oldid) {
     setVariable(newid);
@@ -742,6 +748,7 @@ EventAssignment::renameSIdRefs(const std::string& oldid, const std::string& newi
 void 
 EventAssignment::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -752,6 +759,7 @@ EventAssignment::renameUnitSIdRefs(const std::string& oldid, const std::string&
 void 
 EventAssignment::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -768,6 +776,7 @@ EventAssignment::replaceSIDWithFunction(const std::string& id, const ASTNode* fu
 void 
 EventAssignment::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mVariable == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_DIVIDE);
@@ -781,6 +790,7 @@ EventAssignment::divideAssignmentsToSIdByFunction(const std::string& id, const A
 void 
 EventAssignment::multiplyAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mVariable == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_TIMES);
@@ -1144,6 +1154,7 @@ ListOfEventAssignments::get (const std::string& sid) const
 EventAssignment*
 ListOfEventAssignments::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<EventAssignment*>(ListOf::remove(n));
 }
 
@@ -1152,6 +1163,7 @@ ListOfEventAssignments::remove (unsigned int n)
 EventAssignment*
 ListOfEventAssignments::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1161,6 +1173,7 @@ ListOfEventAssignments::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <EventAssignment*> (item);
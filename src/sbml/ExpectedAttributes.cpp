@@ -52,18 +52,23 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 bool ExpectedAttributes::hasAttribute(const std::string & attribute) const
 {
-  return (std::find(mAttributes.begin(), mAttributes.end(), attribute)
-    != mAttributes.end());
+  return std::binary_search(mAttributes.begin(), mAttributes.end(), attribute);
 }
 
 std::string ExpectedAttributes::get(unsigned int i) const
 {
-  return (mAttributes.size() < i) ? mAttributes[i] : std::string();
+  return (i < mAttributes.size()) ? mAttributes[i] : std::string();
 }
 
 void ExpectedAttributes::add(const std::string & attribute) 
 { 
-  mAttributes.push_back(attribute);
+  std::vector<std::string>::iterator it =
+    std::lower_bound(mAttributes.begin(), mAttributes.end(), attribute);
+
+  if (it == mAttributes.end() || *it != attribute)
+  {
+    mAttributes.insert(it, attribute);
+  }
 }
 
 ExpectedAttributes::ExpectedAttributes()
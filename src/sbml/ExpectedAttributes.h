@@ -70,6 +70,7 @@ public:
   bool hasAttribute(const std::string& attribute) const;
 
 private:
+  /* kept sorted, without duplicates, so lookups are binary searches */
   std::vector<std::string> mAttributes;
 };
 
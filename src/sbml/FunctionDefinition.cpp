@@ -224,12 +224,14 @@ FunctionDefinition::isSetMath () const
 int
 FunctionDefinition::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -242,6 +244,7 @@ FunctionDefinition::setId (const std::string& sid)
 int
 FunctionDefinition::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -253,6 +256,7 @@ FunctionDefinition::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -271,6 +275,7 @@ FunctionDefinition::setName (const std::string& name)
 int
 FunctionDefinition::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -301,8 +306,10 @@ FunctionDefinition::setMath (const ASTNode* math)
 int
 FunctionDefinition::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -458,6 +465,7 @@ FunctionDefinition::getBody () const
 ASTNode*
 FunctionDefinition::getBody ()
 {
+  invalidateOriginalText();
   if (mMath == NULL) return NULL;
   
   /* if the math is not a lambda this function can cause issues
@@ -618,6 +626,7 @@ FunctionDefinition::hasRequiredElements() const
 void 
 FunctionDefinition::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -1225,12 +1234,7 @@ ListOfFunctionDefinitions::get (const std::string& sid)
 const FunctionDefinition*
 ListOfFunctionDefinitions::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqFD(sid) );
-  return (result == mItems.end()) ? NULL : 
-                             static_cast <FunctionDefinition*> (*result);
-
+  return static_cast <const FunctionDefinition*> (getItemBySId(sid));
 }
 
 
@@ -1238,6 +1242,7 @@ ListOfFunctionDefinitions::get (const std::string& sid) const
 FunctionDefinition*
 ListOfFunctionDefinitions::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<FunctionDefinition*>(ListOf::remove(n));
 }
 
@@ -1246,6 +1251,7 @@ ListOfFunctionDefinitions::remove (unsigned int n)
 FunctionDefinition*
 ListOfFunctionDefinitions::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1255,6 +1261,7 @@ ListOfFunctionDefinitions::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <FunctionDefinition*> (item);
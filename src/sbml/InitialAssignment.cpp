@@ -210,12 +210,14 @@ InitialAssignment::isSetMath () const
 int
 InitialAssignment::setSymbol (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mSymbol = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -225,6 +227,8 @@ InitialAssignment::setSymbol (const std::string& sid)
 int
 InitialAssignment::unsetSymbol ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mSymbol.erase();
 
   if (mSymbol.empty())
@@ -245,6 +249,7 @@ InitialAssignment::unsetSymbol ()
 int
 InitialAssignment::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -709,6 +714,7 @@ InitialAssignment::unsetAttribute(const std::string& attributeName)
 void
 InitialAssignment::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (mSymbol == oldid) {
     setSymbol(newid);
@@ -721,6 +727,7 @@ InitialAssignment::renameSIdRefs(const std::string& oldid, const std::string& ne
 void 
 InitialAssignment::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -731,6 +738,7 @@ InitialAssignment::renameUnitSIdRefs(const std::string& oldid, const std::string
 void 
 InitialAssignment::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -747,6 +755,7 @@ InitialAssignment::replaceSIDWithFunction(const std::string& id, const ASTNode*
 void 
 InitialAssignment::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mSymbol == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_DIVIDE);
@@ -760,6 +769,7 @@ InitialAssignment::divideAssignmentsToSIdByFunction(const std::string& id, const
 void 
 InitialAssignment::multiplyAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mSymbol == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_TIMES);
@@ -1126,6 +1136,7 @@ ListOfInitialAssignments::get (const std::string& sid) const
 InitialAssignment*
 ListOfInitialAssignments::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<InitialAssignment*>(ListOf::remove(n));
 }
 
@@ -1134,6 +1145,7 @@ ListOfInitialAssignments::remove (unsigned int n)
 InitialAssignment*
 ListOfInitialAssignments::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1143,6 +1155,7 @@ ListOfInitialAssignments::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <InitialAssignment*> (item);
@@ -356,6 +356,7 @@ KineticLaw::isSetSubstanceUnits () const
 int
 KineticLaw::setFormula (const std::string& formula)
 {
+  invalidateOriginalText();
   if (formula == "")
   {
     mFormula.erase();
@@ -391,6 +392,7 @@ KineticLaw::setFormula (const std::string& formula)
 int
 KineticLaw::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -423,6 +425,7 @@ KineticLaw::setMath (const ASTNode* math)
 int
 KineticLaw::setTimeUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   /* only in L1 and L2V1 */
   if ((getLevel() == 2 && getVersion() > 1)
     || getLevel() > 2)
@@ -447,6 +450,7 @@ KineticLaw::setTimeUnits (const std::string& sid)
 int
 KineticLaw::setSubstanceUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   /* only in L1 and L2V1 */
   if ((getLevel() == 2 && getVersion() > 1)
     || getLevel() > 2)
@@ -471,6 +475,7 @@ KineticLaw::setSubstanceUnits (const std::string& sid)
 int
 KineticLaw::unsetTimeUnits ()
 {
+  invalidateOriginalText();
   /* only in L1 and L2V1 */
   if ((getLevel() == 2 && getVersion() > 1)
     || getLevel() > 2)
@@ -497,6 +502,7 @@ KineticLaw::unsetTimeUnits ()
 int
 KineticLaw::unsetSubstanceUnits ()
 {
+  invalidateOriginalText();
   /* only in L1 and L2V1 */
   if ((getLevel() == 2 && getVersion() > 1)
     || getLevel() > 2)
@@ -523,6 +529,7 @@ KineticLaw::unsetSubstanceUnits ()
 int
 KineticLaw::addParameter (const Parameter* p)
 {
+  invalidateOriginalText();
   if (p == NULL)
   {
     return LIBSBML_OPERATION_FAILED;
@@ -588,6 +595,7 @@ KineticLaw::addParameter (const Parameter* p)
 int
 KineticLaw::addLocalParameter (const LocalParameter* p)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(p));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -612,6 +620,7 @@ KineticLaw::addLocalParameter (const LocalParameter* p)
 Parameter*
 KineticLaw::createParameter ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     Parameter* p = NULL;
@@ -665,6 +674,7 @@ KineticLaw::createParameter ()
 LocalParameter*
 KineticLaw::createLocalParameter ()
 {
+  invalidateOriginalText();
   LocalParameter* p = NULL;
 
   try
@@ -993,6 +1003,7 @@ KineticLaw::containsUndeclaredUnits() const
 Parameter* 
 KineticLaw::removeParameter (unsigned int n)
 {
+  invalidateOriginalText();
   return mParameters.remove(n);  
 }
 
@@ -1004,6 +1015,7 @@ KineticLaw::removeParameter (unsigned int n)
 LocalParameter* 
 KineticLaw::removeLocalParameter (unsigned int n)
 {
+  invalidateOriginalText();
   return mLocalParameters.remove(n);  
 }
 
@@ -1015,6 +1027,7 @@ KineticLaw::removeLocalParameter (unsigned int n)
 Parameter* 
 KineticLaw::removeParameter (const std::string& sid)
 {
+  invalidateOriginalText();
   return mParameters.remove(sid);
 }
 
@@ -1026,6 +1039,7 @@ KineticLaw::removeParameter (const std::string& sid)
 LocalParameter* 
 KineticLaw::removeLocalParameter (const std::string& sid)
 {
+  invalidateOriginalText();
   return mLocalParameters.remove(sid);
 }
 
@@ -1543,6 +1557,7 @@ KineticLaw::getObject(const std::string& elementName, unsigned int index)
 void
 KineticLaw::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   //If the oldid is actually a local parameter, we should not rename it.
   if (getParameter(oldid) != NULL) return;
@@ -1555,6 +1570,7 @@ KineticLaw::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 KineticLaw::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -1567,6 +1583,7 @@ KineticLaw::renameUnitSIdRefs(const std::string& oldid, const std::string& newid
 void 
 KineticLaw::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -1583,6 +1600,7 @@ KineticLaw::replaceSIDWithFunction(const std::string& id, const ASTNode* functio
 void 
 KineticLaw::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   SBase* parentrxn = getParentSBMLObject();
   if (parentrxn==NULL) return;
   if (parentrxn->getId() == id && isSetMath()) {
@@ -1598,6 +1616,7 @@ KineticLaw::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNod
 void 
 KineticLaw::multiplyAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   SBase* parentrxn = getParentSBMLObject();
   if (parentrxn==NULL) return;
   if (parentrxn->getId() == id && isSetMath()) {
@@ -44,6 +44,7 @@
 
 #include <sbml/SBMLVisitor.h>
 #include <sbml/ListOf.h>
+#include <sbml/ParallelListOfWriter.h>
 #include <sbml/SBO.h>
 #include <sbml/common/common.h>
 #include <sbml/util/ElementFilter.h>
@@ -56,6 +57,13 @@ using namespace std;
 LIBSBML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
+/*
+ * Lists shorter than this are simply searched; indexing them would cost
+ * more than it saves.
+ */
+static const unsigned int ID_INDEX_MIN_SIZE = 16;
+
+
 /*
  * Creates a new ListOf items.
  */
@@ -128,6 +136,7 @@ ListOf& ListOf::operator=(const ListOf& rhs)
   {
     this->SBase::operator =(rhs);
     // Deletes existing items
+    mIdIndex.invalidate();
     for_each( mItems.begin(), mItems.end(), Delete() );
     mItems.resize( rhs.size() );
     transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
@@ -166,6 +175,7 @@ ListOf::clone () const
 int 
 ListOf::insert(int location, const SBase* item)
 {
+  invalidateOriginalText();
   return insertAndOwn(location, item->clone());
 }
 
@@ -176,6 +186,7 @@ ListOf::insert(int location, const SBase* item)
 int 
 ListOf::insertAndOwn(int location, SBase* item)
 {
+  invalidateOriginalText();
   /* no list elements yet */
   if (this->getItemTypeCode() == SBML_UNKNOWN )
   {
@@ -202,6 +213,7 @@ ListOf::insertAndOwn(int location, SBase* item)
 int
 ListOf::append (const SBase* item)
 {
+  invalidateOriginalText();
   SBase* clone = item->clone();
   int ret = appendAndOwn( clone );
   if (ret != LIBSBML_OPERATION_SUCCESS) {
@@ -218,6 +230,7 @@ ListOf::append (const SBase* item)
 int
 ListOf::appendAndOwn (SBase* item)
 {
+  invalidateOriginalText();
   /* no list elements yet */
   if (this->getItemTypeCode() == SBML_UNKNOWN )
   {
@@ -275,6 +288,26 @@ SBase*
 ListOf::getElementBySId(const std::string& id)
 {
   if (id.empty()) return NULL;
+
+  bool indexed = false;
+  SBase* holder = getIdHolder(id, indexed);
+  if (holder != NULL)
+  {
+    if (holder->isSetId() && holder->getId() == id)
+    {
+      return holder;
+    }
+    SBase* obj = holder->getElementBySId(id);
+    if (obj != NULL) return obj;
+
+    // the index is out of date; search the items the slow way below
+    mIdIndex.invalidate();
+  }
+  else if (indexed)
+  {
+    return getElementFromPluginsBySId(id);
+  }
+
   for (unsigned int i = 0; i < size(); i++)
   {
     SBase* obj = get(i);
@@ -340,9 +373,11 @@ ListOf::getAllElements(ElementFilter *filter)
 void
 ListOf::clear (bool doDelete)
 {
+  invalidateOriginalText();
   if (doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
   mItems.clear();
+  invalidateIdIndexes();
 }
 
 int ListOf::removeFromParentAndDelete()
@@ -367,8 +402,13 @@ int ListOf::removeFromParentAndDelete()
 SBase*
 ListOf::remove (unsigned int n)
 {
+  invalidateOriginalText();
   SBase* item = get(n);
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    mItems.erase( mItems.begin() + n );
+    invalidateIdIndexes();
+  }
   return item;
 }
 
@@ -522,7 +562,12 @@ void
 ListOf::writeElements (XMLOutputStream& stream) const
 {
   SBase::writeElements(stream);
-  for_each( mItems.begin(), mItems.end(), Write(stream) );
+
+  ListOfItemsWriter* itemsWriter = stream.getListOfItemsWriter();
+  if (itemsWriter == NULL || !itemsWriter->writeItems(*this, stream))
+  {
+    for_each( mItems.begin(), mItems.end(), Write(stream) );
+  }
 
   //
   // (EXTENSION)
@@ -629,6 +674,7 @@ ListOf::isExplicitlyListed() const
 void 
 ListOf::setExplicitlyListed(bool value)
 {
+  invalidateOriginalText();
   mExplicitlyListed = value;
 }
 
@@ -666,6 +712,80 @@ struct ListOfComparator
 void ListOf::sort()
 {
     std::sort(mItems.begin(), mItems.end(), ListOfComparator());
+    mIdIndex.invalidate();
+}
+
+
+SBase*
+ListOf::getItemBySId(const std::string& sid) const
+{
+  bool indexed = false;
+  SBase* holder = sid.empty() ? NULL : getIdHolder(sid, indexed);
+  if (holder != NULL && holder->getId() == sid)
+  {
+    return holder;
+  }
+  else if (holder == NULL && indexed)
+  {
+    return NULL;
+  }
+
+  // either the list is not indexed, or sid belongs to an element further
+  // down the first item that holds it (such as a local parameter), in
+  // which case a later item may still carry it
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if ((*it)->getId() == sid) return *it;
+  }
+  return NULL;
+}
+
+
+SBase*
+ListOf::getIdHolder(const std::string& id, bool& indexed) const
+{
+  indexed = false;
+  if (mItems.size() < ID_INDEX_MIN_SIZE) return NULL;
+
+  // items may have been erased by a subclass without going through remove()
+  if (mIdIndex.isValid() && mIdIndex.getStamp() != mItems.size())
+  {
+    // an index that cannot be invalidated must not be used either
+    if (IdIndex::isReadOnly()) return NULL;
+    mIdIndex.invalidate();
+  }
+
+  if (!mIdIndex.isValid())
+  {
+    if (!mIdIndex.isWorthRebuilding()) return NULL;
+    rebuildIdIndex();
+  }
+
+  indexed = true;
+  return mIdIndex.getHolder(id);
+}
+
+
+void
+ListOf::buildIdIndex() const
+{
+  if (mItems.size() < ID_INDEX_MIN_SIZE) return;
+
+  if (!mIdIndex.isValid() || mIdIndex.getStamp() != mItems.size())
+  {
+    rebuildIdIndex();
+  }
+}
+
+
+void
+ListOf::rebuildIdIndex() const
+{
+  mIdIndex.reset((unsigned int)mItems.size());
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    mIdIndex.addSubtree(*it, *it);
+  }
 }
 
 
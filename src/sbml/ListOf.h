@@ -101,6 +101,7 @@
 #include <functional>
 
 #include <sbml/SBase.h>
+#include <sbml/util/IdIndex.h>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
@@ -623,6 +624,14 @@ public:
   void sort();
   /** @endcond */
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Builds the index of the ids held by the items of this ListOf, unless
+   * it is up to date or the list is too short to need one.
+   */
+  void buildIdIndex () const;
+  /** @endcond */
+
 protected:
   /** @cond doxygenLibsbmlInternal */
   typedef std::vector<SBase*>           ListItem;
@@ -660,10 +669,34 @@ protected:
   virtual bool isValidTypeForList(SBase * item);
 
 
+  /**
+   * Returns the first item of this ListOf whose getId() is @p sid, or
+   * @c NULL if there is none.  Used by the ListOf subclasses to implement
+   * get(const std::string& sid) through the id index.
+   */
+  SBase* getItemBySId (const std::string& sid) const;
+
+
+  /**
+   * Returns the item of this ListOf whose subtree holds the element with
+   * the given @p id, (re)building the id index when worthwhile.
+   *
+   * @p indexed is set to @c true if the index could be used, in which case
+   * a @c NULL return value means there is no such element; otherwise the
+   * caller must search the items itself.
+   */
+  SBase* getIdHolder (const std::string& id, bool& indexed) const;
+
+
+  void rebuildIdIndex () const;
+
+
   ListItem mItems;
 
   bool mExplicitlyListed;
 
+  mutable IdIndex mIdIndex;
+
   /** @endcond */
 };
 
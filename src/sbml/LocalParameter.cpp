@@ -186,6 +186,7 @@ LocalParameter::isSetConstant () const
 int
 LocalParameter::setConstant (bool)
 {
+  invalidateOriginalText();
   return LIBSBML_UNEXPECTED_ATTRIBUTE;
 }
 /** @endcond */
@@ -195,6 +196,7 @@ LocalParameter::setConstant (bool)
 int
 LocalParameter::unsetConstant ()
 {
+  invalidateOriginalText();
   return LIBSBML_UNEXPECTED_ATTRIBUTE;
 }
 /** @endcond */
@@ -669,12 +671,7 @@ ListOfLocalParameters::get (const std::string& sid)
 const LocalParameter*
 ListOfLocalParameters::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqP(sid) );
-  return (result == mItems.end()) ? NULL : 
-                           static_cast <LocalParameter*> (*result);
-  
+  return static_cast <const LocalParameter*> (getItemBySId(sid));
 }
 
 
@@ -696,6 +693,7 @@ ListOfLocalParameters::getElementBySId(const std::string& id)
 LocalParameter*
 ListOfLocalParameters::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<LocalParameter*>(ListOf::remove(n));
 }
 
@@ -704,6 +702,7 @@ ListOfLocalParameters::remove (unsigned int n)
 LocalParameter*
 ListOfLocalParameters::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -713,6 +712,7 @@ ListOfLocalParameters::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <LocalParameter*> (item);
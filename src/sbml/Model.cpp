@@ -104,6 +104,7 @@ Model::Model (unsigned int level, unsigned int version) :
  , mIdList (  )
  , mMetaidList ( )
  , mUnitsDataMap ()
+ , mIdIndex ()
 {
   if (!hasValidLevelVersionNamespaceCombination())
     throw SBMLConstructorException();
@@ -137,6 +138,7 @@ Model::Model (SBMLNamespaces * sbmlns) :
  , mIdList (  )
  , mMetaidList ( )
  , mUnitsDataMap ()
+ , mIdIndex ()
 {
   if (!hasValidLevelVersionNamespaceCombination())
   {
@@ -197,6 +199,7 @@ Model::Model(const Model& orig)
   , mIdList              (orig.mIdList)
   , mMetaidList          (orig.mMetaidList)
   , mUnitsDataMap        ()
+  , mIdIndex            ()
 {
 
   if (orig.mFormulaUnitsData != NULL)
@@ -247,6 +250,7 @@ Model& Model::operator=(const Model& rhs)
     mConstraints          = rhs.mConstraints;
     mReactions            = rhs.mReactions;
     mEvents               = rhs.mEvents;
+    mIdIndex.invalidate();
 
 
     if (this->mFormulaUnitsData  != NULL)
@@ -326,10 +330,53 @@ Model::clone () const
   return new Model(*this);
 }
 
+void
+Model::buildIdIndex()
+{
+  if (mIdIndex.isValid()) return;
+
+  ListOf* lists[] = { &mFunctionDefinitions, &mUnitDefinitions,
+                      &mCompartmentTypes, &mSpeciesTypes, &mCompartments,
+                      &mSpecies, &mParameters, &mReactions,
+                      &mInitialAssignments, &mRules, &mConstraints, &mEvents };
+  const unsigned int numLists = sizeof(lists) / sizeof(lists[0]);
+
+  mIdIndex.reset();
+  for (unsigned int l = 0; l < numLists; ++l)
+  {
+    for (unsigned int i = 0; i < lists[l]->size(); ++i)
+    {
+      mIdIndex.addSubtree(lists[l]->get(i), lists[l]);
+    }
+  }
+}
+
+
 SBase* 
 Model::getElementBySId(const std::string& id)
 {
   if (id.empty()) return NULL;
+
+  if (!mIdIndex.isValid() && mIdIndex.isWorthRebuilding())
+  {
+    buildIdIndex();
+  }
+
+  if (mIdIndex.isValid())
+  {
+    SBase* holder = mIdIndex.getHolder(id);
+    if (holder == NULL)
+    {
+      return getElementFromPluginsBySId(id);
+    }
+
+    SBase* found = holder->getElementBySId(id);
+    if (found != NULL) return found;
+
+    // the index is out of date; fall back to searching the lists in order
+    mIdIndex.invalidate();
+  }
+
   SBase* obj = mFunctionDefinitions.getElementBySId(id);
   if (obj != NULL) return obj;
   obj = mUnitDefinitions.getElementBySId(id);
@@ -363,6 +410,24 @@ SBase*
 Model::getElementByMetaId(const std::string& metaid)
 {
   if (metaid.empty()) return NULL;
+
+  SBMLDocument* doc = getSBMLDocument();
+  if (doc == NULL) return searchElementByMetaId(metaid);
+
+  SBase* obj = doc->getIndexedElementByMetaId(metaid, this);
+  if (obj == NULL)
+  {
+    obj = searchElementByMetaId(metaid);
+    doc->indexMetaId(metaid, obj, this);
+  }
+  return obj;
+}
+
+
+/** @cond doxygenLibsbmlInternal */
+SBase*
+Model::searchElementByMetaId(const std::string& metaid)
+{
   if (mFunctionDefinitions.getMetaId()==metaid) return &mFunctionDefinitions;
   if (mUnitDefinitions.getMetaId()==metaid) return &mUnitDefinitions;
   if (mCompartmentTypes.getMetaId()==metaid) return &mCompartmentTypes;
@@ -403,6 +468,7 @@ Model::getElementByMetaId(const std::string& metaid)
 
   return getElementFromPluginsByMetaId(metaid);
 }
+/** @endcond */
 
 
 List*
@@ -434,6 +500,7 @@ Model::getAllElements(ElementFilter *filter)
 int 
 Model::renameAllIds(IdentifierTransformer* idTransformer, ElementFilter* filter)
 {
+  invalidateOriginalText();
   if (idTransformer == NULL) 
   return LIBSBML_OPERATION_SUCCESS;
   
@@ -454,6 +521,7 @@ Model::renameAllIds(IdentifierTransformer* idTransformer, ElementFilter* filter)
 void 
 Model::renameIDs(List* elements, IdentifierTransformer* idTransformer)
 {
+  invalidateOriginalText();
   if (elements == NULL || elements->getSize() == 0 || idTransformer == NULL)
     return;
 
@@ -716,12 +784,14 @@ Model::isSetConversionFactor () const
 int
 Model::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -734,6 +804,7 @@ Model::setId (const std::string& sid)
 int
 Model::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -745,6 +816,7 @@ Model::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -763,6 +835,7 @@ Model::setName (const std::string& name)
 int
 Model::setSubstanceUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -785,6 +858,7 @@ Model::setSubstanceUnits (const std::string& units)
 int
 Model::setTimeUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -807,6 +881,7 @@ Model::setTimeUnits (const std::string& units)
 int
 Model::setVolumeUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -829,6 +904,7 @@ Model::setVolumeUnits (const std::string& units)
 int
 Model::setAreaUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -851,6 +927,7 @@ Model::setAreaUnits (const std::string& units)
 int
 Model::setLengthUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -873,6 +950,7 @@ Model::setLengthUnits (const std::string& units)
 int
 Model::setExtentUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -895,6 +973,7 @@ Model::setExtentUnits (const std::string& units)
 int
 Model::setConversionFactor (const std::string& id)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -917,6 +996,8 @@ Model::setConversionFactor (const std::string& id)
 int
 Model::unsetId ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
@@ -936,8 +1017,10 @@ Model::unsetId ()
 int
 Model::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -967,6 +1050,7 @@ Model::unsetName ()
 int
 Model::unsetSubstanceUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -993,6 +1077,7 @@ Model::unsetSubstanceUnits ()
 int
 Model::unsetTimeUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1019,6 +1104,7 @@ Model::unsetTimeUnits ()
 int
 Model::unsetVolumeUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1045,6 +1131,7 @@ Model::unsetVolumeUnits ()
 int
 Model::unsetAreaUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1071,6 +1158,7 @@ Model::unsetAreaUnits ()
 int
 Model::unsetLengthUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1097,6 +1185,7 @@ Model::unsetLengthUnits ()
 int
 Model::unsetExtentUnits ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1123,6 +1212,7 @@ Model::unsetExtentUnits ()
 int
 Model::unsetConversionFactor ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1149,6 +1239,7 @@ Model::unsetConversionFactor ()
 int
 Model::addFunctionDefinition (const FunctionDefinition* fd)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(fd));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1172,6 +1263,7 @@ Model::addFunctionDefinition (const FunctionDefinition* fd)
 int
 Model::addUnitDefinition (const UnitDefinition* ud)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(ud));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1195,6 +1287,7 @@ Model::addUnitDefinition (const UnitDefinition* ud)
 int
 Model::addCompartmentType (const CompartmentType* ct)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(ct));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1218,6 +1311,7 @@ Model::addCompartmentType (const CompartmentType* ct)
 int
 Model::addSpeciesType (const SpeciesType* st)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(st));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1241,6 +1335,7 @@ Model::addSpeciesType (const SpeciesType* st)
 int
 Model::addCompartment (const Compartment* c)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(c));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1264,6 +1359,7 @@ Model::addCompartment (const Compartment* c)
 int
 Model::addSpecies (const Species* s)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(s));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1287,6 +1383,7 @@ Model::addSpecies (const Species* s)
 int
 Model::addParameter (const Parameter* p)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(p));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1319,6 +1416,7 @@ Model::addParameter (const Parameter* p)
 int
 Model::addInitialAssignment (const InitialAssignment* ia)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(ia));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1342,6 +1440,7 @@ Model::addInitialAssignment (const InitialAssignment* ia)
 int
 Model::addRule (const Rule* r)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(r));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1366,6 +1465,7 @@ Model::addRule (const Rule* r)
 int
 Model::addConstraint (const Constraint* c)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(c));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1384,6 +1484,7 @@ Model::addConstraint (const Constraint* c)
 int
 Model::addReaction (const Reaction* r)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(r));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1407,6 +1508,7 @@ Model::addReaction (const Reaction* r)
 int
 Model::addEvent (const Event* e)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(e));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -1430,6 +1532,7 @@ Model::addEvent (const Event* e)
 FunctionDefinition*
 Model::createFunctionDefinition ()
 {
+  invalidateOriginalText();
   FunctionDefinition* fd = NULL;
 
   try
@@ -1458,6 +1561,7 @@ Model::createFunctionDefinition ()
 UnitDefinition*
 Model::createUnitDefinition ()
 {
+  invalidateOriginalText();
   UnitDefinition* ud = NULL;
 
   try
@@ -1490,6 +1594,7 @@ Model::createUnitDefinition ()
 Unit*
 Model::createUnit ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumUnitDefinitions();
   return (size > 0) ? getUnitDefinition(size - 1)->createUnit() : NULL;
 }
@@ -1501,6 +1606,7 @@ Model::createUnit ()
 CompartmentType*
 Model::createCompartmentType ()
 {
+  invalidateOriginalText();
   CompartmentType* ct = NULL;
 
   try
@@ -1529,6 +1635,7 @@ Model::createCompartmentType ()
 SpeciesType*
 Model::createSpeciesType ()
 {
+  invalidateOriginalText();
   SpeciesType* st = NULL;
 
   try
@@ -1557,6 +1664,7 @@ Model::createSpeciesType ()
 Compartment*
 Model::createCompartment ()
 {
+  invalidateOriginalText();
   Compartment* c = NULL;
 
   try
@@ -1585,6 +1693,7 @@ Model::createCompartment ()
 Species*
 Model::createSpecies ()
 {
+  invalidateOriginalText();
   Species* s = NULL;
 
   try
@@ -1613,6 +1722,7 @@ Model::createSpecies ()
 Parameter*
 Model::createParameter ()
 {
+  invalidateOriginalText();
   Parameter* p = NULL;
 
   try
@@ -1641,6 +1751,7 @@ Model::createParameter ()
 InitialAssignment*
 Model::createInitialAssignment ()
 {
+  invalidateOriginalText();
   InitialAssignment* ia = NULL;
 
   try
@@ -1669,6 +1780,7 @@ Model::createInitialAssignment ()
 AlgebraicRule*
 Model::createAlgebraicRule ()
 {
+  invalidateOriginalText();
   AlgebraicRule* ar = NULL;
 
   try
@@ -1697,6 +1809,7 @@ Model::createAlgebraicRule ()
 AssignmentRule*
 Model::createAssignmentRule ()
 {
+  invalidateOriginalText();
   AssignmentRule* ar = NULL;
 
   try
@@ -1725,6 +1838,7 @@ Model::createAssignmentRule ()
 RateRule*
 Model::createRateRule ()
 {
+  invalidateOriginalText();
   RateRule* rr = NULL;
 
   try
@@ -1753,6 +1867,7 @@ Model::createRateRule ()
 Constraint*
 Model::createConstraint ()
 {
+  invalidateOriginalText();
   Constraint* c = NULL;
 
   try
@@ -1781,6 +1896,7 @@ Model::createConstraint ()
 Reaction*
 Model::createReaction ()
 {
+  invalidateOriginalText();
   Reaction* r = NULL;
 
   try
@@ -1814,6 +1930,7 @@ Model::createReaction ()
 SpeciesReference*
 Model::createReactant ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
   return (size > 0) ? getReaction(size - 1)->createReactant() : NULL;
 }
@@ -1830,6 +1947,7 @@ Model::createReactant ()
 SpeciesReference*
 Model::createProduct ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
   return (size > 0) ? getReaction(size - 1)->createProduct() : NULL;
 }
@@ -1846,6 +1964,7 @@ Model::createProduct ()
 ModifierSpeciesReference*
 Model::createModifier ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
   return (size > 0) ? getReaction(size - 1)->createModifier() : NULL;
 }
@@ -1862,6 +1981,7 @@ Model::createModifier ()
 KineticLaw*
 Model::createKineticLaw ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
   return (size > 0) ? getReaction(size - 1)->createKineticLaw() : NULL;
 }
@@ -1878,6 +1998,7 @@ Model::createKineticLaw ()
 Parameter*
 Model::createKineticLawParameter ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
 
   if (size > 0)
@@ -1901,6 +2022,7 @@ Model::createKineticLawParameter ()
 LocalParameter*
 Model::createKineticLawLocalParameter ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumReactions();
 
   if (size > 0)
@@ -1919,6 +2041,7 @@ Model::createKineticLawLocalParameter ()
 Event*
 Model::createEvent ()
 {
+  invalidateOriginalText();
   Event* e = NULL;
 
   try
@@ -1951,6 +2074,7 @@ Model::createEvent ()
 EventAssignment*
 Model::createEventAssignment ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumEvents();
   return (size > 0) ? getEvent(size - 1)->createEventAssignment() : NULL;
 }
@@ -1966,6 +2090,7 @@ Model::createEventAssignment ()
 Trigger*
 Model::createTrigger ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumEvents();
   return (size > 0) ? getEvent(size - 1)->createTrigger() : NULL;
 }
@@ -1981,6 +2106,7 @@ Model::createTrigger ()
 Delay*
 Model::createDelay ()
 {
+  invalidateOriginalText();
   unsigned int size = getNumEvents();
   return (size > 0) ? getEvent(size - 1)->createDelay() : NULL;
 }
@@ -1992,6 +2118,7 @@ Model::createDelay ()
 int
 Model::setAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
   int success = SBase::setAnnotation(annotation);
 
   if (success == 0)
@@ -2026,6 +2153,7 @@ Model::setAnnotation (const XMLNode* annotation)
 int
 Model::setAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
   if(annotation.empty())
   {
@@ -2061,6 +2189,7 @@ Model::setAnnotation (const std::string& annotation)
 int
 Model::appendAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
   return SBase::appendAnnotation(annotation);
 }
 
@@ -2073,6 +2202,7 @@ Model::appendAnnotation (const XMLNode* annotation)
 int
 Model::appendAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
   XMLNode* annt_xmln;
   if (getSBMLDocument() != NULL)
@@ -3418,6 +3548,7 @@ Model::hasRequiredElements() const
 FunctionDefinition* 
 Model::removeFunctionDefinition (unsigned int n)
 {
+  invalidateOriginalText();
   return mFunctionDefinitions.remove(n);
 }
 
@@ -3429,6 +3560,7 @@ Model::removeFunctionDefinition (unsigned int n)
 FunctionDefinition* 
 Model::removeFunctionDefinition (const std::string& sid)
 {
+  invalidateOriginalText();
   return mFunctionDefinitions.remove(sid);
 }
 
@@ -3440,6 +3572,7 @@ Model::removeFunctionDefinition (const std::string& sid)
 UnitDefinition*
 Model::removeUnitDefinition (unsigned int n)
 {
+  invalidateOriginalText();
   return mUnitDefinitions.remove(n);
 }
 
@@ -3451,6 +3584,7 @@ Model::removeUnitDefinition (unsigned int n)
 UnitDefinition*
 Model::removeUnitDefinition (const std::string& sid)
 {
+  invalidateOriginalText();
   return mUnitDefinitions.remove(sid);
 }
 
@@ -3462,6 +3596,7 @@ Model::removeUnitDefinition (const std::string& sid)
 CompartmentType*
 Model::removeCompartmentType (unsigned int n)
 {
+  invalidateOriginalText();
   return mCompartmentTypes.remove(n);
 }
 
@@ -3473,6 +3608,7 @@ Model::removeCompartmentType (unsigned int n)
 CompartmentType*
 Model::removeCompartmentType (const std::string& sid)
 {
+  invalidateOriginalText();
   return mCompartmentTypes.remove(sid);
 }
 
@@ -3484,6 +3620,7 @@ Model::removeCompartmentType (const std::string& sid)
 SpeciesType*
 Model::removeSpeciesType (unsigned int n)
 {
+  invalidateOriginalText();
   return mSpeciesTypes.remove(n);
 }
 
@@ -3495,6 +3632,7 @@ Model::removeSpeciesType (unsigned int n)
 SpeciesType*
 Model::removeSpeciesType (const std::string& sid)
 {
+  invalidateOriginalText();
   return mSpeciesTypes.remove(sid);
 }
 
@@ -3506,6 +3644,7 @@ Model::removeSpeciesType (const std::string& sid)
 Compartment*
 Model::removeCompartment (unsigned int n)
 {
+  invalidateOriginalText();
   return mCompartments.remove(n);
 }
 
@@ -3517,6 +3656,7 @@ Model::removeCompartment (unsigned int n)
 Compartment*
 Model::removeCompartment (const std::string& sid)
 {
+  invalidateOriginalText();
   return mCompartments.remove(sid);
 }
 
@@ -3528,6 +3668,7 @@ Model::removeCompartment (const std::string& sid)
 Species*
 Model::removeSpecies (unsigned int n)
 {
+  invalidateOriginalText();
   return mSpecies.remove(n);
 }
 
@@ -3539,6 +3680,7 @@ Model::removeSpecies (unsigned int n)
 Species*
 Model::removeSpecies (const std::string& sid)
 {
+  invalidateOriginalText();
   return mSpecies.remove(sid);
 }
 
@@ -3550,6 +3692,7 @@ Model::removeSpecies (const std::string& sid)
 Parameter*
 Model::removeParameter (unsigned int n)
 {
+  invalidateOriginalText();
   return mParameters.remove(n);
 }
 
@@ -3561,6 +3704,7 @@ Model::removeParameter (unsigned int n)
 Parameter*
 Model::removeParameter (const std::string& sid)
 {
+  invalidateOriginalText();
   return mParameters.remove(sid);
 }
 
@@ -3572,6 +3716,7 @@ Model::removeParameter (const std::string& sid)
 InitialAssignment*
 Model::removeInitialAssignment (unsigned int n)
 {
+  invalidateOriginalText();
   return mInitialAssignments.remove(n);
 }
 
@@ -3583,6 +3728,7 @@ Model::removeInitialAssignment (unsigned int n)
 InitialAssignment*
 Model::removeInitialAssignment (const std::string& sid)
 {
+  invalidateOriginalText();
   return mInitialAssignments.remove(sid);
 }
 
@@ -3594,6 +3740,7 @@ Model::removeInitialAssignment (const std::string& sid)
 Rule*
 Model::removeRule (unsigned int n)
 {
+  invalidateOriginalText();
   return mRules.remove(n);
 }
 
@@ -3605,6 +3752,7 @@ Model::removeRule (unsigned int n)
 Rule*
 Model::removeRule (const std::string& sid)
 {
+  invalidateOriginalText();
   return mRules.remove(sid);
 }
 
@@ -3615,6 +3763,7 @@ Model::removeRule (const std::string& sid)
 Rule*
 Model::removeRuleByVariable (const std::string& variable)
 {
+  invalidateOriginalText();
   return mRules.remove(variable);
 }
 
@@ -3626,6 +3775,7 @@ Model::removeRuleByVariable (const std::string& variable)
 Constraint*
 Model::removeConstraint (unsigned int n)
 {
+  invalidateOriginalText();
   return mConstraints.remove(n);
 }
 
@@ -3637,6 +3787,7 @@ Model::removeConstraint (unsigned int n)
 Reaction*
 Model::removeReaction (unsigned int n)
 {
+  invalidateOriginalText();
   return mReactions.remove(n);
 }
 
@@ -3648,6 +3799,7 @@ Model::removeReaction (unsigned int n)
 Reaction*
 Model::removeReaction (const std::string& sid)
 {
+  invalidateOriginalText();
   return mReactions.remove(sid);
 }
 
@@ -3659,6 +3811,7 @@ Model::removeReaction (const std::string& sid)
 Event*
 Model::removeEvent (unsigned int n)
 {
+  invalidateOriginalText();
   return mEvents.remove(n);
 }
 
@@ -3670,6 +3823,7 @@ Model::removeEvent (unsigned int n)
 Event*
 Model::removeEvent (const std::string& sid)
 {
+  invalidateOriginalText();
   return mEvents.remove(sid);
 }
 
@@ -4475,6 +4629,7 @@ Model::getObject(const std::string& elementName, unsigned int index)
 int 
 Model::appendFrom(const Model* model)
 {
+  invalidateOriginalText();
   int ret = LIBSBML_OPERATION_SUCCESS;
   ret = mFunctionDefinitions.appendFrom(&model->mFunctionDefinitions);
   if (ret != LIBSBML_OPERATION_SUCCESS) return ret;
@@ -4511,6 +4666,7 @@ Model::appendFrom(const Model* model)
 void
 Model::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetConversionFactor()) {
     if (getConversionFactor()==oldid) {
@@ -4522,6 +4678,7 @@ Model::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Model::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (mSubstanceUnits == oldid) mSubstanceUnits = newid;
   if (mTimeUnits == oldid)      mTimeUnits = newid;
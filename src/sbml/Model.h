@@ -466,6 +466,7 @@ sp.setId("MySpecies");
 
 #include <sbml/units/FormulaUnitsData.h>
 #include <sbml/util/IdList.h>
+#include <sbml/util/IdIndex.h>
 
 #include <sbml/annotation/ModelHistory.h>
 
@@ -4124,6 +4125,14 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Builds the index used by getElementBySId(), unless it is up to date.
+   */
+  void buildIdIndex ();
+  /** @endcond */
+
+
 protected:
   /** @cond doxygenLibsbmlInternal */
   /**
@@ -4186,6 +4195,13 @@ protected:
    */
   virtual void syncAnnotation();
 
+
+  /**
+   * Searches the components of this Model for the element with the given
+   * @p metaid, without consulting the index of the document.
+   */
+  SBase* searchElementByMetaId (const std::string& metaid);
+
   std::string     mSubstanceUnits;
   std::string     mTimeUnits;
   std::string     mVolumeUnits;
@@ -4212,6 +4228,7 @@ protected:
   IdList                     mIdList;
   IdList                     mMetaidList;
   UnitsValueMap              mUnitsDataMap;
+  IdIndex                    mIdIndex;
 
 
   /* the validator classes need to be friends to access the 
@@ -0,0 +1,635 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ParallelListOfReader.cpp
+ * @brief   Reads the items of the large lists of a model on several threads.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <climits>
+#include <cstring>
+#include <typeinfo>
+
+#include <sbml/ParallelListOfReader.h>
+#include <sbml/DeferredElementReader.h>
+#include <sbml/ListOf.h>
+#include <sbml/SBMLDocument.h>
+#include <sbml/SBMLError.h>
+#include <sbml/SBMLErrorLog.h>
+#include <sbml/math/ASTNodeArena.h>
+#include <sbml/xml/XMLElementFilter.h>
+#include <sbml/xml/XMLElementScanner.h>
+#include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLMappedFileBuffer.h>
+
+#if defined(LIBSBML_WITH_PARALLEL_READING) && \
+    ((__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900))
+#define LIBSBML_READ_CONCURRENTLY 1
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+/* the name of the element left in the place of the items read in parts */
+static const char* const PLACEHOLDER = "libsbmlParallelListOfItems";
+
+/* the items of smaller lists are left to be read as usual */
+static const size_t MIN_PART_LENGTH = 64 * 1024;
+
+
+/*
+ * Creating and deleting a parser is not thread-safe with every XML
+ * library (Xerces counts its users in a global).
+ */
+#ifdef LIBSBML_READ_CONCURRENTLY
+static std::mutex sParserMutex;
+#define PARSER_LOCK std::lock_guard<std::mutex> lock(sParserMutex)
+#else
+#define PARSER_LOCK
+#endif
+
+
+/*
+ * The items of a list are [starts[0], end); the notes and annotation of
+ * the list must come before them.
+ */
+struct ScannedList
+{
+  XMLElementScanner::Tag  list;
+  std::vector<size_t>  starts;
+  size_t               end;
+};
+
+
+/*
+ * Reads a part: records which list of the document of the part has its
+ * items, and which of the errors of that document were logged while they
+ * were read.  The list is the first one to have any child.
+ */
+class PartReader : public ListOfItemsReader
+{
+public:
+
+  PartReader (ParallelListOfReader::Part& part)
+    : mPart (part)
+  {
+  }
+
+
+  virtual bool readChild (SBase& parent, XMLInputStream&)
+  {
+    if (mPart.list == NULL)
+    {
+      mPart.list = dynamic_cast<ListOf*>(&parent);
+      if (mPart.list != NULL)
+      {
+        mPart.errorsBegin = parent.getSBMLDocument()->getNumErrors();
+      }
+    }
+
+    return false;
+  }
+
+
+  virtual void readEnd (SBase& parent)
+  {
+    if (&parent == mPart.list)
+    {
+      mPart.errorsEnd = parent.getSBMLDocument()->getNumErrors();
+      mPart.read      = true;
+    }
+  }
+
+
+private:
+
+  ParallelListOfReader::Part& mPart;
+};
+
+
+ListOfItemsReader::~ListOfItemsReader ()
+{
+}
+
+
+/*
+ * Scans the document to read it with up to numThreads threads.
+ */
+ParallelListOfReader::ParallelListOfReader (const char* content,
+                                            bool isFile,
+                                            unsigned int numThreads,
+                                            const XMLElementFilter* filter)
+  : mNumThreads     (numThreads)
+  , mNextList       (0)
+  , mFailed         (false)
+  , mDeferredReader (NULL)
+  , mFilter         (filter)
+{
+#ifdef LIBSBML_READ_CONCURRENTLY
+  if (mNumThreads == 0)
+  {
+    mNumThreads = std::thread::hardware_concurrency();
+  }
+#endif
+
+  if (mNumThreads <= 1 || content == NULL) return;
+
+  if (isFile)
+  {
+    // only regular files are scanned; compressed ones are read as usual
+    XMLMappedFileBuffer file(content);
+    if (file.error()) return;
+
+    unsigned int length = UINT_MAX;
+    const char* data = file.readInPlace(length);
+    scan(data, length);
+  }
+  else
+  {
+    scan(content, strlen(content));
+  }
+}
+
+
+ParallelListOfReader::~ParallelListOfReader ()
+{
+  clear();
+}
+
+
+/*
+ * Finds the lists of the model large enough to be read in parts, and
+ * cuts their items into parts about the same size.
+ */
+void
+ParallelListOfReader::scan (const char* content, size_t length)
+{
+  typedef XMLElementScanner Scanner;
+
+  Scanner scanner(content, length);
+  Scanner::Tag root;
+  Scanner::Tag model;
+  Scanner::Tag list;
+  Scanner::Tag item;
+
+  if (!scanner.skipProlog() || !scanner.nextChild(root)
+      || root.empty || !root.hasName("sbml"))
+  {
+    return;
+  }
+
+  // the placeholders must not be left out by the parser
+  if (mFilter != NULL && (mFilter->hasElement("sbml", 4)
+                          || mFilter->hasElement("model", 5)))
+  {
+    return;
+  }
+
+  bool hasModel = false;
+  while (!hasModel && scanner.nextChild(model))
+  {
+    hasModel = model.hasName("model");
+    if (!hasModel && !scanner.skipElement(model)) return;
+  }
+  if (!hasModel || model.empty) return;
+
+  std::vector<ScannedList> lists;
+  size_t total = 0;
+
+  while (scanner.nextChild(list))
+  {
+    bool isSkipped = mFilter != NULL
+      && (mFilter->hasElement(list.name, list.nameLength)
+          || (list.hasPrefix() && mFilter->hasNamespaces()));
+
+    if (list.empty || !list.hasNamePrefix("listOf") || isSkipped)
+    {
+      if (!scanner.skipElement(list)) return;
+      continue;
+    }
+
+    ScannedList items;
+    items.list = list;
+    items.end  = 0;
+    bool ordered = true;
+
+    while (scanner.nextChild(item))
+    {
+      bool isItem = !item.hasName("notes") && !item.hasName("annotation")
+        && !DeferredElementReader::isPlaceholderName(item.name,
+                                                     item.nameLength);
+
+      if (isItem)                      items.starts.push_back(item.begin);
+      else if (!items.starts.empty())  ordered = false;
+
+      if (!scanner.skipElement(item)) return;
+
+      if (isItem) items.end = scanner.offset();
+    }
+    if (scanner.failed()) return;
+
+    if (ordered && !items.starts.empty()
+        && items.end - items.starts[0] >= MIN_PART_LENGTH)
+    {
+      total += items.end - items.starts[0];
+      lists.push_back(items);
+    }
+  }
+  if (scanner.failed() || lists.empty()) return;
+
+  // a few parts per thread even out the time the threads take
+  size_t partLength = total / (4 * mNumThreads);
+  if (partLength < MIN_PART_LENGTH) partLength = MIN_PART_LENGTH;
+
+  string rootTag(content + root.begin, root.end - root.begin);
+  string modelTag(content + model.begin, model.end - model.begin);
+
+  Scanner::Position original = Scanner::startOf();
+  Scanner::Position left     = Scanner::startOf();
+  size_t copied = 0;
+
+  for (size_t l = 0; l < lists.size(); ++l)
+  {
+    const ScannedList& items = lists[l];
+
+    string header = rootTag + modelTag
+      + string(content + items.list.begin, items.list.end - items.list.begin)
+      + "\n";
+    string footer = "\n</" + items.list.getQName() + "></"
+      + model.getQName() + "></" + root.getQName() + ">\n";
+
+    Scanner::Position start = Scanner::startOf();
+    Scanner::advance(header.c_str(), header.size(), header.size(), start);
+
+    List parts;
+    parts.begin = mParts.size();
+
+    for (size_t n = 0; n < items.starts.size(); )
+    {
+      size_t begin = items.starts[n];
+      while (n < items.starts.size() && items.starts[n] - begin < partLength)
+      {
+        ++n;
+      }
+      size_t end = (n < items.starts.size()) ? items.starts[n] : items.end;
+
+      Scanner::advance(content, length, begin, original);
+
+      Part part;
+      part.content     = header;
+      part.content.append(content + begin, end - begin);
+      part.content    += footer;
+      part.line        = start.line;
+      part.column      = start.column;
+      part.toLine      = original.line;
+      part.toColumn    = original.column;
+      part.document    = NULL;
+      part.list        = NULL;
+      part.errorsBegin = 0;
+      part.errorsEnd   = 0;
+      part.read        = false;
+      mParts.push_back(part);
+    }
+
+    parts.end = mParts.size();
+    mLists.push_back(parts);
+
+    // what follows the placeholder is where the items ended
+    mContent.append(content + copied, items.starts[0] - copied);
+    mContent += "<";
+    mContent += PLACEHOLDER;
+    mContent += "/>";
+    copied = items.end;
+
+    Scanner::advance(mContent.c_str(), mContent.size(), mContent.size(), left);
+    Scanner::advance(content, length, items.end, original);
+
+    Relocation relocation = { left.line, left.column,
+                              original.line, original.column };
+    mRelocations.push_back(relocation);
+  }
+
+  mContent.append(content + copied, length - copied);
+
+  if (mParts.size() < 2)
+  {
+    mParts.clear();
+    mLists.clear();
+    mRelocations.clear();
+    string().swap(mContent);
+  }
+}
+
+
+/*
+ * @return true if the document has lists large enough to be read in
+ * parts.
+ */
+bool
+ParallelListOfReader::isActive () const
+{
+  return !mParts.empty();
+}
+
+
+/*
+ * @return the content of the document with the items read in parts
+ * replaced by placeholders.
+ */
+const char*
+ParallelListOfReader::getContent () const
+{
+  return mContent.c_str();
+}
+
+
+/*
+ * Prepares the stream reading getContent() for the parts.
+ */
+void
+ParallelListOfReader::attach (XMLInputStream& stream)
+{
+  if (!isActive()) return;
+
+  for (size_t n = 0; n < mRelocations.size(); ++n)
+  {
+    const Relocation& r = mRelocations[n];
+    stream.addRelocation(r.line, r.column, r.toLine, r.toColumn);
+  }
+
+  stream.setListOfItemsReader(this);
+
+  // the parts may have notes and annotations left to be read later too
+  mDeferredReader = stream.getDeferredElementReader();
+}
+
+
+/*
+ * Reads the parts, allocating their math in the arena of d.
+ */
+void
+ParallelListOfReader::readParts (SBMLDocument& d)
+{
+  ASTNodeArena* arena = d.getASTNodeArena();
+
+#ifdef LIBSBML_READ_CONCURRENTLY
+  std::vector<std::exception_ptr> exceptions(mParts.size());
+  std::atomic<size_t> next(0);
+
+  auto work = [&]()
+  {
+    ASTNodeArena::Scope arenaScope(arena);
+    for (size_t n = next++; n < mParts.size(); n = next++)
+    {
+      try
+      {
+        readPart(mParts[n]);
+      }
+      catch (...)
+      {
+        exceptions[n] = std::current_exception();
+      }
+    }
+  };
+
+  /* this thread reads its share of the parts too */
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < mNumThreads && t < mParts.size(); ++t)
+  {
+    try
+    {
+      threads.push_back(std::thread(work));
+    }
+    catch (const std::exception&)
+    {
+      break;
+    }
+  }
+  work();
+  for (size_t t = 0; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  for (size_t n = 0; n < exceptions.size(); ++n)
+  {
+    if (exceptions[n])
+    {
+      std::rethrow_exception(exceptions[n]);
+    }
+  }
+#else
+  ASTNodeArena::Scope arenaScope(arena);
+  for (size_t n = 0; n < mParts.size(); ++n)
+  {
+    readPart(mParts[n]);
+  }
+#endif
+}
+
+
+/*
+ * Reads a part into a document of its own.
+ */
+void
+ParallelListOfReader::readPart (Part& part)
+{
+  part.document = new SBMLDocument();
+
+  XMLInputStream* stream = NULL;
+  {
+    PARSER_LOCK;
+    stream = new XMLInputStream(part.content.c_str(), false, "",
+                                part.document->getErrorLog());
+  }
+
+  PartReader reader(part);
+  stream->addRelocation(part.line, part.column, part.toLine, part.toColumn);
+  stream->setListOfItemsReader(&reader);
+  stream->setDeferredElementReader(mDeferredReader);
+  stream->setElementFilter(mFilter);
+
+  try
+  {
+    part.document->read(*stream);
+  }
+  catch (...)
+  {
+    PARSER_LOCK;
+    delete stream;
+    throw;
+  }
+
+  part.read = part.read && !stream->isError();
+
+  {
+    PARSER_LOCK;
+    delete stream;
+  }
+
+  string().swap(part.content);
+}
+
+
+/*
+ * Reads the placeholder that replaces the items of a list, if it is the
+ * next child: the items read in parts are moved into the list instead.
+ */
+bool
+ParallelListOfReader::readChild (SBase& parent, XMLInputStream& stream)
+{
+  const XMLToken& next = stream.peek();
+  if (next.getName() != PLACEHOLDER || !next.getPrefix().empty())
+  {
+    return false;
+  }
+
+  stream.skipPastEnd(stream.next());
+
+  ListOf* list = dynamic_cast<ListOf*>(&parent);
+  if (list == NULL || mNextList == mLists.size())
+  {
+    mFailed = true;
+    return true;
+  }
+
+  const List& parts = mLists[mNextList++];
+  for (size_t n = parts.begin; n < parts.end; ++n)
+  {
+    addItems(*list, mParts[n]);
+  }
+
+  return true;
+}
+
+
+void
+ParallelListOfReader::readEnd (SBase&)
+{
+}
+
+
+/*
+ * Moves the items of part into list, and copies the errors logged while
+ * reading them.
+ */
+void
+ParallelListOfReader::addItems (ListOf& list, Part& part)
+{
+  if (!part.read || typeid(*part.list) != typeid(list)
+      || part.list->getElementName() != list.getElementName())
+  {
+    mFailed = true;
+    return;
+  }
+
+  // the checks made while reading an item may depend on the errors logged
+  // before it, so the part must have been read after the same errors as
+  // in the document, unless reading it logged none
+  SBMLErrorLog* log = list.getSBMLDocument()->getErrorLog();
+  SBMLErrorLog* partLog = part.document->getErrorLog();
+
+  if (part.errorsEnd > part.errorsBegin)
+  {
+    bool same = (log->getNumErrors() == part.errorsBegin);
+    for (unsigned int n = 0; same && n < part.errorsBegin; ++n)
+    {
+      same = (log->getError(n)->getErrorId()
+              == partLog->getError(n)->getErrorId());
+    }
+
+    if (!same)
+    {
+      mFailed = true;
+      return;
+    }
+  }
+
+  for (unsigned int n = 0; n < part.list->size(); ++n)
+  {
+    SBase* item = part.list->get(n);
+    if (list.appendAndOwn(item) != LIBSBML_OPERATION_SUCCESS)
+    {
+      delete item;
+      mFailed = true;
+    }
+  }
+  part.list->clear(false);
+
+  for (unsigned int n = part.errorsBegin; n < part.errorsEnd; ++n)
+  {
+    log->add(*part.document->getError(n));
+  }
+}
+
+
+/*
+ * @return true if all the parts have been put into the document read from
+ * stream.
+ */
+bool
+ParallelListOfReader::isComplete (const XMLInputStream& stream) const
+{
+  return !mFailed && mNextList == mLists.size() && !stream.isError();
+}
+
+
+/*
+ * Deletes the parts that have not been put into the document.
+ */
+void
+ParallelListOfReader::clear ()
+{
+  for (size_t n = 0; n < mParts.size(); ++n)
+  {
+    delete mParts[n].document;
+    mParts[n].document = NULL;
+    mParts[n].list     = NULL;
+    mParts[n].read     = false;
+  }
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
@@ -0,0 +1,257 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ParallelListOfReader.h
+ * @brief   Reads the items of the large lists of a model on several threads.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class ListOfItemsReader
+ * @sbmlbrief{core} Reads children of elements on behalf of SBase::read().
+ *
+ * A ListOfItemsReader set on an XMLInputStream is given a chance to read
+ * each child element before SBase::read() does, and is told when the end
+ * of an element is reached.
+ *
+ * @class ParallelListOfReader
+ * @sbmlbrief{core} Reads the items of the large lists of a model on
+ * several threads.
+ *
+ * The document is first scanned for the start and end of its elements,
+ * down to the children of the lists of the model: the
+ * <code>&lt;listOf...&gt;</code> elements directly inside
+ * <code>&lt;model&gt;</code>, including those of packages.  The items of
+ * the large lists are cut into parts, and each part is made into a small
+ * document of its own, with the same <code>&lt;sbml&gt;</code>,
+ * <code>&lt;model&gt;</code> and <code>&lt;listOf...&gt;</code> start
+ * tags as the original.  These are read by readParts(), on as many
+ * threads as asked for, into detached lists.
+ *
+ * What is left of the document, where the items of each of those lists
+ * are replaced by a placeholder element, is then read by the calling
+ * thread as usual.  When SBase::read() comes to a placeholder, the items
+ * read in parts are moved into the list being read, and the errors logged
+ * while reading them are copied into the error log of the document.  The
+ * positions reported by the elements of the parts and of what is left of
+ * the document are relocated to their positions in the original.
+ *
+ * Reading an item could depend on the errors logged before it, which
+ * differ when it is read separately.  When that could make a difference,
+ * or when anything else goes wrong, isComplete() returns @c false and the
+ * document has to be read again by a single thread.
+ */
+
+#ifndef ParallelListOfReader_h
+#define ParallelListOfReader_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class DeferredElementReader;
+class ListOf;
+class SBase;
+class SBMLDocument;
+class XMLElementFilter;
+class XMLInputStream;
+
+class LIBSBML_EXTERN ListOfItemsReader
+{
+public:
+
+  virtual ~ListOfItemsReader ();
+
+
+  /**
+   * Called by SBase::read() when the next token of @p stream starts a
+   * child of @p parent.
+   *
+   * @return @c true if the child has been read, @c false to let
+   * SBase::read() read it.
+   */
+  virtual bool readChild (SBase& parent, XMLInputStream& stream) = 0;
+
+
+  /**
+   * Called by SBase::read() when the next token of the stream ends
+   * @p parent.
+   */
+  virtual void readEnd (SBase& parent) = 0;
+};
+
+
+class LIBSBML_EXTERN ParallelListOfReader : public ListOfItemsReader
+{
+public:
+
+  /**
+   * Scans the document in @p content, the name of a file if @p isFile is
+   * @c true, to read it with up to @p numThreads threads, or one per
+   * hardware thread if @p numThreads is @c 0.  The lists the parser may
+   * leave out by @p filter are not read in parts.
+   */
+  ParallelListOfReader (const char* content, bool isFile,
+                        unsigned int numThreads,
+                        const XMLElementFilter* filter = NULL);
+
+
+  virtual ~ParallelListOfReader ();
+
+
+  /**
+   * Returns @c true if the document has lists large enough to be read in
+   * parts.  Otherwise it is better read as usual, and the other methods
+   * do nothing.
+   */
+  bool isActive () const;
+
+
+  /**
+   * Returns the content of the document with the items of the lists read
+   * in parts replaced by placeholders.
+   */
+  const char* getContent () const;
+
+
+  /**
+   * Prepares the @p stream reading getContent() for the parts: the
+   * positions of the elements are relocated to their positions in the
+   * original document, and the placeholders are read by this object.
+   * Must be called before anything is read from the stream.
+   */
+  void attach (XMLInputStream& stream);
+
+
+  /**
+   * Reads the parts, allocating their math in the arena of @p d.
+   */
+  void readParts (SBMLDocument& d);
+
+
+  /**
+   * Returns @c true if all the parts have been put into the document read
+   * from @p stream, which is then the same as if it had been read by a
+   * single thread.
+   */
+  bool isComplete (const XMLInputStream& stream) const;
+
+
+  /**
+   * Deletes the parts that have not been put into the document.  This
+   * must be done before the document is deleted.
+   */
+  void clear ();
+
+
+  virtual bool readChild (SBase& parent, XMLInputStream& stream);
+
+  virtual void readEnd (SBase& parent);
+
+
+  /* a piece of the document read by a thread of its own */
+  struct Part
+  {
+    std::string   content;
+    unsigned int  line;
+    unsigned int  column;
+    unsigned int  toLine;
+    unsigned int  toColumn;
+
+    SBMLDocument* document;
+    ListOf*       list;
+    unsigned int  errorsBegin;
+    unsigned int  errorsEnd;
+    bool          read;
+  };
+
+
+protected:
+
+  /* the parts [begin, end) of a list, in the order of the document */
+  struct List
+  {
+    size_t begin;
+    size_t end;
+  };
+
+
+  struct Relocation
+  {
+    unsigned int line;
+    unsigned int column;
+    unsigned int toLine;
+    unsigned int toColumn;
+  };
+
+
+  void scan (const char* content, size_t length);
+
+  void readPart (Part& part);
+
+  void addItems (ListOf& list, Part& part);
+
+
+  std::string              mContent;
+  std::vector<Part>        mParts;
+  std::vector<List>        mLists;
+  std::vector<Relocation>  mRelocations;
+  unsigned int             mNumThreads;
+  size_t                   mNextList;
+  bool                     mFailed;
+  DeferredElementReader*   mDeferredReader;
+  const XMLElementFilter*  mFilter;
+
+
+private:
+
+  ParallelListOfReader (const ParallelListOfReader&);
+  ParallelListOfReader& operator= (const ParallelListOfReader&);
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* ParallelListOfReader_h */
+/** @endcond */
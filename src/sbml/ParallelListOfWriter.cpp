@@ -0,0 +1,291 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ParallelListOfWriter.cpp
+ * @brief   Writes the items of the large lists of a model on several threads.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <cstdlib>
+#include <ostream>
+#include <vector>
+
+#include <sbml/ParallelListOfWriter.h>
+#include <sbml/ListOf.h>
+#include <sbml/Model.h>
+#include <sbml/util/IdIndex.h>
+#include <sbml/xml/XMLOutputBuffer.h>
+#include <sbml/xml/XMLOutputStream.h>
+
+#if defined(LIBSBML_WITH_PARALLEL_WRITING) && \
+    ((__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900))
+#define LIBSBML_WRITE_CONCURRENTLY 1
+#include <atomic>
+#include <exception>
+#include <thread>
+#endif
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+/* lists with fewer items are written as usual */
+static const unsigned int MIN_PART_ITEMS = 64;
+
+/* parts per thread, so that threads given larger items are not waited for */
+static const unsigned int PARTS_PER_THREAD = 4;
+
+
+ListOfItemsWriter::~ListOfItemsWriter ()
+{
+}
+
+
+#ifdef LIBSBML_WRITE_CONCURRENTLY
+
+/*
+ * The items [begin, end) of a list, written to memory by a thread of its
+ * own.
+ */
+struct WrittenPart
+{
+  unsigned int            begin;
+  unsigned int            end;
+  char*                   text;
+  size_t                  offset;
+  size_t                  length;
+  XMLOutputStream::State  state;
+};
+
+
+/*
+ * Writes the items of the part to memory, starting from the given state
+ * of the stream, and records the state they leave the stream in.
+ */
+static void
+writePart (WrittenPart& part, const ListOf& list,
+           const XMLOutputStream::State& state, SBMLNamespaces* sbmlns,
+           const std::string* originalText)
+{
+  XMLMemorySink sink;
+
+  {
+    XMLOutputBuffer buffer(sink);
+    std::ostream    os(&buffer);
+
+    XMLOutputStream xos(os, "UTF-8", false);
+
+    // whatever the stream writes to start with is left out
+    os.flush();
+    part.offset = sink.getLength();
+
+    xos.setSBMLNamespaces(sbmlns);
+    xos.setOriginalText(originalText);
+    xos.setState(state);
+
+    for (unsigned int n = part.begin; n < part.end; ++n)
+    {
+      list.get(n)->write(xos);
+    }
+
+    part.state = xos.getState();
+    os.flush();
+  }
+
+  part.length = sink.getLength() - part.offset;
+  part.text   = sink.release();
+}
+
+#endif  /* LIBSBML_WRITE_CONCURRENTLY */
+
+
+ParallelListOfWriter::ParallelListOfWriter (unsigned int numThreads)
+  : mNumThreads (numThreads)
+{
+#ifdef LIBSBML_WRITE_CONCURRENTLY
+  if (mNumThreads == 0)
+  {
+    mNumThreads = std::thread::hardware_concurrency();
+  }
+#endif
+}
+
+
+ParallelListOfWriter::~ParallelListOfWriter ()
+{
+}
+
+
+/*
+ * Writes the items of the large lists of a model in parts, on several
+ * threads.
+ */
+bool
+ParallelListOfWriter::writeItems (const ListOf& list, XMLOutputStream& stream)
+{
+#ifdef LIBSBML_WRITE_CONCURRENTLY
+  const unsigned int numItems = list.size();
+
+  if (mNumThreads <= 1 || numItems < 1 + 2 * MIN_PART_ITEMS
+      || dynamic_cast<const Model*>(list.getParentSBMLObject()) == NULL)
+  {
+    return false;
+  }
+
+  unsigned int numParts = (numItems - 1) / MIN_PART_ITEMS;
+  if (numParts > PARTS_PER_THREAD * mNumThreads)
+  {
+    numParts = PARTS_PER_THREAD * mNumThreads;
+  }
+
+  /*
+   * The notes and annotations not read yet are read here, in the order
+   * they would be while writing, since their errors go to the document.
+   */
+  list.readDeferredElements(true);
+
+  /* the first item leaves the stream in the state the parts start from */
+  list.get(0)->write(stream);
+
+  const XMLOutputStream::State state = stream.getState();
+  SBMLNamespaces* sbmlns = stream.getSBMLNamespaces();
+  const std::string* originalText = stream.getOriginalText();
+
+  std::vector<WrittenPart> parts(numParts);
+  for (unsigned int p = 0; p < numParts; ++p)
+  {
+    parts[p].begin  = 1 + (unsigned int)((unsigned long long)(numItems - 1)
+                                         * p / numParts);
+    parts[p].end    = 1 + (unsigned int)((unsigned long long)(numItems - 1)
+                                         * (p + 1) / numParts);
+    parts[p].text   = NULL;
+    parts[p].offset = 0;
+    parts[p].length = 0;
+    parts[p].state  = state;
+  }
+
+  std::vector<std::exception_ptr> exceptions(numParts);
+  std::atomic<size_t> next(0);
+
+  auto work = [&]()
+  {
+    IdIndex::ReadOnlyScope readOnly;
+    for (size_t n = next++; n < parts.size(); n = next++)
+    {
+      try
+      {
+        writePart(parts[n], list, state, sbmlns, originalText);
+      }
+      catch (...)
+      {
+        exceptions[n] = std::current_exception();
+      }
+    }
+  };
+
+  /* this thread writes its share of the parts too */
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < mNumThreads && t < parts.size(); ++t)
+  {
+    try
+    {
+      threads.push_back(std::thread(work));
+    }
+    catch (const std::exception&)
+    {
+      break;
+    }
+  }
+  work();
+  for (size_t t = 0; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  std::exception_ptr failure;
+  for (size_t n = 0; n < exceptions.size() && !failure; ++n)
+  {
+    failure = exceptions[n];
+  }
+
+  try
+  {
+    for (size_t n = 0; n < parts.size() && !failure; ++n)
+    {
+      const WrittenPart& part = parts[n];
+
+      if (stream.getState() == state)
+      {
+        stream.writeFormatted(part.text + part.offset, part.length);
+        stream.setState(part.state);
+      }
+      else
+      {
+        for (unsigned int i = part.begin; i < part.end; ++i)
+        {
+          list.get(i)->write(stream);
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    failure = std::current_exception();
+  }
+
+  for (size_t n = 0; n < parts.size(); ++n)
+  {
+    free(parts[n].text);
+  }
+
+  if (failure)
+  {
+    std::rethrow_exception(failure);
+  }
+
+  return true;
+#else
+  (void)list;
+  (void)stream;
+  return false;
+#endif
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+/** @endcond */
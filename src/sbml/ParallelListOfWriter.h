@@ -0,0 +1,137 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ParallelListOfWriter.h
+ * @brief   Writes the items of the large lists of a model on several threads.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class ListOfItemsWriter
+ * @sbmlbrief{core} Writes the items of lists on behalf of
+ * ListOf::writeElements().
+ *
+ * A ListOfItemsWriter set on an XMLOutputStream is given a chance to write
+ * the items of each list written to the stream before
+ * ListOf::writeElements() does.
+ *
+ * @class ParallelListOfWriter
+ * @sbmlbrief{core} Writes the items of the large lists of a model on
+ * several threads.
+ *
+ * The items of the large lists of a model, the
+ * <code>&lt;listOf...&gt;</code> elements directly inside
+ * <code>&lt;model&gt;</code>, including those of packages, are cut into
+ * parts.  The first item of the list is written to the stream as usual;
+ * each part is then written by a thread of its own to a stream in memory,
+ * with the namespaces of the document and starting from the state the
+ * stream was left in by the first item, so that it is indented and
+ * formatted as it would have been if written there.  The parts are then
+ * copied to the stream in order.
+ *
+ * Writing an item leaves the stream in the state it was in before the
+ * item was written for everything libSBML writes.  Should a part not end
+ * in the state the next one was started from, the items of the next part
+ * are written again by the calling thread, so the output is always the
+ * same as when written by a single thread.
+ */
+
+#ifndef ParallelListOfWriter_h
+#define ParallelListOfWriter_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+
+#ifdef __cplusplus
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class ListOf;
+class XMLOutputStream;
+
+class LIBSBML_EXTERN ListOfItemsWriter
+{
+public:
+
+  virtual ~ListOfItemsWriter ();
+
+
+  /**
+   * Called by ListOf::writeElements() to write the items of @p list to
+   * @p stream, once the notes and annotation of the list are written.
+   *
+   * @return @c true if the items have been written, @c false to let
+   * ListOf::writeElements() write them.
+   */
+  virtual bool writeItems (const ListOf& list, XMLOutputStream& stream) = 0;
+};
+
+
+class LIBSBML_EXTERN ParallelListOfWriter : public ListOfItemsWriter
+{
+public:
+
+  /**
+   * Creates a writer using up to @p numThreads threads, or one per
+   * hardware thread if @p numThreads is @c 0.
+   */
+  ParallelListOfWriter (unsigned int numThreads);
+
+
+  virtual ~ParallelListOfWriter ();
+
+
+  virtual bool writeItems (const ListOf& list, XMLOutputStream& stream);
+
+
+protected:
+
+  unsigned int  mNumThreads;
+
+
+private:
+
+  ParallelListOfWriter (const ParallelListOfWriter&);
+  ParallelListOfWriter& operator= (const ParallelListOfWriter&);
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* ParallelListOfWriter_h */
+/** @endcond */
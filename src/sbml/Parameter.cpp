@@ -334,12 +334,14 @@ Parameter::isSetConstant () const
 int
 Parameter::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -352,6 +354,7 @@ Parameter::setId (const std::string& sid)
 int
 Parameter::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -363,6 +366,7 @@ Parameter::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -381,6 +385,7 @@ Parameter::setName (const std::string& name)
 int
 Parameter::setValue (double value)
 {
+  invalidateOriginalText();
   mValue      = value;
   mIsSetValue = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -393,6 +398,7 @@ Parameter::setValue (double value)
 int
 Parameter::setUnits (const std::string& units)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalUnitSId(units)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -411,6 +417,7 @@ Parameter::setUnits (const std::string& units)
 int
 Parameter::setConstant (bool flag)
 {
+  invalidateOriginalText();
   if ( getLevel() < 2 )
   {
     mConstant = flag;
@@ -432,8 +439,10 @@ Parameter::setConstant (bool flag)
 int
 Parameter::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -459,6 +468,7 @@ Parameter::unsetName ()
 int
 Parameter::unsetConstant ()
 {
+  invalidateOriginalText();
   if ( getLevel() < 2 )
   {
     mConstant = false;
@@ -491,6 +501,7 @@ Parameter::unsetConstant ()
 int
 Parameter::unsetValue ()
 {
+  invalidateOriginalText();
   mValue      = numeric_limits<double>::quiet_NaN();
   mIsSetValue = false;
   if (!isSetValue())
@@ -510,6 +521,7 @@ Parameter::unsetValue ()
 int
 Parameter::unsetUnits ()
 {
+  invalidateOriginalText();
   mUnits.erase();
 
   if (mUnits.empty()) 
@@ -980,6 +992,7 @@ bool Parameter::isExplicitlySetConstant() const
 void 
 Parameter::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (mUnits == oldid) mUnits= newid;
 }
@@ -1851,10 +1864,7 @@ ListOfParameters::get (const std::string& sid)
 const Parameter*
 ListOfParameters::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqP(sid) );
-  return (result == mItems.end()) ? NULL : static_cast <Parameter*> (*result);
+  return static_cast <const Parameter*> (getItemBySId(sid));
 }
 
 
@@ -1862,6 +1872,7 @@ ListOfParameters::get (const std::string& sid) const
 Parameter*
 ListOfParameters::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Parameter*>(ListOf::remove(n));
 }
 
@@ -1870,6 +1881,7 @@ ListOfParameters::remove (unsigned int n)
 Parameter*
 ListOfParameters::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1879,6 +1891,7 @@ ListOfParameters::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Parameter*> (item);
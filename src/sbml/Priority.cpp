@@ -188,6 +188,7 @@ Priority::isSetMath () const
 int
 Priority::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -278,6 +279,7 @@ int Priority::removeFromParentAndDelete()
 void
 Priority::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -287,6 +289,7 @@ Priority::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Priority::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -297,6 +300,7 @@ Priority::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Priority::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
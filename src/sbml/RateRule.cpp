@@ -425,6 +425,7 @@ RateRule::accept (SBMLVisitor& v) const
 void
 RateRule::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   Rule::renameSIdRefs(oldid, newid);
   if (isSetVariable()) {
     if (getVariable()==oldid) {
@@ -327,6 +327,7 @@ Reaction::getAllElements(ElementFilter *filter)
 void
 Reaction::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (mCompartment == oldid) {
     setCompartment(newid);
@@ -516,12 +517,14 @@ Reaction::isSetReversible () const
 int
 Reaction::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -534,6 +537,7 @@ Reaction::setId (const std::string& sid)
 int
 Reaction::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -545,6 +549,7 @@ Reaction::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -563,6 +568,7 @@ Reaction::setName (const std::string& name)
 int
 Reaction::setKineticLaw (const KineticLaw* kl)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(kl));
   
   if (returnValue == LIBSBML_OPERATION_FAILED && kl == NULL)
@@ -598,6 +604,7 @@ Reaction::setKineticLaw (const KineticLaw* kl)
 int
 Reaction::setReversible (bool value)
 {
+  invalidateOriginalText();
   mReversible = value;
   mIsSetReversible = true;
   mExplicitlySetReversible = true;
@@ -611,6 +618,7 @@ Reaction::setReversible (bool value)
 int
 Reaction::setFast (bool value)
 {
+  invalidateOriginalText();
   if (getLevel() == 3 && getVersion() > 1)
   {
     mFast = false;
@@ -634,6 +642,7 @@ Reaction::setFast (bool value)
 int
 Reaction::setCompartment (const std::string& sid)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -657,8 +666,10 @@ Reaction::setCompartment (const std::string& sid)
 int
 Reaction::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -687,6 +698,7 @@ Reaction::unsetName ()
 int
 Reaction::unsetKineticLaw ()
 {
+  invalidateOriginalText();
   delete mKineticLaw;
   mKineticLaw = NULL;
 
@@ -711,6 +723,7 @@ Reaction::unsetKineticLaw ()
 int
 Reaction::unsetFast ()
 {
+  invalidateOriginalText();
   mIsSetFast = false;
 
   if (getLevel() == 3 && getVersion() > 1)
@@ -735,6 +748,7 @@ Reaction::unsetFast ()
 int
 Reaction::unsetCompartment ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3) 
   {
     mCompartment.erase();
@@ -760,6 +774,7 @@ Reaction::unsetCompartment ()
 int
 Reaction::unsetReversible ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     // reset default
@@ -783,6 +798,7 @@ Reaction::unsetReversible ()
 int
 Reaction::addReactant (const SpeciesReference* sr)
 {
+  invalidateOriginalText();
   if (sr == NULL)
     return LIBSBML_OPERATION_FAILED;
 
@@ -839,6 +855,7 @@ int Reaction::addReactant(
 int
 Reaction::addProduct (const SpeciesReference* sr)
 {
+  invalidateOriginalText();
   if (sr == NULL)
     return LIBSBML_OPERATION_FAILED;
 
@@ -866,6 +883,7 @@ Reaction::addProduct(
     const std::string id,
     bool constant)
 {
+  invalidateOriginalText();
   if (species == NULL)
     return LIBSBML_INVALID_OBJECT;
 
@@ -899,6 +917,7 @@ Reaction::addProduct(
 int
 Reaction::addModifier (const ModifierSpeciesReference* msr)
 {
+  invalidateOriginalText();
   if (msr == NULL)
     return LIBSBML_OPERATION_FAILED;
 
@@ -924,6 +943,7 @@ Reaction::addModifier(
     const Species *species,
     const std::string id)
 {
+  invalidateOriginalText();
   if (species == NULL)
     return LIBSBML_INVALID_OBJECT;
 
@@ -953,6 +973,7 @@ Reaction::addModifier(
 SpeciesReference*
 Reaction::createReactant ()
 {
+  invalidateOriginalText();
   SpeciesReference* sr = NULL;
 
   try
@@ -982,6 +1003,7 @@ Reaction::createReactant ()
 SpeciesReference*
 Reaction::createProduct ()
 {
+  invalidateOriginalText();
   SpeciesReference* sr = NULL;
 
   try
@@ -1011,6 +1033,7 @@ Reaction::createProduct ()
 ModifierSpeciesReference*
 Reaction::createModifier ()
 {
+  invalidateOriginalText();
   ModifierSpeciesReference* sr = NULL;
 
   try
@@ -1040,6 +1063,7 @@ Reaction::createModifier ()
 KineticLaw*
 Reaction::createKineticLaw ()
 {
+  invalidateOriginalText();
   delete mKineticLaw;
   mKineticLaw = NULL;
 
@@ -1298,6 +1322,7 @@ Reaction::getNumModifiers () const
 SpeciesReference* 
 Reaction::removeReactant (unsigned int n)
 {
+  invalidateOriginalText();
   return static_cast<SpeciesReference*>(mReactants.remove(n));
 }
 
@@ -1309,6 +1334,7 @@ Reaction::removeReactant (unsigned int n)
 SpeciesReference* 
 Reaction::removeReactant (const std::string& species)
 {
+  invalidateOriginalText();
   unsigned int size = mReactants.size();
 
   for (unsigned int n = 0; n < size; ++n)
@@ -1328,6 +1354,7 @@ Reaction::removeReactant (const std::string& species)
 SpeciesReference* 
 Reaction::removeProduct (unsigned int n)
 {
+  invalidateOriginalText();
   return static_cast<SpeciesReference*>(mProducts.remove(n));
 }
 
@@ -1339,6 +1366,7 @@ Reaction::removeProduct (unsigned int n)
 SpeciesReference* 
 Reaction::removeProduct (const std::string& species)
 {
+  invalidateOriginalText();
   unsigned int size = mProducts.size();
 
   for (unsigned int n = 0; n < size; ++n)
@@ -1358,6 +1386,7 @@ Reaction::removeProduct (const std::string& species)
 ModifierSpeciesReference* 
 Reaction::removeModifier (unsigned int n)
 {
+  invalidateOriginalText();
   return static_cast<ModifierSpeciesReference*>(mModifiers.remove(n));
 }
 
@@ -1369,6 +1398,7 @@ Reaction::removeModifier (unsigned int n)
 ModifierSpeciesReference* 
 Reaction::removeModifier (const std::string& species)
 {
+  invalidateOriginalText();
   unsigned int size = mModifiers.size();
 
   for (unsigned int n = 0; n < size; ++n)
@@ -2534,10 +2564,7 @@ ListOfReactions::get (const std::string& sid)
 const Reaction*
 ListOfReactions::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEq<Reaction>(sid) );
-  return (result == mItems.end()) ? NULL : static_cast <Reaction*> (*result);
+  return static_cast <const Reaction*> (getItemBySId(sid));
 }
 
 
@@ -2545,6 +2572,7 @@ ListOfReactions::get (const std::string& sid) const
 Reaction*
 ListOfReactions::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Reaction*>(ListOf::remove(n));
 }
 
@@ -2553,6 +2581,7 @@ ListOfReactions::remove (unsigned int n)
 Reaction*
 ListOfReactions::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -2562,6 +2591,7 @@ ListOfReactions::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
 
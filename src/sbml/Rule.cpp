@@ -304,6 +304,7 @@ Rule::isSetUnits () const
 int
 Rule::setFormula (const std::string& formula)
 {
+  invalidateOriginalText();
   
   
   if (formula == "")
@@ -341,6 +342,7 @@ Rule::setFormula (const std::string& formula)
 int
 Rule::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -373,6 +375,7 @@ Rule::setMath (const ASTNode* math)
 int
 Rule::setVariable (const std::string& sid)
 {
+  invalidateOriginalText();
   if (isAlgebraic())
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -383,6 +386,7 @@ Rule::setVariable (const std::string& sid)
   }
   else
   {
+    invalidateIdIndexes();
     mVariable = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -396,6 +400,7 @@ Rule::setVariable (const std::string& sid)
 int
 Rule::setUnits (const std::string& sname)
 {
+  invalidateOriginalText();
   /* only in L1 ParameterRule */
   if (getLevel() > 1)
   {
@@ -423,11 +428,13 @@ Rule::setUnits (const std::string& sname)
 int
 Rule::unsetVariable ()
 {
+  invalidateOriginalText();
   if (isAlgebraic())
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
   }
 
+  invalidateIdIndexes();
   mVariable.erase();
 
   if (mVariable.empty()) 
@@ -447,6 +454,7 @@ Rule::unsetVariable ()
 int
 Rule::unsetUnits ()
 {
+  invalidateOriginalText();
   /* only in L1 Parameter rule */
   if (getLevel() > 1)
   {
@@ -843,6 +851,7 @@ Rule::hasRequiredElements() const
 void
 Rule::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -861,6 +870,7 @@ Rule::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Rule::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -880,6 +890,7 @@ Rule::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Rule::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -896,6 +907,7 @@ Rule::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 void 
 Rule::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mVariable == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_DIVIDE);
@@ -909,6 +921,7 @@ Rule::divideAssignmentsToSIdByFunction(const std::string& id, const ASTNode* fun
 void 
 Rule::multiplyAssignmentsToSIdByFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (mVariable == id && isSetMath()) {
     ASTNode* temp = mMath;
     mMath = new ASTNode(AST_TIMES);
@@ -1554,12 +1567,15 @@ Rule::writeAttributes (XMLOutputStream& stream) const
 int
 Rule::setL1TypeCode (int type)
 {
+  invalidateOriginalText();
   if (    (type == SBML_PARAMETER_RULE) 
        || (type == SBML_COMPARTMENT_VOLUME_RULE) 
        || (type == SBML_SPECIES_CONCENTRATION_RULE) 
      )
   {
+    unshareSBMLNamespaces();
     mSBMLNamespaces->setLevel(1);
+    shareSBMLNamespaces();
     mL1Type = type;
   }
   else
@@ -1673,6 +1689,7 @@ ListOfRules::get (const std::string& sid) const
 Rule*
 ListOfRules::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Rule*>(ListOf::remove(n));
 }
 
@@ -1695,6 +1712,7 @@ ListOfRules::getElementBySId(const std::string& id)
 Rule*
 ListOfRules::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1704,6 +1722,7 @@ ListOfRules::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Rule*> (item);
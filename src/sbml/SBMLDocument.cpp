@@ -71,6 +71,7 @@
 #include <sbml/conversion/SBMLConverterRegistry.h>
 
 #include <sbml/util/ElementFilter.h>
+#include <sbml/math/ASTNodeArena.h>
 
 /** @cond doxygenIgnored */
 using namespace std;
@@ -127,7 +128,13 @@ SBMLDocument::SBMLDocument (unsigned int level, unsigned int version) :
  , mLocationURI     ("")
  , mRequiredAttrOfUnknownPkg()
  , mRequiredAttrOfUnknownDisabledPkg()
+ , mMetaIdIndex (true)
+ , mASTNodeArena (NULL)
+ , mOriginalText (NULL)
 {
+  // the namespaces of a document are its own, as they may be changed
+  unshareSBMLNamespaces();
+
   if (mLevel   == 0 && mVersion == 0)  
   {
     mLevel   = getDefaultLevel  ();
@@ -161,7 +168,12 @@ SBMLDocument::SBMLDocument (SBMLNamespaces* sbmlns) :
  , mLocationURI ("")
  , mRequiredAttrOfUnknownPkg()
  , mRequiredAttrOfUnknownDisabledPkg()
+ , mMetaIdIndex (true)
+ , mASTNodeArena (NULL)
+ , mOriginalText (NULL)
 {
+  unshareSBMLNamespaces();
+
   if (!hasValidLevelVersionNamespaceCombination())
   {
     throw SBMLConstructorException(SBMLDocument::getElementName(), sbmlns);
@@ -237,6 +249,12 @@ SBMLDocument::~SBMLDocument ()
   if (mModel != NULL)
     delete mModel;
   clearValidators();
+
+  // the arena frees itself once any nodes still in use are gone
+  if (mASTNodeArena != NULL)
+    mASTNodeArena->detach();
+
+  delete mOriginalText;
 }
 
 
@@ -255,8 +273,11 @@ SBMLDocument::SBMLDocument (const SBMLDocument& orig)
  , mRequiredAttrOfUnknownPkg(orig.mRequiredAttrOfUnknownPkg)
  , mRequiredAttrOfUnknownDisabledPkg(orig.mRequiredAttrOfUnknownDisabledPkg)
  , mPkgUseDefaultNSMap()
+ , mMetaIdIndex (orig.mMetaIdIndex)
+ , mASTNodeArena (NULL)
+ , mOriginalText (NULL)
 {
-  
+  unshareSBMLNamespaces();
   
   SBMLDocument::setSBMLDocument(this);
   
@@ -282,7 +303,9 @@ SBMLDocument& SBMLDocument::operator=(const SBMLDocument& rhs)
   if(&rhs!=this)
   {
     this->SBase::operator =(rhs);
+    unshareSBMLNamespaces();
     setSBMLDocument(this);
+    discardOriginalText();
 
     mLevel                             = rhs.mLevel;
     mVersion                           = rhs.mVersion;
@@ -415,13 +438,167 @@ SBase*
 SBMLDocument::getElementByMetaId(const std::string& metaid)
 {
   if (metaid.empty()) return NULL;
-  if (getMetaId()==metaid) return this;
-  if (mModel != NULL) {
-    if (mModel->getMetaId() == metaid) return mModel;
-    SBase * obj = mModel->getElementByMetaId(metaid);
-    if (obj != NULL) return obj;
+
+  SBase* obj = getIndexedElementByMetaId(metaid, this);
+  if (obj != NULL) return obj;
+
+  if (getMetaId()==metaid) 
+  {
+    obj = this;
+  }
+  else if (mModel != NULL && mModel->getMetaId() == metaid) 
+  {
+    obj = mModel;
+  }
+  else
+  {
+    if (mModel != NULL) 
+    {
+      obj = mModel->getElementByMetaId(metaid);
+    }
+    if (obj == NULL) 
+    {
+      obj = getElementFromPluginsByMetaId(metaid);
+    }
   }
-  return getElementFromPluginsByMetaId(metaid);
+
+  indexMetaId(metaid, obj, this);
+  return obj;
+}
+
+
+/** @cond doxygenLibsbmlInternal */
+SBase*
+SBMLDocument::getIndexedElementByMetaId(const std::string& metaid, 
+                                        const SBase* scope)
+{
+  if (!mMetaIdIndex.isValid())
+  {
+    if (!mMetaIdIndex.isWorthRebuilding()) return NULL;
+    rebuildMetaIdIndex();
+  }
+
+  SBase* obj = mMetaIdIndex.getHolder(metaid);
+  if (obj == NULL) return NULL;
+
+  if (obj->getMetaId() != metaid)
+  {
+    // the metaid of the element was changed without telling the index
+    mMetaIdIndex.erase(metaid, obj);
+    return NULL;
+  }
+
+  // the index covers the whole document, which may hold elements
+  // (such as those of comp ModelDefinitions) outside of scope
+  for (SBase* ancestor = obj; ancestor != NULL; 
+       ancestor = ancestor->getParentSBMLObject())
+  {
+    if (ancestor == scope) return obj;
+  }
+  return NULL;
+}
+
+
+void
+SBMLDocument::indexMetaId(const std::string& metaid, SBase* element, 
+                          const SBase* scope)
+{
+  // only a search from the document or its model is known to have found
+  // an element that is still part of this document
+  if (element != NULL && (scope == this || scope == mModel))
+  {
+    mMetaIdIndex.insert(metaid, element);
+  }
+}
+
+
+void
+SBMLDocument::unindexMetaId(const std::string& metaid, const SBase* element)
+{
+  mMetaIdIndex.erase(metaid, element);
+}
+
+
+const IdIndex&
+SBMLDocument::rebuildMetaIdIndex()
+{
+  mMetaIdIndex.reset();
+  mMetaIdIndex.addElements(this);
+  return mMetaIdIndex;
+}
+
+
+void
+SBMLDocument::buildIdIndexes()
+{
+  if (!mMetaIdIndex.isValid())
+  {
+    rebuildMetaIdIndex();
+  }
+
+  if (mModel != NULL)
+  {
+    mModel->buildIdIndex();
+  }
+
+  List* elements = getAllElements();
+  for (ListIterator it = elements->begin(); it != elements->end(); ++it)
+  {
+    const SBase* element = static_cast<const SBase*>(*it);
+    if (element->getTypeCode() == SBML_LIST_OF)
+    {
+      static_cast<const ListOf*>(element)->buildIdIndex();
+    }
+  }
+  delete elements;
+}
+
+
+ASTNodeArena*
+SBMLDocument::getASTNodeArena()
+{
+#ifdef LIBSBML_USE_AST_NODE_ARENA
+  if (mASTNodeArena == NULL)
+  {
+    mASTNodeArena = new ASTNodeArena();
+  }
+#endif
+
+  return mASTNodeArena;
+}
+
+
+void
+SBMLDocument::setOriginalText (std::string* text)
+{
+  delete mOriginalText;
+  mOriginalText = text;
+}
+
+
+const std::string*
+SBMLDocument::getOriginalText () const
+{
+  return mOriginalText;
+}
+/** @endcond */
+
+
+/*
+ * Frees the text this document was read from.
+ */
+void
+SBMLDocument::discardOriginalText ()
+{
+  delete mOriginalText;
+  mOriginalText = NULL;
+}
+
+
+bool
+SBMLDocument::isSetOriginalText () const
+{
+  return mOriginalText != NULL;
 }
 
 List*
@@ -522,6 +699,7 @@ bool
 SBMLDocument::setLevelAndVersion (unsigned int level, unsigned int version,
                                   bool strict, bool ignorePackages)
 {
+  invalidateOriginalText();
   SBMLNamespaces sbmlns(level, version);
   ConversionProperties prop(&sbmlns);
   prop.addOption("strict", strict, "should validity be preserved");
@@ -578,6 +756,7 @@ SBMLDocument::updateSBMLNamespace(const std::string& package, unsigned int level
 int
 SBMLDocument::setModel (const Model* m)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(m));
   
   if (returnValue == LIBSBML_OPERATION_FAILED && m == NULL)
@@ -622,6 +801,7 @@ SBMLDocument::setModel (const Model* m)
 Model*
 SBMLDocument::createModel (const std::string sid)
 {
+  invalidateOriginalText();
   if (mModel != NULL) delete mModel;
   mModel = NULL;
 
@@ -1216,6 +1396,9 @@ int SBMLDocument::convert(const ConversionProperties& props)
 
   if (converter == NULL) return LIBSBML_CONV_CONVERSION_NOT_AVAILABLE;
 
+  // what is converted can no longer be written as it was read
+  discardOriginalText();
+
   converter->setDocument(this);
   converter->setProperties(&props);
   int result = converter->convert();
@@ -1346,6 +1529,7 @@ SBMLDocument::getErrorLog () const
 int
 SBMLDocument::enableDefaultNS(const std::string& package, bool flag)
 {
+  invalidateOriginalText();
   std::string pkgURI = "";
   for (size_t i=0; i < mPlugins.size(); i++)
   {
@@ -1403,6 +1587,7 @@ SBMLDocument::isEnabledDefaultNS(const std::string& package)
 int
 SBMLDocument::setPackageRequired(const std::string& package, bool flag)
 {
+  invalidateOriginalText();
   for (size_t i=0; i < mPlugins.size(); i++)
   {
     std::string uri = mPlugins[i]->getURI();
@@ -1442,6 +1627,7 @@ int
 SBMLDocument::addUnknownPackageRequired(const std::string& pkgURI,
                                 const std::string& prefix, bool flag)
 {
+  invalidateOriginalText();
   std::string value = (flag) ? "true" : "false";
 
   return mRequiredAttrOfUnknownPkg.add("required", value, pkgURI, prefix);
@@ -1452,6 +1638,7 @@ SBMLDocument::addUnknownPackageRequired(const std::string& pkgURI,
 int
 SBMLDocument::setPkgRequired(const std::string& package, bool flag)
 {
+  invalidateOriginalText();
   return setPackageRequired(package,flag);
 }
 
@@ -305,6 +305,7 @@
 #include <sbml/SBMLErrorLog.h>
 #include <sbml/SBase.h>
 #include <sbml/SBMLTransforms.h>
+#include <sbml/util/IdIndex.h>
 
 
 #ifdef __cplusplus
@@ -323,6 +324,7 @@ class XMLError;
 class SBMLValidator;
 class SBMLInternalValidator;
 class SBMLLevelVersionConverter;
+class ASTNodeArena;
 
 /** @cond doxygenLibsbmlInternal */
 /* Internal constants for setting/unsetting particular consistency checks. */
@@ -697,6 +699,28 @@ public:
                            bool strict = true, bool ignorePackages = false);
 
 
+  /**
+   * Frees the original text of this document, kept when it was read by
+   * an SBMLReader set to keep it (see SBMLReader::setKeepOriginalText()).
+   * The parts of the document that have not been changed since are then
+   * written from the objects they were read into, like the rest.
+   *
+   * The original text is discarded by any conversion of the document,
+   * including setLevelAndVersion().
+   */
+  void discardOriginalText ();
+
+
+  /**
+   * Returns @c true if this document keeps the text it was read from
+   * (see SBMLReader::setKeepOriginalText()).
+   *
+   * @return @c true if the original text of this document is kept,
+   * @c false otherwise.
+   */
+  bool isSetOriginalText () const;
+
+
   /** @cond doxygenLibsbmlInternal */
   /**
    * @param package.
@@ -1642,6 +1666,73 @@ public:
 
   /** @endcond */
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Looks @p metaid up in the index of the metaids of this document,
+   * rebuilding the index when worthwhile, and returns the element found
+   * if it lies within @p scope.
+   *
+   * A @c NULL return value does not mean there is no such element: the
+   * index may not be up to date, or not include it, and the caller must
+   * then search for it.
+   */
+  SBase* getIndexedElementByMetaId (const std::string& metaid,
+                                    const SBase* scope);
+
+
+  /**
+   * Records that a search from @p scope found @p element with the given
+   * @p metaid, so that the next lookup can answer from the index.
+   */
+  void indexMetaId (const std::string& metaid, SBase* element,
+                    const SBase* scope);
+
+
+  /**
+   * Removes @p metaid from the index of the metaids of this document if
+   * it refers to @p element; called before @p element changes its metaid.
+   */
+  void unindexMetaId (const std::string& metaid, const SBase* element);
+
+
+  /**
+   * Rebuilds the index of the metaids of this document from scratch, and
+   * returns it.  IdIndex::getDuplicates() then lists the elements whose
+   * metaid is already used by an element before them in the document.
+   */
+  const IdIndex& rebuildMetaIdIndex ();
+
+
+  /**
+   * Brings the index of the metaids of this document, and the indexes of
+   * the SIds of its Model and ListOf objects, up to date.  Lookups made
+   * from an IdIndex::ReadOnlyScope then need not search the document.
+   */
+  void buildIdIndexes ();
+
+
+  /**
+   * Returns the arena from which the ASTNode objects of this document are
+   * allocated while it is read, creating it if necessary, or @c NULL if
+   * libSBML was built without @c WITH_AST_NODE_ARENA.
+   */
+  ASTNodeArena* getASTNodeArena ();
+
+
+  /**
+   * Sets the text this document was read from, which it takes ownership
+   * of, so that the objects unchanged since they were read are written as
+   * they were (see SBMLReader::setKeepOriginalText()).
+   */
+  void setOriginalText (std::string* text);
+
+
+  /**
+   * Returns the text set with setOriginalText(), or @c NULL.
+   */
+  const std::string* getOriginalText () const;
+  /** @endcond */
+
   /** @cond doxygenLibsbmlInternal */
   int addUnknownPackageRequired(const std::string& pkgURI,
                                 const std::string& prefix, bool flag);
@@ -1732,6 +1823,12 @@ protected:
 
   PkgUseDefaultNSMap       mPkgUseDefaultNSMap;
 
+  IdIndex                  mMetaIdIndex;
+
+  ASTNodeArena*            mASTNodeArena;
+
+  std::string*             mOriginalText;
+
   friend class SBase;
   friend class SBMLReader;
   friend class SBMLLevelVersionConverter;
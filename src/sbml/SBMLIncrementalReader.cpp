@@ -0,0 +1,241 @@
+/**
+ * @file    SBMLIncrementalReader.cpp
+ * @brief   Reads an SBML document from content given to it in chunks
+ *
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ */
+
+#include <sbml/SBMLIncrementalReader.h>
+#include <sbml/SBMLDocument.h>
+#include <sbml/xml/XMLChunkBuffer.h>
+
+#if defined(LIBSBML_WITH_PARALLEL_READING) && \
+    ((__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900))
+#define LIBSBML_READ_CONCURRENTLY 1
+#include <exception>
+#include <thread>
+#endif
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * The number of bytes added and not yet read after which addChunk() waits
+ * for the reading thread to catch up.
+ */
+static const size_t MAX_BUFFERED = 4 * 1024 * 1024;
+
+
+#ifdef LIBSBML_READ_CONCURRENTLY
+struct SBMLIncrementalReader::Thread
+{
+  std::thread         thread;
+  std::exception_ptr  exception;
+};
+#else
+struct SBMLIncrementalReader::Thread
+{
+};
+#endif
+
+/** @endcond */
+
+
+/*
+ * Creates a new SBMLIncrementalReader with the default settings.
+ */
+SBMLIncrementalReader::SBMLIncrementalReader ()
+  : mReader   ()
+  , mBuffer   (NULL)
+  , mDocument (NULL)
+  , mThread   (NULL)
+  , mFinished (false)
+{
+}
+
+
+/*
+ * Creates a new SBMLIncrementalReader with the settings of reader.
+ */
+SBMLIncrementalReader::SBMLIncrementalReader (const SBMLReader& reader)
+  : mReader   (reader)
+  , mBuffer   (NULL)
+  , mDocument (NULL)
+  , mThread   (NULL)
+  , mFinished (false)
+{
+}
+
+
+/*
+ * Destroys this SBMLIncrementalReader.
+ */
+SBMLIncrementalReader::~SBMLIncrementalReader ()
+{
+#ifdef LIBSBML_READ_CONCURRENTLY
+  if (mThread != NULL)
+  {
+    // the reading thread is stopped by the end of the content
+    mBuffer->close();
+    mThread->thread.join();
+  }
+#endif
+
+  delete mThread;
+  delete mBuffer;
+  delete mDocument;
+}
+
+
+/*
+ * Adds the next chunk of the content of the document.
+ */
+int
+SBMLIncrementalReader::addChunk (const char* data, size_t length)
+{
+  if (mFinished) return LIBSBML_OPERATION_FAILED;
+
+  if (mBuffer == NULL)
+  {
+#ifdef LIBSBML_READ_CONCURRENTLY
+    if (mReader.getNumThreads() != 1)
+    {
+      mBuffer = new XMLChunkBuffer(MAX_BUFFERED);
+      startThread();
+    }
+#endif
+    if (mBuffer == NULL)
+    {
+      mBuffer = new XMLChunkBuffer();
+    }
+  }
+
+  // once the reading thread has stopped, at an error, the rest of the
+  // content is not needed anymore
+  mBuffer->append(data, length);
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Tells this SBMLIncrementalReader that all the content has been added,
+ * and returns the document read.
+ */
+SBMLDocument*
+SBMLIncrementalReader::finish ()
+{
+  if (mFinished) return NULL;
+  mFinished = true;
+
+  if (mBuffer == NULL)
+  {
+    mBuffer = new XMLChunkBuffer();
+  }
+  mBuffer->close();
+
+#ifdef LIBSBML_READ_CONCURRENTLY
+  if (mThread != NULL)
+  {
+    mThread->thread.join();
+
+    std::exception_ptr exception = mThread->exception;
+    delete mThread;
+    mThread = NULL;
+
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+  else
+#endif
+  {
+    mDocument = mReader.readFromBuffer(*mBuffer);
+  }
+
+  delete mBuffer;
+  mBuffer = NULL;
+
+  SBMLDocument* d = mDocument;
+  mDocument = NULL;
+
+  return d;
+}
+
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Starts reading the document on a thread of its own, as the chunks are
+ * added to mBuffer.
+ */
+void
+SBMLIncrementalReader::startThread ()
+{
+#ifdef LIBSBML_READ_CONCURRENTLY
+  mThread = new Thread();
+  mThread->thread = std::thread([this]()
+  {
+    try
+    {
+      mDocument = mReader.readFromBuffer(*mBuffer);
+    }
+    catch (...)
+    {
+      mThread->exception = std::current_exception();
+    }
+
+    // addChunk() must not wait for a thread that reads no more
+    mBuffer->abandon();
+  });
+#endif
+}
+/** @endcond */
+
+
+#endif  /* __cplusplus */
+
+LIBSBML_CPP_NAMESPACE_END
@@ -0,0 +1,190 @@
+/**
+ * @file    SBMLIncrementalReader.h
+ * @brief   Reads an SBML document from content given to it in chunks
+ *
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class SBMLIncrementalReader
+ * @sbmlbrief{core} Reads an SBML document from content given to it in
+ * chunks.
+ *
+ * @htmlinclude not-sbml-warning.html
+ *
+ * SBMLReader reads documents from files and strings, which must be
+ * complete before reading starts.  SBMLIncrementalReader reads a document
+ * whose content arrives a piece at a time, such as from a network
+ * connection or a pipe, without the whole of it ever being held in
+ * memory: each chunk is given to addChunk() as it arrives, and finish()
+ * returns the SBMLDocument once the last one has been given.
+ *
+ * @code{.cpp}
+ * SBMLIncrementalReader reader;
+ * char buffer[65536];
+ * size_t length;
+ * while ((length = fread(buffer, 1, sizeof(buffer), stdin)) > 0)
+ * {
+ *   reader.addChunk(buffer, length);
+ * }
+ * SBMLDocument* d = reader.finish();
+ * @endcode
+ *
+ * The document is read as SBMLReader::readSBMLFromString() would read the
+ * concatenation of the chunks, with the settings of the SBMLReader given
+ * to the constructor, except that the content is not prepended with an
+ * XML declaration if it has none, and that notes and annotations are
+ * always read with the document and large lists with a single thread.
+ *
+ * When libSBML is built with the option <code>WITH_PARALLEL_READING</code>
+ * and the SBMLReader reads with more than one thread (see
+ * SBMLReader::setNumThreads()), the document is read by a thread of its
+ * own while the chunks are added: addChunk() returns as soon as the chunk
+ * has been copied, and waits only when several megabytes are waiting to
+ * be read.  Otherwise, the chunks are kept until finish() is called, and
+ * freed as they are read.
+ */
+
+#ifndef SBMLIncrementalReader_h
+#define SBMLIncrementalReader_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+#include <sbml/SBMLReader.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class SBMLDocument;
+class XMLChunkBuffer;
+
+
+class LIBSBML_EXTERN SBMLIncrementalReader
+{
+public:
+
+  /**
+   * Creates a new SBMLIncrementalReader, reading a document with the
+   * default settings of SBMLReader.
+   */
+  SBMLIncrementalReader ();
+
+
+  /**
+   * Creates a new SBMLIncrementalReader, reading a document with the
+   * settings of @p reader, such as its number of threads and the elements
+   * it leaves out.
+   *
+   * @param reader the SBMLReader whose settings are used.
+   */
+  SBMLIncrementalReader (const SBMLReader& reader);
+
+
+  /**
+   * Destroys this SBMLIncrementalReader, and the document read unless it
+   * has been returned by finish().
+   */
+  virtual ~SBMLIncrementalReader ();
+
+
+  /**
+   * Adds the next @p length bytes of the content of the document.
+   *
+   * The bytes are copied, so @p data can be reused as soon as this method
+   * returns.  Chunks can be cut anywhere, even inside a tag or a UTF-8
+   * character.
+   *
+   * @param data the bytes to add.
+   * @param length the number of bytes at @p data.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   * if finish() has been called already.
+   */
+  int addChunk (const char* data, size_t length);
+
+
+  /**
+   * Tells this SBMLIncrementalReader that all the content has been added,
+   * and returns the document read.
+   *
+   * Errors are logged in the document as SBMLReader logs them; a document
+   * that ends early is reported as badly formed XML.  The caller owns the
+   * document returned.
+   *
+   * @return the SBMLDocument read, or @c NULL if finish() has been called
+   * already.
+   */
+  SBMLDocument* finish ();
+
+
+protected:
+  /** @cond doxygenLibsbmlInternal */
+
+  void startThread ();
+
+
+  struct Thread;
+
+  SBMLReader       mReader;
+  XMLChunkBuffer*  mBuffer;
+  SBMLDocument*    mDocument;
+  Thread*          mThread;
+  bool             mFinished;
+
+  /** @endcond */
+
+
+private:
+  /** @cond doxygenLibsbmlInternal */
+
+  SBMLIncrementalReader (const SBMLIncrementalReader&);
+  SBMLIncrementalReader& operator= (const SBMLIncrementalReader&);
+
+  /** @endcond */
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* SBMLIncrementalReader_h */
@@ -43,9 +43,17 @@
 #include <sbml/SBMLNamespaces.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBMLExtensionException.h>
+#include <sbml/extension/ISBMLExtensionNamespaces.h>
 #include <sstream>
 #include <sbml/common/common.h>
 #include <iostream>
+#include <typeinfo>
+#include <vector>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <mutex>
+#define LIBSBML_SHARED_NAMESPACES_LOCKED
+#endif
 
 /** @cond doxygenIgnored */
 using namespace std;
@@ -119,6 +127,8 @@ SBMLNamespaces::initSBMLNamespace()
 SBMLNamespaces::SBMLNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mNumShares(0)
+  ,mIsShared(false)
 {
   initSBMLNamespace();
 }
@@ -137,6 +147,8 @@ SBMLNamespaces::SBMLNamespaces(unsigned int level, unsigned int version,
                                const std::string pkgPrefix)
  : mLevel(level)
   ,mVersion(version)
+  ,mNumShares(0)
+  ,mIsShared(false)
 {
   initSBMLNamespace();
 
@@ -187,6 +199,8 @@ SBMLNamespaces::SBMLNamespaces(const SBMLNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mNumShares(0)
+ , mIsShared(false)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -255,6 +269,143 @@ SBMLNamespaces::clone () const
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * The shared SBMLNamespaces, of which there are only as many as different
+ * namespaces are in use.  These are plain pointers so that they can be
+ * shared by the constructors of static objects.
+ */
+static std::vector<SBMLNamespaces*>* sShared = NULL;
+
+#ifdef LIBSBML_SHARED_NAMESPACES_LOCKED
+static std::mutex sSharedMutex;
+#define SHARED_NAMESPACES_LOCK std::lock_guard<std::mutex> lock(sSharedMutex)
+#else
+#define SHARED_NAMESPACES_LOCK
+#endif
+
+
+/*
+ * @return true if lhs and rhs are of the same class and have the same
+ * level, version, package and namespaces.
+ */
+static bool
+isSameNamespaces (const SBMLNamespaces& lhs, const SBMLNamespaces& rhs)
+{
+  if (typeid(lhs) != typeid(rhs)
+      || lhs.getLevel() != rhs.getLevel()
+      || lhs.getVersion() != rhs.getVersion())
+  {
+    return false;
+  }
+
+  const ISBMLExtensionNamespaces* lhsExt =
+    dynamic_cast<const ISBMLExtensionNamespaces*>(&lhs);
+  if (lhsExt != NULL)
+  {
+    const ISBMLExtensionNamespaces* rhsExt =
+      static_cast<const ISBMLExtensionNamespaces*>(&rhs);
+    if (lhsExt->getPackageVersion() != rhsExt->getPackageVersion()
+        || lhsExt->getPackageName() != rhsExt->getPackageName())
+    {
+      return false;
+    }
+  }
+
+  const XMLNamespaces* lhsNS = lhs.getNamespaces();
+  const XMLNamespaces* rhsNS = rhs.getNamespaces();
+  if (lhsNS == NULL || rhsNS == NULL)
+    return lhsNS == rhsNS;
+
+  return lhsNS->isIdentical(*rhsNS);
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::share (const SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return NULL;
+
+  SHARED_NAMESPACES_LOCK;
+
+  SBMLNamespaces* shared = NULL;
+
+  if (sbmlns->mIsShared)
+  {
+    shared = const_cast<SBMLNamespaces*>(sbmlns);
+  }
+  else
+  {
+    if (sShared == NULL)
+      sShared = new std::vector<SBMLNamespaces*>();
+
+    for (size_t n = 0; n < sShared->size() && shared == NULL; ++n)
+    {
+      if (isSameNamespaces(*(*sShared)[n], *sbmlns))
+        shared = (*sShared)[n];
+    }
+
+    if (shared == NULL)
+    {
+      shared = sbmlns->clone();
+      shared->mIsShared = true;
+      sShared->push_back(shared);
+    }
+  }
+
+  ++shared->mNumShares;
+  return shared;
+}
+
+
+void
+SBMLNamespaces::release (SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return;
+
+  // mIsShared does not change once the namespaces are shared
+  if (!sbmlns->mIsShared)
+  {
+    delete sbmlns;
+    return;
+  }
+
+  SHARED_NAMESPACES_LOCK;
+
+  if (--sbmlns->mNumShares > 0) return;
+
+  for (size_t n = 0; n < sShared->size(); ++n)
+  {
+    if ((*sShared)[n] == sbmlns)
+    {
+      (*sShared)[n] = sShared->back();
+      sShared->pop_back();
+      break;
+    }
+  }
+
+  if (sShared->empty())
+  {
+    delete sShared;
+    sShared = NULL;
+  }
+
+  delete sbmlns;
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::unshare (SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL || !sbmlns->mIsShared) return sbmlns;
+
+  SBMLNamespaces* copy = sbmlns->clone();
+  release(sbmlns);
+  return copy;
+}
+/** @endcond */
+
+
 std::string 
 SBMLNamespaces::getSBMLNamespaceURI(unsigned int level,
                                  unsigned int version)
@@ -615,6 +615,36 @@ else
   void setNamespaces(XMLNamespaces * xmlns);
   /** @endcond */
 
+
+#ifndef SWIG
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Returns an SBMLNamespaces equal to @p sbmlns, of the same class and
+   * with the same namespaces in the same order, that is shared by all who
+   * asked for one equal to it.  It must not be changed, and must be given
+   * back with release() instead of being deleted.
+   *
+   * This lets the objects of a model share one copy of the namespaces of
+   * the document instead of each having its own.
+   */
+  static SBMLNamespaces* share(const SBMLNamespaces* sbmlns);
+
+
+  /**
+   * Gives back @p sbmlns, which is deleted if it is not shared or if this
+   * was its last share.
+   */
+  static void release(SBMLNamespaces* sbmlns);
+
+
+  /**
+   * Returns @p sbmlns if it is not shared, or else gives it back and
+   * returns a copy of it that is not, which may be changed.
+   */
+  static SBMLNamespaces* unshare(SBMLNamespaces* sbmlns);
+  /** @endcond */
+#endif
+
   /**
    * Returns the name of the main package for this namespace.
    *
@@ -632,6 +662,10 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  /* the number of shares of a shared SBMLNamespaces, counted by share() */
+  unsigned int    mNumShares;
+  bool            mIsShared;
+
   /** @endcond */
 };
 
@@ -39,6 +39,8 @@
  * and also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <climits>
+
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLInputStream.h>
@@ -49,6 +51,14 @@
 #include <sbml/SBMLError.h>
 #include <sbml/Model.h>
 #include <sbml/SBMLReader.h>
+#include <sbml/math/ASTNodeArena.h>
+#include <sbml/ParallelListOfReader.h>
+#include <sbml/DeferredElementReader.h>
+#include <sbml/util/CallbackRegistry.h>
+#include <sbml/extension/SBMLExtensionRegistry.h>
+#include <sbml/xml/XMLElementFilter.h>
+#include <sbml/xml/XMLElementSpans.h>
+#include <sbml/xml/XMLMappedFileBuffer.h>
 
 #include <sbml/compress/CompressCommon.h>
 #include <sbml/compress/InputDecompressor.h>
@@ -64,6 +74,9 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  * Creates a new SBMLReader and returns it. 
  */
 SBMLReader::SBMLReader ()
+  : mNumThreads (1)
+  , mLazyNotesAndAnnotations (false)
+  , mKeepOriginalText (false)
 {
 }
 
@@ -159,6 +172,111 @@ SBMLReader::readSBMLFromString (const std::string& xml)
 }
 
 
+/*
+ * Sets the number of threads used to read large documents.
+ */
+void
+SBMLReader::setNumThreads (unsigned int numThreads)
+{
+  mNumThreads = numThreads;
+}
+
+
+/*
+ * @return the number of threads used to read large documents.
+ */
+unsigned int
+SBMLReader::getNumThreads () const
+{
+  return mNumThreads;
+}
+
+
+/*
+ * Sets whether notes and annotations are read when first used.
+ */
+void
+SBMLReader::setReadNotesAndAnnotationsLazily (bool lazily)
+{
+  mLazyNotesAndAnnotations = lazily;
+}
+
+
+/*
+ * @return true if notes and annotations are read when first used.
+ */
+bool
+SBMLReader::getReadNotesAndAnnotationsLazily () const
+{
+  return mLazyNotesAndAnnotations;
+}
+
+
+/*
+ * Sets whether the documents read keep the text they were read from.
+ */
+void
+SBMLReader::setKeepOriginalText (bool keep)
+{
+  mKeepOriginalText = keep;
+}
+
+
+/*
+ * @return true if the documents read keep the text they were read from.
+ */
+bool
+SBMLReader::getKeepOriginalText () const
+{
+  return mKeepOriginalText;
+}
+
+
+/*
+ * Leaves the elements named name out of the documents read.
+ */
+void
+SBMLReader::addSkippedElement (const std::string& name)
+{
+  mSkippedElements.push_back(name);
+}
+
+
+/*
+ * Leaves the elements of a package out of the documents read.
+ */
+void
+SBMLReader::addSkippedPackage (const std::string& package)
+{
+  SBMLExtension* ext =
+    SBMLExtensionRegistry::getInstance().getExtension(package);
+
+  if (ext == NULL)
+  {
+    mSkippedNamespaces.push_back(package);
+    return;
+  }
+
+  for (unsigned int n = 0; n < ext->getNumOfSupportedPackageURI(); ++n)
+  {
+    mSkippedNamespaces.push_back(ext->getSupportedPackageURI(n));
+  }
+
+  delete ext;
+}
+
+
+/*
+ * Reads the documents whole again.
+ */
+void
+SBMLReader::clearSkippedElements ()
+{
+  mSkippedElements.clear();
+  mSkippedNamespaces.clear();
+}
+
+
 /*
  * Predicate returning @c true if
  * libSBML is linked with zlib.
@@ -249,125 +367,328 @@ void sortReportedErrors(SBMLDocument* d)
 /** @endcond */
 
 /** @cond doxygenLibsbmlInternal */
-
 /*
- * Used by readSBML() and readSBMLFromString().
+ * Adds the elements asked to be left out to filter; the names are those
+ * of elements in any of the namespaces of SBML.
  */
-SBMLDocument*
-SBMLReader::readInternal (const char* content, bool isFile)
+static void
+addSkippedElements(XMLElementFilter& filter,
+                   const vector<string>& elements,
+                   const vector<string>& namespaces)
 {
-  SBMLDocument* d = new SBMLDocument();
-  if (isFile) {
-    d->setLocationURI(string("file:") + content);
-  }
-
-  if (isFile && content != NULL && (util_file_exists(content) == false))
+  for (size_t n = 0; n < elements.size(); ++n)
   {
-    d->getErrorLog()->logError(XMLFileUnreadable);
+    filter.addElement(elements[n], "http://www.sbml.org/sbml/");
   }
-  else 
+  for (size_t n = 0; n < namespaces.size(); ++n)
   {
-    XMLInputStream stream(content, isFile, "", d->getErrorLog());
+    filter.addNamespace(namespaces[n]);
+  }
+}
 
-    if (stream.peek().isStart())
+
+/*
+ * Checks that the document read from stream starts with an sbml element.
+ *
+ * @return false if it does not, in which case d has been given the errors
+ * to report and is not to be read.
+ */
+bool
+SBMLReader::startReading (SBMLDocument* d, XMLInputStream& stream)
+{
+  if (stream.peek().isStart())
+  {
+    // so we have got an xml based document
+    //check that it is an sbml element
+    if (stream.peek().getName() != "sbml")
     {
-      // so we have got an xml based document
-      //check that it is an sbml element
-      if (stream.peek().getName() != "sbml")
-      {
-        // the root element ought to be an sbml element. 
-        d->getErrorLog()->logError(NotSchemaConformant);
+      // the root element ought to be an sbml element. 
+      d->getErrorLog()->logError(NotSchemaConformant);
 
-        d->setInvalidLevel();
+      d->setInvalidLevel();
 
-        return d;
-      }
+      return false;
     }
-    else
+  }
+  else
+  {
+    if (stream.isError())
     {
-      if (stream.isError())
-      {
-        sortReportedErrors(d);    
-      }
-      d->setInvalidLevel();
-
-      return d;
+      sortReportedErrors(d);    
     }
+    d->setInvalidLevel();
 
-    d->read(stream);
+    return false;
+  }
 
-    if (stream.isError())
+  return true;
+}
+
+
+/*
+ * Logs the errors found once d has been read from stream.
+ */
+static void
+finishReading(SBMLDocument* d, XMLInputStream& stream)
+{
+  if (stream.isError())
+  {
+    // If we encountered an error, some parsers will report it sooner
+    // than others.  Unfortunately, those that fail sooner do it in an
+    // opaque call, so we can't change the behavior.  Since we don't want
+    // different parsers to report different validation errors, we bring
+    // all parsers back to the same point.
+
+    sortReportedErrors(d);    
+  }
+  else
+  {
+    // Low-level XML errors will have been caught in the first read,
+    // before we even attempt to interpret the content as SBML.  Here
+    // we want to start checking some basic SBML-level errors.
+
+    if (stream.getEncoding() == "")
     {
-      // If we encountered an error, some parsers will report it sooner
-      // than others.  Unfortunately, those that fail sooner do it in an
-      // opaque call, so we can't change the behavior.  Since we don't want
-      // different parsers to report different validation errors, we bring
-      // all parsers back to the same point.
+      d->getErrorLog()->logError(MissingXMLEncoding);
+    }
+    else if (strcmp_insensitive(stream.getEncoding().c_str(), "UTF-8") != 0)
+    {
+      d->getErrorLog()->logError(NotUTF8);
+    }
 
-      sortReportedErrors(d);    
+    if (stream.getVersion() == "")
+    {
+      d->getErrorLog()->logError(BadXMLDecl);
     }
-    else
+    else if (strcmp_insensitive(stream.getVersion().c_str(), "1.0") != 0)
     {
-      // Low-level XML errors will have been caught in the first read,
-      // before we even attempt to interpret the content as SBML.  Here
-      // we want to start checking some basic SBML-level errors.
+      d->getErrorLog()->logError(BadXMLDecl);
+    }
 
-      if (stream.getEncoding() == "")
-      {
-        d->getErrorLog()->logError(MissingXMLEncoding);
-      }
-      else if (strcmp_insensitive(stream.getEncoding().c_str(), "UTF-8") != 0)
+    if (d->getModel() == NULL)
+    {
+      // L3V2 removed the restriction that a model was necessary
+      if (d->getLevel() < 3 ||(d->getLevel() == 3 && d->getVersion() == 1))
       {
-        d->getErrorLog()->logError(NotUTF8);
+        d->getErrorLog()->logError(MissingModel, 
+                                   d->getLevel(), d->getVersion());
       }
+    }
+    else if (d->getLevel() == 1)
+    {
+      // In Level 1, some listOfElements were required.
 
-      if (stream.getVersion() == "")
-      {
-        d->getErrorLog()->logError(BadXMLDecl);
-      }
-      else if (strcmp_insensitive(stream.getVersion().c_str(), "1.0") != 0)
+      if (d->getModel()->getNumCompartments() == 0)
       {
-        d->getErrorLog()->logError(BadXMLDecl);
+        d->getErrorLog()->logError(NotSchemaConformant,
+                                 d->getLevel(), d->getVersion(), 
+          "An SBML Level 1 model must contain at least one <compartment>.");
       }
 
-      if (d->getModel() == NULL)
+      if (d->getVersion() == 1)
       {
-        // L3V2 removed the restriction that a model was necessary
-        if (d->getLevel() < 3 ||(d->getLevel() == 3 && d->getVersion() == 1))
+        if (d->getModel()->getNumSpecies() == 0)
         {
-          d->getErrorLog()->logError(MissingModel, 
-                                     d->getLevel(), d->getVersion());
+          d->getErrorLog()->logError(NotSchemaConformant,
+                                   d->getLevel(), d->getVersion(), 
+          "An SBML Level 1 Version 1 model must contain at least one <species>.");
         }
-      }
-      else if (d->getLevel() == 1)
-      {
-	// In Level 1, some listOfElements were required.
-
-        if (d->getModel()->getNumCompartments() == 0)
+        if (d->getModel()->getNumReactions() == 0)
         {
           d->getErrorLog()->logError(NotSchemaConformant,
-				     d->getLevel(), d->getVersion(), 
-            "An SBML Level 1 model must contain at least one <compartment>.");
+                                   d->getLevel(), d->getVersion(), 
+          "An SBML Level 1 Version 1 model must contain at least one <reaction>.");
         }
+      }
+    }
+  }
+}
+/** @endcond */
 
-        if (d->getVersion() == 1)
-        {
-          if (d->getModel()->getNumSpecies() == 0)
-          {
-            d->getErrorLog()->logError(NotSchemaConformant,
-				       d->getLevel(), d->getVersion(), 
-            "An SBML Level 1 Version 1 model must contain at least one <species>.");
-          }
-          if (d->getModel()->getNumReactions() == 0)
-          {
-            d->getErrorLog()->logError(NotSchemaConformant,
-				       d->getLevel(), d->getVersion(), 
-            "An SBML Level 1 Version 1 model must contain at least one <reaction>.");
-          }
-        }
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Used by readSBML() and readSBMLFromString().
+ */
+SBMLDocument*
+SBMLReader::readInternal (const char* content, bool isFile)
+{
+  SBMLDocument* d = new SBMLDocument();
+  if (isFile) {
+    d->setLocationURI(string("file:") + content);
+  }
+
+  if (isFile && content != NULL && (util_file_exists(content) == false))
+  {
+    d->getErrorLog()->logError(XMLFileUnreadable);
+  }
+  else 
+  {
+    // the elements asked to be left out are skipped by the parser
+    XMLElementFilter filter;
+    addSkippedElements(filter, mSkippedElements, mSkippedNamespaces);
+    const XMLElementFilter* skipped = filter.isEmpty() ? NULL : &filter;
+
+    // documents keeping their text are read as they are by this thread
+    if (mKeepOriginalText && skipped == NULL
+        && readKeepingOriginalText(d, content, isFile))
+    {
+      return d;
+    }
+
+    // notes and annotations are cut out of the document to be read when
+    // first used, when so asked
+    DeferredElementReader deferred(content, isFile, mLazyNotesAndAnnotations,
+                                   skipped);
+
+    const char* source = deferred.isActive() ? deferred.getContent() : content;
+    bool sourceIsFile  = isFile && !deferred.isActive();
+
+#ifdef LIBSBML_WITH_PARALLEL_READING
+    // the items of large lists are read by several threads when so
+    // configured, the stream then only has what is left of the document;
+    // callbacks must see the document being read, so they prevent it
+    ParallelListOfReader parallel(source, sourceIsFile,
+      (CallbackRegistry::getNumCallbacks() == 0) ? mNumThreads : 1, skipped);
+
+    XMLInputStream stream(parallel.isActive() ? parallel.getContent() : source,
+                          sourceIsFile && !parallel.isActive(), "",
+                          d->getErrorLog());
+    stream.setElementFilter(skipped);
+    deferred.attach(stream);
+    parallel.attach(stream);
+#else
+    XMLInputStream stream(source, sourceIsFile, "", d->getErrorLog());
+    stream.setElementFilter(skipped);
+    deferred.attach(stream);
+#endif
+
+    if (!startReading(d, stream))
+    {
+      return d;
+    }
+
+    {
+      // allocate the math of the document together, when so configured
+      ASTNodeArena::Scope arenaScope(d->getASTNodeArena());
+#ifdef LIBSBML_WITH_PARALLEL_READING
+      if (parallel.isActive())
+      {
+        parallel.readParts(*d);
       }
+#endif
+      d->read(stream);
+    }
+
+#ifdef LIBSBML_WITH_PARALLEL_READING
+    if (parallel.isActive() && !parallel.isComplete(stream))
+    {
+      // the parts could not be put together as a single thread would have
+      // read them (the document is not well-formed, say): start again
+      parallel.clear();
+      delete d;
+
+      SBMLReader serial(*this);
+      serial.setNumThreads(1);
+      return serial.readInternal(content, isFile);
+    }
+#endif
+
+    finishReading(d, stream);
+  }
+  return d;
+}
+
+
+/*
+ * Reads d from content keeping the text it is read from.
+ */
+bool
+SBMLReader::readKeepingOriginalText (SBMLDocument* d, const char* content,
+                                     bool isFile)
+{
+  if (content == NULL) return false;
+
+  std::string* text = NULL;
+  if (isFile)
+  {
+    // only regular files are kept; compressed ones are read as usual
+    XMLMappedFileBuffer file(content);
+    if (file.error()) return false;
+
+    unsigned int length = UINT_MAX;
+    const char* data = file.readInPlace(length);
+    text = new std::string(data, length);
+  }
+  else
+  {
+    text = new std::string(content);
+  }
+
+  XMLElementSpans spans(text->data(), text->size());
+  if (spans.failed())
+  {
+    delete text;
+    return false;
+  }
+
+  XMLInputStream stream(text->c_str(), false, "", d->getErrorLog());
+  stream.setElementSpans(&spans);
+
+  if (startReading(d, stream))
+  {
+    {
+      // allocate the math of the document together, when so configured
+      ASTNodeArena::Scope arenaScope(d->getASTNodeArena());
+      d->read(stream);
     }
+
+    finishReading(d, stream);
+  }
+
+  // the spans are only those of the elements read if there are as many
+  if (stream.getNumElementsStarted() == spans.size())
+  {
+    d->setOriginalText(text);
+  }
+  else
+  {
+    delete text;
+  }
+
+  return true;
+}
+
+
+/*
+ * Used by SBMLIncrementalReader.
+ */
+SBMLDocument*
+SBMLReader::readFromBuffer (XMLBuffer& source)
+{
+  SBMLDocument* d = new SBMLDocument();
+
+  XMLElementFilter filter;
+  addSkippedElements(filter, mSkippedElements, mSkippedNamespaces);
+
+  // the content is only seen once, as it arrives, so neither notes and
+  // annotations nor the items of lists can be cut out to be read apart
+  XMLInputStream stream(source, "", d->getErrorLog());
+  stream.setElementFilter(filter.isEmpty() ? NULL : &filter);
+
+  if (!startReading(d, stream))
+  {
+    return d;
   }
+
+  {
+    // allocate the math of the document together, when so configured
+    ASTNodeArena::Scope arenaScope(d->getASTNodeArena());
+    d->read(stream);
+  }
+
+  finishReading(d, stream);
+
   return d;
 }
 /** @endcond */
@@ -333,10 +333,13 @@ if (doc.getNumErrors() > 0)
 
 
 #include <string>
+#include <vector>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class SBMLDocument;
+class XMLBuffer;
+class XMLInputStream;
 
 
 class LIBSBML_EXTERN SBMLReader
@@ -413,6 +416,166 @@ public:
   SBMLDocument* readSBMLFromString (const std::string& xml);
 
 
+  /**
+   * Sets the number of threads used to read large documents.
+   *
+   * This only has an effect if libSBML was built with the option
+   * @c WITH_PARALLEL_READING.  The items of the large lists of a model,
+   * such as its <code>&lt;listOfSpecies&gt;</code> or
+   * <code>&lt;listOfReactions&gt;</code> and the lists added by packages,
+   * are then parsed on separate threads and put into the document
+   * afterwards.  The document, including the errors logged and their line
+   * numbers, is the same as when it is read by a single thread.
+   * Compressed files are always read by a single thread.
+   *
+   * @param numThreads the largest number of threads to use, including the
+   * calling thread, or @c 0 for one per hardware thread.  The default,
+   * @c 1, reads documents serially.
+   */
+  void setNumThreads (unsigned int numThreads);
+
+
+  /**
+   * Returns the number of threads used to read large documents (see
+   * setNumThreads()).
+   *
+   * @return the number of threads, or @c 0 for one per hardware thread.
+   */
+  unsigned int getNumThreads () const;
+
+
+  /**
+   * Sets whether the <code>&lt;notes&gt;</code> and
+   * <code>&lt;annotation&gt;</code> elements of the components of a model
+   * are read only when they are first used.
+   *
+   * When set, these elements are cut out of the document before it is
+   * parsed, and each component keeps the text of its own.  They are read
+   * when the notes, the annotation, the CVTerms or the model history of
+   * the component are first asked for, or when the component is written
+   * out, so a document that is read and written out again keeps them
+   * unchanged.  Documents whose annotations are larger than the rest of
+   * the model are read much faster, and take less memory, when their
+   * annotations are not used.
+   *
+   * Errors found in these elements are logged when they are read rather
+   * than when the document is: SBMLDocument::checkConsistency() reads
+   * them all first.  The elements of the <code>&lt;sbml&gt;</code>,
+   * <code>&lt;model&gt;</code> and species reference elements, those of
+   * the elements of packages and those of components that have package
+   * plugins are always read with the document, as are all the elements
+   * of compressed files.
+   *
+   * @param lazily @c true to read the notes and annotations when they are
+   * first used, @c false (the default) to read them with the document.
+   */
+  void setReadNotesAndAnnotationsLazily (bool lazily);
+
+
+  /**
+   * Returns @c true if the <code>&lt;notes&gt;</code> and
+   * <code>&lt;annotation&gt;</code> elements of the components of a model
+   * are read only when they are first used (see
+   * setReadNotesAndAnnotationsLazily()).
+   *
+   * @return whether notes and annotations are read lazily.
+   */
+  bool getReadNotesAndAnnotationsLazily () const;
+
+
+  /**
+   * Sets whether the documents read keep the text they were read from, so
+   * that the parts of a model that have not been changed are written back
+   * as they were read.
+   *
+   * When set, every object of SBML Level&nbsp;1, 2 or 3 Core read from a
+   * document remembers where it is in the text, which the
+   * SBMLDocument holds on to.  Every method changing an object, or giving
+   * access to something of it that can be changed, such as
+   * SBase::getNotes() or SBase::getCVTerms(), marks it, and all that
+   * contains it, as changed.  When the document is written, the objects
+   * that have not been changed since they were read are copied from the
+   * text as they are, instead of being written again; large models of
+   * which little is changed are then written much faster.  A document
+   * that is not changed at all is written exactly as it was read.
+   *
+   * The objects of packages, and those with package plugins, such as a
+   * model with layouts, are always written again, and so are the objects
+   * containing them.  Documents are read by a single thread in this mode,
+   * notes and annotations included (see setNumThreads() and
+   * setReadNotesAndAnnotationsLazily()), and compressed files, and
+   * documents read with elements left out (see addSkippedElement()), do
+   * not keep their text.  A conversion of the
+   * document, or SBMLDocument::discardOriginalText(), frees it.
+   *
+   * @param keep @c true to keep the text of the documents read,
+   * @c false (the default) not to.
+   */
+  void setKeepOriginalText (bool keep);
+
+
+  /**
+   * Returns @c true if the documents read keep the text they were read
+   * from (see setKeepOriginalText()).
+   *
+   * @return whether the original text of documents is kept.
+   */
+  bool getKeepOriginalText () const;
+
+
+  /**
+   * Leaves the elements named @p name out of the documents read, with
+   * everything they contain.
+   *
+   * The elements are left out by the XML parser, which makes nothing of
+   * them, so a document of which only a part is needed is read in less
+   * time and memory.  For example, leaving out
+   * <code>&lt;notes&gt;</code>, <code>&lt;annotation&gt;</code> and
+   * <code>&lt;listOfEvents&gt;</code> reads little more than the reaction
+   * network of a model.  The elements are left out wherever they are, in
+   * the namespace of SBML Level&nbsp;1, 2 or 3 or of any Level&nbsp;3
+   * package; elements of the same name in the MathML or XHTML namespaces,
+   * or inside annotations, are read as usual.
+   *
+   * A document read this way is the same as if the elements were not in
+   * the file: no errors are logged for them, and the document may not be
+   * valid without them.
+   *
+   * @param name the name of the elements, without prefix, such as
+   * <code>"listOfEvents"</code> or <code>"annotation"</code>.
+   *
+   * @see addSkippedPackage()
+   * @see clearSkippedElements()
+   */
+  void addSkippedElement (const std::string& name);
+
+
+  /**
+   * Leaves the elements of a package out of the documents read, with
+   * everything they contain (see addSkippedElement()).
+   *
+   * Only elements are left out: the attributes a package adds to the
+   * elements of SBML Level&nbsp;3 Core, such as the charge of a species
+   * in the Flux Balance Constraints package, are read as usual.
+   *
+   * @param package the name of a package known to this copy of libSBML,
+   * such as <code>"layout"</code> or <code>"render"</code>, for the
+   * elements in any of its namespaces, or a namespace URI for the
+   * elements in that namespace.
+   *
+   * @see addSkippedElement()
+   * @see clearSkippedElements()
+   */
+  void addSkippedPackage (const std::string& package);
+
+
+  /**
+   * Reads the documents whole again, undoing addSkippedElement() and
+   * addSkippedPackage().
+   */
+  void clearSkippedElements ();
+
+
   /**
    * Static method; returns @c true if this copy of libSBML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -450,6 +613,40 @@ protected:
    */
   SBMLDocument* readInternal (const char* content, bool isFile = true);
 
+
+  /**
+   * Used by SBMLIncrementalReader: reads the document whose content is
+   * added to @p source as it arrives.
+   */
+  SBMLDocument* readFromBuffer (XMLBuffer& source);
+
+
+  /**
+   * Reads @p d from @p content, the name of a file if @p isFile is
+   * @c true, keeping its text (see setKeepOriginalText()).  Returns
+   * @c false, having read nothing, if the text cannot be kept.
+   */
+  bool readKeepingOriginalText (SBMLDocument* d, const char* content,
+                                bool isFile);
+
+
+  /**
+   * Returns @c false, having logged the errors to report in @p d, if the
+   * document read from @p stream does not start with an sbml element.
+   */
+  static bool startReading (SBMLDocument* d, XMLInputStream& stream);
+
+
+  unsigned int mNumThreads;
+  bool         mLazyNotesAndAnnotations;
+  bool         mKeepOriginalText;
+
+  std::vector<std::string> mSkippedElements;
+  std::vector<std::string> mSkippedNamespaces;
+
+
+  friend class SBMLIncrementalReader;
+
   /** @endcond */
 };
 
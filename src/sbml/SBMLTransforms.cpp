@@ -1092,7 +1092,7 @@ SBMLTransforms::evaluateASTNode(const ASTNode * node, const IdValueMap& values,
       const ASTBasePlugin* baseplugin = node->getPlugin(p);
       if (baseplugin->defines(node->getType()))
       {
-        result = baseplugin->evaluateASTNode(node, m);
+        result = baseplugin->evaluateASTNode(node, values, m);
       }
     }
   }
@@ -1102,14 +1102,15 @@ SBMLTransforms::evaluateASTNode(const ASTNode * node, const IdValueMap& values,
 }
 
 bool
-SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
+SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia,
+                         IdValueMap& values)
 {
   bool removed = false;
   std::string id = ia->getSymbol();
   if (m->getCompartment(id) != NULL) 
   {
     if (expandInitialAssignment(m->getCompartment(id), 
-                                ia))
+                                ia, values))
     {
       delete m->removeInitialAssignment(id);
       removed = true;
@@ -1118,7 +1119,7 @@ SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
   else if (m->getParameter(id) != NULL)
   {
     if (expandInitialAssignment(m->getParameter(id), 
-                                ia))
+                                ia, values))
     {
       delete m->removeInitialAssignment(id);
       removed = true;
@@ -1127,7 +1128,7 @@ SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
   else if (m->getSpecies(id) != NULL)
   {
     if (expandInitialAssignment(m->getSpecies(id), 
-                                ia))
+                                ia, values))
     {
       delete m->removeInitialAssignment(id);
       removed = true;
@@ -1144,7 +1145,7 @@ SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
         if (r->getProduct(k)->getId() == id)
         {
           if (expandInitialAssignment(r->getProduct(k), 
-                                      ia))
+                                      ia, values))
           {
             delete m->removeInitialAssignment(id);
             removed = true;
@@ -1156,7 +1157,7 @@ SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
         if (r->getReactant(k)->getId() == id)
         {
           if (expandInitialAssignment(r->getReactant(k), 
-                                      ia))
+                                      ia, values))
           {
             delete m->removeInitialAssignment(id);
             removed = true;
@@ -1172,71 +1173,46 @@ SBMLTransforms::expandIA(Model* m, const InitialAssignment* ia)
 bool 
 SBMLTransforms::expandInitialAssignments(Model * m)
 {
-  IdList idsNoValues = mapComponentValues(m);
-  IdList idsWithValues;
+  bool result = expandInitialAssignments(m, mValues, false);
 
-  IdValueIter iter;
-  bool needToBail = false;
-  unsigned int count;
+  // clear the internal map of values
+  mValues.clear();
 
-  do
-  {
-    /* need a fail safe in case a value is just missing */
-    unsigned int num = m->getNumInitialAssignments();
-    count = num;
-    
-    /* list ids that have a calculated/assigned value */
-    idsWithValues.clear();
-    for (iter = mValues.begin(); iter != mValues.end(); ++iter)
-    {
-      if (((*iter).second).second)
-      {
-        idsWithValues.append((*iter).first);
-      }
-    }
+  return result;
+}
 
-    for (int i = num-1; i >= 0; i--)
-    {
-      if (m->getInitialAssignment(i)->isSetMath())
-      {
-        if (!nodeContainsId(m->getInitialAssignment(i)->getMath(), idsNoValues))
-        {
-          if (!nodeContainsNameNotInList(m->getInitialAssignment(i)->getMath(), 
-                                                                   idsWithValues))
-          {
-            bool removed = expandIA(m, m->getInitialAssignment(i));
-            if (removed) count--;
-          }
-        }
-        else
-        {
-          needToBail = true;
-        }
-      }
-      else
-      {
-        count--;
-      }
-    }
-    /* if count is still same nothing changed so bail or endlessly loop */
-    if (count == num)
-    {
-      needToBail = true;
-    }
-  }
-  while(count > 0 && needToBail == false);
+
+bool 
+SBMLTransforms::expandInitialAssignments(Model * m, IdValueMap& values)
+{
+  return expandInitialAssignments(m, values, false);
+}
+
+
+bool 
+SBMLTransforms::expandL3V2InitialAssignments(Model * m)
+{
+  bool result = expandInitialAssignments(m, mValues, true);
 
   // clear the internal map of values
   mValues.clear();
 
-  return true;
+  return result;
 }
 
 
 bool 
-SBMLTransforms::expandL3V2InitialAssignments(Model * m)
+SBMLTransforms::expandL3V2InitialAssignments(Model * m, IdValueMap& values)
 {
-  IdList idsNoValues = mapComponentValues(m);
+  return expandInitialAssignments(m, values, true);
+}
+
+
+bool 
+SBMLTransforms::expandInitialAssignments(Model * m, IdValueMap& values,
+                                         bool onlyL3V2)
+{
+  IdList idsNoValues = getComponentValuesForModel(m, values);
   IdList idsWithValues;
 
   IdValueIter iter;
@@ -1251,7 +1227,7 @@ SBMLTransforms::expandL3V2InitialAssignments(Model * m)
     
     /* list ids that have a calculated/assigned value */
     idsWithValues.clear();
-    for (iter = mValues.begin(); iter != mValues.end(); ++iter)
+    for (iter = values.begin(); iter != values.end(); ++iter)
     {
       if (((*iter).second).second)
       {
@@ -1262,14 +1238,23 @@ SBMLTransforms::expandL3V2InitialAssignments(Model * m)
     for (int i = num-1; i >= 0; i--)
     {
       const InitialAssignment* ia = m->getInitialAssignment(i);
-      // we only want to do something if the initial assignment uses l3v2 math
-      if (ia->isSetMath() && ia->getMath()->usesL3V2MathConstructs() && !ia->getMath()->usesRateOf())
+      bool expand = ia->isSetMath();
+
+      // for l3v2 we only want to do something if the initial assignment 
+      // uses l3v2 math
+      if (expand && onlyL3V2)
+      {
+        expand = ia->getMath()->usesL3V2MathConstructs() 
+                 && !ia->getMath()->usesRateOf();
+      }
+
+      if (expand)
       {
         if (!nodeContainsId(ia->getMath(), idsNoValues))
         {
           if (!nodeContainsNameNotInList(ia->getMath(), idsWithValues))
           {
-            bool removed = expandIA(m, ia);
+            bool removed = expandIA(m, ia, values);
             if (removed) count--;
           }
         }
@@ -1291,23 +1276,20 @@ SBMLTransforms::expandL3V2InitialAssignments(Model * m)
   }
   while(count > 0 && needToBail == false);
 
-  // clear the internal map of values
-  mValues.clear();
-
   return true;
 }
 
 
 bool 
 SBMLTransforms::expandInitialAssignment(Compartment * c, 
-    const InitialAssignment *ia)
+    const InitialAssignment *ia, IdValueMap& values)
 {
   bool success = false; 
-  double value = evaluateASTNode(ia->getMath(), c->getModel());
+  double value = evaluateASTNode(ia->getMath(), values, c->getModel());
   if (!util_isNaN(value))
   {
     c->setSize(value);
-    IdValueIter it = mValues.find(c->getId());
+    IdValueIter it = values.find(c->getId());
     ((*it).second).first = value;
     ((*it).second).second = true;
     success = true;
@@ -1318,14 +1300,14 @@ SBMLTransforms::expandInitialAssignment(Compartment * c,
 
 bool 
 SBMLTransforms::expandInitialAssignment(Parameter * p, 
-    const InitialAssignment *ia)
+    const InitialAssignment *ia, IdValueMap& values)
 {
   bool success = false; 
-  double value = evaluateASTNode(ia->getMath(), p->getModel());
+  double value = evaluateASTNode(ia->getMath(), values, p->getModel());
   if (!util_isNaN(value))
   {
     p->setValue(value);
-    IdValueIter it = mValues.find(p->getId());
+    IdValueIter it = values.find(p->getId());
     ((*it).second).first = value;
     ((*it).second).second = true;
     success = true;
@@ -1336,14 +1318,14 @@ SBMLTransforms::expandInitialAssignment(Parameter * p,
 
 bool 
 SBMLTransforms::expandInitialAssignment(SpeciesReference * sr, 
-    const InitialAssignment *ia)
+    const InitialAssignment *ia, IdValueMap& values)
 {
   bool success = false; 
-  double value = evaluateASTNode(ia->getMath(), sr->getModel());
+  double value = evaluateASTNode(ia->getMath(), values, sr->getModel());
   if (!util_isNaN(value))
   {
     sr->setStoichiometry(value);
-    IdValueIter it = mValues.find(sr->getId());
+    IdValueIter it = values.find(sr->getId());
     ((*it).second).first = value;
     ((*it).second).second = true;
     success = true;
@@ -1354,10 +1336,10 @@ SBMLTransforms::expandInitialAssignment(SpeciesReference * sr,
 
 bool 
 SBMLTransforms::expandInitialAssignment(Species * s, 
-    const InitialAssignment *ia)
+    const InitialAssignment *ia, IdValueMap& values)
 {
   bool success = false; 
-  double value = evaluateASTNode(ia->getMath(), s->getModel());
+  double value = evaluateASTNode(ia->getMath(), values, s->getModel());
   if (!util_isNaN(value))
   {
     if (s->getHasOnlySubstanceUnits())
@@ -1369,7 +1351,7 @@ SBMLTransforms::expandInitialAssignment(Species * s,
       s->setInitialConcentration(value);
     }
 
-    IdValueIter it = mValues.find(s->getId());
+    IdValueIter it = values.find(s->getId());
     ((*it).second).first = value;
     ((*it).second).second = true;
     success = true;
@@ -136,6 +136,13 @@ public:
                         const IdList* idsToExclude = NULL);
 
 
+  /*
+   * The functions that do not take an IdValueMap share a single table of
+   * values, so they must not be called on different models at the same
+   * time.  The overloads taking an IdValueMap use the table provided by
+   * the caller instead, and can be called concurrently on different
+   * models as long as each call has a table of its own.
+   */
   static bool expandInitialAssignments(Model * m);
 
 
@@ -148,6 +155,15 @@ public:
   static double evaluateASTNode(const ASTNode * node, const IdValueMap& values, const Model * m = NULL);
   static double evaluateASTNode(const ASTNode * node, const std::map<std::string, double>& values, const Model * m = NULL);
   static IdList getComponentValuesForModel(const Model * m, IdValueMap& values);
+
+  /*
+   * Expands the initial assignments of the model as
+   * expandInitialAssignments(Model*) does, keeping the values of the
+   * components in @p values, which is filled from the model first.
+   */
+  static bool expandInitialAssignments(Model * m, IdValueMap& values);
+
+  static bool expandL3V2InitialAssignments(Model * m, IdValueMap& values);
 #endif
   
   static IdList mapComponentValues(const Model * m);
@@ -166,18 +182,26 @@ protected:
   static bool nodeContainsNameNotInList(const ASTNode * node, IdList& ids);
   
   static bool expandInitialAssignment(Parameter * p, 
-                                          const InitialAssignment *ia);
+                                          const InitialAssignment *ia,
+                                          IdValueMap& values);
   
   static bool expandInitialAssignment(Compartment * c, 
-                                          const InitialAssignment *ia);
+                                          const InitialAssignment *ia,
+                                          IdValueMap& values);
   
   static bool expandInitialAssignment(SpeciesReference * sr, 
-                                          const InitialAssignment *ia);
+                                          const InitialAssignment *ia,
+                                          IdValueMap& values);
   
   static bool expandInitialAssignment(Species * s, 
-                                          const InitialAssignment *ia);
+                                          const InitialAssignment *ia,
+                                          IdValueMap& values);
+
+  static bool expandIA(Model* m, const InitialAssignment *ia,
+                       IdValueMap& values);
 
-  static bool expandIA(Model* m, const InitialAssignment *ia);
+  static bool expandInitialAssignments(Model * m, IdValueMap& values,
+                                       bool onlyL3V2);
 
   static void recurseReplaceFD(ASTNode * math, const FunctionDefinition * fd,
                         const IdList* idsToExclude);
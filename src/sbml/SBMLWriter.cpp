@@ -45,11 +45,13 @@
 #include <sstream>
 
 #include <sbml/common/common.h>
+#include <sbml/xml/XMLOutputBuffer.h>
 #include <sbml/xml/XMLOutputStream.h>
 
 #include <sbml/SBMLError.h>
 #include <sbml/SBMLDocument.h>
 #include <sbml/SBMLWriter.h>
+#include <sbml/ParallelListOfWriter.h>
 
 #include <sbml/compress/CompressCommon.h>
 #include <sbml/compress/OutputCompressor.h>
@@ -65,6 +67,7 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  * Creates a new SBMLWriter.
  */
 SBMLWriter::SBMLWriter ()
+  : mNumThreads (1)
 {
 }
 
@@ -111,6 +114,26 @@ SBMLWriter::setProgramVersion (const std::string& version)
 }
 
 
+/*
+ * Sets the number of threads used to write large documents.
+ */
+void
+SBMLWriter::setNumThreads (unsigned int numThreads)
+{
+  mNumThreads = numThreads;
+}
+
+
+/*
+ * @return the number of threads used to write large documents.
+ */
+unsigned int
+SBMLWriter::getNumThreads () const
+{
+  return mNumThreads;
+}
+
+
 /*
  * Writes the given SBML document to filename.
  *
@@ -143,10 +166,10 @@ SBMLWriter::writeSBML (const SBMLDocument* d, const std::string& filename)
 
   try
   {
-    // open an uncompressed XML file.
+    // an uncompressed XML file is written by writeToFile() below.
     if ( string::npos != filename.find(".xml", filename.length() - 4) )
     {
-      stream = new(std::nothrow) std::ofstream(filename.c_str());
+      return writeToFile(d, filename);
     }
     // open a gzip file
     else if ( string::npos != filename.find(".gz", filename.length() - 3) )
@@ -187,7 +210,7 @@ SBMLWriter::writeSBML (const SBMLDocument* d, const std::string& filename)
     }
     else
     {
-      stream = new(std::nothrow) std::ofstream(filename.c_str());
+      return writeToFile(d, filename);
     }
   }
   catch ( ZlibNotLinked& )
@@ -228,6 +251,37 @@ SBMLWriter::writeSBML (const SBMLDocument* d, const std::string& filename)
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Writes the given SBML document to the uncompressed file filename,
+ * through a file descriptor.
+ */
+bool
+SBMLWriter::writeToFile (const SBMLDocument* d, const std::string& filename)
+{
+  XMLFileDescriptorSink sink(filename);
+
+  if ( !sink.isOpen() )
+  {
+    SBMLErrorLog *log = (const_cast<SBMLDocument *>(d))->getErrorLog();
+    log->logError(XMLFileUnwritable);
+    return false;
+  }
+
+  bool result = writeSBML(d, sink);
+
+  if ( !sink.close() && result )
+  {
+    SBMLErrorLog *log = (const_cast<SBMLDocument *>(d))->getErrorLog();
+    log->logError(XMLFileOperationError);
+    result = false;
+  }
+
+  return result;
+}
+/** @endcond */
+
+
 /*
  * Writes the given SBML document to the output stream.
  *
@@ -236,14 +290,43 @@ SBMLWriter::writeSBML (const SBMLDocument* d, const std::string& filename)
  */
 bool
 SBMLWriter::writeSBML (const SBMLDocument* d, std::ostream& stream)
+{
+  stream.exceptions(ios_base::badbit | ios_base::failbit | ios_base::eofbit);
+
+  XMLOStreamSink sink(stream);
+  return writeSBML(d, sink);
+}
+
+
+/*
+ * Writes the given SBML document to the sink, through a buffer that
+ * passes it on in large blocks.
+ *
+ * @return @c true on success and false if the sink fails.
+ */
+bool
+SBMLWriter::writeSBML (const SBMLDocument* d, XMLOutputSink& sink)
 {
   bool result = false;
 
   try
   {
+    XMLOutputBuffer buffer(sink);
+    std::ostream    stream(&buffer);
+
     stream.exceptions(ios_base::badbit | ios_base::failbit | ios_base::eofbit);
     XMLOutputStream xos(stream, "UTF-8", true, mProgramName, 
                                                mProgramVersion);
+
+    ParallelListOfWriter itemsWriter(mNumThreads);
+    if (mNumThreads != 1)
+    {
+      xos.setListOfItemsWriter(&itemsWriter);
+    }
+
+    // what has not changed since it was read is written as it was
+    xos.setOriginalText(d->getOriginalText());
+
     d->write(xos);
     stream << endl;
 
@@ -272,10 +355,10 @@ LIBSBML_EXTERN
 char*
 SBMLWriter::writeToString (const SBMLDocument* d)
 {
-  ostringstream stream;
-  writeSBML(d, stream);
+  XMLMemorySink sink;
+  writeSBML(d, sink);
 
-  return safe_strdup( stream.str().c_str() );
+  return sink.release();
 }
 
 std::string 
@@ -283,9 +366,9 @@ SBMLWriter::writeSBMLToStdString(const SBMLDocument* d)
 {
   if (d == NULL) return "";
   
-  ostringstream stream;
-  writeSBML(d, stream);
-  return stream.str();
+  XMLMemorySink sink;
+  writeSBML(d, sink);
+  return std::string(sink.getBuffer(), sink.getLength());
 }
 
 LIBSBML_EXTERN
@@ -109,6 +109,7 @@
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class SBMLDocument;
+class XMLOutputSink;
 
 
 class LIBSBML_EXTERN SBMLWriter
@@ -184,6 +185,33 @@ public:
   int setProgramVersion (const std::string& version);
 
 
+  /**
+   * Sets the number of threads used to write large documents.
+   *
+   * This only has an effect if libSBML was built with the option
+   * @c WITH_PARALLEL_WRITING.  The items of the large lists of a model,
+   * such as its <code>&lt;listOfSpecies&gt;</code> or
+   * <code>&lt;listOfReactions&gt;</code> and the lists added by packages,
+   * are then written to memory on separate threads, and put into the
+   * output in order.  The output is the same as when the document is
+   * written by a single thread.
+   *
+   * @param numThreads the largest number of threads to use, including the
+   * calling thread, or @c 0 for one per hardware thread.  The default,
+   * @c 1, writes documents serially.
+   */
+  void setNumThreads (unsigned int numThreads);
+
+
+  /**
+   * Returns the number of threads used to write large documents (see
+   * setNumThreads()).
+   *
+   * @return the number of threads, or @c 0 for one per hardware thread.
+   */
+  unsigned int getNumThreads () const;
+
+
   /**
    * Writes the given SBML document to filename.
    *
@@ -221,6 +249,29 @@ public:
   bool writeSBML (const SBMLDocument* d, std::ostream& stream);
 
 
+#ifndef SWIG
+  /**
+   * Writes the given SBML document to the given sink.
+   *
+   * The document is written through a large buffer, so that the sink
+   * receives it in a few large blocks.  XMLFileDescriptorSink,
+   * XMLMemorySink and XMLOStreamSink write to a file descriptor, to memory
+   * and to an output stream; other destinations can be added by deriving
+   * from XMLOutputSink.
+   *
+   * @param d the SBML document to be written.
+   *
+   * @param sink the sink where the SBML is to be written.
+   *
+   * @return @c true on success and @c false if the sink fails.
+   *
+   * @see setProgramVersion(const std::string& version)
+   * @see setProgramName(const std::string& name)
+   */
+  bool writeSBML (const SBMLDocument* d, XMLOutputSink& sink);
+#endif
+
+
   /** @cond doxygenLibsbmlInternal */
   /**
    * Writes the given SBML document to an in-memory string and returns a
@@ -336,8 +387,11 @@ public:
 
  protected:
   /** @cond doxygenLibsbmlInternal */
+  bool writeToFile (const SBMLDocument* d, const std::string& filename);
+
   std::string mProgramName;
   std::string mProgramVersion;
+  unsigned int mNumThreads;
 
   /** @endcond */
 };
@@ -40,6 +40,8 @@
  * ---------------------------------------------------------------------- -->*/
 
 #include <sstream>
+#include <map>
+#include <typeinfo>
 
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
@@ -47,6 +49,7 @@
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/xml/XMLToken.h>
 #include <sbml/xml/XMLNode.h>
+#include <sbml/xml/XMLStringPool.h>
 
 #include <sbml/util/util.h>
 
@@ -59,8 +62,11 @@
 #include <sbml/Model.h>
 #include <sbml/ListOf.h>
 #include <sbml/SBase.h>
+#include <sbml/ParallelListOfReader.h>
+#include <sbml/DeferredElementReader.h>
 
 #include <sbml/util/IdList.h>
+#include <sbml/util/IdIndex.h>
 #include <sbml/util/IdentifierTransformer.h>
 #include <sbml/extension/SBasePlugin.h>
 #include <sbml/extension/ISBMLExtensionNamespaces.h>
@@ -68,6 +74,11 @@
 #include <sbml/extension/SBMLExtensionException.h>
 #include <sbml/util/CallbackRegistry.h>
 
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <mutex>
+#define LIBSBML_EXPECTED_ATTRIBUTES_LOCKED
+#endif
+
 /** @cond doxygenIgnored */
 using namespace std;
 /** @endcond */
@@ -99,6 +110,131 @@ struct ClonePluginEntity
 /** @endcond */
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Identifies a set of expected attributes: those an SBase subclass adds
+ * for an element name, namespace, level and version (base is NULL), or
+ * those a plugin class for the namespace adds to the cached attributes
+ * base of the element it extends.
+ */
+struct ExpectedAttributesKey
+{
+  const ExpectedAttributes* base;
+  const std::type_info*     type;
+  const std::string*        name;
+  const std::string*        uri;
+  unsigned int              level;
+  unsigned int              version;
+};
+
+
+struct ExpectedAttributesKeyLess
+{
+  bool operator() (const ExpectedAttributesKey& lhs,
+                   const ExpectedAttributesKey& rhs) const
+  {
+    if (lhs.base    != rhs.base)    return lhs.base < rhs.base;
+    if (*lhs.type   != *rhs.type)   return lhs.type->before(*rhs.type);
+    if (lhs.level   != rhs.level)   return lhs.level < rhs.level;
+    if (lhs.version != rhs.version) return lhs.version < rhs.version;
+
+    int cmp = lhs.name->compare(*rhs.name);
+    if (cmp != 0) return cmp < 0;
+
+    return *lhs.uri < *rhs.uri;
+  }
+};
+
+
+typedef std::map<ExpectedAttributesKey, ExpectedAttributes,
+                 ExpectedAttributesKeyLess> ExpectedAttributesCache;
+
+
+/*
+ * The cache is never freed, so the attributes it returns stay valid for
+ * the lifetime of the process.
+ */
+static ExpectedAttributesCache&
+getExpectedAttributesCache()
+{
+  static ExpectedAttributesCache* cache = new ExpectedAttributesCache();
+  return *cache;
+}
+
+
+#ifdef LIBSBML_EXPECTED_ATTRIBUTES_LOCKED
+static std::mutex sExpectedAttributesMutex;
+#define EXPECTED_ATTRIBUTES_LOCK \
+  std::lock_guard<std::mutex> lock(sExpectedAttributesMutex)
+#else
+#define EXPECTED_ATTRIBUTES_LOCK
+#endif
+
+
+static const ExpectedAttributes*
+findExpectedAttributes(const ExpectedAttributesKey& key)
+{
+  EXPECTED_ATTRIBUTES_LOCK;
+
+  ExpectedAttributesCache& cache = getExpectedAttributesCache();
+  ExpectedAttributesCache::const_iterator it = cache.find(key);
+
+  return (it != cache.end()) ? &it->second : NULL;
+}
+
+
+static const ExpectedAttributes&
+cacheExpectedAttributes(ExpectedAttributesKey key,
+                        const ExpectedAttributes& attributes)
+{
+  // the strings of the key have to outlive the element it came from
+  key.name = XMLStringPool::intern(*key.name);
+  key.uri  = XMLStringPool::intern(*key.uri);
+
+  EXPECTED_ATTRIBUTES_LOCK;
+
+  return getExpectedAttributesCache().insert(
+    ExpectedAttributesCache::value_type(key, attributes)).first->second;
+}
+
+
+static const ExpectedAttributes&
+getPluginExpectedAttributes(SBasePlugin* plugin, const ExpectedAttributes& base)
+{
+  // the namespace of a plugin determines its level and version
+  ExpectedAttributesKey key = { &base, &typeid(*plugin),
+                                XMLStringPool::getEmpty(),
+                                &plugin->getElementNamespace(), 0, 0 };
+
+  const ExpectedAttributes* cached = findExpectedAttributes(key);
+  if (cached != NULL) return *cached;
+
+  ExpectedAttributes attributes(base);
+  plugin->addExpectedAttributes(attributes);
+
+  return cacheExpectedAttributes(key, attributes);
+}
+
+
+/*
+ * @return the shared namespaces for a copy of an object with sbmlns, which
+ * are a plain SBMLNamespaces even if sbmlns are those of a package.
+ */
+static SBMLNamespaces*
+sharePlainNamespaces(const SBMLNamespaces* sbmlns)
+{
+  if (sbmlns != NULL && typeid(*sbmlns) == typeid(SBMLNamespaces))
+    return SBMLNamespaces::share(sbmlns);
+
+  SBMLNamespaces plain;
+  if (sbmlns != NULL)
+    plain = *sbmlns;
+
+  return SBMLNamespaces::share(&plain);
+}
+/** @endcond */
+
+
 SBase*
 SBase::getElementBySId(const std::string& id)
 {
@@ -137,6 +273,7 @@ SBase::getAllElements(ElementFilter *filter)
 void
 SBase::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   //No SIdRefs in SBase, but plugins might have some.
   for (unsigned int p = 0; p < getNumPlugins(); p++)
   {
@@ -147,6 +284,7 @@ SBase::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void
 SBase::renameMetaIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   //The only thing in core that uses metaids is the annotation element.  If the metaid of an SBase object is changed, and the annotation was in the 'sbml-official' form, the rdf:about will be changed automatically, so this function doesn't need to do anything.  However, we do need the function itself so that packages can extend it for their own purposes (such as comp, with its 'metaIdRef' attributes, and annot, which one would imagine would use something similar).
 
   //The following code is here in case you want a hacky solution for your own package:
@@ -173,6 +311,7 @@ SBase::renameMetaIdRefs(const std::string& oldid, const std::string& newid)
 void
 SBase::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   //No UnitSIdRefs in SBase, either.  But check the plugins.
   for (unsigned int p = 0; p < getNumPlugins(); p++)
   {
@@ -327,16 +466,16 @@ SBase::SBase (unsigned int level, unsigned int version) :
  , mCVTerms   ( NULL )
  , mHistory   ( NULL )
  , mHasBeenDeleted (false)
- , mEmptyString ("")
  , mURI("")
  , mHistoryChanged (false)
  , mCVTermsChanged (false)
- , mAttributesOfUnknownPkg()
- , mAttributesOfUnknownDisabledPkg()
- , mElementsOfUnknownPkg()
- , mElementsOfUnknownDisabledPkg()
+ , mDeferredElements (NULL)
+ , mOriginalBegin (0)
+ , mOriginalEnd (0)
+ , mUnknownPackageData (NULL)
 {
-  mSBMLNamespaces = new SBMLNamespaces(level, version);
+  SBMLNamespaces sbmlns(level, version);
+  mSBMLNamespaces = SBMLNamespaces::share(&sbmlns);
 
   //
   // Sets the XMLNS URI of corresponding SBML Level/Version to
@@ -373,21 +512,20 @@ SBase::SBase (const SBMLNamespaces *sbmlns) :
  , mCVTerms   ( NULL )
  , mHistory   ( NULL )
  , mHasBeenDeleted (false)
- , mEmptyString ("")
  , mURI("")
  , mHistoryChanged (false)
  , mCVTermsChanged (false)
- , mAttributesOfUnknownPkg()
- , mAttributesOfUnknownDisabledPkg()
- , mElementsOfUnknownPkg()
- , mElementsOfUnknownDisabledPkg()
+ , mDeferredElements (NULL)
+ , mOriginalBegin (0)
+ , mOriginalEnd (0)
+ , mUnknownPackageData (NULL)
 {
   if (!sbmlns)
   {
     std::string err("SBase::SBase(SBMLNamespaces*, SBaseExtensionPoint*) : SBMLNamespaces is null");
     throw SBMLConstructorException(err);
   }
-  mSBMLNamespaces = sbmlns->clone();
+  mSBMLNamespaces = SBMLNamespaces::share(sbmlns);
 
   //
   // Sets the XMLNS URI of corresponding SBML Level/Version to
@@ -427,26 +565,40 @@ SBase::SBase(const SBase& orig)
   , mCVTerms(NULL)
   , mHistory(NULL)
   , mHasBeenDeleted(false)
-  , mEmptyString()
   , mPlugins(orig.mPlugins.size())
-  , mDisabledPlugins()
   , mURI(orig.mURI)
   , mHistoryChanged(orig.mHistoryChanged)
   , mCVTermsChanged(orig.mCVTermsChanged)
-  , mAttributesOfUnknownPkg (orig.mAttributesOfUnknownPkg)
-  , mAttributesOfUnknownDisabledPkg (orig.mAttributesOfUnknownDisabledPkg)
-  , mElementsOfUnknownPkg (orig.mElementsOfUnknownPkg)
-  , mElementsOfUnknownDisabledPkg (orig.mElementsOfUnknownDisabledPkg)
+  , mDeferredElements(NULL)
+  , mOriginalBegin(0)
+  , mOriginalEnd(0)
+  , mUnknownPackageData(NULL)
 {
   if(orig.mNotes != NULL)
-    this->mNotes = new XMLNode(*const_cast<SBase&>(orig).getNotes());
+    this->mNotes = new XMLNode(*orig.mNotes);
 
   if(orig.mAnnotation != NULL)
     this->mAnnotation = new XMLNode(*const_cast<SBase&>(orig).mAnnotation);
 
-  if(orig.getSBMLNamespaces() != NULL)
-    this->mSBMLNamespaces =
-    new SBMLNamespaces(*const_cast<SBase&>(orig).getSBMLNamespaces());
+  if (orig.mDeferredElements != NULL)
+  {
+    this->mDeferredElements =
+      new std::vector<DeferredElement>(*orig.mDeferredElements);
+  }
+
+  // the plugins of disabled packages are not copied
+  if (orig.mUnknownPackageData != NULL)
+  {
+    const UnknownPackageData& data = *orig.mUnknownPackageData;
+    UnknownPackageData& copy = getUnknownPackageData();
+    copy.mAttributesOfUnknownPkg = data.mAttributesOfUnknownPkg;
+    copy.mAttributesOfUnknownDisabledPkg = data.mAttributesOfUnknownDisabledPkg;
+    copy.mElementsOfUnknownPkg = data.mElementsOfUnknownPkg;
+    copy.mElementsOfUnknownDisabledPkg = data.mElementsOfUnknownDisabledPkg;
+  }
+
+  this->mSBMLNamespaces = sharePlainNamespaces(orig.mSBML != NULL
+    ? orig.mSBML->mSBMLNamespaces : orig.mSBMLNamespaces);
 
   if(orig.mCVTerms != NULL)
   {
@@ -482,7 +634,7 @@ SBase::~SBase ()
 {
   if (mNotes != NULL)       delete mNotes;
   if (mAnnotation != NULL)  delete mAnnotation;
-  if (mSBMLNamespaces != NULL)  delete mSBMLNamespaces;
+  SBMLNamespaces::release(mSBMLNamespaces);
   if (mCVTerms != NULL)
   {
     unsigned int size = mCVTerms->getSize();
@@ -494,10 +646,13 @@ SBase::~SBase ()
     delete mCVTerms;
   }
   if (mHistory != NULL) delete mHistory;
+  delete mDeferredElements;
   mHasBeenDeleted = true;
+  invalidateIdIndexes();
 
   for_each( mPlugins.begin(), mPlugins.end(), DeletePluginEntity() );
   deleteDisabledPlugins(false);
+  delete mUnknownPackageData;
 }
 
 /*
@@ -507,6 +662,8 @@ SBase& SBase::operator=(const SBase& rhs)
 {
   if(&rhs!=this)
   {
+    invalidateIdIndexes();
+    invalidateOriginalText();
     this->mId     = rhs.mId;
     this->mName   = rhs.mName;
     this->mMetaId = rhs.mMetaId;
@@ -514,7 +671,7 @@ SBase& SBase::operator=(const SBase& rhs)
     delete this->mNotes;
 
     if(rhs.mNotes != NULL)
-      this->mNotes = new XMLNode(*const_cast<SBase&>(rhs).getNotes());
+      this->mNotes = new XMLNode(*rhs.mNotes);
     else
       this->mNotes = NULL;
 
@@ -525,22 +682,38 @@ SBase& SBase::operator=(const SBase& rhs)
     else
       this->mAnnotation = NULL;
 
+    delete this->mDeferredElements;
+
+    if (rhs.mDeferredElements != NULL)
+      this->mDeferredElements =
+        new std::vector<DeferredElement>(*rhs.mDeferredElements);
+    else
+      this->mDeferredElements = NULL;
+
     this->mSBML       = rhs.mSBML;
     this->mSBOTerm    = rhs.mSBOTerm;
     this->mLine       = rhs.mLine;
     this->mColumn     = rhs.mColumn;
     this->mParentSBMLObject = rhs.mParentSBMLObject;
     this->mUserData   = rhs.mUserData;
-    this->mAttributesOfUnknownPkg = rhs.mAttributesOfUnknownPkg;
-    this->mAttributesOfUnknownDisabledPkg = rhs.mAttributesOfUnknownDisabledPkg;
-    this->mElementsOfUnknownPkg = rhs.mElementsOfUnknownPkg;
-    this->mElementsOfUnknownDisabledPkg = rhs.mElementsOfUnknownDisabledPkg;
 
-    delete this->mSBMLNamespaces;
+    if (rhs.mUnknownPackageData != NULL || this->mUnknownPackageData != NULL)
+    {
+      // the plugins of disabled packages are kept
+      static const UnknownPackageData none;
+      const UnknownPackageData& data = (rhs.mUnknownPackageData != NULL)
+        ? *rhs.mUnknownPackageData : none;
+      UnknownPackageData& copy = getUnknownPackageData();
+      copy.mAttributesOfUnknownPkg = data.mAttributesOfUnknownPkg;
+      copy.mAttributesOfUnknownDisabledPkg = data.mAttributesOfUnknownDisabledPkg;
+      copy.mElementsOfUnknownPkg = data.mElementsOfUnknownPkg;
+      copy.mElementsOfUnknownDisabledPkg = data.mElementsOfUnknownDisabledPkg;
+    }
+
+    SBMLNamespaces::release(this->mSBMLNamespaces);
 
     if(rhs.mSBMLNamespaces != NULL)
-      this->mSBMLNamespaces =
-      new SBMLNamespaces(*const_cast<SBase&>(rhs).mSBMLNamespaces);
+      this->mSBMLNamespaces = sharePlainNamespaces(rhs.mSBMLNamespaces);
     else
       this->mSBMLNamespaces = NULL;
 
@@ -717,7 +890,7 @@ SBase::getId () const
   }
   else
   {
-    return mEmptyString;
+    return *XMLStringPool::getEmpty();
   }
 }
 
@@ -735,7 +908,7 @@ SBase::getName () const
   }
   else
   {
-    return mEmptyString;
+    return *XMLStringPool::getEmpty();
   }
 }
 
@@ -752,6 +925,8 @@ SBase::getIdAttribute () const
 XMLNode*
 SBase::getNotes()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   return mNotes;
 }
 
@@ -759,6 +934,7 @@ SBase::getNotes()
 XMLNode*
 SBase::getNotes() const
 {
+  readDeferredElements();
   return mNotes;
 }
 
@@ -769,6 +945,7 @@ SBase::getNotes() const
 std::string
 SBase::getNotesString()
 {
+  readDeferredElements();
   return XMLNode::convertXMLNodeToString(mNotes);
 }
 
@@ -776,6 +953,7 @@ SBase::getNotesString()
 std::string
 SBase::getNotesString() const
 {
+  readDeferredElements();
   return XMLNode::convertXMLNodeToString(mNotes);
 }
 
@@ -786,6 +964,8 @@ SBase::getNotesString() const
 XMLNode*
 SBase::getAnnotation ()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   syncAnnotation();
 
   return mAnnotation;
@@ -795,7 +975,10 @@ SBase::getAnnotation ()
 XMLNode*
 SBase::getAnnotation () const
 {
-  return const_cast<SBase *>(this)->getAnnotation();
+  readDeferredElements();
+  const_cast<SBase *>(this)->syncAnnotation();
+
+  return mAnnotation;
 }
 
 
@@ -805,7 +988,8 @@ SBase::getAnnotation () const
 std::string
 SBase::getAnnotationString ()
 {
-  return XMLNode::convertXMLNodeToString(getAnnotation());
+  return XMLNode::convertXMLNodeToString(
+    static_cast<const SBase *>(this)->getAnnotation());
 }
 
 
@@ -847,6 +1031,7 @@ SBase::getURI() const
 void
 SBase::replaceSIDWithFunction(const std::string&, const ASTNode*)
 {
+  invalidateOriginalText();
  // This function does nothing itself--subclasses with ASTNode subelements must override this function.
 }
 /** @endcond */
@@ -855,6 +1040,7 @@ SBase::replaceSIDWithFunction(const std::string&, const ASTNode*)
 void
 SBase::divideAssignmentsToSIdByFunction(const std::string&, const ASTNode*)
 {
+  invalidateOriginalText();
  // This function does nothing itself--subclasses with ASTNode subelements must override this function.
 }
 /** @endcond */
@@ -863,6 +1049,7 @@ SBase::divideAssignmentsToSIdByFunction(const std::string&, const ASTNode*)
 void
 SBase::multiplyAssignmentsToSIdByFunction(const std::string&, const ASTNode*)
 {
+  invalidateOriginalText();
  // This function does nothing itself--subclasses with ASTNode subelements must override this function.
 }
 /** @endcond */
@@ -928,7 +1115,11 @@ SBase::getNamespaces() const
   if (mSBML != NULL)
     return mSBML->getSBMLNamespaces()->getNamespaces();
   if (mSBMLNamespaces != NULL)
+  {
+    // the namespaces returned may be changed, so they must not be shared
+    const_cast<SBase*>(this)->unshareSBMLNamespaces();
     return mSBMLNamespaces->getNamespaces();
+  }
   return NULL;
 }
 
@@ -1055,12 +1246,15 @@ SBase::getColumn () const
 ModelHistory*
 SBase::getModelHistory() const
 {
+  readDeferredElements();
   return mHistory;
 }
 
 ModelHistory*
 SBase::getModelHistory()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   return mHistory;
 }
 
@@ -1116,6 +1310,7 @@ SBase::isSetIdAttribute () const
 bool
 SBase::isSetNotes () const
 {
+  readDeferredElements();
   return (mNotes != NULL);
 }
 
@@ -1127,6 +1322,7 @@ SBase::isSetNotes () const
 bool
 SBase::isSetAnnotation () const
 {
+  readDeferredElements();
   const_cast <SBase *> (this)->syncAnnotation();
   return (mAnnotation != NULL);
 }
@@ -1146,6 +1342,7 @@ SBase::isSetSBOTerm () const
 bool
 SBase::isSetModelHistory() const
 {
+  readDeferredElements();
   return (mHistory != NULL);
 }
 
@@ -1156,12 +1353,15 @@ SBase::isSetModelHistory() const
 int
 SBase::setMetaId (const std::string& metaid)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   if (getLevel() == 1)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
   }
   else if (metaid.empty())
   {
+    unindexMetaId();
     mMetaId.erase();
     // force any annotation to synchronize
     if (isSetAnnotation())
@@ -1176,6 +1376,7 @@ SBase::setMetaId (const std::string& metaid)
   }
   else
   {
+    unindexMetaId();
     mMetaId = metaid;
     // force any annotation to synchronize
     if (isSetAnnotation())
@@ -1190,6 +1391,7 @@ SBase::setMetaId (const std::string& metaid)
 int
 SBase::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (getLevel() == 3 && getVersion() > 1)
   {
     // HACK to make a rule/initailassignment/eventassignment
@@ -1209,6 +1411,7 @@ SBase::setId (const std::string& sid)
     }
     else
     {
+      invalidateIdIndexes();
       mId = sid;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -1223,6 +1426,7 @@ SBase::setId (const std::string& sid)
 int
 SBase::setName (const std::string& name)
 {
+  invalidateOriginalText();
   if (getLevel() == 3 && getVersion() > 1)
   {
     mName = name;
@@ -1238,12 +1442,14 @@ SBase::setName (const std::string& name)
 int
 SBase::setIdAttribute (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -1255,6 +1461,8 @@ SBase::setIdAttribute (const std::string& sid)
 int
 SBase::setAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   //
   // (*NOTICE*)
   //
@@ -1373,6 +1581,8 @@ SBase::setAnnotation (const XMLNode* annotation)
 int
 SBase::setAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   
   int success = LIBSBML_OPERATION_FAILED;
   
@@ -1420,6 +1630,8 @@ SBase::setAnnotation (const std::string& annotation)
 int
 SBase::appendAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   unsigned int duplicates = 0;
 
@@ -1532,6 +1744,8 @@ SBase::appendAnnotation (const XMLNode* annotation)
 int
 SBase::appendAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   //
   // (*NOTICE*)
   //
@@ -1573,6 +1787,8 @@ int
 SBase::removeTopLevelAnnotationElement(const std::string& elementName,
     const std::string elementURI, bool removeEmpty)
 {
+  invalidateOriginalText();
+  readDeferredElements();
 
   int success = LIBSBML_OPERATION_FAILED;
   if (mAnnotation == NULL)
@@ -1646,6 +1862,8 @@ SBase::removeTopLevelAnnotationElement(const std::string& elementName,
 int
 SBase::replaceTopLevelAnnotationElement(const XMLNode* annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   XMLNode * replacement = NULL;
   if (annotation->getName() == "annotation")
@@ -1680,6 +1898,8 @@ SBase::replaceTopLevelAnnotationElement(const XMLNode* annotation)
 int
 SBase::replaceTopLevelAnnotationElement(const std::string& annotation)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   XMLNode* annt_xmln;
   if (getSBMLDocument() != NULL)
@@ -1709,6 +1929,8 @@ SBase::replaceTopLevelAnnotationElement(const std::string& annotation)
 int
 SBase::setNotes(const XMLNode* notes)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   if (mNotes == notes)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -1779,6 +2001,8 @@ SBase::setNotes(const XMLNode* notes)
 int
 SBase::setNotes(const std::string& notes, bool addXHTMLMarkup)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   
   if (notes.empty())
@@ -1857,6 +2081,8 @@ SBase::setNotes(const std::string& notes, bool addXHTMLMarkup)
 int
 SBase::appendNotes(const XMLNode* notes)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   if(notes == NULL)
   {
@@ -2199,6 +2425,8 @@ SBase::appendNotes(const XMLNode* notes)
 int
 SBase::appendNotes(const std::string& notes)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   int success = LIBSBML_OPERATION_FAILED;
   if (notes.empty())
   {
@@ -2229,6 +2457,8 @@ SBase::appendNotes(const std::string& notes)
 int
 SBase::setModelHistory(ModelHistory * history)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   /* ModelHistory is only allowed on Model in L2
    * but on any element in L3
    */
@@ -2299,6 +2529,7 @@ SBase::connectToParent (SBase* parent)
   mParentSBMLObject = parent;
   if (mParentSBMLObject)
   {
+    invalidateIdIndexes();
 #if 0
     cout << "[DEBUG] connectToParent " << this << " (parent) " << SBMLTypeCode_toString(parent->getTypeCode(),"core")
          << " " << parent->getSBMLDocument() << endl;
@@ -2331,6 +2562,31 @@ SBase::connectToChild()
     mPlugins[p]->connectToParent(this);
   }
 }
+
+
+/*
+ * Marks the identifier indexes kept by ListOf and Model objects as out of
+ * date.
+ */
+void
+SBase::invalidateIdIndexes()
+{
+  IdIndex::invalidateAll();
+}
+
+
+/*
+ * Removes the metaid of this object from the index kept by its document.
+ */
+void
+SBase::unindexMetaId()
+{
+  SBMLDocument* doc = getSBMLDocument();
+  if (doc != NULL && !mMetaId.empty())
+  {
+    doc->unindexMetaId(mMetaId, this);
+  }
+}
 /** @endcond */
 
 SBase*
@@ -2397,6 +2653,7 @@ SBase::getAncestorOfType(int type, const std::string pkgName) const
 int
 SBase::setSBOTerm (int value)
 {
+  invalidateOriginalText();
   if (getLevel() < 2 || (getLevel() == 2 && getVersion() < 2))
   {
     mSBOTerm = -1;
@@ -2420,6 +2677,7 @@ SBase::setSBOTerm (int value)
 int
 SBase::setSBOTerm (const std::string &sboid)
 {
+  invalidateOriginalText();
   return setSBOTerm(SBO::stringToInt(sboid));
 }
 
@@ -2432,16 +2690,18 @@ SBase::setSBOTerm (const std::string &sboid)
 int
 SBase::setNamespaces(XMLNamespaces* xmlns)
 {
+  invalidateOriginalText();
+  unshareSBMLNamespaces();
   if (xmlns == NULL)
   {
     mSBMLNamespaces->setNamespaces(NULL);
-    return LIBSBML_OPERATION_SUCCESS;
   }
   else
   {
     mSBMLNamespaces->setNamespaces(xmlns);
-    return LIBSBML_OPERATION_SUCCESS;
   }
+  shareSBMLNamespaces();
+  return LIBSBML_OPERATION_SUCCESS;
 }
 
 
@@ -2452,12 +2712,14 @@ SBase::setNamespaces(XMLNamespaces* xmlns)
 int
 SBase::unsetMetaId ()
 {
+  invalidateOriginalText();
   /* only in L2 onwards */
   if (getLevel() < 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
   }
 
+  unindexMetaId();
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -2477,8 +2739,10 @@ SBase::unsetMetaId ()
 int
 SBase::unsetId ()
 {
+  invalidateOriginalText();
   if (getLevel() == 3 && getVersion() > 1)
   {
+    invalidateIdIndexes();
     mId.erase();
     // HACK to make a rule in l3v2 not able to use this function
     int tc = getTypeCode();
@@ -2509,6 +2773,8 @@ SBase::unsetId ()
 int
 SBase::unsetIdAttribute ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
@@ -2528,6 +2794,7 @@ SBase::unsetIdAttribute ()
 int
 SBase::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 3 && getVersion() > 1)
   {
     mName.erase();
@@ -2554,6 +2821,8 @@ SBase::unsetName ()
 int
 SBase::unsetNotes ()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   delete mNotes;
   mNotes = NULL;
   return LIBSBML_OPERATION_SUCCESS;
@@ -2566,6 +2835,8 @@ SBase::unsetNotes ()
 int
 SBase::unsetAnnotation ()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   const XMLNode* empty = NULL;
   return setAnnotation(empty);
 }
@@ -2577,6 +2848,7 @@ SBase::unsetAnnotation ()
 int
 SBase::unsetSBOTerm ()
 {
+  invalidateOriginalText();
   if (getLevel() < 2 || (getLevel() == 2 && getVersion() < 2))
   {
     mSBOTerm = -1;
@@ -2687,6 +2959,8 @@ int SBase::addTermToExistingBag(CVTerm *term, QualifierType_t type ) const
 int
 SBase::addCVTerm(CVTerm * term, bool newBag)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   unsigned int added = 0;
   // shouldnt add a CVTerm to an object with no metaid
   if (!isSetMetaId())
@@ -2751,6 +3025,8 @@ SBase::addCVTerm(CVTerm * term, bool newBag)
 List*
 SBase::getCVTerms()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   return mCVTerms;
 }
 
@@ -2761,6 +3037,7 @@ SBase::getCVTerms()
 List*
 SBase::getCVTerms() const
 {
+  readDeferredElements();
   return mCVTerms;
 }
 
@@ -2773,6 +3050,7 @@ SBase::getCVTerms() const
 unsigned int
 SBase::getNumCVTerms() const
 {
+  readDeferredElements();
   if (mCVTerms != NULL)
   {
     return mCVTerms->getSize();
@@ -2795,6 +3073,8 @@ SBase::getNumCVTerms() const
 CVTerm*
 SBase::getCVTerm(unsigned int n)
 {
+  invalidateOriginalText();
+  readDeferredElements();
   return (mCVTerms) ? static_cast <CVTerm*> (mCVTerms->get(n)) : NULL;
 }
 
@@ -2806,6 +3086,8 @@ SBase::getCVTerm(unsigned int n)
 int
 SBase::unsetCVTerms()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   if (mCVTerms != NULL)
   {
     unsigned int size = mCVTerms->getSize();
@@ -2825,6 +3107,8 @@ SBase::unsetCVTerms()
 int
 SBase::unsetModelHistory()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   if (mHistory != NULL)
     mHistoryChanged = true;
 
@@ -2862,6 +3146,7 @@ SBase::unsetModelHistory()
 BiolQualifierType_t
 SBase::getResourceBiologicalQualifier(std::string resource) const
 {
+  readDeferredElements();
   if (mCVTerms != NULL)
   {
     for (unsigned int n = 0; n < mCVTerms->getSize(); n++)
@@ -2899,6 +3184,7 @@ SBase::getResourceBiologicalQualifier(std::string resource) const
 ModelQualifierType_t
 SBase::getResourceModelQualifier(std::string resource) const
 {
+  readDeferredElements();
   if (mCVTerms != NULL)
   {
     for (unsigned int n = 0; n < mCVTerms->getSize(); n++)
@@ -3229,19 +3515,21 @@ SBase::getObject(const std::string& objectName, unsigned int index)
 int
 SBase::setMath(const ASTNode* math)
 {
+  invalidateOriginalText();
   return LIBSBML_UNEXPECTED_ATTRIBUTE;
 }
 
 int
 SBase::setMessage (const std::string& message, bool addXHTMLMarkup)
 {
+  invalidateOriginalText();
   return LIBSBML_UNEXPECTED_ATTRIBUTE;
 }
 
 std::string 
 SBase::getMessageString () const
 {
-  return mEmptyString;
+  return *XMLStringPool::getEmpty();
 }
 
 
@@ -3391,7 +3679,7 @@ SBasePlugin*
 SBase::getDisabledPlugin(unsigned int n)
 {
   if (n>=getNumDisabledPlugins()) return NULL;
-  return mDisabledPlugins[n];
+  return mUnknownPackageData->mDisabledPlugins[n];
 }
 
 
@@ -3432,14 +3720,31 @@ SBase::getNumPlugins() const
 unsigned int
 SBase::getNumDisabledPlugins() const
 {
-  return (unsigned int)mDisabledPlugins.size();
+  return (mUnknownPackageData != NULL)
+    ? (unsigned int)mUnknownPackageData->mDisabledPlugins.size() : 0;
 }
 
+/** @cond doxygenLibsbmlInternal */
+SBase::UnknownPackageData&
+SBase::getUnknownPackageData()
+{
+  if (mUnknownPackageData == NULL)
+    mUnknownPackageData = new UnknownPackageData();
+
+  return *mUnknownPackageData;
+}
+/** @endcond */
+
+
 void 
 SBase::deleteDisabledPlugins(bool recursive /*= true*/)
 {
-  for_each(mDisabledPlugins.begin(), mDisabledPlugins.end(), DeletePluginEntity());
-  mDisabledPlugins.clear();
+  if (mUnknownPackageData != NULL)
+  {
+    std::vector<SBasePlugin*>& disabled = mUnknownPackageData->mDisabledPlugins;
+    for_each(disabled.begin(), disabled.end(), DeletePluginEntity());
+    disabled.clear();
+  }
 
   if (recursive)
   {
@@ -3456,6 +3761,7 @@ SBase::deleteDisabledPlugins(bool recursive /*= true*/)
 int
 SBase::disablePackage(const std::string& pkgURI, const std::string& prefix)
 {
+  invalidateOriginalText();
   return enablePackage(pkgURI, prefix, false);
 }
 
@@ -3465,6 +3771,7 @@ SBase::disablePackage(const std::string& pkgURI, const std::string& prefix)
 int
 SBase::enablePackage(const std::string& pkgURI, const std::string& prefix, bool flag)
 {
+  invalidateOriginalText();
   //
   // Checks if the package with the given URI is already enabled/disabled with
   // this element.
@@ -3566,7 +3873,9 @@ SBase::enablePackageInternal(const std::string& pkgURI, const std::string& pkgPr
       cout << "[DEBUG] SBase::enablePackageInternal() (uri) " <<  pkgURI
         << " (prefix) " << pkgPrefix << " (element) " << getElementName() << endl;
 #endif
+      unshareSBMLNamespaces();
       mSBMLNamespaces->addNamespace(pkgURI, pkgPrefix);
+      shareSBMLNamespaces();
     }
 
     //
@@ -3575,14 +3884,15 @@ SBase::enablePackageInternal(const std::string& pkgURI, const std::string& pkgPr
     //
 
     bool wasDisabled = false;
-    int numDisabledPlugins = (int)mDisabledPlugins.size();
+    int numDisabledPlugins = (int)getNumDisabledPlugins();
     for (int i = numDisabledPlugins - 1; i >= 0; --i)
     {
-      SBasePlugin *current = mDisabledPlugins[(size_t)i];
+      std::vector<SBasePlugin*>& disabled = mUnknownPackageData->mDisabledPlugins;
+      SBasePlugin *current = disabled[(size_t)i];
       std::string uri = current->getURI();
       if (pkgURI == uri)
       {
-        mDisabledPlugins.erase(mDisabledPlugins.begin() + i);
+        disabled.erase(disabled.begin() + i);
         current->connectToParent(this);
         mPlugins.push_back(current);
         wasDisabled = true;
@@ -3612,7 +3922,8 @@ SBase::enablePackageInternal(const std::string& pkgURI, const std::string& pkgPr
         }
         if (sbPluginCreator)
         {
-          SBasePlugin* entity = sbPluginCreator->createPlugin(pkgURI, pkgPrefix, getNamespaces());
+          SBasePlugin* entity = sbPluginCreator->createPlugin(pkgURI, pkgPrefix,
+                                       getSBMLNamespaces()->getNamespaces());
           entity->connectToParent(this);
           mPlugins.push_back(entity);
         }
@@ -3622,31 +3933,35 @@ SBase::enablePackageInternal(const std::string& pkgURI, const std::string& pkgPr
     /* check whether we are trying to reenable an unknown package
      * that we previously disabled
      */
-    for (int i = 0; i < mAttributesOfUnknownDisabledPkg.getLength();)
+    if (mUnknownPackageData != NULL)
     {
-      if (pkgURI == mAttributesOfUnknownDisabledPkg.getURI(i)
-        && pkgPrefix == mAttributesOfUnknownDisabledPkg.getPrefix(i))
+      UnknownPackageData& data = *mUnknownPackageData;
+      for (int i = 0; i < data.mAttributesOfUnknownDisabledPkg.getLength();)
       {
-        mAttributesOfUnknownPkg.add(
-          mAttributesOfUnknownDisabledPkg.getName(i), 
-          mAttributesOfUnknownDisabledPkg.getValue(i), pkgURI, pkgPrefix);
-        mAttributesOfUnknownDisabledPkg.remove(i);
-      }
-      else {
-        i++;
+        if (pkgURI == data.mAttributesOfUnknownDisabledPkg.getURI(i)
+          && pkgPrefix == data.mAttributesOfUnknownDisabledPkg.getPrefix(i))
+        {
+          data.mAttributesOfUnknownPkg.add(
+            data.mAttributesOfUnknownDisabledPkg.getName(i), 
+            data.mAttributesOfUnknownDisabledPkg.getValue(i), pkgURI, pkgPrefix);
+          data.mAttributesOfUnknownDisabledPkg.remove(i);
+        }
+        else {
+          i++;
+        }
       }
-    }
-    for (unsigned int i = 0; i < mElementsOfUnknownDisabledPkg.getNumChildren();)
-    {
-      if (pkgURI == mElementsOfUnknownDisabledPkg.getChild(i).getURI()
-        && pkgPrefix == mElementsOfUnknownDisabledPkg.getChild(i).getPrefix())
+      for (unsigned int i = 0; i < data.mElementsOfUnknownDisabledPkg.getNumChildren();)
       {
-        mElementsOfUnknownPkg.addChild(mElementsOfUnknownDisabledPkg.getChild(i));
-        XMLNode* removed = mElementsOfUnknownDisabledPkg.removeChild(i);
-        delete removed;
-      }
-      else {
-        i++;
+        if (pkgURI == data.mElementsOfUnknownDisabledPkg.getChild(i).getURI()
+          && pkgPrefix == data.mElementsOfUnknownDisabledPkg.getChild(i).getPrefix())
+        {
+          data.mElementsOfUnknownPkg.addChild(data.mElementsOfUnknownDisabledPkg.getChild(i));
+          XMLNode* removed = data.mElementsOfUnknownDisabledPkg.removeChild(i);
+          delete removed;
+        }
+        else {
+          i++;
+        }
       }
     }
   }
@@ -3663,43 +3978,49 @@ SBase::enablePackageInternal(const std::string& pkgURI, const std::string& pkgPr
       if (pkgURI == uri)
       {        
         mPlugins.erase( mPlugins.begin() + i );
-        mDisabledPlugins.push_back(current);
+        getUnknownPackageData().mDisabledPlugins.push_back(current);
       }
     }
 
     if (mSBMLNamespaces)
     {
+      unshareSBMLNamespaces();
       mSBMLNamespaces->removeNamespace(pkgURI);
+      shareSBMLNamespaces();
     }
 
     /* before we remove the unknown package keep a copy
      * in case we try to re-enable it later
      */
-    for (int i = 0; i < mAttributesOfUnknownPkg.getLength();)
+    if (mUnknownPackageData != NULL)
     {
-      if (pkgURI == mAttributesOfUnknownPkg.getURI(i)
-        && pkgPrefix == mAttributesOfUnknownPkg.getPrefix(i))
+      UnknownPackageData& data = *mUnknownPackageData;
+      for (int i = 0; i < data.mAttributesOfUnknownPkg.getLength();)
       {
-        mAttributesOfUnknownDisabledPkg.add(
-          mAttributesOfUnknownPkg.getName(i), 
-          mAttributesOfUnknownPkg.getValue(i), pkgURI, pkgPrefix);
-        mAttributesOfUnknownPkg.remove(i);
-      }
-      else {
-        i++;
+        if (pkgURI == data.mAttributesOfUnknownPkg.getURI(i)
+          && pkgPrefix == data.mAttributesOfUnknownPkg.getPrefix(i))
+        {
+          data.mAttributesOfUnknownDisabledPkg.add(
+            data.mAttributesOfUnknownPkg.getName(i), 
+            data.mAttributesOfUnknownPkg.getValue(i), pkgURI, pkgPrefix);
+          data.mAttributesOfUnknownPkg.remove(i);
+        }
+        else {
+          i++;
+        }
       }
-    }
-    for (unsigned int i = 0; i < mElementsOfUnknownPkg.getNumChildren();)
-    {
-      if (pkgURI == mElementsOfUnknownPkg.getChild(i).getURI()
-        && pkgPrefix == mElementsOfUnknownPkg.getChild(i).getPrefix())
+      for (unsigned int i = 0; i < data.mElementsOfUnknownPkg.getNumChildren();)
       {
-        mElementsOfUnknownDisabledPkg.addChild(mElementsOfUnknownPkg.getChild(i));
-        XMLNode* removed = mElementsOfUnknownPkg.removeChild(i);
-        delete removed;
-      }
-      else {
-        i++;
+        if (pkgURI == data.mElementsOfUnknownPkg.getChild(i).getURI()
+          && pkgPrefix == data.mElementsOfUnknownPkg.getChild(i).getPrefix())
+        {
+          data.mElementsOfUnknownDisabledPkg.addChild(data.mElementsOfUnknownPkg.getChild(i));
+          XMLNode* removed = data.mElementsOfUnknownPkg.removeChild(i);
+          delete removed;
+        }
+        else {
+          i++;
+        }
       }
     }
   }
@@ -3796,7 +4117,7 @@ bool
 SBase::hasValidLevelVersionNamespaceCombination()
 {
   int typecode = getTypeCode();
-  XMLNamespaces *xmlns = getNamespaces();
+  XMLNamespaces *xmlns = getSBMLNamespaces()->getNamespaces();
 
   return hasValidLevelVersionNamespaceCombination(typecode, xmlns);
 }
@@ -4224,7 +4545,8 @@ SBase::setSBMLNamespaces(const SBMLNamespaces * sbmlns)
 void
 SBase::setSBMLNamespacesAndOwn(SBMLNamespaces * sbmlns)
 {
-  delete mSBMLNamespaces;
+  // the constructors passing sbmlns still use it, so it is not shared
+  SBMLNamespaces::release(mSBMLNamespaces);
   mSBMLNamespaces = sbmlns;
 
   if(sbmlns != NULL)
@@ -4232,6 +4554,25 @@ SBase::setSBMLNamespacesAndOwn(SBMLNamespaces * sbmlns)
 }
 
 
+void
+SBase::unshareSBMLNamespaces()
+{
+  mSBMLNamespaces = SBMLNamespaces::unshare(mSBMLNamespaces);
+}
+
+
+void
+SBase::shareSBMLNamespaces()
+{
+  if (mSBMLNamespaces == NULL || getTypeCode() == SBML_DOCUMENT)
+    return;
+
+  SBMLNamespaces* own = mSBMLNamespaces;
+  mSBMLNamespaces = SBMLNamespaces::share(own);
+  SBMLNamespaces::release(own);
+}
+
+
 /* gets the SBMLnamespaces - internal use only*/
 SBMLNamespaces *
 SBase::getSBMLNamespaces() const
@@ -4275,10 +4616,15 @@ SBase::read (XMLInputStream& stream)
   const XMLToken  element  = stream.next();
   int             position =  0;
 
+  // where the element is in the original text, when that is kept
+  size_t originalBegin = 0;
+  size_t originalEnd   = 0;
+  const bool original  = stream.getElementSpan(originalBegin, originalEnd);
+
   setSBaseFields( element );
 
-  ExpectedAttributes expectedAttributes;
-  addExpectedAttributes(expectedAttributes);
+  const ExpectedAttributes& expectedAttributes = getExpectedAttributes();
+  invalidateIdIndexes();
   readAttributes( element.getAttributes(), expectedAttributes );
 
   /* if we are reading a document pass the
@@ -4330,8 +4676,7 @@ SBase::read (XMLInputStream& stream)
 
         if (error == true && errorLoggedAlready == false)
         {
-          static ostringstream errMsg;
-          errMsg.str("");
+          ostringstream errMsg;
           errMsg << "The prefix for the <sbml> element does not match "
             << "the prefix for the SBML namespace.  This means that "
             << "the <sbml> element in not in the SBMLNamespace."<< endl;
@@ -4359,7 +4704,17 @@ SBase::read (XMLInputStream& stream)
     }
   }
 
-  if ( element.isEnd() ) return;
+  if ( element.isEnd() )
+  {
+    if (original) keepOriginalText(true, originalBegin, originalEnd);
+    return;
+  }
+
+  // set when the items of lists are read separately
+  ListOfItemsReader* itemsReader = stream.getListOfItemsReader();
+
+  // set when notes and annotations are read when first used
+  DeferredElementReader* deferredReader = stream.getDeferredElementReader();
 
   while ( stream.isGood() )
   {
@@ -4385,17 +4740,31 @@ SBase::read (XMLInputStream& stream)
 
     if ( next.isEndFor(element) )
     {
+      if (itemsReader != NULL) itemsReader->readEnd(*this);
       stream.next();
-      break;
+      if (original) keepOriginalText(true, originalBegin, originalEnd);
+      return;
     }
     else if ( next.isStart() )
     {
-      const std::string nextName = next.getName();
+      // names are interned, so this stays valid once next is consumed
+      const std::string& nextName = next.getName();
 #if 0
       cout << "[DEBUG] SBase::read " << nextName << " uri "
            << stream.peek().getURI() << endl;
 #endif
 
+      if (itemsReader != NULL && itemsReader->readChild(*this, stream))
+      {
+        continue;
+      }
+
+      if (deferredReader != NULL && DeferredElementReader::isPlaceholder(next))
+      {
+        readDeferredElement(stream, *deferredReader);
+        continue;
+      }
+
       SBase * object = NULL;
       try
       {
@@ -4444,6 +4813,78 @@ SBase::read (XMLInputStream& stream)
       stream.skipPastEnd( stream.next() );
     }
   }
+
+  if (original) keepOriginalText(false, originalBegin, originalEnd);
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Keeps where this object can be written from in the original text.
+ */
+void
+SBase::keepOriginalText (bool complete, size_t begin, size_t end)
+{
+  // only what is read of the objects of the core is sure to be written
+  // back as it was: those of packages, and objects with plugins, are
+  // always written again, and so are the objects containing them; the
+  // plugins of packages in the namespace of the core itself (such as
+  // l3v2extendedmath) add nothing to the text of an object
+  bool core = complete && begin < end && mOriginalBegin == 0
+              && getPackageName() == "core";
+
+  for (size_t i = 0; core && i < mPlugins.size(); ++i)
+  {
+    core = (mPlugins[i]->getElementNamespace() == mURI);
+  }
+
+  if (core)
+  {
+    mOriginalBegin = begin;
+    mOriginalEnd   = end;
+  }
+  else
+  {
+    mOriginalBegin = 0;
+    mOriginalEnd   = 0;
+
+    // the object being read that contains this one was changed by reading
+    // it; mOriginalBegin only marks objects without a span
+    if (mParentSBMLObject != NULL && mParentSBMLObject->mOriginalEnd == 0)
+    {
+      mParentSBMLObject->mOriginalBegin = 1;
+    }
+  }
+}
+
+
+bool
+SBase::hasOriginalText () const
+{
+  return mOriginalEnd != 0;
+}
+
+
+/*
+ * Marks this object and the objects containing it as changed.
+ */
+void
+SBase::invalidateOriginalText ()
+{
+  if (mOriginalEnd == 0) return;
+
+  SBase* object = this;
+  do
+  {
+    object->mOriginalBegin = 0;
+    object->mOriginalEnd   = 0;
+    object = object->mParentSBMLObject;
+  }
+  while (object != NULL && object->mOriginalEnd != 0);
+
+  // an object still being read must not be given a span when it ends
+  if (object != NULL) object->mOriginalBegin = 1;
 }
 /** @endcond */
 
@@ -4478,6 +4919,17 @@ SBase::write (XMLOutputStream& stream) const
   }
 #endif
 
+  // unchanged since it was read, the object is written as it was
+  if (mOriginalEnd != 0 && stream.getOriginalText() != NULL)
+  {
+    const SBMLDocument* d = getSBMLDocument();
+    if (d != NULL && d->getOriginalText() == stream.getOriginalText())
+    {
+      stream.writeOriginalText(mOriginalBegin, mOriginalEnd);
+      return;
+    }
+  }
+
   stream.startElement( getElementName(), getPrefix() );
 
   writeXMLNS     ( stream );
@@ -4499,6 +4951,7 @@ SBase::write (XMLOutputStream& stream) const
 void
 SBase::writeElements (XMLOutputStream& stream) const
 {
+  readDeferredElements();
   if (mNotes != NULL)
   {
     mNotes->writeToStream(stream);
@@ -4530,9 +4983,9 @@ SBase::writeExtensionElements (XMLOutputStream& stream) const
   //
   // writes elements of unkown packages
   //
-  if (getLevel() > 2)
+  if (getLevel() > 2 && mUnknownPackageData != NULL)
   {
-    stream << mElementsOfUnknownPkg;
+    stream << mUnknownPackageData->mElementsOfUnknownPkg;
   }
 
   /////////////////////////////////////////////////////////////////////////
@@ -4648,6 +5101,7 @@ SBase::readOtherXML (XMLInputStream& stream)
 bool
 SBase::readAnnotation (XMLInputStream& stream)
 {
+  readDeferredElements();
   const string& name = stream.peek().getName();
 
   unsigned int level = getLevel();
@@ -4779,6 +5233,7 @@ SBase::readAnnotation (XMLInputStream& stream)
 bool
 SBase::readNotes (XMLInputStream& stream)
 {
+  readDeferredElements();
   const string& name = stream.peek().getName();
 
   if (name == "notes")
@@ -4835,6 +5290,84 @@ SBase::readNotes (XMLInputStream& stream)
   return false;
 }
 
+
+/*
+ * Reads the placeholder of a <notes> or <annotation> element left to be
+ * read later.  The element is kept to be read when first used, unless
+ * plugins may need it right away.
+ */
+void
+SBase::readDeferredElement (XMLInputStream& stream,
+                            DeferredElementReader& reader)
+{
+  if (mDeferredElements == NULL)
+  {
+    mDeferredElements = new std::vector<DeferredElement>();
+  }
+  mDeferredElements->push_back(DeferredElement());
+
+  if (!reader.read(stream, mDeferredElements->back()))
+  {
+    mDeferredElements->pop_back();
+    logUnknownElement(stream.peek().getName(), getLevel(), getVersion());
+    stream.skipPastEnd( stream.next() );
+    return;
+  }
+
+  if (!mPlugins.empty())
+  {
+    readDeferredElements();
+  }
+}
+
+
+/*
+ * Reads the <notes> and <annotation> elements left to be read when first
+ * used, as readNotes() and readAnnotation() would have when the document
+ * was read.
+ */
+void
+SBase::readDeferredElements (bool recursive) const
+{
+  SBase* self = const_cast<SBase*>(this);
+
+  if (recursive)
+  {
+    List* elements = self->getAllElements();
+    for (ListIterator it = elements->begin(); it != elements->end(); ++it)
+    {
+      static_cast<SBase*>(*it)->readDeferredElements();
+    }
+    delete elements;
+  }
+
+  if (mDeferredElements == NULL) return;
+
+  std::vector<DeferredElement>* deferred = mDeferredElements;
+  self->mDeferredElements = NULL;
+
+  for (size_t n = 0; n < deferred->size(); ++n)
+  {
+    const DeferredElement& element = (*deferred)[n];
+
+    XMLInputStream stream(element.content.c_str(), false, "",
+                          self->getErrorLog());
+    stream.addRelocation(element.line, element.column,
+                         element.toLine, element.toColumn);
+    stream.setSBMLNamespaces(self->getSBMLNamespaces());
+
+    // the element declaring the namespaces
+    stream.next();
+
+    if (!self->readNotes(stream))
+    {
+      self->readAnnotation(stream);
+    }
+  }
+
+  delete deferred;
+}
+
 bool
 SBase::getHasBeenDeleted() const
 {
@@ -5350,6 +5883,27 @@ SBase::logError (  unsigned int       id
 
 
 /** @cond doxygenLibsbmlInternal */
+/*
+ * Returns the attributes given by addExpectedAttributes(), which are
+ * collected once for each class, element name, namespace, level and
+ * version.
+ */
+const ExpectedAttributes&
+SBase::getExpectedAttributes()
+{
+  ExpectedAttributesKey key = { NULL, &typeid(*this), &getElementName(),
+                                &mURI, getLevel(), getVersion() };
+
+  const ExpectedAttributes* cached = findExpectedAttributes(key);
+  if (cached != NULL) return *cached;
+
+  ExpectedAttributes attributes;
+  addExpectedAttributes(attributes);
+
+  return cacheExpectedAttributes(key, attributes);
+}
+
+
 /**
  * Subclasses should override this method to get the list of
  * expected attributes.
@@ -5546,6 +6100,9 @@ SBase::readExtensionAttributes (const XMLAttributes& attributes, const ExpectedA
     const ExpectedAttributes* base = expectedAttributes  != NULL ?
 expectedAttributes : new ExpectedAttributes();
 
+  // the attributes of the plugins are cached along with those of this
+  // element, so they can only be reused when reading with the latter
+  const bool cached = !mPlugins.empty() && base == &getExpectedAttributes();
 
   for (size_t i=0; i < mPlugins.size(); i++)
   {
@@ -5555,6 +6112,13 @@ expectedAttributes : new ExpectedAttributes();
               << getElementName() << std::endl;
 #endif
 
+    if (cached)
+    {
+      mPlugins[i]->readAttributes(attributes,
+        getPluginExpectedAttributes(mPlugins[i], *base));
+      continue;
+    }
+
     ExpectedAttributes ea(*base);
 
     mPlugins[i]->addExpectedAttributes(ea);
@@ -5601,7 +6165,7 @@ SBase::storeUnknownExtAttribute(const std::string& element,
       std::string prefix = xattr.getPrefix((int)index);
       std::string value  = xattr.getValue((int)index);
 
-      mAttributesOfUnknownPkg.add(name,value,uri,prefix);
+      getUnknownPackageData().mAttributesOfUnknownPkg.add(name,value,uri,prefix);
     }
     else
     {
@@ -5626,7 +6190,7 @@ SBase::storeUnknownExtElement(XMLInputStream &stream)
   {
 
     XMLNode xmlnode(stream);
-    mElementsOfUnknownPkg.addChild(xmlnode);
+    getUnknownPackageData().mElementsOfUnknownPkg.addChild(xmlnode);
 
     return true;
   }
@@ -5645,7 +6209,7 @@ SBase::getPrefix() const
 {
   std::string prefix = "";
 
-  const XMLNamespaces *xmlns = getNamespaces();
+  const XMLNamespaces *xmlns = getSBMLNamespaces()->getNamespaces();
   string uri = getURI();
   if(xmlns && mSBML && !mSBML->isEnabledDefaultNS(uri))
   {
@@ -5684,7 +6248,7 @@ SBase::getSBMLPrefix() const
 {
   std::string prefix = "";
 
-  const XMLNamespaces *xmlns = getNamespaces();
+  const XMLNamespaces *xmlns = getSBMLNamespaces()->getNamespaces();
   if (xmlns == NULL)
     return getPrefix();
 
@@ -5812,12 +6376,16 @@ SBase::writeExtensionAttributes (XMLOutputStream& stream) const
   //
   // writes attributes of unknown packages
   //
-  for (int i=0; i < mAttributesOfUnknownPkg.getLength(); i++)
+  if (mUnknownPackageData != NULL)
   {
-    std::string name   = mAttributesOfUnknownPkg.getName(i);
-    std::string prefix = mAttributesOfUnknownPkg.getPrefix(i);
-    std::string value  = mAttributesOfUnknownPkg.getValue(i);
-    stream.writeAttribute(name, prefix, value);
+    const XMLAttributes& attributes = mUnknownPackageData->mAttributesOfUnknownPkg;
+    for (int i=0; i < attributes.getLength(); i++)
+    {
+      std::string name   = attributes.getName(i);
+      std::string prefix = attributes.getPrefix(i);
+      std::string value  = attributes.getValue(i);
+      stream.writeAttribute(name, prefix, value);
+    }
   }
 
   /////////////////////////////////////////////////////////////////////////
@@ -5873,10 +6441,13 @@ SBase::hasOptionalElements() const
 void
 SBase::syncAnnotation ()
 {
+  readDeferredElements();
   // look to see whether an existing history has been altered
+  // (the members are used rather than the accessors, which would mark
+  // this object as changed)
   if (!mHistoryChanged
-      && getModelHistory() != NULL
-      && getModelHistory()->hasBeenModified()
+      && mHistory != NULL
+      && mHistory->hasBeenModified()
       )
   {
     mHistoryChanged = true;
@@ -5886,7 +6457,7 @@ SBase::syncAnnotation ()
   {
     for (unsigned int i = 0; i < getNumCVTerms(); i++)
     {
-      if (getCVTerm(i)->hasBeenModified() == true)
+      if (static_cast<CVTerm*>(mCVTerms->get(i))->hasBeenModified() == true)
       {
         mCVTermsChanged = true;
         break;
@@ -5896,16 +6467,17 @@ SBase::syncAnnotation ()
 
   if (mHistoryChanged == true || mCVTermsChanged == true)
   {
+    invalidateOriginalText();
     reconstructRDFAnnotation();
     mHistoryChanged = false;
     mCVTermsChanged = false;
-    if (getModelHistory() != NULL)
+    if (mHistory != NULL)
     {
-      getModelHistory()->resetModifiedFlags();
+      mHistory->resetModifiedFlags();
     }
     for (unsigned int i = 0; i < getNumCVTerms(); i++)
     {
-      getCVTerm(i)->resetModifiedFlags();
+      static_cast<CVTerm*>(mCVTerms->get(i))->resetModifiedFlags();
     }
   }
 
@@ -5937,6 +6509,7 @@ SBase::syncAnnotation ()
 void
 SBase::reconstructRDFAnnotation()
 {
+  readDeferredElements();
   bool hasRDF = false;
   bool hasAdditionalRDF = false;
 
@@ -6544,8 +7117,7 @@ SBase::checkDefaultNamespace(const XMLNamespaces* xmlns,
        && (elementName == "notes" || elementName == "annotation"))
     return;
 
-  static ostringstream errMsg;
-  errMsg.str("");
+  ostringstream errMsg;
   errMsg << "xmlns=\"" << defaultURI << "\" in <" << elementName
          << "> element is an invalid namespace." << endl;
 
@@ -6919,6 +7491,8 @@ SBase::checkCompatibility(const SBase * object) const
 void
 SBase::removeDuplicateAnnotations()
 {
+  invalidateOriginalText();
+  readDeferredElements();
   bool resetNecessary = false;
   XMLNamespaces xmlns = XMLNamespaces();
   xmlns.add("http://www.sbml.org/libsbml/annotation", "");
@@ -7079,6 +7653,7 @@ SBase::updateSBMLNamespace(const std::string& package, unsigned int level,
     {
       mSBMLNamespaces = new SBMLNamespaces(level, version);
     }
+    unshareSBMLNamespaces();
 
 
     if (mSBMLNamespaces->getNamespaces() != NULL && 
@@ -7107,6 +7682,7 @@ SBase::updateSBMLNamespace(const std::string& package, unsigned int level,
 
     mSBMLNamespaces->setLevel(level);
     mSBMLNamespaces->setVersion(version);
+    shareSBMLNamespaces();
     if (this->getPackageName().empty() || this->getPackageName() == "core")
       setElementNamespace(uri);
   }
@@ -7144,8 +7720,10 @@ SBase::updateSBMLNamespace(const std::string& package, unsigned int level,
 
       if (found)
       {
+        unshareSBMLNamespaces();
         mSBMLNamespaces->getNamespaces()->remove(uri);
         mSBMLNamespaces->getNamespaces()->add(newURI, package);
+        shareSBMLNamespaces();
         if (this->getPackageName() == package)
           setElementNamespace(newURI);
       }
@@ -186,6 +186,8 @@ class XMLToken;
 class SBasePlugin;
 class IdentifierTransformer;
 class ElementFilter;
+struct DeferredElement;
+class DeferredElementReader;
 
 class LIBSBML_EXTERN SBase
 {
@@ -1744,6 +1746,25 @@ s.setNotes("<body xmlns='http://www.w3.org/1999/xhtml'><p>here is my note</p></b
    */
   virtual void connectToChild ();
 
+
+  /**
+   * Marks the identifier indexes kept by ListOf and Model objects as out
+   * of date.
+   *
+   * This must be called whenever the identifier of an object is about to
+   * change, or an object is attached, removed or deleted, so that
+   * getElementBySId() never answers from an out of date index.  Setters
+   * that assign @c mId directly are responsible for calling it.
+   */
+  static void invalidateIdIndexes ();
+
+
+  /**
+   * Removes the metaid of this object from the index of metaids kept by
+   * its SBMLDocument; to be called before the metaid changes.
+   */
+  void unindexMetaId ();
+
   /** @endcond */
 
 
@@ -2981,6 +3002,39 @@ newModel.addSpecies(s1);
   /** @endcond */
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Reads the <code>&lt;notes&gt;</code> and <code>&lt;annotation&gt;</code>
+   * elements of this object that were left to be read when first used
+   * (see SBMLReader::setReadNotesAndAnnotationsLazily()), and those of all
+   * the objects it contains if @p recursive is @c true.  Errors found in
+   * them are logged then.
+   */
+  void readDeferredElements (bool recursive = false) const;
+  /** @endcond */
+
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Returns @c true if this object has not been changed since it was read
+   * by an SBMLReader keeping the original text of documents (see
+   * SBMLReader::setKeepOriginalText()), so that it is written as it was
+   * read.
+   */
+  bool hasOriginalText () const;
+  /** @endcond */
+
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Marks this object, and the objects that contain it, as changed, so
+   * that they are no longer written as they were read.  Every method
+   * changing an object calls this.
+   */
+  void invalidateOriginalText ();
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
   /**
    * Writes (serializes) this SBML object by writing it to XMLOutputStream.
@@ -3036,6 +3090,18 @@ newModel.addSpecies(s1);
 
   /* sets the SBMLNamaepaces and owns the given object - internal use only */
   void setSBMLNamespacesAndOwn(SBMLNamespaces * disownedNs);
+
+  /*
+   * Gives this object namespaces of its own, not shared with other objects
+   * as they usually are, so that they can be changed.
+   */
+  void unshareSBMLNamespaces();
+
+  /*
+   * Shares the namespaces of this object again once they have been changed,
+   * unless this object is a document, whose namespaces are its own.
+   */
+  void shareSBMLNamespaces();
   /** @endcond */
 
 
@@ -3418,6 +3484,14 @@ protected:
    */
   virtual void addExpectedAttributes(ExpectedAttributes& attributes);
 
+
+  /**
+   * Returns the attributes added by addExpectedAttributes(), which is
+   * only called the first time an element of this class is read with a
+   * given element name, namespace, level and version.
+   */
+  const ExpectedAttributes& getExpectedAttributes();
+
   /**
    * Subclasses should override this method to read values from the given
    * XMLAttributes set into their specific fields.  Be sure to call your
@@ -3707,8 +3781,6 @@ SBase.readExtensionAttributes(attributes, expectedAttributes);
    */
   bool mHasBeenDeleted;
 
-  std::string mEmptyString;
-
   //----------------------------------------------------------------------
   //
   // Additional data members for Extension
@@ -3724,13 +3796,6 @@ SBase.readExtensionAttributes(attributes, expectedAttributes);
   //
   std::vector<SBasePlugin*> mPlugins;
 
-  //
-  // In case an SBasePlugin is disabled, we still store it here in case it 
-  // will be re-enabled later on. 
-  //
-  std::vector<SBasePlugin*> mDisabledPlugins;
-
-
   //
   // namespace to which this SBase object belongs.
   // This variable can be publicly accessible by getElementNamespace function.
@@ -3753,16 +3818,51 @@ SBase.readExtensionAttributes(attributes, expectedAttributes);
   bool            mCVTermsChanged;
 
   //
-  // XMLAttributes object containing attributes of unknown packages
+  // the <notes> and <annotation> elements left to be read when first used,
+  // in the order of the document (see DeferredElementReader)
+  //
+  std::vector<DeferredElement>* mDeferredElements;
+
+  //
+  // where this object starts and ends in the original text of the
+  // document it was read from (see SBMLReader::setKeepOriginalText()),
+  // while it has not been changed since
   //
-  XMLAttributes mAttributesOfUnknownPkg;
-  XMLAttributes mAttributesOfUnknownDisabledPkg;
+  size_t mOriginalBegin;
+  size_t mOriginalEnd;
 
   //
-  // XMLNode object containing elements of unknown packages
+  // what this object has of unknown or disabled packages, which few objects
+  // have, allocated when first needed (see getUnknownPackageData())
   //
-  XMLNode       mElementsOfUnknownPkg;
-  XMLNode       mElementsOfUnknownDisabledPkg;
+  struct UnknownPackageData
+  {
+    //
+    // XMLAttributes object containing attributes of unknown packages
+    //
+    XMLAttributes mAttributesOfUnknownPkg;
+    XMLAttributes mAttributesOfUnknownDisabledPkg;
+
+    //
+    // XMLNode object containing elements of unknown packages
+    //
+    XMLNode       mElementsOfUnknownPkg;
+    XMLNode       mElementsOfUnknownDisabledPkg;
+
+    //
+    // In case an SBasePlugin is disabled, we still store it here in case it 
+    // will be re-enabled later on. 
+    //
+    std::vector<SBasePlugin*> mDisabledPlugins;
+  };
+
+  UnknownPackageData* mUnknownPackageData;
+
+  /*
+   * Returns what this object has of unknown or disabled packages,
+   * allocating it if need be.
+   */
+  UnknownPackageData& getUnknownPackageData();
 
   //-----------------------------------------------------------------------------
 
@@ -3806,6 +3906,23 @@ private:
   bool readNotes (XMLInputStream& stream);
 
 
+  /**
+   * Reads the placeholder of a <notes> or <annotation> element left to be
+   * read later, which is the next token of the stream.
+   */
+  void readDeferredElement (XMLInputStream& stream,
+                            DeferredElementReader& reader);
+
+
+  /**
+   * Called once this object has been read from @p begin to @p end of the
+   * original text, completely if @p complete is @c true: keeps the span
+   * if the object can be written back from it, and otherwise marks the
+   * object containing it as changed.
+   */
+  void keepOriginalText (bool complete, size_t begin, size_t end);
+
+
   /** @endcond */
 };
 
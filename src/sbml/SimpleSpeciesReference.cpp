@@ -195,6 +195,7 @@ SimpleSpeciesReference::isSetSpecies () const
 int
 SimpleSpeciesReference::setSpecies (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -213,6 +214,7 @@ SimpleSpeciesReference::setSpecies (const std::string& sid)
 int
 SimpleSpeciesReference::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (getLevel() == 1 ||
     (getLevel() == 2 && getVersion() == 1))
   {
@@ -247,6 +249,7 @@ SimpleSpeciesReference::setId (const std::string& sid)
                    
     if (enabledLayoutL2)
     {
+      invalidateIdIndexes();
       mId = sid;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -261,6 +264,7 @@ SimpleSpeciesReference::setId (const std::string& sid)
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -273,6 +277,7 @@ SimpleSpeciesReference::setId (const std::string& sid)
 int
 SimpleSpeciesReference::setName (const std::string& name)
 {
+  invalidateOriginalText();
   if (getLevel() == 1 ||
     (getLevel() == 2 && getVersion() == 1))
   {
@@ -296,6 +301,8 @@ SimpleSpeciesReference::setName (const std::string& name)
 int
 SimpleSpeciesReference::unsetId ()
 {
+  invalidateOriginalText();
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
@@ -315,8 +322,10 @@ SimpleSpeciesReference::unsetId ()
 int
 SimpleSpeciesReference::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -345,6 +354,7 @@ SimpleSpeciesReference::unsetName ()
 int
 SimpleSpeciesReference::unsetSpecies ()
 {
+  invalidateOriginalText();
   mSpecies.erase();
 
   if (mSpecies.empty())
@@ -370,6 +380,7 @@ SimpleSpeciesReference::isModifier () const
 void
 SimpleSpeciesReference::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetSpecies()) {
     if (mSpecies==oldid) setSpecies(newid);
@@ -590,12 +590,14 @@ Species::isSetConstant () const
 int
 Species::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -608,6 +610,7 @@ Species::setId (const std::string& sid)
 int
 Species::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -619,6 +622,7 @@ Species::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -637,6 +641,7 @@ Species::setName (const std::string& name)
 int
 Species::setSpeciesType (const std::string& sid)
 {
+  invalidateOriginalText();
   if ( (getLevel() < 2)
     || (getLevel() == 2 && getVersion() == 1))
   {
@@ -660,6 +665,7 @@ Species::setSpeciesType (const std::string& sid)
 int
 Species::setCompartment (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -679,6 +685,7 @@ Species::setCompartment (const std::string& sid)
 int
 Species::setInitialAmount (double value)
 {
+  invalidateOriginalText();
   mInitialAmount      = value;
   mIsSetInitialAmount = true;
 
@@ -694,6 +701,7 @@ Species::setInitialAmount (double value)
 int
 Species::setInitialConcentration (double value)
 {
+  invalidateOriginalText();
   if ( getLevel() < 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -715,6 +723,7 @@ Species::setInitialConcentration (double value)
 int
 Species::setSubstanceUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -733,6 +742,7 @@ Species::setSubstanceUnits (const std::string& sid)
 int
 Species::setSpatialSizeUnits (const std::string& sid)
 {
+  invalidateOriginalText();
   if ( (getLevel() != 2)
     || (getLevel() == 2 && getVersion() > 2))
   {
@@ -756,6 +766,7 @@ Species::setSpatialSizeUnits (const std::string& sid)
 int
 Species::setUnits (const std::string& sname)
 {
+  invalidateOriginalText();
   return setSubstanceUnits(sname);
 }
 
@@ -766,6 +777,7 @@ Species::setUnits (const std::string& sname)
 int
 Species::setHasOnlySubstanceUnits (bool value)
 {
+  invalidateOriginalText();
   if (getLevel() < 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -786,6 +798,7 @@ Species::setHasOnlySubstanceUnits (bool value)
 int
 Species::setBoundaryCondition (bool value)
 {
+  invalidateOriginalText();
   mBoundaryCondition = value;
   mIsSetBoundaryCondition = true;
   mExplicitlySetBoundaryCondition = true;
@@ -799,6 +812,7 @@ Species::setBoundaryCondition (bool value)
 int
 Species::setCharge (int value)
 {
+  invalidateOriginalText();
   if ( !((getLevel() == 1)
     || (getLevel() == 2 && getVersion() == 1)))
   {
@@ -819,6 +833,7 @@ Species::setCharge (int value)
 int
 Species::setConstant (bool value)
 {
+  invalidateOriginalText();
   if ( getLevel() < 2 )
   {
     mConstant = value;
@@ -840,6 +855,7 @@ Species::setConstant (bool value)
 int
 Species::setConversionFactor (const std::string& sid)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -862,8 +878,10 @@ Species::setConversionFactor (const std::string& sid)
 int
 Species::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -889,6 +907,7 @@ Species::unsetName ()
 int
 Species::unsetConstant ()
 {
+  invalidateOriginalText();
   if ( getLevel() < 2 )
   {
     mConstant = false;
@@ -917,6 +936,7 @@ Species::unsetConstant ()
 int
 Species::unsetSpeciesType ()
 {
+  invalidateOriginalText();
   mSpeciesType.erase();
 
   if (mSpeciesType.empty()) 
@@ -936,6 +956,7 @@ Species::unsetSpeciesType ()
 int
 Species::unsetInitialAmount ()
 {
+  invalidateOriginalText();
   mInitialAmount      = numeric_limits<double>::quiet_NaN();
   mIsSetInitialAmount = false;
   
@@ -956,6 +977,7 @@ Species::unsetInitialAmount ()
 int
 Species::unsetInitialConcentration ()
 {
+  invalidateOriginalText();
   mInitialConcentration      = numeric_limits<double>::quiet_NaN();
   mIsSetInitialConcentration = false;
 
@@ -976,6 +998,7 @@ Species::unsetInitialConcentration ()
 int
 Species::unsetSubstanceUnits ()
 {
+  invalidateOriginalText();
   mSubstanceUnits.erase();
   
   if (mSubstanceUnits.empty()) 
@@ -995,6 +1018,7 @@ Species::unsetSubstanceUnits ()
 int
 Species::unsetSpatialSizeUnits ()
 {
+  invalidateOriginalText();
   mSpatialSizeUnits.erase();
 
   if (mSpatialSizeUnits.empty()) 
@@ -1014,6 +1038,7 @@ Species::unsetSpatialSizeUnits ()
 int
 Species::unsetUnits ()
 {
+  invalidateOriginalText();
   return unsetSubstanceUnits();
 }
 
@@ -1024,6 +1049,7 @@ Species::unsetUnits ()
 int
 Species::unsetCharge ()
 {
+  invalidateOriginalText();
   if ( !((getLevel() == 1)
     || (getLevel() == 2 && getVersion() == 1)))
   {
@@ -1050,6 +1076,7 @@ Species::unsetCharge ()
 int
 Species::unsetConversionFactor ()
 {
+  invalidateOriginalText();
   /* only in L3 */
   if (getLevel() < 3)
   {
@@ -1075,6 +1102,7 @@ Species::unsetConversionFactor ()
 int
 Species::unsetHasOnlySubstanceUnits ()
 {
+  invalidateOriginalText();
   if (getLevel() < 2)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -1099,6 +1127,7 @@ Species::unsetHasOnlySubstanceUnits ()
 int
 Species::unsetBoundaryCondition ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     // reset default
@@ -1117,6 +1146,7 @@ Species::unsetBoundaryCondition ()
 int
 Species::unsetCompartment ()
 {
+  invalidateOriginalText();
   mCompartment.erase();
 
   if (mCompartment.empty()) 
@@ -1722,6 +1752,7 @@ bool Species::isExplicitlySetHasOnlySubsUnits() const
 void
 Species::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetSpeciesType()) {
     if (mSpeciesType==oldid) setSpeciesType(newid);
@@ -1737,6 +1768,7 @@ Species::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Species::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetSubstanceUnits()) {
     if (mSubstanceUnits==oldid) setSubstanceUnits(newid);
@@ -2480,10 +2512,7 @@ ListOfSpecies::get (const std::string& sid)
 const Species*
 ListOfSpecies::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqS(sid) );
-  return (result == mItems.end()) ? NULL : static_cast <Species*> (*result);
+  return static_cast <const Species*> (getItemBySId(sid));
 }
 
 
@@ -2491,6 +2520,7 @@ ListOfSpecies::get (const std::string& sid) const
 Species*
 ListOfSpecies::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Species*>(ListOf::remove(n));
 }
 
@@ -2499,6 +2529,7 @@ ListOfSpecies::remove (unsigned int n)
 Species*
 ListOfSpecies::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -2508,6 +2539,7 @@ ListOfSpecies::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Species*> (item);
@@ -311,6 +311,7 @@ SpeciesReference::isSetStoichiometry () const
 int
 SpeciesReference::setStoichiometry (double value)
 {
+  invalidateOriginalText();
    unsetStoichiometryMath();
 
    mStoichiometry = value;
@@ -327,6 +328,7 @@ SpeciesReference::setStoichiometry (double value)
 int
 SpeciesReference::setStoichiometryMath (const StoichiometryMath* math)
 {
+  invalidateOriginalText();
   if ( getLevel() != 2 )
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -373,6 +375,7 @@ SpeciesReference::setStoichiometryMath (const StoichiometryMath* math)
 int
 SpeciesReference::setDenominator (int value)
 {
+  invalidateOriginalText();
   // this attribute was removed in l2 but we were able to capture it
   // by creating a stoichiometryMath element for the speciesReference
   // however stoichiometryMath was removed in l3 and so would require
@@ -399,6 +402,7 @@ SpeciesReference::setDenominator (int value)
 int
 SpeciesReference::setConstant (bool flag)
 {
+  invalidateOriginalText();
   if ( getLevel() < 3 )
   {
     mConstant = flag;
@@ -419,6 +423,7 @@ SpeciesReference::setConstant (bool flag)
 int 
 SpeciesReference::unsetStoichiometryMath ()
 {
+  invalidateOriginalText();
   delete mStoichiometryMath;
   mStoichiometryMath = NULL;
 
@@ -452,6 +457,7 @@ SpeciesReference::unsetStoichiometryMath ()
 int
 SpeciesReference::unsetStoichiometry ()
 {
+  invalidateOriginalText();
   const unsigned int level = getLevel();
 
   if ( level > 2 )
@@ -510,6 +516,7 @@ SpeciesReference::unsetStoichiometry ()
 int
 SpeciesReference::unsetConstant ()
 {
+  invalidateOriginalText();
   if ( getLevel() < 3 )
   {
     mConstant = false;
@@ -532,6 +539,7 @@ SpeciesReference::unsetConstant ()
 StoichiometryMath*
 SpeciesReference::createStoichiometryMath ()
 {
+  invalidateOriginalText();
   delete mStoichiometryMath;
   mStoichiometryMath = NULL;
 
@@ -1003,6 +1011,7 @@ SpeciesReference::getObject(const std::string& elementName, unsigned int index)
 int
 SpeciesReference::setAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
   int success = SBase::setAnnotation(annotation);
 
   return success;
@@ -1015,6 +1024,7 @@ SpeciesReference::setAnnotation (const XMLNode* annotation)
 int
 SpeciesReference::setAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
 
   if(annotation.empty())
@@ -1051,6 +1061,7 @@ SpeciesReference::setAnnotation (const std::string& annotation)
 int
 SpeciesReference::appendAnnotation (const XMLNode* annotation)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
   if(!annotation) return LIBSBML_OPERATION_SUCCESS;
 
@@ -1071,6 +1082,7 @@ SpeciesReference::appendAnnotation (const XMLNode* annotation)
 int
 SpeciesReference::appendAnnotation (const std::string& annotation)
 {
+  invalidateOriginalText();
   int success = LIBSBML_OPERATION_FAILED;
   XMLNode* annt_xmln;
   if (getSBMLDocument() != NULL)
@@ -1635,6 +1647,7 @@ ListOfSpeciesReferences::get (const std::string& sid) const
 SimpleSpeciesReference*
 ListOfSpeciesReferences::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<SimpleSpeciesReference*>(ListOf::remove(n));
 }
 
@@ -1643,6 +1656,7 @@ ListOfSpeciesReferences::remove (unsigned int n)
 SimpleSpeciesReference*
 ListOfSpeciesReferences::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -1652,6 +1666,7 @@ ListOfSpeciesReferences::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SimpleSpeciesReference*> (item);
@@ -1688,6 +1703,7 @@ ListOfSpeciesReferences::getElementPosition () const
 void
 ListOfSpeciesReferences::setType (SpeciesType type)
 {
+  invalidateOriginalText();
   mType = type;
 }
 /** @endcond */
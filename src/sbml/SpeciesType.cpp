@@ -177,12 +177,14 @@ SpeciesType::isSetName () const
 int
 SpeciesType::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -195,6 +197,7 @@ SpeciesType::setId (const std::string& sid)
 int
 SpeciesType::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -206,6 +209,7 @@ SpeciesType::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -224,8 +228,10 @@ SpeciesType::setName (const std::string& name)
 int
 SpeciesType::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -738,11 +744,7 @@ ListOfSpeciesTypes::get (const std::string& sid)
 const SpeciesType*
 ListOfSpeciesTypes::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqST(sid) );
-  return (result == mItems.end()) ? NULL : 
-                             static_cast <SpeciesType*> (*result);
+  return static_cast <const SpeciesType*> (getItemBySId(sid));
 }
 
 
@@ -750,6 +752,7 @@ ListOfSpeciesTypes::get (const std::string& sid) const
 SpeciesType*
 ListOfSpeciesTypes::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<SpeciesType*>(ListOf::remove(n));
 }
 
@@ -758,6 +761,7 @@ ListOfSpeciesTypes::remove (unsigned int n)
 SpeciesType*
 ListOfSpeciesTypes::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   vector<SBase*>::iterator result;
 
@@ -767,6 +771,7 @@ ListOfSpeciesTypes::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesType*> (item);
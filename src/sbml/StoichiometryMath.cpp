@@ -185,6 +185,7 @@ StoichiometryMath::isSetMath () const
 int
 StoichiometryMath::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -272,6 +273,7 @@ int StoichiometryMath::removeFromParentAndDelete()
 void
 StoichiometryMath::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -281,6 +283,7 @@ StoichiometryMath::renameSIdRefs(const std::string& oldid, const std::string& ne
 void 
 StoichiometryMath::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -291,6 +294,7 @@ StoichiometryMath::renameUnitSIdRefs(const std::string& oldid, const std::string
 void 
 StoichiometryMath::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
@@ -243,6 +243,7 @@ Trigger::isSetPersistent () const
 int
 Trigger::setMath (const ASTNode* math)
 {
+  invalidateOriginalText();
   if (mMath == math) 
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -273,6 +274,7 @@ Trigger::setMath (const ASTNode* math)
 int
 Trigger::setInitialValue (bool initialValue)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -292,6 +294,7 @@ Trigger::setInitialValue (bool initialValue)
 int
 Trigger::setPersistent (bool persistent)
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -308,6 +311,7 @@ Trigger::setPersistent (bool persistent)
 int
 Trigger::unsetInitialValue ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -323,6 +327,7 @@ Trigger::unsetInitialValue ()
 int
 Trigger::unsetPersistent ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
@@ -680,6 +685,7 @@ int Trigger::removeFromParentAndDelete()
 void
 Trigger::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameSIdRefs(oldid, newid);
@@ -689,6 +695,7 @@ Trigger::renameSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Trigger::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  invalidateOriginalText();
   SBase::renameUnitSIdRefs(oldid, newid);
   if (isSetMath()) {
     mMath->renameUnitSIdRefs(oldid, newid);
@@ -699,6 +706,7 @@ Trigger::renameUnitSIdRefs(const std::string& oldid, const std::string& newid)
 void 
 Trigger::replaceSIDWithFunction(const std::string& id, const ASTNode* function)
 {
+  invalidateOriginalText();
   if (isSetMath()) {
     if (mMath->getType() == AST_NAME && mMath->getName() == id) {
       delete mMath;
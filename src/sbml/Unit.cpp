@@ -754,6 +754,7 @@ Unit::isSetOffset () const
 int
 Unit::setKind (UnitKind_t kind)
 {
+  invalidateOriginalText();
   if (!UnitKind_isValidUnitKindString(UnitKind_toString(kind),
                  getLevel(), getVersion()))
   {
@@ -773,6 +774,7 @@ Unit::setKind (UnitKind_t kind)
 int
 Unit::setExponent (int value)
 {
+  invalidateOriginalText();
   return setExponent((double) value);
 }
 
@@ -783,6 +785,7 @@ Unit::setExponent (int value)
 int
 Unit::setExponent (double value)
 {
+  invalidateOriginalText();
   bool representsInteger = true;
   if (floor(value) != value)
     representsInteger = false;
@@ -816,6 +819,7 @@ Unit::setExponent (double value)
 int
 Unit::setScale (int value)
 {
+  invalidateOriginalText();
   mScale = value;
   mIsSetScale = true;
   mExplicitlySetScale = true;
@@ -829,6 +833,7 @@ Unit::setScale (int value)
 int
 Unit::setMultiplier (double value)
 {
+  invalidateOriginalText();
   if (getLevel() < 2)
   {
     mMultiplier = value;
@@ -850,6 +855,7 @@ Unit::setMultiplier (double value)
 int
 Unit::setOffset (double value)
 {
+  invalidateOriginalText();
   if (!(getLevel() == 2 && getVersion() == 1))
   {
     mOffset = 0;
@@ -870,6 +876,7 @@ Unit::setOffset (double value)
 int
 Unit::unsetKind ()
 {
+  invalidateOriginalText();
   mKind = UNIT_KIND_INVALID;
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -881,6 +888,7 @@ Unit::unsetKind ()
 int
 Unit::unsetExponent ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     // reset defaults
@@ -905,6 +913,7 @@ Unit::unsetExponent ()
 int
 Unit::unsetScale ()
 {
+  invalidateOriginalText();
   if (getLevel() < 3)
   {
     // reset default
@@ -929,6 +938,7 @@ Unit::unsetScale ()
 int
 Unit::unsetMultiplier ()
 {
+  invalidateOriginalText();
   if (getLevel() < 2)
   {
     mMultiplier = 1.0;
@@ -957,6 +967,7 @@ Unit::unsetMultiplier ()
 int
 Unit::unsetOffset ()
 {
+  invalidateOriginalText();
   if (!(getLevel() == 2 && getVersion() == 1))
   {
     mOffset = 0.0;
@@ -2425,6 +2436,7 @@ Unit::writeAttributes (XMLOutputStream& stream) const
 void 
 Unit::setExponentUnitChecking (double value) 
 { 
+  invalidateOriginalText();
   /* cannot use setExponent becuase want a double exponent 
    * - even if we are dealing with L2/L1
    */
@@ -2534,6 +2546,7 @@ ListOfUnits::get(unsigned int n) const
 Unit*
 ListOfUnits::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<Unit*>(ListOf::remove(n));
 }
 
@@ -236,12 +236,14 @@ UnitDefinition::isSetName () const
 int
 UnitDefinition::setId (const std::string& sid)
 {
+  invalidateOriginalText();
   if (!(SyntaxChecker::isValidInternalSId(sid)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    invalidateIdIndexes();
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -254,6 +256,7 @@ UnitDefinition::setId (const std::string& sid)
 int
 UnitDefinition::setName (const std::string& name)
 {
+  invalidateOriginalText();
   /* if this is setting an L2 name the type is string
    * whereas if it is setting an L1 name its type is SId
    */
@@ -265,6 +268,7 @@ UnitDefinition::setName (const std::string& name)
     }
     else
     {
+      invalidateIdIndexes();
       mId = name;
       return LIBSBML_OPERATION_SUCCESS;
     }
@@ -283,8 +287,10 @@ UnitDefinition::setName (const std::string& name)
 int
 UnitDefinition::unsetName ()
 {
+  invalidateOriginalText();
   if (getLevel() == 1) 
   {
+    invalidateIdIndexes();
     mId.erase();
   }
   else 
@@ -641,6 +647,7 @@ UnitDefinition::isVariantOfSubstancePerTime (bool relaxed) const
 int
 UnitDefinition::addUnit (const Unit* u)
 {
+  invalidateOriginalText();
   int returnValue = checkCompatibility(static_cast<const SBase *>(u));
   if (returnValue != LIBSBML_OPERATION_SUCCESS)
   {
@@ -681,6 +688,7 @@ UnitDefinition::addUnit (const Unit* u)
 Unit*
 UnitDefinition::createUnit ()
 {
+  invalidateOriginalText();
   Unit* u = NULL;
 
   try
@@ -760,6 +768,7 @@ UnitDefinition::getNumUnits () const
 Unit* 
 UnitDefinition::removeUnit (unsigned int n)
 {
+  invalidateOriginalText();
   return mUnits.remove(n);  
 }
 
@@ -2230,11 +2239,7 @@ ListOfUnitDefinitions::get (const std::string& sid)
 const UnitDefinition*
 ListOfUnitDefinitions::get (const std::string& sid) const
 {
-  vector<SBase*>::const_iterator result;
-
-  result = find_if( mItems.begin(), mItems.end(), IdEqUD(sid) );
-  return (result == mItems.end()) ? NULL : 
-                   static_cast <UnitDefinition*> (*result);
+  return static_cast <const UnitDefinition*> (getItemBySId(sid));
 }
 
 
@@ -2256,6 +2261,7 @@ ListOfUnitDefinitions::getElementBySId(const std::string& id)
 UnitDefinition*
 ListOfUnitDefinitions::remove (unsigned int n)
 {
+  invalidateOriginalText();
    return static_cast<UnitDefinition*>(ListOf::remove(n));
 }
 
@@ -2264,6 +2270,7 @@ ListOfUnitDefinitions::remove (unsigned int n)
 UnitDefinition*
 ListOfUnitDefinitions::remove (const std::string& sid)
 {
+  invalidateOriginalText();
   SBase* item = NULL;
   ListItemIter result;
 
@@ -2273,6 +2280,7 @@ ListOfUnitDefinitions::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <UnitDefinition*> (item);
@@ -45,10 +45,9 @@
 
 #include <istream>
 #include <fstream>
-#include <sstream>
 #include <iostream>
 #include <new>
-#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
 #include <sbml/compress/InputDecompressor.h>
@@ -126,6 +125,45 @@ InputDecompressor::openZipIStream (const std::string& filename)
 }
 
 
+#if defined(USE_ZLIB) || defined(USE_BZ2)
+/*
+ * Returns the rest of the content of in, in a string allocated with
+ * malloc() as strdup() would.  The content is read a block at a time
+ * straight into the string, which grows as needed, rather than being
+ * gathered in a stream and copied twice.
+ */
+static char*
+readContent (istream& in)
+{
+  size_t capacity = 65536;
+  size_t length   = 0;
+  char*  content  = static_cast<char*>(malloc(capacity));
+
+  while (content != NULL && in.good())
+  {
+    if (capacity - length < 2)
+    {
+      char* grown = static_cast<char*>(realloc(content, 2 * capacity));
+      if (grown == NULL)
+      {
+        free(content);
+        return NULL;
+      }
+      content   = grown;
+      capacity *= 2;
+    }
+
+    in.read(content + length, (streamsize)(capacity - length - 1));
+    length += (size_t)in.gcount();
+  }
+
+  if (content != NULL) content[length] = '\0';
+
+  return content;
+}
+#endif
+
+
 /**
  * Opens the given gzip file and returned the string in the file.
  *
@@ -136,14 +174,9 @@ char*
 InputDecompressor::getStringFromGzip (const std::string& filename) 
 {
 #ifdef USE_ZLIB
-  std::ostringstream oss;
   gzifstream in(filename.c_str(), ios_base::in | ios_base::binary);
-  istreambuf_iterator<char> in_itr(in);
-  ostreambuf_iterator<char> out_itr(oss);
-
-  std::copy(in_itr, istreambuf_iterator<char>(), out_itr);
 
-  return strdup(oss.str().c_str());
+  return readContent(in);
 #else
   throw ZlibNotLinked();
   return NULL; // never reached
@@ -161,14 +194,9 @@ char*
 InputDecompressor::getStringFromBzip2 (const std::string& filename) 
 {
 #ifdef USE_BZ2
-  std::ostringstream oss;
   bzifstream in(filename.c_str(), ios_base::in | ios_base::binary);
-  istreambuf_iterator<char> in_itr(in);
-  ostreambuf_iterator<char> out_itr(oss);
 
-  std::copy(in_itr, istreambuf_iterator<char>(), out_itr);
-
-  return strdup(oss.str().c_str());
+  return readContent(in);
 #else
   throw Bzip2NotLinked();
   return NULL; // never reached
@@ -189,14 +217,9 @@ char*
 InputDecompressor::getStringFromZip (const std::string& filename) 
 {
 #ifdef USE_ZLIB
-  std::ostringstream oss;
   zipifstream in(filename.c_str(), ios_base::in | ios_base::binary);
-  istreambuf_iterator<char> in_itr(in);
-  ostreambuf_iterator<char> out_itr(oss);
-
-  std::copy(in_itr, istreambuf_iterator<char>(), out_itr);
 
-  return strdup(oss.str().c_str());
+  return readContent(in);
 #else
   throw ZlibNotLinked();
   return NULL; // never reached
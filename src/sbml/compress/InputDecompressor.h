@@ -100,6 +100,12 @@ public:
   static std::istream* openZipIStream (const std::string& filename);
 
 
+ /*
+  * The getStringFrom...() functions below hold the whole of the
+  * decompressed content in memory; the parsers read compressed files
+  * through the streams above instead, as they are decompressed.
+  */
+
  /**
   * Opens the given gzip file and returned the string in the file.
   *
@@ -265,6 +265,13 @@ double ASTBasePlugin::evaluateASTNode(const ASTNode * node, const Model * m) con
   return numeric_limits<double>::quiet_NaN();
 }
 
+double ASTBasePlugin::evaluateASTNode(const ASTNode * node,
+  const std::map<const std::string, std::pair<double, bool> >& values,
+  const Model * m) const
+{
+  return evaluateASTNode(node, m);
+}
+
 UnitDefinition * ASTBasePlugin::getUnitDefinitionFromPackage(UnitFormulaFormatter* uff, const ASTNode * node, bool inKL, int reactNo) const
 {
   return NULL;
@@ -107,6 +107,16 @@ public:
   virtual bool isMathMLNodeTag(ASTNodeType_t type) const;
   virtual ExtendedMathType_t getExtendedMathType() const;
   virtual double evaluateASTNode(const ASTNode * node, const Model * m = NULL) const;
+#ifndef SWIG
+  /*
+   * Evaluates the node as SBMLTransforms::evaluateASTNode() does with
+   * the table of values given; by default this calls the overload above,
+   * which uses the table SBMLTransforms shares between all callers.
+   */
+  virtual double evaluateASTNode(const ASTNode * node,
+    const std::map<const std::string, std::pair<double, bool> >& values,
+    const Model * m = NULL) const;
+#endif
   virtual UnitDefinition * getUnitDefinitionFromPackage(UnitFormulaFormatter* uff, const ASTNode * node, bool inKL, int reactNo) const;
 
   const ASTNodeValues_t* getASTNodeValue(unsigned int n) const;
@@ -57,6 +57,21 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * @return the namespaces shared by the objects having the same as sbmlns,
+ * which have been changed and are given back.
+ */
+static SBMLNamespaces*
+shareChanged (SBMLNamespaces* sbmlns)
+{
+  SBMLNamespaces* shared = SBMLNamespaces::share(sbmlns);
+  SBMLNamespaces::release(sbmlns);
+  return shared;
+}
+/** @endcond */
+
+
 /** @cond doxygenLibsbmlInternal */
 /*
  * Constructor
@@ -67,7 +82,7 @@ SBasePlugin::SBasePlugin (const std::string& uri, const std::string &prefix,
   ,mSBML(NULL)
   ,mParent(NULL)
   ,mURI(uri)
-  ,mSBMLNS(sbmlns == NULL ? NULL : sbmlns->clone())
+  ,mSBMLNS(SBMLNamespaces::share(sbmlns))
   ,mPrefix(prefix)
 {
 }
@@ -87,7 +102,7 @@ SBasePlugin::SBasePlugin(const SBasePlugin& orig)
    ,mPrefix(orig.mPrefix)
 {
   if (orig.mSBMLNS) {
-    mSBMLNS = orig.mSBMLNS->clone();
+    mSBMLNS = SBMLNamespaces::share(orig.mSBMLNS);
   }
 }
 /** @endcond */
@@ -98,8 +113,7 @@ SBasePlugin::SBasePlugin(const SBasePlugin& orig)
  */
 SBasePlugin::~SBasePlugin ()
 {
-	if (mSBMLNS != NULL)
-	delete mSBMLNS;
+  SBMLNamespaces::release(mSBMLNS);
 }
 
 
@@ -115,9 +129,9 @@ SBasePlugin::operator=(const SBasePlugin& orig)
   mURI     = orig.mURI;
   mPrefix  = orig.mPrefix;
 
-  delete mSBMLNS;
+  SBMLNamespaces::release(mSBMLNS);
   if (orig.mSBMLNS)
-    mSBMLNS = orig.mSBMLNS->clone();
+    mSBMLNS = SBMLNamespaces::share(orig.mSBMLNS);
   else
     mSBMLNS = NULL;
 
@@ -1006,6 +1020,7 @@ SBasePlugin::updateSBMLNamespace(const std::string& package, unsigned int level,
     {
       mSBMLNS = new SBMLNamespaces(level, version);
     }
+    mSBMLNS = SBMLNamespaces::unshare(mSBMLNS);
 
 
     if (mSBMLNS->getNamespaces() != NULL &&
@@ -1034,6 +1049,7 @@ SBasePlugin::updateSBMLNamespace(const std::string& package, unsigned int level,
 
     mSBMLNS->setLevel(level);
     mSBMLNS->setVersion(version);
+    mSBMLNS = shareChanged(mSBMLNS);
     if (this->getPackageName().empty() || this->getPackageName() == "core")
       setElementNamespace(uri);
   }
@@ -1071,8 +1087,10 @@ SBasePlugin::updateSBMLNamespace(const std::string& package, unsigned int level,
 
       if (found)
       {
+        mSBMLNS = SBMLNamespaces::unshare(mSBMLNS);
         mSBMLNS->getNamespaces()->remove(uri);
         mSBMLNS->getNamespaces()->add(newURI, package);
+        mSBMLNS = shareChanged(mSBMLNS);
         if (this->getPackageName() == package)
           setElementNamespace(newURI);
       }
@@ -48,6 +48,7 @@
 #include <sbml/util/List.h>
 
 #include <sbml/math/ASTNode.h>
+#include <sbml/math/ASTNodeArena.h>
 #include <sbml/xml/XMLAttributes.h>
 #include <sbml/xml/XMLNode.h>
 #include <sbml/Model.h>
@@ -236,6 +237,46 @@ static const char *AST_OPERATOR_STRINGS[] =
 
 #ifdef __cplusplus
 
+/*
+ * The parts of an ASTNode that most nodes do not use.
+ */
+struct ASTNode::Extras
+{
+  Extras () : mUserData(NULL) { }
+
+  ~Extras ()
+  {
+    unsigned int size = mSemanticsAnnotations.getSize();
+    while (size--)  delete static_cast<XMLNode*>(mSemanticsAnnotations.remove(0) );
+  }
+
+  std::string mUnits;
+
+  // additional MathML attributes
+  std::string mId;
+  std::string mClass;
+  std::string mStyle;
+
+  XMLAttributes mDefinitionURL;
+  List          mSemanticsAnnotations;
+  void*         mUserData;
+
+  // ASTBasePlugin derived classes will be stored in mPlugins.
+  std::vector<ASTBasePlugin*> mPlugins;
+};
+
+
+/*
+ * Node types whose value is held in mReal; the value of all other types
+ * is held in mRational.
+ */
+static bool
+hasRealValue (ASTNodeType_t type)
+{
+  return (type == AST_REAL || type == AST_REAL_E || type == AST_NAME_AVOGADRO);
+}
+
+
 /*
  * Creates a new ASTNode.
  *
@@ -246,27 +287,19 @@ LIBSBML_EXTERN
 ASTNode::ASTNode (ASTNodeType_t type)
 {
   unsetSemanticsFlag();
-  mDefinitionURL = new XMLAttributes();
-  mReal          = 0;
-  mExponent      = 0;
   mType          = AST_UNKNOWN;
   mChar          = 0;
   mName          = NULL;
-  mInteger       = 0;
-  mDenominator   = 1;
+  resetValue(mType);
   mParentSBMLObject = NULL;
-  mUnits         = "";
-  mId			 = "";
-  mClass		 = "";
-  mStyle		 = "";
   mIsBvar = false;
-  mUserData      = NULL;
+  mExtras        = NULL;
 
   // move to after we have loaded plugins
   //setType(type);
 
-  mChildren             = new List;
-  mSemanticsAnnotations = new List;
+  // children are only allocated when the first one is added
+  mChildren             = NULL;
   // only load plugins when we need to
   //if (type > AST_END_OF_CORE && type < AST_UNKNOWN)
   //{
@@ -292,24 +325,15 @@ LIBSBML_EXTERN
 ASTNode::ASTNode (Token_t* token)
 {
   unsetSemanticsFlag();
-  mDefinitionURL = new XMLAttributes();
-  mReal          = 0;
-  mExponent      = 0;
   mType          = AST_UNKNOWN;
   mChar          = 0;
   mName          = NULL;
-  mInteger       = 0;
-  mDenominator   = 1;
+  resetValue(mType);
   mParentSBMLObject = NULL;
-  mUnits         = "";
-  mId			 = "";
-  mClass		 = "";
-  mStyle		 = "";
   mIsBvar = false;
-  mUserData      = NULL;
+  mExtras        = NULL;
 
-  mChildren             = new List;
-  mSemanticsAnnotations = new List;
+  mChildren             = NULL;
 
   if (token != NULL)
   {
@@ -362,23 +386,19 @@ LIBSBML_EXTERN
 ASTNode::ASTNode (const ASTNode& orig) :
   mType                 ( orig.mType )
  ,mChar                 ( orig.mChar )
- ,mName                 ( NULL )
- ,mInteger              ( orig.mInteger )
- ,mReal                 ( orig.mReal )
- ,mDenominator          ( orig.mDenominator )
- ,mExponent             ( orig.mExponent )
- ,mDefinitionURL        ( orig.mDefinitionURL->clone() )	
  ,hasSemantics          ( orig.hasSemantics )
- ,mChildren             ( new List() )
- ,mSemanticsAnnotations ( new List() )
- ,mParentSBMLObject     ( orig.mParentSBMLObject )
- ,mUnits                ( orig.mUnits)
- ,mId                   ( orig.mId)
- ,mClass                ( orig.mClass)
- ,mStyle                ( orig.mStyle)
  ,mIsBvar               ( orig.mIsBvar)
- ,mUserData             ( orig.mUserData )
+ ,mName                 ( NULL )
+ ,mRational             ( orig.mRational )
+ ,mChildren             ( NULL )
+ ,mParentSBMLObject     ( orig.mParentSBMLObject )
+ ,mExtras               ( NULL )
 {
+  if (hasRealValue(mType))
+  {
+    mReal = orig.mReal;
+  }
+
   if (orig.mName)
   {
     mName = safe_strdup(orig.mName);
@@ -389,16 +409,29 @@ ASTNode::ASTNode (const ASTNode& orig) :
     addChild( orig.getChild(c)->deepCopy() );
   }
 
-  for (unsigned int c = 0; c < orig.getNumSemanticsAnnotations(); ++c)
+  if (orig.mExtras != NULL)
   {
-    addSemanticsAnnotation( orig.getSemanticsAnnotation(c)->clone() );
-  }
-  mPlugins.resize(orig.mPlugins.size());
-  transform(orig.mPlugins.begin(), orig.mPlugins.end(),
-    mPlugins.begin(), CloneASTPluginEntity());
-  for (size_t i = 0; i < mPlugins.size(); i++)
-  {
-    getPlugin((unsigned int)i)->connectToParent(this);
+    Extras& extras = getExtras();
+
+    extras.mUnits         = orig.mExtras->mUnits;
+    extras.mId            = orig.mExtras->mId;
+    extras.mClass         = orig.mExtras->mClass;
+    extras.mStyle         = orig.mExtras->mStyle;
+    extras.mDefinitionURL = orig.mExtras->mDefinitionURL;
+    extras.mUserData      = orig.mExtras->mUserData;
+
+    for (unsigned int c = 0; c < orig.getNumSemanticsAnnotations(); ++c)
+    {
+      addSemanticsAnnotation( orig.getSemanticsAnnotation(c)->clone() );
+    }
+
+    extras.mPlugins.resize(orig.mExtras->mPlugins.size());
+    transform(orig.mExtras->mPlugins.begin(), orig.mExtras->mPlugins.end(),
+      extras.mPlugins.begin(), CloneASTPluginEntity());
+    for (size_t i = 0; i < extras.mPlugins.size(); i++)
+    {
+      getPlugin((unsigned int)i)->connectToParent(this);
+    }
   }
 }
 
@@ -414,18 +447,17 @@ ASTNode& ASTNode::operator=(const ASTNode& rhs)
   {
     mType                 = rhs.mType;
     mChar                 = rhs.mChar;
-    mInteger              = rhs.mInteger;
-    mReal                 = rhs.mReal;
-    mDenominator          = rhs.mDenominator;
-    mExponent             = rhs.mExponent;
+    if (hasRealValue(mType))
+    {
+      mReal               = rhs.mReal;
+    }
+    else
+    {
+      mRational           = rhs.mRational;
+    }
     hasSemantics          = rhs.hasSemantics;
     mParentSBMLObject     = rhs.mParentSBMLObject;
-    mUnits                = rhs.mUnits;
-    mId                   = rhs.mId;
-    mClass                = rhs.mClass;
-    mStyle                = rhs.mStyle;
     mIsBvar               = rhs.mIsBvar;
-    mUserData             = rhs.mUserData;
     freeName();
     if (rhs.mName)
     {
@@ -436,32 +468,43 @@ ASTNode& ASTNode::operator=(const ASTNode& rhs)
       mName = NULL;
     }
 
-    unsigned int size = mChildren->getSize();
-    while (size--) delete static_cast<ASTNode*>( mChildren->remove(0) );
-    delete mChildren;
-    mChildren = new List();
+    if (mChildren != NULL)
+    {
+      unsigned int size = mChildren->getSize();
+      while (size--) delete static_cast<ASTNode*>( mChildren->remove(0) );
+      delete mChildren;
+      mChildren = NULL;
+    }
 
     for (unsigned int c = 0; c < rhs.getNumChildren(); ++c)
     {
       addChild( rhs.getChild(c)->deepCopy() );
     }
 
-    size = mSemanticsAnnotations->getSize();
-    while (size--)  delete static_cast<XMLNode*>(mSemanticsAnnotations->remove(0) );
-    delete mSemanticsAnnotations;
-    mSemanticsAnnotations = new List();
+    clearPlugins();
+    delete mExtras;
+    mExtras = NULL;
 
-    for (unsigned int c = 0; c < rhs.getNumSemanticsAnnotations(); ++c)
+    if (rhs.mExtras != NULL)
     {
-      addSemanticsAnnotation( rhs.getSemanticsAnnotation(c)->clone() );
+      Extras& extras = getExtras();
+
+      extras.mUnits         = rhs.mExtras->mUnits;
+      extras.mId            = rhs.mExtras->mId;
+      extras.mClass         = rhs.mExtras->mClass;
+      extras.mStyle         = rhs.mExtras->mStyle;
+      extras.mDefinitionURL = rhs.mExtras->mDefinitionURL;
+      extras.mUserData      = rhs.mExtras->mUserData;
+
+      for (unsigned int c = 0; c < rhs.getNumSemanticsAnnotations(); ++c)
+      {
+        addSemanticsAnnotation( rhs.getSemanticsAnnotation(c)->clone() );
+      }
+
+      extras.mPlugins.resize(rhs.mExtras->mPlugins.size());
+      transform(rhs.mExtras->mPlugins.begin(), rhs.mExtras->mPlugins.end(),
+        extras.mPlugins.begin(), CloneASTPluginEntity());
     }
-    
-    delete mDefinitionURL;
-    mDefinitionURL        = rhs.mDefinitionURL->clone();	
-    clearPlugins();
-    mPlugins.resize(rhs.mPlugins.size());
-    transform(rhs.mPlugins.begin(), rhs.mPlugins.end(),
-      mPlugins.begin(), CloneASTPluginEntity());
   }
   return *this;
 }
@@ -472,24 +515,102 @@ ASTNode& ASTNode::operator=(const ASTNode& rhs)
 LIBSBML_EXTERN
 ASTNode::~ASTNode ()
 {
-  unsigned int size = getNumChildren();
-
-
-  while (size--) delete static_cast<ASTNode*>( mChildren->remove(0) );
-  delete mChildren;
+  if (mChildren != NULL)
+  {
+    unsigned int size = getNumChildren();
 
-  size = mSemanticsAnnotations->getSize();
-  while (size--)  delete static_cast<XMLNode*>(mSemanticsAnnotations->remove(0) );
-  delete mSemanticsAnnotations;
+    while (size--) delete static_cast<ASTNode*>( mChildren->remove(0) );
+    delete mChildren;
+  }
 
-  delete mDefinitionURL;
-  
   freeName();
   clearPlugins();
 
+  delete mExtras;
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+LIBSBML_EXTERN
+void*
+ASTNode::operator new (size_t size)
+{
+#ifdef LIBSBML_USE_AST_NODE_ARENA
+  return ASTNodeArena::allocate(size);
+#else
+  return ::operator new(size);
+#endif
+}
+
+
+LIBSBML_EXTERN
+void*
+ASTNode::operator new (size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return ASTNode::operator new(size);
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+
+LIBSBML_EXTERN
+void
+ASTNode::operator delete (void* ptr)
+{
+#ifdef LIBSBML_USE_AST_NODE_ARENA
+  ASTNodeArena::release(ptr);
+#else
+  ::operator delete(ptr);
+#endif
+}
+
+
+LIBSBML_EXTERN
+void
+ASTNode::operator delete (void* ptr, const std::nothrow_t&) throw()
+{
+  ASTNode::operator delete(ptr);
+}
+
+
+ASTNode::Extras&
+ASTNode::getExtras ()
+{
+  if (mExtras == NULL)
+  {
+    mExtras = new Extras();
+  }
+
+  return *mExtras;
+}
+
+
+/*
+ * Sets the value of this node to zero, in the member of the value union
+ * used by the given type.
+ */
+void
+ASTNode::resetValue (ASTNodeType_t type)
+{
+  if (hasRealValue(type))
+  {
+    mReal.mantissa = 0;
+    mReal.exponent = 0;
+  }
+  else
+  {
+    mRational.numerator   = 0;
+    mRational.denominator = 1;
+  }
+}
+/** @endcond */
+
+
 /*
  * Frees the name of this ASTNode and sets it to NULL.
  * 
@@ -833,6 +954,10 @@ ASTNode::addChild (ASTNode* child, bool inRead)
 {
 
   unsigned int numBefore = getNumChildren();
+  if (mChildren == NULL)
+  {
+    mChildren = new List;
+  }
   mChildren->add(child);
 
   /* HACK to allow representsBVar function to be correct */
@@ -871,6 +996,10 @@ ASTNode::prependChild (ASTNode* child)
   if (child == NULL) return LIBSBML_INVALID_OBJECT;
 
   unsigned int numBefore = getNumChildren();
+  if (mChildren == NULL)
+  {
+    mChildren = new List;
+  }
   mChildren->prepend(child);
 
   if (getNumChildren() == numBefore + 1)
@@ -1004,7 +1133,7 @@ LIBSBML_EXTERN
 ASTNode*
 ASTNode::getChild (unsigned int n) const
 {
-  return static_cast<ASTNode*>( mChildren->get(n) );
+  return (mChildren == NULL) ? NULL : static_cast<ASTNode*>( mChildren->get(n) );
 }
 
 
@@ -1016,7 +1145,7 @@ LIBSBML_EXTERN
 ASTNode*
 ASTNode::getLeftChild () const
 {
-  return static_cast<ASTNode*>( mChildren->get(0) );
+  return (mChildren == NULL) ? NULL : static_cast<ASTNode*>( mChildren->get(0) );
 }
 
 
@@ -1045,7 +1174,7 @@ LIBSBML_EXTERN
 unsigned int
 ASTNode::getNumChildren () const
 {
-  return mChildren->getSize();
+  return (mChildren == NULL) ? 0 : mChildren->getSize();
 }
 
 
@@ -1060,7 +1189,7 @@ ASTNode::addSemanticsAnnotation (XMLNode* sAnnotation)
   {
     return LIBSBML_OPERATION_FAILED;
   }
-  mSemanticsAnnotations->add(sAnnotation);
+  getExtras().mSemanticsAnnotations.add(sAnnotation);
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -1072,7 +1201,7 @@ LIBSBML_EXTERN
 unsigned int 
 ASTNode::getNumSemanticsAnnotations () const
 {
-  return mSemanticsAnnotations->getSize();
+  return (mExtras == NULL) ? 0 : mExtras->mSemanticsAnnotations.getSize();
 }
 
 
@@ -1084,7 +1213,9 @@ LIBSBML_EXTERN
 XMLNode* 
 ASTNode::getSemanticsAnnotation (unsigned int n) const
 {
-  return static_cast<XMLNode*>( mSemanticsAnnotations->get(n) );
+  if (mExtras == NULL) return NULL;
+
+  return static_cast<XMLNode*>( mExtras->mSemanticsAnnotations.get(n) );
 }
 
 /*
@@ -1167,7 +1298,7 @@ LIBSBML_EXTERN
 long
 ASTNode::getInteger () const
 {
-  return mInteger;
+  return hasRealValue(mType) ? 0 : mRational.numerator;
 }
 
 
@@ -1281,7 +1412,7 @@ LIBSBML_EXTERN
 long
 ASTNode::getNumerator () const
 {
-  return mInteger;
+  return hasRealValue(mType) ? 0 : mRational.numerator;
 }
 
 
@@ -1293,7 +1424,7 @@ LIBSBML_EXTERN
 long
 ASTNode::getDenominator () const
 {
-  return mDenominator;
+  return hasRealValue(mType) ? 1 : mRational.denominator;
 }
 
 
@@ -1309,16 +1440,16 @@ LIBSBML_EXTERN
 double
 ASTNode::getReal () const
 {
-  double result = mReal;
+  double result = getMantissa();
   
 
   if (mType == AST_REAL_E)
   {
-    result *= pow(10.0,  static_cast<double>(mExponent) );
+    result *= pow(10.0,  static_cast<double>(mReal.exponent) );
   }
   else if (mType == AST_RATIONAL)
   {
-    result = static_cast<double>(mInteger) / mDenominator;
+    result = static_cast<double>(mRational.numerator) / mRational.denominator;
   }
 
   return result;
@@ -1334,7 +1465,7 @@ LIBSBML_EXTERN
 double
 ASTNode::getMantissa () const
 {
-  return mReal;
+  return hasRealValue(mType) ? mReal.mantissa : 0;
 }
 
 
@@ -1346,7 +1477,7 @@ LIBSBML_EXTERN
 long
 ASTNode::getExponent () const
 {
-  return mExponent;
+  return hasRealValue(mType) ? mReal.exponent : 0;
 }
 
 
@@ -1455,28 +1586,28 @@ LIBSBML_EXTERN
 std::string
 ASTNode::getId() const
 {
-  return mId;
+  return (mExtras == NULL) ? "" : mExtras->mId;
 }
 
 LIBSBML_EXTERN
 std::string
 ASTNode::getClass() const
 {
-  return mClass;
+  return (mExtras == NULL) ? "" : mExtras->mClass;
 }
 
 LIBSBML_EXTERN
 std::string
 ASTNode::getStyle() const
 {
-  return mStyle;
+  return (mExtras == NULL) ? "" : mExtras->mStyle;
 }
 
 LIBSBML_EXTERN
 std::string
 ASTNode::getUnits() const
 {
-  return mUnits;
+  return (mExtras == NULL) ? "" : mExtras->mUnits;
 }
 
 /** @cond doxygenLibsbmlInternal */
@@ -1742,7 +1873,7 @@ ASTNode::isLog10 () const
     {
       c = getLeftChild();
 
-      if ((c->mType == AST_INTEGER) && (c->mInteger == 10))
+      if ((c->mType == AST_INTEGER) && (c->mRational.numerator == 10))
       {
         result = true;
       }
@@ -1916,7 +2047,7 @@ ASTNode::isSqrt () const
     {
       c = getLeftChild();
 
-      if ((c->mType == AST_INTEGER) && (c->mInteger == 2))
+      if ((c->mType == AST_INTEGER) && (c->mRational.numerator == 2))
       {
         result = true;
       }
@@ -2003,28 +2134,28 @@ LIBSBML_EXTERN
 bool 
 ASTNode::isSetId() const
 {
-  return (mId.empty() == false);
+  return (mExtras != NULL && mExtras->mId.empty() == false);
 }
   
 LIBSBML_EXTERN
 bool 
 ASTNode::isSetClass() const
 {
-  return (mClass.empty() == false);
+  return (mExtras != NULL && mExtras->mClass.empty() == false);
 }
   
 LIBSBML_EXTERN
 bool 
 ASTNode::isSetStyle() const
 {
-  return (mStyle.empty() == false);
+  return (mExtras != NULL && mExtras->mStyle.empty() == false);
 }
   
 LIBSBML_EXTERN
 bool 
 ASTNode::isSetUnits() const
 {
-  return (mUnits.empty() == false);
+  return (mExtras != NULL && mExtras->mUnits.empty() == false);
 }
   
 
@@ -2098,7 +2229,7 @@ int
 ASTNode::setValue (int value)
 {
   setType(AST_INTEGER);
-  mInteger = value;
+  mRational.numerator = value;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2112,7 +2243,7 @@ int
 ASTNode::setValue (long value)
 {
   setType(AST_INTEGER);
-  mInteger = value;
+  mRational.numerator = value;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2127,8 +2258,8 @@ ASTNode::setValue (long numerator, long denominator)
 {
   setType(AST_RATIONAL);
 
-  mInteger     = numerator;
-  mDenominator = denominator;
+  mRational.numerator   = numerator;
+  mRational.denominator = denominator;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2147,8 +2278,8 @@ ASTNode::setValue (double value)
 {
   setType(AST_REAL);
 
-  mReal     = value;
-  mExponent = 0;
+  mReal.mantissa = value;
+  mReal.exponent = 0;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2163,8 +2294,8 @@ ASTNode::setValue (double mantissa, long exponent)
 {
   setType(AST_REAL_E);
 
-  mReal     = mantissa;
-  mExponent = exponent;
+  mReal.mantissa = mantissa;
+  mReal.exponent = exponent;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2181,12 +2312,9 @@ ASTNode::setType (ASTNodeType_t type)
     return LIBSBML_OPERATION_SUCCESS;
   }
 
-  if (isOperator() || isNumber())
+  if (isOperator() || isNumber() || hasRealValue(mType) != hasRealValue(type))
   {
-    mReal     = 0;
-    mExponent = 0;
-    mDenominator = 1;
-    mInteger = 0;
+    resetValue(type);
   }
 
   /* if avogadro set value */
@@ -2203,23 +2331,17 @@ ASTNode::setType (ASTNodeType_t type)
     //}
     //else
     //{
-      mReal = 6.02214179e23;
+      mReal.mantissa = 6.02214179e23;
     //}
-    mDefinitionURL->clear();
-    mDefinitionURL->add("definitionURL", 
-                        "http://www.sbml.org/sbml/symbols/avogadro");
+    setDefinitionURL("http://www.sbml.org/sbml/symbols/avogadro");
   }
   else if (type == AST_NAME_TIME)
   {
-    mDefinitionURL->clear();
-    mDefinitionURL->add("definitionURL", 
-                        "http://www.sbml.org/sbml/symbols/time");
+    setDefinitionURL("http://www.sbml.org/sbml/symbols/time");
   }
   else if (type == AST_FUNCTION_DELAY)
   {
-    mDefinitionURL->clear();
-    mDefinitionURL->add("definitionURL", 
-                        "http://www.sbml.org/sbml/symbols/delay");
+    setDefinitionURL("http://www.sbml.org/sbml/symbols/delay");
   }
 
   /*
@@ -2284,13 +2406,14 @@ ASTNode::setType (ASTNodeType_t type)
   {
     mType = AST_UNKNOWN;
     mChar = 0;
-    mDefinitionURL->clear();
+    if (mExtras != NULL) mExtras->mDefinitionURL.clear();
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
 
-  if (clearDefinitionURL == true && getSemanticsFlag() == false)
+  if (clearDefinitionURL == true && getSemanticsFlag() == false
+    && mExtras != NULL)
   {
-    mDefinitionURL->clear();
+    mExtras->mDefinitionURL.clear();
   }
 
     
@@ -2302,7 +2425,7 @@ LIBSBML_EXTERN
 int
 ASTNode::setId (const std::string& id)
 {
-  mId     = id;
+  getExtras().mId = id;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2310,7 +2433,7 @@ LIBSBML_EXTERN
 int
 ASTNode::setClass (const std::string& className)
 {
-  mClass   = className;
+  getExtras().mClass = className;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2318,7 +2441,7 @@ LIBSBML_EXTERN
 int
 ASTNode::setStyle (const std::string& style)
 {
-  mStyle     = style;
+  getExtras().mStyle = style;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2334,7 +2457,7 @@ ASTNode::setUnits (const std::string& units)
   if (!SyntaxChecker::isValidInternalUnitSId(units))
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
 
-  mUnits     = units;
+  getExtras().mUnits = units;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2425,9 +2548,12 @@ LIBSBML_EXTERN
 int
 ASTNode::unsetId ()
 {
-  mId.erase();
+  if (mExtras != NULL)
+  {
+    mExtras->mId.erase();
+  }
 
-  if (mId.empty())
+  if (!isSetId())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -2442,9 +2568,12 @@ LIBSBML_EXTERN
 int
 ASTNode::unsetClass ()
 {
-  mClass.erase();
+  if (mExtras != NULL)
+  {
+    mExtras->mClass.erase();
+  }
 
-  if (mClass.empty())
+  if (!isSetClass())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -2458,9 +2587,12 @@ LIBSBML_EXTERN
 int
 ASTNode::unsetStyle ()
 {
-  mStyle.erase();
+  if (mExtras != NULL)
+  {
+    mExtras->mStyle.erase();
+  }
 
-  if (mStyle.empty())
+  if (!isSetStyle())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -2477,9 +2609,12 @@ ASTNode::unsetUnits ()
   if (!isNumber())
     return LIBSBML_UNEXPECTED_ATTRIBUTE;
 
-  mUnits.erase();
+  if (mExtras != NULL)
+  {
+    mExtras->mUnits.erase();
+  }
 
-  if (mUnits.empty())
+  if (!isSetUnits())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -2543,8 +2678,7 @@ ASTNode::getSemanticsFlag() const
 int 
 ASTNode::setDefinitionURL(XMLAttributes url)
 {
-  delete mDefinitionURL;
-  mDefinitionURL = static_cast<XMLAttributes *>(url.clone());
+  getExtras().mDefinitionURL = url;
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2555,8 +2689,9 @@ ASTNode::setDefinitionURL(XMLAttributes url)
 int 
 ASTNode::setDefinitionURL(const std::string& url)
 {
-  mDefinitionURL->clear();
-  mDefinitionURL->add("definitionURL", url);
+  XMLAttributes& definitionURL = getExtras().mDefinitionURL;
+  definitionURL.clear();
+  definitionURL.add("definitionURL", url);
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -2935,7 +3070,15 @@ LIBSBML_EXTERN
 XMLAttributes*
 ASTNode::getDefinitionURL() const
 {
-  return mDefinitionURL;
+  return &const_cast<ASTNode*>(this)->getExtras().mDefinitionURL;
+}
+
+
+LIBSBML_EXTERN
+bool
+ASTNode::isSetDefinitionURL() const
+{
+  return (mExtras != NULL && !mExtras->mDefinitionURL.isEmpty());
 }
 
 
@@ -2944,13 +3087,13 @@ LIBSBML_EXTERN
 std::string
 ASTNode::getDefinitionURLString() const
 {
-  if (mDefinitionURL == NULL)
+  if (mExtras == NULL)
   {
     return "";
   }
   else
   {
-    return mDefinitionURL->getValue("definitionURL");
+    return mExtras->mDefinitionURL.getValue("definitionURL");
   }
 }
 
@@ -2958,7 +3101,7 @@ LIBSBML_EXTERN
 void *
 ASTNode::getUserData() const
 {
-  return this->mUserData;
+  return (mExtras == NULL) ? NULL : mExtras->mUserData;
 }
 
 
@@ -2966,22 +3109,15 @@ LIBSBML_EXTERN
 int
 ASTNode::setUserData(void *userData)
 {
-  this->mUserData = userData;
- 
   // allow userData to be set to NULL
   if (userData == NULL)
   {
-    if (mUserData != NULL)
-    {
-      return LIBSBML_OPERATION_FAILED;
-    }
-    else
-    {
-      return LIBSBML_OPERATION_SUCCESS;
-    }
+    return unsetUserData();
   }
 
-  if (mUserData != NULL)
+  getExtras().mUserData = userData;
+
+  if (isSetUserData())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -2996,9 +3132,12 @@ LIBSBML_EXTERN
 int
 ASTNode::unsetUserData()
 {
-  mUserData = NULL;
+  if (mExtras != NULL)
+  {
+    mExtras->mUserData = NULL;
+  }
  
-  if (mUserData == NULL)
+  if (!isSetUserData())
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -3013,7 +3152,7 @@ LIBSBML_EXTERN
 bool
 ASTNode::isSetUserData() const
 {
-  return (mUserData != NULL);
+  return (mExtras != NULL && mExtras->mUserData != NULL);
 }
 
 
@@ -3339,7 +3478,7 @@ ASTNode::loadASTPlugin(const std::string& pkgName)
       ASTBasePlugin* myastPlugin = baseplugin->clone();
       myastPlugin->setPrefix(pkgName);
       myastPlugin->connectToParent(this);
-      mPlugins.push_back(myastPlugin);
+      getExtras().mPlugins.push_back(myastPlugin);
     }
   }
 }
@@ -3370,7 +3509,7 @@ ASTNode::loadASTPlugins(const SBMLNamespaces * sbmlns)
           myastPlugin->setSBMLExtension(sbmlext);
           myastPlugin->setPrefix(uri);
           myastPlugin->connectToParent(this);
-          mPlugins.push_back(myastPlugin);
+          getExtras().mPlugins.push_back(myastPlugin);
         }
 
       }
@@ -3397,7 +3536,7 @@ ASTNode::loadASTPlugins(const SBMLNamespaces * sbmlns)
             myastPlugin->setSBMLExtension(sbmlext);
             myastPlugin->setPrefix(xmlns->getPrefix(i));
             myastPlugin->connectToParent(this);
-            mPlugins.push_back(myastPlugin);
+            getExtras().mPlugins.push_back(myastPlugin);
           }
         }
       }
@@ -3409,7 +3548,7 @@ LIBSBML_EXTERN
 void 
 ASTNode::addPlugin(ASTBasePlugin* plugin)
 {
-  mPlugins.push_back(plugin);
+  getExtras().mPlugins.push_back(plugin);
 }
 
 
@@ -3426,18 +3565,18 @@ ASTNode::getPlugin(const std::string& package)
   {
     loadASTPlugin(package);
   }
-  for (size_t i = 0; i < mPlugins.size(); i++)
+  for (unsigned int i = 0; i < getNumPlugins(); i++)
   {
-    std::string uri = mPlugins[i]->getURI();
+    std::string uri = mExtras->mPlugins[i]->getURI();
     const SBMLExtension* sbmlext = SBMLExtensionRegistry::getInstance().getExtensionInternal(uri);
     if (uri == package)
     {
-      astPlugin = mPlugins[i];
+      astPlugin = mExtras->mPlugins[i];
       break;
     }
     else if (sbmlext && (sbmlext->getName() == package))
     {
-      astPlugin = mPlugins[i];
+      astPlugin = mExtras->mPlugins[i];
       break;
     }
   }
@@ -3467,7 +3606,7 @@ ASTNode::getPlugin(unsigned int n)
 {
   if (n >= getNumPlugins())
     return NULL;
-  return mPlugins[n];
+  return mExtras->mPlugins[n];
 }
 
 /** @endcond */
@@ -3489,7 +3628,7 @@ LIBSBML_EXTERN
 unsigned int
 ASTNode::getNumPlugins() const
 {
-  return (unsigned int)mPlugins.size();
+  return (mExtras == NULL) ? 0 : (unsigned int)mExtras->mPlugins.size();
 }
 
 
@@ -3502,8 +3641,10 @@ struct DeleteASTPluginEntity
 
 void ASTNode::clearPlugins()
 {
-  for_each(mPlugins.begin(), mPlugins.end(), DeleteASTPluginEntity());
-  mPlugins.clear();
+  if (mExtras == NULL) return;
+
+  for_each(mExtras->mPlugins.begin(), mExtras->mPlugins.end(), DeleteASTPluginEntity());
+  mExtras->mPlugins.clear();
 }
 
 /* FUNCTIONS FOR INFER REACTIONS*/
@@ -211,6 +211,8 @@ LIBSBML_CPP_NAMESPACE_END
 
 #ifdef __cplusplus
 
+#include <new>
+
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class List;
@@ -276,6 +278,25 @@ public:
   virtual ~ASTNode ();
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /*
+   * ASTNode objects are allocated through ASTNodeArena when libSBML is
+   * built with WITH_AST_NODE_ARENA, and from the heap otherwise.
+   */
+  LIBSBML_EXTERN
+  static void* operator new (size_t size);
+
+  LIBSBML_EXTERN
+  static void* operator new (size_t size, const std::nothrow_t&) throw();
+
+  LIBSBML_EXTERN
+  static void operator delete (void* ptr);
+
+  LIBSBML_EXTERN
+  static void operator delete (void* ptr, const std::nothrow_t&) throw();
+  /** @endcond */
+
+
   /**
    * Frees the name of this ASTNode and sets it to @c NULL.
    * 
@@ -1999,6 +2020,16 @@ setValue(value, 0);
   std::string getDefinitionURLString() const;
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /*
+   * Returns @c true if a definitionURL attribute has been set on this
+   * node; unlike getDefinitionURL(), this never allocates.
+   */
+  LIBSBML_EXTERN
+  bool isSetDefinitionURL() const;
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
 
   LIBSBML_EXTERN
@@ -2432,50 +2463,49 @@ protected:
   ASTNodeType_t mType;
 
   char   mChar;
+  bool   hasSemantics;
+  bool   mIsBvar;
   char*  mName;
-  long   mInteger;
-  double mReal;
-  long mDenominator;
-  long mExponent;
-
-  XMLAttributes* mDefinitionURL;
-  bool hasSemantics;
 
+  /*
+   * The numeric value of the node: mReal for the types with a real value
+   * (AST_REAL, AST_REAL_E and AST_NAME_AVOGADRO), mRational for all
+   * others, where only AST_INTEGER and AST_RATIONAL make use of it.
+   */
+  union
+  {
+    struct
+    {
+      long numerator;
+      long denominator;
+    } mRational;
+
+    struct
+    {
+      double mantissa;
+      long   exponent;
+    } mReal;
+  };
+
+  // NULL until the first child is added.
   List *mChildren;
 
-  List *mSemanticsAnnotations;
-
   SBase *mParentSBMLObject;
 
-  std::string mUnits;
+  // The MathML attributes, semantic annotations, user data and package
+  // plugins, which most nodes do not have; NULL until first needed.
+  struct Extras;
+  Extras *mExtras;
 
-  // additional MathML attributes
-  std::string mId;
-  std::string mClass;
-  std::string mStyle;
-
-  bool mIsBvar;
-  void *mUserData;
-  std::string mPackageName;
-  
   friend class MathMLFormatter;
   friend class MathMLHandler;
 
-  //----------------------------------------------------------------------
-  //
-  // Additional data members for Extension
-  //
-  //----------------------------------------------------------------------
-
-  //
-  // ASTBasePlugin derived classes will be stored in mPlugins.
-  std::vector<ASTBasePlugin*> mPlugins;
-
-
   /** @endcond */
 
 private:
   void clearPlugins();
+  Extras& getExtras();
+  void resetValue(ASTNodeType_t type);
 };
 
 LIBSBML_CPP_NAMESPACE_END
@@ -0,0 +1,306 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ASTNodeArena.cpp
+ * @brief   Block allocator for ASTNode objects.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/math/ASTNodeArena.h>
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * Size, and alignment, of the blocks the nodes are allocated from.
+ */
+static const size_t AST_NODE_ARENA_BLOCK_SIZE = 64 * 1024;
+
+/*
+ * Space reserved at the start of each block for the pointer to its arena;
+ * a multiple of the strictest fundamental alignment.
+ */
+static const size_t AST_NODE_ARENA_HEADER_SIZE = 16;
+
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+static thread_local ASTNodeArena* sCurrentArena = NULL;
+#else
+static ASTNodeArena* sCurrentArena = NULL;
+#endif
+
+
+#ifdef LIBSBML_AST_NODE_ARENA_LOCKED
+#define AST_NODE_ARENA_LOCK std::lock_guard<std::mutex> lock(mMutex)
+#else
+#define AST_NODE_ARENA_LOCK
+#endif
+
+
+/*
+ * Allocates a block of at least the given size, aligned on
+ * AST_NODE_ARENA_BLOCK_SIZE, and records its arena in its header.
+ */
+static char*
+allocateBlock (size_t size, ASTNodeArena* arena)
+{
+  void* block = NULL;
+
+#ifdef _WIN32
+  block = _aligned_malloc(size, AST_NODE_ARENA_BLOCK_SIZE);
+#else
+  if (posix_memalign(&block, AST_NODE_ARENA_BLOCK_SIZE, size) != 0)
+  {
+    block = NULL;
+  }
+#endif
+
+  if (block != NULL)
+  {
+    *static_cast<ASTNodeArena**>(block) = arena;
+  }
+
+  return static_cast<char*>(block);
+}
+
+
+static void
+freeBlock (void* block)
+{
+#ifdef _WIN32
+  _aligned_free(block);
+#else
+  free(block);
+#endif
+}
+
+
+ASTNodeArena::Scope::Scope (ASTNodeArena* arena)
+  : mPrevious (sCurrentArena)
+{
+  sCurrentArena = arena;
+}
+
+
+ASTNodeArena::Scope::~Scope ()
+{
+  sCurrentArena = mPrevious;
+}
+
+
+ASTNodeArena::ASTNodeArena ()
+  : mFree     ( NULL )
+  , mNext     ( NULL )
+  , mEnd      ( NULL )
+  , mSlotSize ( 0 )
+  , mNumNodes ( 0 )
+  , mDetached ( false )
+{
+}
+
+
+ASTNodeArena::~ASTNodeArena ()
+{
+  for (size_t n = 0; n < mBlocks.size(); ++n)
+  {
+    freeBlock(mBlocks[n]);
+  }
+}
+
+
+void
+ASTNodeArena::detach ()
+{
+  bool empty;
+
+  {
+    AST_NODE_ARENA_LOCK;
+    mDetached = true;
+    empty     = (mNumNodes == 0);
+  }
+
+  if (empty)
+  {
+    delete this;
+  }
+}
+
+
+unsigned int
+ASTNodeArena::getNumNodes () const
+{
+  AST_NODE_ARENA_LOCK;
+  return mNumNodes;
+}
+
+
+size_t
+ASTNodeArena::getNumBytes () const
+{
+  AST_NODE_ARENA_LOCK;
+  return mBlocks.size() * AST_NODE_ARENA_BLOCK_SIZE;
+}
+
+
+void*
+ASTNodeArena::allocate (size_t size)
+{
+  ASTNodeArena* arena = (sCurrentArena != NULL) ? sCurrentArena : getShared();
+  void*         ptr   = arena->take(size);
+
+  if (ptr == NULL)
+  {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+
+void
+ASTNodeArena::release (void* ptr)
+{
+  if (ptr == NULL) return;
+
+  char* block = reinterpret_cast<char*>(
+    reinterpret_cast<size_t>(ptr) & ~(AST_NODE_ARENA_BLOCK_SIZE - 1));
+  ASTNodeArena* arena = *reinterpret_cast<ASTNodeArena**>(block);
+
+  if (arena == NULL)
+  {
+    freeBlock(block);
+  }
+  else if (arena->give(ptr))
+  {
+    delete arena;
+  }
+}
+
+
+/*
+ * Returns a slot for an object of the given size.  All slots of an arena
+ * have the size of its first allocation; an object of any other size (a
+ * subclass of ASTNode) gets a block of its own, which has no arena.
+ */
+void*
+ASTNodeArena::take (size_t size)
+{
+  size_t slot = (size + AST_NODE_ARENA_HEADER_SIZE - 1)
+              & ~(AST_NODE_ARENA_HEADER_SIZE - 1);
+
+  AST_NODE_ARENA_LOCK;
+
+  if (mSlotSize == 0)
+  {
+    mSlotSize = slot;
+  }
+
+  if (slot != mSlotSize
+    || mSlotSize > AST_NODE_ARENA_BLOCK_SIZE - AST_NODE_ARENA_HEADER_SIZE)
+  {
+    char* block = allocateBlock(AST_NODE_ARENA_HEADER_SIZE + size, NULL);
+    return (block == NULL) ? NULL : block + AST_NODE_ARENA_HEADER_SIZE;
+  }
+
+  void* ptr = mFree;
+
+  if (ptr != NULL)
+  {
+    mFree = *static_cast<void**>(ptr);
+  }
+  else
+  {
+    if (mNext == NULL || mNext + mSlotSize > mEnd)
+    {
+      char* block = allocateBlock(AST_NODE_ARENA_BLOCK_SIZE, this);
+      if (block == NULL) return NULL;
+
+      mBlocks.push_back(block);
+      mNext = block + AST_NODE_ARENA_HEADER_SIZE;
+      mEnd  = block + AST_NODE_ARENA_BLOCK_SIZE;
+    }
+
+    ptr    = mNext;
+    mNext += mSlotSize;
+  }
+
+  ++mNumNodes;
+  return ptr;
+}
+
+
+/*
+ * Puts the given slot on the free list; returns true if this was the last
+ * node of a detached arena, which the caller should then delete.
+ */
+bool
+ASTNodeArena::give (void* ptr)
+{
+  AST_NODE_ARENA_LOCK;
+
+  *static_cast<void**>(ptr) = mFree;
+  mFree = ptr;
+  --mNumNodes;
+
+  return (mDetached && mNumNodes == 0);
+}
+
+
+/*
+ * The arena used when no other one is current.  It is never deleted, so
+ * that nodes can safely be freed during static destruction.
+ */
+ASTNodeArena*
+ASTNodeArena::getShared ()
+{
+  static ASTNodeArena* shared = new ASTNodeArena();
+  return shared;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
@@ -0,0 +1,177 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    ASTNodeArena.h
+ * @brief   Block allocator for ASTNode objects.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class ASTNodeArena
+ * @sbmlbrief{core} Allocates ASTNode objects from large blocks.
+ *
+ * When libSBML is configured with @c WITH_AST_NODE_ARENA, ASTNode objects
+ * are not allocated one at a time on the heap but carved out of blocks
+ * owned by an ASTNodeArena, which saves the per-allocation overhead of the
+ * system allocator and keeps the nodes of one formula close together in
+ * memory.  Each SBMLDocument read by SBMLReader gets an arena of its own,
+ * made current with an ASTNodeArena::Scope while the document is read;
+ * nodes created at any other time come from an arena shared by the whole
+ * process.
+ *
+ * Every block is aligned on its own size and starts with a pointer to the
+ * arena that owns it, so a node can be returned to its arena without
+ * storing anything in the node itself.  Freed nodes are reused by later
+ * allocations from the same arena.
+ *
+ * A node may outlive the document whose arena it was allocated from (for
+ * instance after ASTNode::removeChild()).  The owner of an arena therefore
+ * does not delete it but calls detach(), and the arena releases its blocks
+ * once its last node has been freed.
+ */
+
+#ifndef ASTNodeArena_h
+#define ASTNodeArena_h
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <vector>
+#include <sbml/common/libsbml-namespace.h>
+#include <sbml/common/extern.h>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <mutex>
+#define LIBSBML_AST_NODE_ARENA_LOCKED
+#endif
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class LIBSBML_EXTERN ASTNodeArena
+{
+public:
+
+  /**
+   * Makes an arena current for the calling thread for as long as the
+   * Scope exists, restoring the previously current arena afterwards.  A
+   * @c NULL arena selects the arena shared by the whole process.
+   */
+  class LIBSBML_EXTERN Scope
+  {
+  public:
+    explicit Scope (ASTNodeArena* arena);
+    ~Scope ();
+
+  private:
+    Scope (const Scope&);
+    Scope& operator= (const Scope&);
+
+    ASTNodeArena* mPrevious;
+  };
+
+
+  /**
+   * Creates an empty arena; no memory is reserved until the first node is
+   * allocated from it.
+   */
+  ASTNodeArena ();
+
+
+  /**
+   * Gives up the creator's hold on this arena.  The arena deletes itself
+   * immediately if it holds no nodes, or else when the last one is freed;
+   * it must not be used by its creator afterwards.
+   */
+  void detach ();
+
+
+  /**
+   * Returns the number of nodes currently allocated from this arena.
+   */
+  unsigned int getNumNodes () const;
+
+
+  /**
+   * Returns the number of bytes reserved by this arena.
+   */
+  size_t getNumBytes () const;
+
+
+  /**
+   * Allocates @p size bytes from the arena current for the calling thread.
+   * Throws std::bad_alloc on failure.
+   */
+  static void* allocate (size_t size);
+
+
+  /**
+   * Returns memory obtained from allocate() to the arena it came from.
+   */
+  static void release (void* ptr);
+
+
+private:
+
+  ~ASTNodeArena ();
+
+  ASTNodeArena (const ASTNodeArena&);
+  ASTNodeArena& operator= (const ASTNodeArena&);
+
+  void* take (size_t size);
+  bool  give (void* ptr);
+
+  static ASTNodeArena* getShared ();
+
+  std::vector<void*> mBlocks;
+  void*         mFree;
+  char*         mNext;
+  char*         mEnd;
+  size_t        mSlotSize;
+  unsigned int  mNumNodes;
+  bool          mDetached;
+
+#ifdef LIBSBML_AST_NODE_ARENA_LOCKED
+  mutable std::mutex mMutex;
+#endif
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* ASTNodeArena_h */
+/** @endcond */
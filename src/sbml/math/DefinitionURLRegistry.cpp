@@ -48,11 +48,30 @@
 #include <sbml/math/DefinitionURLRegistry.h>
 #include <sbml/util/util.h>
 
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <mutex>
+#define LIBSBML_DEFINITION_URLS_LOCKED
+#endif
+
 
 using namespace std;
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 
+/*
+ * Every MathML element read registers the definitionURLs of the packages
+ * of its document, so the registry is locked for documents read by
+ * several threads.
+ */
+#ifdef LIBSBML_DEFINITION_URLS_LOCKED
+static std::mutex sDefinitionURLsMutex;
+#define DEFINITION_URLS_LOCK \
+  std::lock_guard<std::mutex> lock(sDefinitionURLsMutex)
+#else
+#define DEFINITION_URLS_LOCK
+#endif
+
+
 DefinitionURLRegistry& 
 DefinitionURLRegistry::getInstance()
 {
@@ -77,9 +96,8 @@ DefinitionURLRegistry::addSBMLDefinitions()
 int 
 DefinitionURLRegistry::addDefinitionURL (const std::string& url, int type)
 {
-  unsigned int n = getNumDefinitionURLs();
-  getInstance().mDefinitionURLs.insert(std::pair<std::string, int>(url, type));
-  if (getNumDefinitionURLs() == n + 1)
+  DEFINITION_URLS_LOCK;
+  if (getInstance().mDefinitionURLs.insert(std::pair<std::string, int>(url, type)).second)
     return LIBSBML_OPERATION_SUCCESS;
   else
     return LIBSBML_OPERATION_FAILED;
@@ -88,6 +106,7 @@ DefinitionURLRegistry::addDefinitionURL (const std::string& url, int type)
 int
 DefinitionURLRegistry::getType(const std::string& url)
 {
+  DEFINITION_URLS_LOCK;
   int type = AST_UNKNOWN;
   UrlIt it = getInstance().mDefinitionURLs.find(url);
   if (it != getInstance().mDefinitionURLs.end())
@@ -100,6 +119,7 @@ DefinitionURLRegistry::getType(const std::string& url)
 
 std::string DefinitionURLRegistry::getDefinitionUrlByIndex(int index)
 {
+  DEFINITION_URLS_LOCK;
   UrlMap::const_iterator beg = getInstance().mDefinitionURLs.begin();
   for (size_t i = 0; i < getInstance().mDefinitionURLs.size(); ++i)
   {
@@ -113,6 +133,7 @@ std::string DefinitionURLRegistry::getDefinitionUrlByIndex(int index)
 int
 DefinitionURLRegistry::getNumDefinitionURLs()
 {
+  DEFINITION_URLS_LOCK;
   return (int)(getInstance().mDefinitionURLs.size());
 }
 
@@ -125,18 +146,21 @@ DefinitionURLRegistry::DefinitionURLRegistry()
 void 
 DefinitionURLRegistry::setCoreDefinitionsAdded()
 {
+  DEFINITION_URLS_LOCK;
   getInstance().mCoreInit = true;
 }
 
 bool
 DefinitionURLRegistry::getCoreDefinitionsAdded()
 {
+  DEFINITION_URLS_LOCK;
   return getInstance().mCoreInit;
 }
 
 void
 DefinitionURLRegistry::clearDefinitions()
 {
+  DEFINITION_URLS_LOCK;
   getInstance().mDefinitionURLs.clear();
   getInstance().mCoreInit = false;
 }
@@ -1369,14 +1369,17 @@ writeCI (const ASTNode& node, XMLOutputStream& stream, SBMLNamespaces *sbmlns)
     writeAttributes(node, stream);
 #ifdef USE_MULTI
 //    const_cast<ASTNode&>(node).loadASTPlugins(stream.getSBMLNamespaces());
-    MultiASTPlugin * plug = static_cast<MultiASTPlugin*>(const_cast<ASTNode&>(node).getPlugin("multi"));
+    // only nodes read with multi attributes carry the plugin; asking for
+    // it on any other node would allocate one
+    MultiASTPlugin * plug = (node.getNumPlugins() == 0) ? NULL :
+      static_cast<MultiASTPlugin*>(const_cast<ASTNode&>(node).getPlugin("multi"));
     if (plug != NULL)
     {
       plug->writeAttributes(stream, (int)(type));
     }
 
 #endif
-    if (node.getDefinitionURL() != NULL)
+    if (node.isSetDefinitionURL())
     {
       stream.writeAttribute("definitionURL", 
                             node.getDefinitionURL()->getValue(0));
@@ -1562,28 +1565,23 @@ writeCSymbol(const ASTNode& node, XMLOutputStream& stream, SBMLNamespaces *sbmln
 static void
 writeDouble (const double& value, XMLOutputStream& stream)
 {
+  char buffer[32];
+  util_formatDouble(buffer, value, XMLOutputStream::getWriteShortestDoubles());
 
-  ostringstream output;
-
-  output.precision(LIBSBML_DOUBLE_PRECISION);
-  output << value;
+  const char* position = strchr(buffer, 'e');
 
-  string            value_string = output.str();
-  string::size_type position     = value_string.find('e');
-
-  if (position == string::npos)
+  if (position == NULL)
   {
-    stream << " " << value_string << " ";
+    stream << " " << buffer << " ";
   }
   else
   {
-    const string mantissa_string = value_string.substr(0, position);
-    const string exponent_string = value_string.substr(position + 1);
+    const string mantissa_string(buffer, position - buffer);
 
-    double mantissa = strtod(mantissa_string.c_str(), 0);
-    long   exponent = strtol(exponent_string.c_str(), 0, 10);
+    ostringstream output;
+    output << strtol(position + 1, NULL, 10);
 
-    writeENotation(mantissa, exponent, stream);
+    writeENotation(mantissa_string, output.str(), stream);
   }
 }
 /** @endcond */
@@ -1599,25 +1597,22 @@ writeENotation (  const double&    mantissa
                 , long             exponent
                 , XMLOutputStream& stream )
 {
+  char buffer[32];
+  util_formatDouble(buffer, mantissa,
+                    XMLOutputStream::getWriteShortestDoubles());
 
-  ostringstream output;
+  const char* position = strchr(buffer, 'e');
 
-  output.precision(LIBSBML_DOUBLE_PRECISION);
-  output << mantissa;
-
-  const string      value_string = output.str();
-  string::size_type position     = value_string.find('e');
-
-  if (position != string::npos)
+  if (position != NULL)
   {
-    const string exponent_string = value_string.substr(position + 1);
-    exponent += strtol(exponent_string.c_str(), NULL, 10);
+    exponent += strtol(position + 1, NULL, 10);
   }
 
-  output.str("");
+  ostringstream output;
   output << exponent;
 
-  const string mantissa_string = value_string.substr(0, position);
+  const string mantissa_string = position != NULL ?
+    string(buffer, position - buffer) : string(buffer);
   const string exponent_string = output.str();
 
   writeENotation(mantissa_string, exponent_string, stream);
@@ -1964,17 +1959,28 @@ writePiecewise (const ASTNode& node, XMLOutputStream& stream, SBMLNamespaces *sb
 /** @endcond */
 
 /** @cond doxygenLibsbmlInternal */
+/*
+ * Set while the content of a <semantics> element is written; the items of
+ * a list may be written by several threads at once.
+ */
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+static thread_local bool inSemantics = false;
+#else
+static bool inSemantics = false;
+#endif
+
+
 /*
  * Formats the given ASTNode as a <semantics> element.
  */
 static void
-writeSemantics(const ASTNode& node, XMLOutputStream& stream, bool &inSemantics, SBMLNamespaces *sbmlns)
+writeSemantics(const ASTNode& node, XMLOutputStream& stream, SBMLNamespaces *sbmlns)
 {
 
   inSemantics = true;
   stream.startElement("semantics");
   writeAttributes(node, stream);
-  if (node.getDefinitionURL())
+  if (node.isSetDefinitionURL())
     stream.writeAttribute("definitionURL", 
                             node.getDefinitionURL()->getValue(0));
   writeNode(node, stream, sbmlns);
@@ -2032,10 +2038,8 @@ writeNode (const ASTNode& node, XMLOutputStream& stream, SBMLNamespaces *sbmlns)
   //  i++;
 
   //}
-  static bool inSemantics = false;
-  
   if (node.getSemanticsFlag() && !inSemantics)
-                     writeSemantics(node, stream, inSemantics, sbmlns);
+                     writeSemantics(node, stream, sbmlns);
 
   else if (  node.isNumber   () ) writeCN       (node, stream, sbmlns);
   else if (  node.isName     () ) writeCI       (node, stream, sbmlns);
@@ -1112,6 +1112,61 @@ START_TEST (test_ASTNode_deepCopy_5)
 END_TEST
 
 
+START_TEST (test_ASTNode_deepCopy_6)
+{
+  ASTNode_t *node = ASTNode_create();
+  ASTNode_t *copy;
+  char      *str;
+  int        data = 1;
+
+  ASTNode_setReal(node, 1.5);
+  ASTNode_setUnits(node, "mole");
+  ASTNode_setId(node, "i");
+  ASTNode_setClass(node, "c");
+  ASTNode_setStyle(node, "s");
+  ASTNode_setUserData(node, &data);
+
+  /** deepCopy() **/
+  copy = ASTNode_deepCopy(node);
+
+  fail_unless( ASTNode_getType(copy) == AST_REAL );
+  fail_unless( ASTNode_getReal(copy) == 1.5 );
+  fail_unless( ASTNode_getInteger(copy) == 0 );
+  fail_unless( ASTNode_getDenominator(copy) == 1 );
+  fail_unless( ASTNode_getUserData(copy) == &data );
+
+  str = ASTNode_getUnits(copy);
+  fail_unless( !strcmp(str, "mole") );
+  safe_free(str);
+
+  str = ASTNode_getId(copy);
+  fail_unless( !strcmp(str, "i") );
+  safe_free(str);
+
+  str = ASTNode_getClass(copy);
+  fail_unless( !strcmp(str, "c") );
+  safe_free(str);
+
+  str = ASTNode_getStyle(copy);
+  fail_unless( !strcmp(str, "s") );
+  safe_free(str);
+
+  /** the copy does not share the attributes of the original **/
+  ASTNode_unsetId(node);
+  fail_unless( ASTNode_isSetId(copy) == 1 );
+
+  ASTNode_setRational(copy, 1, 3);
+  fail_unless( ASTNode_getNumerator(copy) == 1 );
+  fail_unless( ASTNode_getDenominator(copy) == 3 );
+  fail_unless( ASTNode_getMantissa(copy) == 0 );
+  fail_unless( ASTNode_getExponent(copy) == 0 );
+
+  ASTNode_free(node);
+  ASTNode_free(copy);
+}
+END_TEST
+
+
 START_TEST (test_ASTNode_getName)
 {
   ASTNode_t *n = ASTNode_create();
@@ -5337,6 +5392,7 @@ create_suite_ASTNode (void)
   tcase_add_test( tcase, test_ASTNode_deepCopy_3              );
   tcase_add_test( tcase, test_ASTNode_deepCopy_4              );
   tcase_add_test( tcase, test_ASTNode_deepCopy_5              );
+  tcase_add_test( tcase, test_ASTNode_deepCopy_6              );
   tcase_add_test( tcase, test_ASTNode_getName                 );
   tcase_add_test( tcase, test_ASTNode_getReal                 );
   tcase_add_test( tcase, test_ASTNode_getPrecedence           );
@@ -53,6 +53,7 @@
 
 #include <sbml/xml/XMLToken.h>
 #include <sbml/xml/XMLNode.h>
+#include <sbml/xml/XMLOutputStream.h>
 
 /** @cond doxygenIgnored */
 
@@ -166,6 +167,28 @@ START_TEST (test_MathMLFormatter_cn_real_locale)
 END_TEST
 
 
+START_TEST (test_MathMLFormatter_cn_real_shortest)
+{
+  const char* expected = wrapMathML("  <cn> 0.3333333333333333 </cn>\n");
+
+  N = new ASTNode(AST_REAL);
+  N->setValue(1.0 / 3);
+  S = writeMathMLToString(N);
+
+  fail_unless( equals(expected, S) );
+
+  free(S);
+  expected = wrapMathML("  <cn> 0.333333333333333 </cn>\n");
+
+  XMLOutputStream::setWriteShortestDoubles(false);
+  S = writeMathMLToString(N);
+  XMLOutputStream::setWriteShortestDoubles(true);
+
+  fail_unless( equals(expected, S) );
+}
+END_TEST
+
+
 START_TEST (test_MathMLFormatter_cn_e_notation_1)
 {
   const char* expected = wrapMathML
@@ -1136,6 +1159,7 @@ create_suite_WriteMathML ()
   tcase_add_test( tcase, test_MathMLFormatter_cn_real_2             );
   tcase_add_test( tcase, test_MathMLFormatter_cn_real_3             );
   tcase_add_test( tcase, test_MathMLFormatter_cn_real_locale        );
+  tcase_add_test( tcase, test_MathMLFormatter_cn_real_shortest      );
   tcase_add_test( tcase, test_MathMLFormatter_cn_e_notation_1       );
   tcase_add_test( tcase, test_MathMLFormatter_cn_e_notation_2       );
   tcase_add_test( tcase, test_MathMLFormatter_cn_e_notation_3       );
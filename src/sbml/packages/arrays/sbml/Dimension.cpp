@@ -221,6 +221,7 @@ Dimension::isSetArrayDimension() const
 int
 Dimension::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -272,6 +273,7 @@ Dimension::setArrayDimension(unsigned int arrayDimension)
 int
 Dimension::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
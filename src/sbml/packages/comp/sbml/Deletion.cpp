@@ -120,6 +120,7 @@ Deletion::setId(const string& id)
   if (!SyntaxChecker::isValidSBMLSId(id)) {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
+  invalidateIdIndexes();
   mId = id;
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -128,6 +129,7 @@ Deletion::setId(const string& id)
 int 
 Deletion::unsetId()
 {
+  invalidateIdIndexes();
   mId = "";
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -157,6 +157,7 @@ ExternalModelDefinition::setId(const string& id)
   if (!SyntaxChecker::isValidSBMLSId(id)) {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
+  invalidateIdIndexes();
   mId = id;
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -168,6 +169,7 @@ ExternalModelDefinition::setId(const string& id)
 int 
 ExternalModelDefinition::unsetId()
 {
+  invalidateIdIndexes();
   mId = "";
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -130,6 +130,7 @@ ListOfDeletions::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast<Deletion*>(item);
@@ -125,6 +125,7 @@ ListOfExternalModelDefinitions::remove (const std::string &sid)
   if (result == mItems.end()) return NULL;
 
   mItems.erase(result);
+  invalidateIdIndexes();
   return static_cast<ExternalModelDefinition*>(*result);
 }
 
@@ -126,6 +126,7 @@ ListOfModelDefinitions::remove (const std::string &sid)
   if (result == mItems.end()) return NULL;
 
   mItems.erase(result);
+  invalidateIdIndexes();
   return static_cast<ModelDefinition*>(*result);
 }
 
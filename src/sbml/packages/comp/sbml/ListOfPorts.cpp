@@ -125,6 +125,7 @@ ListOfPorts::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast<Port*>(item);
@@ -125,6 +125,7 @@ ListOfSubmodels::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast<Submodel*>(item);
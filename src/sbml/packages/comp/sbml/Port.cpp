@@ -107,6 +107,7 @@ Port::setId (const std::string& id)
     //LS DEBUG return something else
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
+  invalidateIdIndexes();
   mId = id;
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -129,6 +130,7 @@ Port::isSetId () const
 int
 Port::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
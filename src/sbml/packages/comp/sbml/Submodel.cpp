@@ -181,6 +181,7 @@ Submodel::setId (const std::string& id)
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
+  invalidateIdIndexes();
   mId = id;
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -203,6 +204,7 @@ Submodel::isSetId () const
 int
 Submodel::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty())
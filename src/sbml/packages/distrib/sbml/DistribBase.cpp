@@ -174,6 +174,7 @@ DistribBase::isSetName() const
 int
 DistribBase::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -195,6 +196,7 @@ DistribBase::setName(const std::string& name)
 int
 DistribBase::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
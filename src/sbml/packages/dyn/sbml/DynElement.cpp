@@ -238,6 +238,7 @@ DynElement::setIdRef(const std::string& idRef)
 int
 DynElement::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -293,6 +294,7 @@ DynElement::unsetIdRef()
 int
 DynElement::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -861,6 +863,7 @@ ListOfDynElements::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
 	return static_cast <DynElement*> (item);
@@ -262,6 +262,7 @@ SpatialComponent::setVariable(const std::string& variable)
 int
 SpatialComponent::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -313,6 +314,7 @@ SpatialComponent::unsetVariable()
 int
 SpatialComponent::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -862,6 +864,7 @@ ListOfSpatialComponents::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
 	return static_cast <SpatialComponent*> (item);
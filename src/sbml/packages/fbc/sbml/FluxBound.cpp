@@ -172,6 +172,7 @@ FluxBound::isSetId () const
 int 
 FluxBound::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id,mId);
 }
 
@@ -182,6 +183,7 @@ FluxBound::setId (const std::string& id)
 int 
 FluxBound::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -1145,6 +1147,7 @@ ListOfFluxBounds::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <FluxBound*> (item);
@@ -266,6 +266,7 @@ FluxObjective::isSetVariableType() const
 int
 FluxObjective::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -367,6 +368,7 @@ FluxObjective::setVariableType(const std::string& variableType)
 int
 FluxObjective::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1351,6 +1353,7 @@ ListOfFluxObjectives::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <FluxObjective*> (item);
@@ -247,6 +247,7 @@ GeneAssociation::isSetId () const
 int 
 GeneAssociation::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id ,mId);
 }
 
@@ -257,6 +258,7 @@ GeneAssociation::setId (const std::string& id)
 int 
 GeneAssociation::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -660,6 +662,7 @@ ListOfGeneAssociations::remove (const std::string& symbol)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GeneAssociation*> (item);
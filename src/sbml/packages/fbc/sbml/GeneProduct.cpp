@@ -222,6 +222,7 @@ GeneProduct::isSetAssociatedSpecies() const
 int
 GeneProduct::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -276,6 +277,7 @@ GeneProduct::setAssociatedSpecies(const std::string& associatedSpecies)
 int
 GeneProduct::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1159,6 +1161,7 @@ ListOfGeneProducts::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GeneProduct*> (item);
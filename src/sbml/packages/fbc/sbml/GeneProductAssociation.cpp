@@ -289,6 +289,7 @@ GeneProductAssociation::isSetAssociation() const
 int
 GeneProductAssociation::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -369,6 +370,7 @@ int GeneProductAssociation::setAssociation(const std::string& association,
 int
 GeneProductAssociation::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -224,6 +224,7 @@ GeneProductRef::isSetName() const
 int
 GeneProductRef::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -265,6 +266,7 @@ GeneProductRef::setName(const std::string& name)
 int
 GeneProductRef::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
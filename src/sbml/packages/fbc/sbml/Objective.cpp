@@ -233,6 +233,7 @@ Objective::isSetType() const
 int
 Objective::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -285,6 +286,7 @@ Objective::setType(const std::string& type)
 int
 Objective::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1269,7 +1271,7 @@ Objective::writeAttributes (XMLOutputStream& stream) const
     stream.writeAttribute("type", getPrefix(),
     ObjectiveType_toString(mType));
 
-  SBase::writeExtensionAttributes(stream);
+  SBase::writeExtensionAttributes(stream);
 }
 
 
@@ -1486,6 +1488,7 @@ ListOfObjectives::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Objective*> (item);
@@ -212,6 +212,7 @@ Group::isSetKind() const
 int
 Group::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -269,6 +270,7 @@ Group::setKind(const std::string& kind)
 int
 Group::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -166,6 +166,7 @@ ListOfMembers::isSetName() const
 int
 ListOfMembers::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -187,6 +188,7 @@ ListOfMembers::setName(const std::string& name)
 int
 ListOfMembers::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -288,6 +290,7 @@ ListOfMembers::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Member*> (item);
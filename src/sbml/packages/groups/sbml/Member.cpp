@@ -217,6 +217,7 @@ Member::isSetMetaIdRef() const
 int
 Member::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -274,6 +275,7 @@ Member::setMetaIdRef(const std::string& metaIdRef)
 int
 Member::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -369,6 +369,7 @@ bool BoundingBox::isSetId () const
   */
 int BoundingBox::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id,mId);
 }
 
@@ -378,6 +379,7 @@ int BoundingBox::setId (const std::string& id)
   */
 int BoundingBox::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
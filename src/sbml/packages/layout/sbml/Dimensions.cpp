@@ -209,6 +209,7 @@ bool Dimensions::isSetId () const
   */
 int Dimensions::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id,mId);
 }
 
@@ -218,6 +219,7 @@ int Dimensions::setId (const std::string& id)
   */
 int Dimensions::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -1164,6 +1164,7 @@ ListOfReferenceGlyphs::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <ReferenceGlyph*> (item);
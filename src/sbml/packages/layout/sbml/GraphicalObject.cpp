@@ -391,6 +391,7 @@ int GraphicalObject::setId(const std::string& id)
 {
   if (id.empty())
     return unsetId();
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -400,6 +401,7 @@ int GraphicalObject::setId(const std::string& id)
   */
 int GraphicalObject::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -725,7 +727,7 @@ void GraphicalObject::readAttributes(const XMLAttributes& attributes,
           std::string role;
           attributes.readInto("objectRole", role);
           int index = attributes.getIndex("objectRole");
-          mAttributesOfUnknownPkg.add("objectRole", role, attributes.getURI(index), attributes.getPrefix(index));
+          getUnknownPackageData().mAttributesOfUnknownPkg.add("objectRole", role, attributes.getURI(index), attributes.getPrefix(index));
         }
         else
 #endif
@@ -969,17 +971,20 @@ GraphicalObject::writeXMLNS(XMLOutputStream& stream) const
   }
 #else
 
-  if (getLevel() < 3)
-    for (int i = 0; i < mAttributesOfUnknownPkg.getNumAttributes(); ++i)
+  if (getLevel() < 3 && mUnknownPackageData != NULL)
+  {
+    const XMLAttributes& attributes = mUnknownPackageData->mAttributesOfUnknownPkg;
+    for (int i = 0; i < attributes.getNumAttributes(); ++i)
     {
-      if (mAttributesOfUnknownPkg.getName(i) == "objectRole" && !mAttributesOfUnknownPkg.getPrefix(i).empty())
+      if (attributes.getName(i) == "objectRole" && !attributes.getPrefix(i).empty())
       {
         XMLNamespaces xmlns;
-        xmlns.add(mAttributesOfUnknownPkg.getURI(i), mAttributesOfUnknownPkg.getPrefix(i));
+        xmlns.add(attributes.getURI(i), attributes.getPrefix(i));
         stream << xmlns;
         break;
       }
     }
+  }
 
 #endif
 }
@@ -1190,6 +1195,7 @@ ListOfGraphicalObjects::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GraphicalObject*> (item);
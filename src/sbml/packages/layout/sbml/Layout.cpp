@@ -453,6 +453,7 @@ bool Layout::isSetName () const
   */
 int Layout::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id,mId);
 }
 
@@ -470,6 +471,7 @@ int Layout::setName (const std::string& name)
   */
 int Layout::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -483,6 +485,7 @@ int Layout::unsetId ()
 
 int Layout::unsetName ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -1996,6 +1999,7 @@ ListOfLayouts::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Layout*> (item);
@@ -2178,6 +2182,7 @@ ListOfCompartmentGlyphs::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <CompartmentGlyph*> (item);
@@ -2330,6 +2335,7 @@ ListOfSpeciesGlyphs::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesGlyph*> (item);
@@ -2502,6 +2508,7 @@ ListOfReactionGlyphs::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <ReactionGlyph*> (item);
@@ -2651,6 +2658,7 @@ ListOfTextGlyphs::remove (const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <TextGlyph*> (item);
@@ -227,6 +227,7 @@ bool Point::isSetId () const
   */
 int Point::setId (const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id,mId);
 }
 
@@ -236,6 +237,7 @@ int Point::setId (const std::string& id)
   */
 int Point::unsetId ()
 {
+  invalidateIdIndexes();
   mId.erase();
   if (mId.empty())
   {
@@ -1467,6 +1467,50 @@ END_TEST
 
 
 
+START_TEST (test_SBMLHandler_skipped_layout)
+{
+  std::string s =
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+  "<sbml xmlns=\"http://www.sbml.org/sbml/level3/version1/core\""
+  " xmlns:layout=\"http://www.sbml.org/sbml/level3/version1/layout/version1\""
+  " level=\"3\" version=\"1\" layout:required=\"false\">"
+  "<model id=\"m\">"
+  "<listOfCompartments>"
+  "<compartment id=\"c\" constant=\"true\"/>"
+  "</listOfCompartments>"
+  "<layout:listOfLayouts>"
+  "<layout:layout layout:id=\"l\">"
+  "<layout:dimensions layout:width=\"400\" layout:height=\"230\"/>"
+  "</layout:layout>"
+  "</layout:listOfLayouts>"
+  "</model>"
+  "</sbml>";
+
+  SBMLReader reader;
+  reader.addSkippedPackage("layout");
+
+  D = reader.readSBMLFromString(s);
+
+  Model* model = D->getModel();
+  fail_unless(model != NULL);
+  fail_unless(model->getNumCompartments() == 1);
+
+  LayoutModelPlugin* plugin =
+    static_cast<LayoutModelPlugin*>(model->getPlugin("layout"));
+  fail_unless(plugin != NULL);
+  fail_unless(plugin->getNumLayouts() == 0);
+
+  delete D;
+
+  reader.clearSkippedElements();
+  D = reader.readSBMLFromString(s);
+
+  plugin = static_cast<LayoutModelPlugin*>(D->getModel()->getPlugin("layout"));
+  fail_unless(plugin->getNumLayouts() == 1);
+}
+END_TEST
+
+
 Suite *
 create_suite_SBMLHandler (void)
 {
@@ -1479,6 +1523,7 @@ create_suite_SBMLHandler (void)
   
   
   tcase_add_test( tcase, test_SBMLHandler_Layout                            );
+  tcase_add_test( tcase, test_SBMLHandler_skipped_layout                    );
   
   suite_add_tcase(suite, tcase);
   
@@ -188,6 +188,7 @@ CompartmentReference::isSetCompartment() const
 int
 CompartmentReference::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -227,6 +228,7 @@ CompartmentReference::setCompartment(const std::string& compartment)
 int
 CompartmentReference::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -693,6 +695,7 @@ ListOfCompartmentReferences::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <CompartmentReference*> (item);
@@ -212,6 +212,7 @@ InSpeciesTypeBond::isSetBindingSite2() const
 int
 InSpeciesTypeBond::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -269,6 +270,7 @@ InSpeciesTypeBond::setBindingSite2(const std::string& bindingSite2)
 int
 InSpeciesTypeBond::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -793,6 +795,7 @@ ListOfInSpeciesTypeBonds::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <InSpeciesTypeBond*> (item);
@@ -222,6 +222,7 @@ MultiSpeciesType::isSetCompartment() const
 int
 MultiSpeciesType::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -263,6 +264,7 @@ MultiSpeciesType::setCompartment(const std::string& compartment)
 int
 MultiSpeciesType::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1577,6 +1579,7 @@ ListOfMultiSpeciesTypes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <MultiSpeciesType*> (item);
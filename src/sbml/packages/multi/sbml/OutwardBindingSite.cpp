@@ -204,6 +204,7 @@ OutwardBindingSite::isSetComponent() const
 int
 OutwardBindingSite::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -288,6 +289,7 @@ OutwardBindingSite::setComponent(const std::string& component)
 int
 OutwardBindingSite::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -793,6 +795,7 @@ ListOfOutwardBindingSites::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <OutwardBindingSite*> (item);
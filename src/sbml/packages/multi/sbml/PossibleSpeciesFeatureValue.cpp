@@ -188,6 +188,7 @@ PossibleSpeciesFeatureValue::isSetNumericValue() const
 int
 PossibleSpeciesFeatureValue::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -227,6 +228,7 @@ PossibleSpeciesFeatureValue::setNumericValue(const std::string& numericValue)
 int
 PossibleSpeciesFeatureValue::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -691,6 +693,7 @@ ListOfPossibleSpeciesFeatureValues::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <PossibleSpeciesFeatureValue*> (item);
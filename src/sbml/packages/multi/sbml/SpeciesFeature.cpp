@@ -252,6 +252,7 @@ SpeciesFeature::isSetComponent() const
 int
 SpeciesFeature::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -321,6 +322,7 @@ SpeciesFeature::setComponent(const std::string& component)
 int
 SpeciesFeature::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1179,6 +1181,7 @@ ListOfSpeciesFeatures::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesFeature*> (item);
@@ -209,6 +209,7 @@ SpeciesFeatureType::isSetOccur() const
 int
 SpeciesFeatureType::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -242,6 +243,7 @@ SpeciesFeatureType::setOccur(unsigned int occur)
 int
 SpeciesFeatureType::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -951,6 +953,7 @@ ListOfSpeciesFeatureTypes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesFeatureType*> (item);
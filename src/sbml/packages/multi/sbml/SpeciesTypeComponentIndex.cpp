@@ -209,6 +209,7 @@ SpeciesTypeComponentIndex::isSetIdentifyingParent() const
 int
 SpeciesTypeComponentIndex::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -266,6 +267,7 @@ SpeciesTypeComponentIndex::setIdentifyingParent(const std::string& identifyingPa
 int
 SpeciesTypeComponentIndex::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -812,6 +814,7 @@ ListOfSpeciesTypeComponentIndexes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesTypeComponentIndex*> (item);
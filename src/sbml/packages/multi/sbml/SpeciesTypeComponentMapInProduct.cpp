@@ -230,6 +230,7 @@ SpeciesTypeComponentMapInProduct::isSetProductComponent() const
 int
 SpeciesTypeComponentMapInProduct::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -305,6 +306,7 @@ SpeciesTypeComponentMapInProduct::setProductComponent(const std::string& product
 int
 SpeciesTypeComponentMapInProduct::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -881,6 +883,7 @@ ListOfSpeciesTypeComponentMapInProducts::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesTypeComponentMapInProduct*> (item);
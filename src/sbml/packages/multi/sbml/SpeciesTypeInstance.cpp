@@ -212,6 +212,7 @@ SpeciesTypeInstance::isSetCompartmentReference() const
 int
 SpeciesTypeInstance::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -269,6 +270,7 @@ SpeciesTypeInstance::setCompartmentReference(const std::string& compartmentRefer
 int
 SpeciesTypeInstance::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -806,6 +808,7 @@ ListOfSpeciesTypeInstances::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesTypeInstance*> (item);
@@ -156,6 +156,7 @@ SubListOfSpeciesFeatures::isSetName() const
 int
 SubListOfSpeciesFeatures::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -177,6 +178,7 @@ SubListOfSpeciesFeatures::setName(const std::string& name)
 int
 SubListOfSpeciesFeatures::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -357,6 +359,7 @@ SubListOfSpeciesFeatures::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SpeciesFeature*> (item);
@@ -989,6 +989,7 @@ ListOfFunctionTerms::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <FunctionTerm*> (item);
@@ -272,6 +272,7 @@ Input::isSetThresholdLevel() const
 int
 Input::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -361,6 +362,7 @@ Input::setThresholdLevel(int thresholdLevel)
 int
 Input::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1300,6 +1302,7 @@ ListOfInputs::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Input*> (item);
@@ -248,6 +248,7 @@ Output::isSetOutputLevel() const
 int
 Output::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -320,6 +321,7 @@ Output::setOutputLevel(int outputLevel)
 int
 Output::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1203,6 +1205,7 @@ ListOfOutputs::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Output*> (item);
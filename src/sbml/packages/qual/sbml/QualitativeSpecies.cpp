@@ -280,6 +280,7 @@ QualitativeSpecies::isSetMaxLevel() const
 int
 QualitativeSpecies::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -356,6 +357,7 @@ QualitativeSpecies::setMaxLevel(int maxLevel)
 int
 QualitativeSpecies::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1296,6 +1298,7 @@ ListOfQualitativeSpecies::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <QualitativeSpecies*> (item);
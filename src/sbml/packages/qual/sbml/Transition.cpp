@@ -241,6 +241,7 @@ Transition::isSetName() const
 int
 Transition::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -263,6 +264,7 @@ Transition::setName(const std::string& name)
 int
 Transition::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -1729,6 +1731,7 @@ ListOfTransitions::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <Transition*> (item);
@@ -441,6 +441,7 @@ ColorDefinition::isSetValue() const
 int
 ColorDefinition::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -612,6 +613,7 @@ std::string ColorDefinition::createValueString() const
 int
 ColorDefinition::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
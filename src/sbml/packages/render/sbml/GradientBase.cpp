@@ -330,6 +330,7 @@ GradientBase::isSetSpreadMethod() const
 int
 GradientBase::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -417,6 +418,7 @@ GradientBase::setSpreadMethod(const std::string& spreadMethod)
 int
 GradientBase::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
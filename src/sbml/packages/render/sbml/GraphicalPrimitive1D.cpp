@@ -377,6 +377,7 @@ bool GraphicalPrimitive1D::isSetDashArray() const
 int
 GraphicalPrimitive1D::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -528,6 +529,7 @@ GraphicalPrimitive1D::insertDash(unsigned int index, unsigned int dash)
 int
 GraphicalPrimitive1D::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -303,6 +303,7 @@ Image::isSetImageReference() const
 int
 Image::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -334,6 +335,7 @@ Image::setImageReference(const std::string& href)
 int
 Image::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -345,6 +345,7 @@ LineEnding::isSetEnableRotationalMapping() const
 int
 LineEnding::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -368,6 +369,7 @@ LineEnding::setEnableRotationalMapping(bool enableRotationalMapping)
 int
 LineEnding::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
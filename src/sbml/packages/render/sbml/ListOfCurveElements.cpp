@@ -264,6 +264,7 @@ ListOfCurveElements::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <RenderPoint*> (item);
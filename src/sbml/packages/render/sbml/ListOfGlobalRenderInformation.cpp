@@ -541,6 +541,7 @@ ListOfGlobalRenderInformation::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GlobalRenderInformation*> (item);
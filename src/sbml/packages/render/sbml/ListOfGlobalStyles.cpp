@@ -223,6 +223,7 @@ ListOfGlobalStyles::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GlobalStyle*> (item);
@@ -245,6 +245,7 @@ ListOfGradientDefinitions::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <GradientBase*> (item);
@@ -235,6 +235,7 @@ ListOfLineEndings::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <LineEnding*> (item);
@@ -239,6 +239,7 @@ ListOfLocalStyles::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <LocalStyle*> (item);
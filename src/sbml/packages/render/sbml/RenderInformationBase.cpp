@@ -412,6 +412,7 @@ RenderInformationBase::isSetBackgroundColor() const
 int
 RenderInformationBase::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -502,6 +503,7 @@ RenderInformationBase::setBackgroundColor(const std::string& backgroundColor)
 int
 RenderInformationBase::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
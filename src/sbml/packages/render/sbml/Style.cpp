@@ -321,6 +321,7 @@ Style::isSetName() const
 int
 Style::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -342,6 +343,7 @@ Style::setName(const std::string& name)
 int
 Style::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
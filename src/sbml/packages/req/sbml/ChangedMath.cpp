@@ -223,6 +223,7 @@ ChangedMath::isSetViableWithoutChange() const
 int
 ChangedMath::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -267,6 +268,7 @@ ChangedMath::setViableWithoutChange(bool viableWithoutChange)
 int
 ChangedMath::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -744,6 +746,7 @@ ListOfChangedMaths::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <ChangedMath*> (item);
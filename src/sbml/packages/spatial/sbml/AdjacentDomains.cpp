@@ -220,6 +220,7 @@ AdjacentDomains::isSetDomain2() const
 int
 AdjacentDomains::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -277,6 +278,7 @@ AdjacentDomains::setDomain2(const std::string& domain2)
 int
 AdjacentDomains::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -284,6 +284,7 @@ AnalyticVolume::isSetDomainType() const
 int
 AnalyticVolume::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -373,6 +374,7 @@ AnalyticVolume::setDomainType(const std::string& domainType)
 int
 AnalyticVolume::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
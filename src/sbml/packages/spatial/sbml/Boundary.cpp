@@ -200,6 +200,7 @@ Boundary::isSetValue() const
 int
 Boundary::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -233,6 +234,7 @@ Boundary::setValue(double value)
 int
 Boundary::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -180,6 +180,7 @@ CSGNode::isSetName() const
 int
 CSGNode::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -201,6 +202,7 @@ CSGNode::setName(const std::string& name)
 int
 CSGNode::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -254,6 +254,7 @@ CSGObject::isSetOrdinal() const
 int
 CSGObject::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -305,6 +306,7 @@ CSGObject::setOrdinal(int ordinal)
 int
 CSGObject::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
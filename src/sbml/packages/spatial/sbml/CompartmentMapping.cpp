@@ -225,6 +225,7 @@ CompartmentMapping::isSetUnitSize() const
 int
 CompartmentMapping::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -276,6 +277,7 @@ CompartmentMapping::setUnitSize(double unitSize)
 int
 CompartmentMapping::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -277,6 +277,7 @@ CoordinateComponent::isSetUnit() const
 int
 CoordinateComponent::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -354,6 +355,7 @@ CoordinateComponent::setUnit(const std::string& unit)
 int
 CoordinateComponent::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -202,6 +202,7 @@ Domain::isSetDomainType() const
 int
 Domain::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -241,6 +242,7 @@ Domain::setDomainType(const std::string& domainType)
 int
 Domain::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -198,6 +198,7 @@ DomainType::isSetSpatialDimensions() const
 int
 DomainType::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -231,6 +232,7 @@ DomainType::setSpatialDimensions(int spatialDimensions)
 int
 DomainType::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
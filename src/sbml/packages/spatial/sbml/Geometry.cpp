@@ -219,6 +219,7 @@ Geometry::isSetCoordinateSystem() const
 int
 Geometry::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -265,6 +266,7 @@ Geometry::setCoordinateSystem(const std::string& coordinateSystem)
 int
 Geometry::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
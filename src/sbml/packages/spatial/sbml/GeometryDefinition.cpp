@@ -211,6 +211,7 @@ GeometryDefinition::isSetIsActive() const
 int
 GeometryDefinition::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -244,6 +245,7 @@ GeometryDefinition::setIsActive(bool isActive)
 int
 GeometryDefinition::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -196,6 +196,7 @@ ListOfAnalyticVolumes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <AnalyticVolume*> (item);
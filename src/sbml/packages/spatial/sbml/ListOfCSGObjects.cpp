@@ -192,6 +192,7 @@ ListOfCSGObjects::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <CSGObject*> (item);
@@ -199,6 +199,7 @@ ListOfCoordinateComponents::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <CoordinateComponent*> (item);
@@ -192,6 +192,7 @@ ListOfDomainTypes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <DomainType*> (item);
@@ -193,6 +193,7 @@ ListOfSampledVolumes::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateIdIndexes();
   }
 
   return static_cast <SampledVolume*> (item);
@@ -415,6 +415,7 @@ ParametricObject::isSetDataType() const
 int
 ParametricObject::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -609,6 +610,7 @@ ParametricObject::setDataType(const std::string& dataType)
 int
 ParametricObject::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -545,6 +545,7 @@ SampledField::isSetSamplesLength() const
 int
 SampledField::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -847,6 +848,7 @@ SampledField::setSamplesLength(int samplesLength)
 int
 SampledField::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
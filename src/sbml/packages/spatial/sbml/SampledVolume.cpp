@@ -281,6 +281,7 @@ SampledVolume::isSetMaxValue() const
 int
 SampledVolume::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -356,6 +357,7 @@ SampledVolume::setMaxValue(double maxValue)
 int
 SampledVolume::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
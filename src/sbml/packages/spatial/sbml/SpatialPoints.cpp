@@ -430,6 +430,7 @@ SpatialPoints::isSetDataType() const
 int
 SpatialPoints::setId(const std::string& id)
 {
+  invalidateIdIndexes();
   return SyntaxChecker::checkAndSetSId(id, mId);
 }
 
@@ -682,6 +683,7 @@ SpatialPoints::setDataType(const std::string& dataType)
 int
 SpatialPoints::unsetId()
 {
+  invalidateIdIndexes();
   mId.erase();
 
   if (mId.empty() == true)
@@ -0,0 +1,285 @@
+/**
+ * @file    TestCompiledMath.cpp
+ * @brief   CompiledMath and CompiledModel unit tests
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/common/common.h>
+#include <sbml/common/extern.h>
+#include <sbml/SBMLReader.h>
+#include <sbml/SBMLTypes.h>
+
+#include <sbml/SBMLTransforms.h>
+#include <sbml/CompiledMath.h>
+#include <sbml/CompiledModel.h>
+
+#include <check.h>
+
+LIBSBML_CPP_NAMESPACE_USE
+
+BEGIN_C_DECLS
+
+
+extern char *TestDataDirectory;
+
+
+/*
+ * Returns true if formula evaluates to the same value compiled as with
+ * SBMLTransforms::evaluateASTNode(), with a = 2.5 and b = -0.5.
+ */
+static bool
+compilesLikeEvaluate(const char* formula, const Model* m = NULL)
+{
+  ASTNode* node = SBML_parseL3Formula(formula);
+  if (node == NULL) return false;
+
+  CompiledMath::SlotMap slots;
+  slots["a"] = 0;
+  slots["b"] = 1;
+  double values[] = { 2.5, -0.5 };
+
+  std::map<std::string, double> named;
+  named["a"] = values[0];
+  named["b"] = values[1];
+
+  CompiledMath compiled;
+  compiled.compile(node, slots,
+                   m != NULL ? m->getListOfFunctionDefinitions() : NULL);
+
+  double expected = SBMLTransforms::evaluateASTNode(node, named, m);
+  double actual = compiled.evaluate(values);
+  delete node;
+
+  return (util_isNaN(expected) && util_isNaN(actual)) || expected == actual;
+}
+
+
+START_TEST (test_CompiledMath_evaluate)
+{
+  const char* formulas[] = {
+    "2.5 + 6.1", "-a", "a - b", "a * b * 3", "a / b", "pow(a, 3)",
+    "a^b", "abs(b)", "ceil(a)", "floor(b)", "exp(a)", "ln(a)", "log(a)",
+    "log10(a)", "sqrt(a)", "root(3, a)", "factorial(4)", "sin(a) + cos(b)",
+    "tan(a)", "sec(a)", "csc(a)", "cot(a)", "sinh(a)", "cosh(a)", "tanh(a)",
+    "sech(a)", "csch(a)", "coth(a)", "arcsin(b)", "arccos(b)", "arctan(a)",
+    "arcsinh(a)", "arccosh(a)", "arctanh(b)", "arcsec(a)", "arccsc(a)",
+    "arccot(a)", "arcsech(0.5)", "arccsch(a)", "arccoth(a)",
+    "a > b", "a >= b", "a < b", "a <= b", "a == b", "a != b",
+    "a > b && b > 0", "a > b || b > 0", "xor(a > b, b > 0)", "!(a > b)",
+    "piecewise(a, a > b, b)", "piecewise(a, a < b, b)",
+    "piecewise(a, a > b, b, b < a)", "piecewise(a, a < b)",
+    "max(2.5, -0.5, 1)", "min(2.5, -0.5, 1)", "rem(7, 2.5)",
+    "quotient(7, 2.5)", "implies(3 > 2, 1 < 0)", "exponentiale * pi",
+    "true + false",
+    "avogadro / 1e23", "c + a", "undefinedfunc(a)", "delay(a, 1)",
+  };
+
+  for (size_t i = 0; i < sizeof(formulas) / sizeof(formulas[0]); ++i)
+  {
+    fail_unless(compilesLikeEvaluate(formulas[i]), formulas[i]);
+  }
+}
+END_TEST
+
+
+START_TEST (test_CompiledMath_functionDefinitions)
+{
+  std::string filename(TestDataDirectory);
+  filename += "multiple-functions.xml";
+
+  SBMLDocument* d = readSBMLFromFile(filename.c_str());
+  Model* m = d->getModel();
+  fail_unless(m != NULL);
+
+  fail_unless(compilesLikeEvaluate("f(2, g(4, cos(0)))", m));
+  fail_unless(compilesLikeEvaluate("f(a, g(b, a)) + f(b, 1)", m));
+  fail_unless(compilesLikeEvaluate("f(2, g(1, undefinedfunc(0)))", m));
+
+  CompiledMath::SlotMap slots;
+  slots["a"] = 0;
+  double values[] = { 3 };
+
+  /* the arguments of f are bound to the bvars, not to the ids of the model */
+  ASTNode* node = SBML_parseL3Formula("f(a, 2) + x");
+  CompiledMath compiled;
+  fail_unless(compiled.compile(node, slots, m->getListOfFunctionDefinitions()));
+  fail_unless(util_isNaN(compiled.evaluate(values)));
+  delete node;
+
+  node = SBML_parseL3Formula("g(a, 2) * 2");
+  fail_unless(compiled.compile(node, slots, m->getListOfFunctionDefinitions()));
+  fail_unless(compiled.evaluate(values) == 12);
+
+  /* constant subexpressions are folded */
+  delete node;
+  node = SBML_parseL3Formula("f(2, 3) + cos(0)");
+  fail_unless(compiled.compile(node, slots, m->getListOfFunctionDefinitions()));
+  fail_unless(compiled.isConstant());
+  fail_unless(compiled.evaluate(NULL) == 7);
+
+  /* calls that cannot be compiled are reported */
+  delete node;
+  node = SBML_parseL3Formula("h(a)");
+  fail_unless(!compiled.compile(node, slots, m->getListOfFunctionDefinitions()));
+  fail_unless(util_isNaN(compiled.evaluate(values)));
+
+  delete node;
+  delete d;
+}
+END_TEST
+
+
+START_TEST (test_CompiledModel_reactionRates)
+{
+  SBMLDocument doc(3, 1);
+  Model* m = doc.createModel();
+
+  Compartment* c = m->createCompartment();
+  c->setId("C");
+  c->setSize(2);
+  c->setConstant(true);
+
+  Species* s = m->createSpecies();
+  s->setId("S");
+  s->setCompartment("C");
+  s->setInitialAmount(6);
+  s->setHasOnlySubstanceUnits(false);
+  s->setBoundaryCondition(false);
+  s->setConstant(false);
+
+  const char* params[] = { "k", "k2", "k3" };
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    Parameter* p = m->createParameter();
+    p->setId(params[i]);
+    p->setConstant(i == 0);
+    if (i == 0) p->setValue(0.5);
+  }
+
+  /* k3 is listed before the rule for k2 it depends on */
+  AssignmentRule* r = m->createAssignmentRule();
+  r->setVariable("k3");
+  ASTNode* math = SBML_parseL3Formula("k2 * 3");
+  r->setMath(math);
+  delete math;
+
+  r = m->createAssignmentRule();
+  r->setVariable("k2");
+  math = SBML_parseL3Formula("k * 2");
+  r->setMath(math);
+  delete math;
+
+  Reaction* rn = m->createReaction();
+  rn->setId("J1");
+  rn->setReversible(false);
+  SpeciesReference* sr = rn->createReactant();
+  sr->setId("SR");
+  sr->setSpecies("S");
+  sr->setStoichiometry(2);
+  sr->setConstant(true);
+  KineticLaw* kl = rn->createKineticLaw();
+  LocalParameter* lp = kl->createLocalParameter();
+  lp->setId("k");
+  lp->setValue(10);
+  math = SBML_parseL3Formula("k * S * SR");
+  kl->setMath(math);
+  delete math;
+
+  rn = m->createReaction();
+  rn->setId("J2");
+  rn->setReversible(false);
+  kl = rn->createKineticLaw();
+  math = SBML_parseL3Formula("k3 + J1 + time");
+  kl->setMath(math);
+  delete math;
+
+  CompiledModel compiled(m);
+
+  fail_unless(compiled.getNumReactions() == 2);
+  fail_unless(compiled.getNumValues() == 9);
+  fail_unless(compiled.getIndex("S") >= 0);
+  fail_unless(compiled.getIndex("nothing") == -1);
+  fail_unless(compiled.getLocalParameterIndex("J1", "k") >= 0);
+  fail_unless(compiled.getLocalParameterIndex("J1", "k")
+              != compiled.getIndex("k"));
+  fail_unless(compiled.getLocalParameterIndex("J2", "k") == -1);
+  fail_unless(compiled.getId(compiled.getReactionIndex(1)) == "J2");
+
+  std::vector<double> values;
+  compiled.getInitialValues(values);
+  fail_unless(values.size() == 9);
+  fail_unless(values[compiled.getIndex("S")] == 3);
+  fail_unless(values[compiled.getIndex("k3")] == 3);
+  fail_unless(values[compiled.getIndex("J1")] == 60);
+
+  double rates[2];
+  values[compiled.getIndex("k")] = 1;
+  values[compiled.getLocalParameterIndex("J1", "k")] = 1;
+  compiled.evaluateReactionRates(&values[0], rates, 0.5);
+  fail_unless(rates[0] == 6);
+  fail_unless(rates[1] == 12.5);
+  fail_unless(values[compiled.getIndex("k2")] == 2);
+
+  /* the rules are applied as SBMLTransforms does */
+  compiled.getInitialValues(values);
+  math = SBML_parseL3Formula("k3");
+  SBMLTransforms::clearComponentValues();
+  fail_unless(SBMLTransforms::evaluateASTNode(math, m)
+              == values[compiled.getIndex("k3")]);
+  SBMLTransforms::clearComponentValues();
+  delete math;
+}
+END_TEST
+
+
+Suite *
+create_suite_CompiledMath (void)
+{
+  Suite *suite = suite_create("CompiledMath");
+  TCase *tcase = tcase_create("CompiledMath");
+
+  tcase_add_test(tcase, test_CompiledMath_evaluate);
+  tcase_add_test(tcase, test_CompiledMath_functionDefinitions);
+  tcase_add_test(tcase, test_CompiledModel_reactionRates);
+
+  suite_add_tcase(suite, tcase);
+
+  return suite;
+}
+
+
+END_C_DECLS
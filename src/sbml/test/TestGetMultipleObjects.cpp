@@ -49,6 +49,7 @@
 #include <check.h>
 
 #include <iostream>
+#include <sstream>
 
 LIBSBML_CPP_NAMESPACE_USE
 
@@ -499,6 +500,106 @@ START_TEST (test_GetMultipleObjects_withFilter)
 }
 END_TEST
 
+START_TEST (test_GetMultipleObjects_getIdAfterChanges)
+{
+  SBMLDocument d(3, 1);
+  Model* m = d.createModel();
+
+  for (unsigned int i = 0; i < 40; ++i)
+  {
+    std::ostringstream id;
+    id << "p" << i;
+    m->createParameter()->setId(id.str());
+  }
+  Reaction* r = m->createReaction();
+  r->setId("r");
+  r->createReactant()->setId("sr");
+  r->createKineticLaw()->createLocalParameter()->setId("lp");
+
+  // repeated lookups so that the indexes get built
+  for (unsigned int n = 0; n < 10; ++n)
+  {
+    fail_unless(m->getElementBySId("p25") == m->getParameter(25));
+    fail_unless(m->getElementBySId("sr") == r->getReactant(0));
+    // local parameters are not in the SId namespace of the model
+    fail_unless(m->getElementBySId("lp") == NULL);
+    fail_unless(m->getParameter("p39") == m->getParameter(39));
+    fail_unless(m->getElementBySId("none") == NULL);
+  }
+
+  m->getParameter(25)->setId("renamed");
+  fail_unless(m->getElementBySId("p25") == NULL);
+  fail_unless(m->getElementBySId("renamed") == m->getParameter(25));
+  fail_unless(m->getParameter("renamed") == m->getParameter(25));
+
+  r->getReactant(0)->setId("sr2");
+  fail_unless(m->getElementBySId("sr") == NULL);
+  fail_unless(m->getElementBySId("sr2") == r->getReactant(0));
+
+  delete m->removeParameter(0);
+  for (unsigned int n = 0; n < 10; ++n)
+  {
+    fail_unless(m->getElementBySId("p0") == NULL);
+    fail_unless(m->getParameter("p0") == NULL);
+    fail_unless(m->getElementBySId("p1") == m->getParameter(0));
+  }
+
+  m->createParameter()->setId("p0");
+  fail_unless(m->getElementBySId("p0") == m->getParameter(39));
+  fail_unless(m->getParameter("p0") == m->getParameter(39));
+}
+END_TEST
+
+
+START_TEST (test_GetMultipleObjects_getMetaIdAfterChanges)
+{
+  SBMLDocument d(3, 1);
+  Model* m = d.createModel();
+  d.setMetaId("doc");
+
+  for (unsigned int i = 0; i < 40; ++i)
+  {
+    std::ostringstream metaid;
+    metaid << "meta_p" << i;
+    m->createParameter()->setMetaId(metaid.str());
+  }
+
+  // repeated lookups so that the index gets built
+  for (unsigned int n = 0; n < 10; ++n)
+  {
+    fail_unless(d.getElementByMetaId("doc") == &d);
+    fail_unless(d.getElementByMetaId("meta_p25") == m->getParameter(25));
+    fail_unless(m->getElementByMetaId("meta_p39") == m->getParameter(39));
+    fail_unless(m->getElementByMetaId("doc") == NULL);
+    fail_unless(d.getElementByMetaId("none") == NULL);
+  }
+
+  m->getParameter(25)->setMetaId("renamed");
+  fail_unless(d.getElementByMetaId("meta_p25") == NULL);
+  fail_unless(d.getElementByMetaId("renamed") == m->getParameter(25));
+  fail_unless(m->getElementByMetaId("renamed") == m->getParameter(25));
+
+  m->getParameter(26)->unsetMetaId();
+  fail_unless(m->getElementByMetaId("meta_p26") == NULL);
+
+  m->getParameter(27)->setMetaId("meta_p26");
+  fail_unless(m->getElementByMetaId("meta_p26") == m->getParameter(27));
+
+  Parameter* removed = m->removeParameter(0);
+  for (unsigned int n = 0; n < 10; ++n)
+  {
+    fail_unless(d.getElementByMetaId("meta_p0") == NULL);
+    fail_unless(m->getElementByMetaId("meta_p1") == m->getParameter(0));
+  }
+  removed->setMetaId("meta_p0_removed");
+  fail_unless(d.getElementByMetaId("meta_p0_removed") == NULL);
+  delete removed;
+
+  fail_unless(m->getElementByMetaId("meta_p39") == m->getParameter(38));
+}
+END_TEST
+
+
 Suite *
 create_suite_GetMultipleObjects (void)
 {
@@ -513,6 +614,8 @@ create_suite_GetMultipleObjects (void)
   tcase_add_test(tcase, test_GetMultipleObjects_noAssignments);
   tcase_add_test(tcase, test_GetMultipleObjects_allElements);
   tcase_add_test(tcase, test_GetMultipleObjects_withFilter);
+  tcase_add_test(tcase, test_GetMultipleObjects_getIdAfterChanges);
+  tcase_add_test(tcase, test_GetMultipleObjects_getMetaIdAfterChanges);
 
 
   suite_add_tcase(suite, tcase);
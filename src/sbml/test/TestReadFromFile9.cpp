@@ -43,6 +43,7 @@
 #include <sbml/SBMLReader.h>
 #include <sbml/SBMLWriter.h>
 #include <sbml/SBMLTypes.h>
+#include <sbml/xml/XMLParser.h>
 
 #include <string>
 #include <limits>
@@ -436,6 +437,37 @@ START_TEST (test_read_l3v1_new)
 END_TEST
 
 
+START_TEST (test_read_l3v1_new_chunkSize)
+{
+  std::string filename(TestDataDirectory);
+  filename += "l3v1-new-invalid.xml";
+
+  SBMLDocument* d = readSBMLFromFile(filename.c_str());
+  const std::string expected = writeSBMLToStdString(d);
+  const unsigned int numErrors = d->getNumErrors();
+  delete d;
+
+  fail_unless(numErrors > 0);
+
+  /* the mapped file gives the same document whatever the chunk size */
+  const unsigned int defaultChunkSize = XMLParser::getChunkSize();
+  const unsigned int chunkSizes[] = { 1, 7, 4096, 0 };
+
+  for (unsigned int n = 0; n < 4; ++n)
+  {
+    XMLParser::setChunkSize(chunkSizes[n]);
+    d = readSBMLFromFile(filename.c_str());
+
+    fail_unless(d->getNumErrors() == numErrors);
+    fail_unless(writeSBMLToStdString(d) == expected);
+    delete d;
+  }
+
+  XMLParser::setChunkSize(defaultChunkSize);
+}
+END_TEST
+
+
 Suite *
 create_suite_TestReadFromFile9 (void)
 { 
@@ -444,6 +476,7 @@ create_suite_TestReadFromFile9 (void)
 
 
   tcase_add_test(tcase, test_read_l3v1_new);
+  tcase_add_test(tcase, test_read_l3v1_new_chunkSize);
 
   suite_add_tcase(suite, tcase);
 
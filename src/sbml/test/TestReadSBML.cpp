@@ -48,7 +48,11 @@
 
 #include <sbml/SBMLTypes.h>
 #include <sbml/SBMLReader.h>
+#include <sbml/SBMLIncrementalReader.h>
 #include <sbml/SBMLError.h>
+#include <sbml/ParallelListOfReader.h>
+
+#include <sstream>
 
 #include <check.h>
 
@@ -2771,6 +2775,591 @@ START_TEST (test_ReadSBML_invalid_default_namespace )
 END_TEST
 
 
+/*
+ * Returns a model with lists of species and reactions large enough to be
+ * read in parts, with an unknown attribute on the species @p badSpecies,
+ * and notes and annotations on the species and reactions if @p annotated.
+ */
+static string
+largeModel(unsigned int badSpecies, const char* modelAttributes = "",
+           bool annotated = false)
+{
+  ostringstream oss;
+
+  oss << "<?xml version='1.0' encoding='UTF-8'?>\n"
+      << "<sbml xmlns='http://www.sbml.org/sbml/level3/version2/core'"
+      << " level='3' version='2'>\n"
+      << "  <model id='m'" << modelAttributes << ">\n"
+      << "    <listOfCompartments>\n"
+      << "      <compartment id='c' constant='true'/>\n"
+      << "    </listOfCompartments>\n"
+      << "    <listOfSpecies>\n";
+
+  for (unsigned int i = 0; i < 2000; ++i)
+  {
+    oss << "      <species id='s" << i << "' compartment='c'\n"
+        << "               initialAmount='" << i << "'"
+        << (i == badSpecies ? " unknown='1'" : "")
+        << " hasOnlySubstanceUnits='false' boundaryCondition='false'"
+        << " constant='false'";
+
+    if (!annotated)
+    {
+      oss << "/>\n";
+      continue;
+    }
+
+    oss << " metaid='_s" << i << "'>\n"
+        << "        <notes>\n"
+        << "          <p xmlns='http://www.w3.org/1999/xhtml'>Species "
+        << i << " &amp; more</p>\n"
+        << "        </notes>\n"
+        << "        <annotation>\n"
+        << "          <rdf:RDF"
+        << " xmlns:rdf='http://www.w3.org/1999/02/22-rdf-syntax-ns#'\n"
+        << "                   xmlns:bqbiol='http://biomodels.net/biology-qualifiers/'>\n"
+        << "            <rdf:Description rdf:about='#_s" << i << "'>\n"
+        << "              <bqbiol:is>\n"
+        << "                <rdf:Bag>\n"
+        << "                  <rdf:li rdf:resource='http://identifiers.org/chebi/CHEBI:"
+        << i << "'/>\n"
+        << "                </rdf:Bag>\n"
+        << "              </bqbiol:is>\n"
+        << "            </rdf:Description>\n"
+        << "          </rdf:RDF>\n"
+        << "        </annotation>\n"
+        << "      </species>\n";
+  }
+
+  oss << "    </listOfSpecies>\n"
+      << "    <listOfReactions>\n";
+
+  for (unsigned int i = 0; i < 500; ++i)
+  {
+    oss << "      <reaction id='r" << i << "' reversible='false'>\n";
+
+    if (annotated)
+    {
+      oss << "        <annotation><tool:data xmlns:tool='http://tool'"
+          << " step='" << i << "'/></annotation>\n";
+    }
+
+    oss << "        <listOfReactants>\n"
+        << "          <speciesReference species='s" << i << "'"
+        << " constant='true'/>\n"
+        << "        </listOfReactants>\n"
+        << "        <kineticLaw>\n"
+        << "          <math xmlns='http://www.w3.org/1998/Math/MathML'>\n"
+        << "            <apply> <times/> <cn> " << i << " </cn>"
+        << " <ci> s" << i << " </ci> </apply>\n"
+        << "          </math>\n"
+        << "        </kineticLaw>\n"
+        << "      </reaction>\n";
+  }
+
+  oss << "    </listOfReactions>\n"
+      << "  </model>\n"
+      << "</sbml>\n";
+
+  return oss.str();
+}
+
+
+/*
+ * Returns true if @p actual has the same errors and content as
+ * @p expected, and deletes them both.
+ */
+static bool
+sameDocuments(SBMLDocument* expected, SBMLDocument* actual)
+{
+  bool same = expected->getNumErrors() == actual->getNumErrors();
+
+  for (unsigned int i = 0; same && i < expected->getNumErrors(); ++i)
+  {
+    const SBMLError* e = expected->getError(i);
+    const SBMLError* a = actual->getError(i);
+
+    same = e->getErrorId() == a->getErrorId()
+        && e->getLine()    == a->getLine()
+        && e->getColumn()  == a->getColumn()
+        && e->getMessage() == a->getMessage();
+  }
+
+  if (same)
+  {
+    char* e = expected->toSBML();
+    char* a = actual->toSBML();
+    same = !strcmp(e, a);
+    free(e);
+    free(a);
+  }
+
+  delete expected;
+  delete actual;
+
+  return same;
+}
+
+
+/*
+ * Returns true if the document read from @p xml by @p reader, once its
+ * notes and annotations have all been read, is the same as the one read by
+ * a single thread at once, leaving out the same elements.
+ */
+static bool
+readsLike(SBMLReader& reader, const string& xml)
+{
+  SBMLReader serial(reader);
+  serial.setNumThreads(1);
+  serial.setReadNotesAndAnnotationsLazily(false);
+
+  SBMLDocument* expected = serial.readSBMLFromString(xml);
+  SBMLDocument* actual   = reader.readSBMLFromString(xml);
+  actual->readDeferredElements(true);
+
+  return sameDocuments(expected, actual);
+}
+
+
+/*
+ * Returns true if the document read from @p xml given in chunks of
+ * @p chunkSize bytes to an SBMLIncrementalReader with the settings of
+ * @p reader is the same as the one read from the whole of it at once.
+ */
+static bool
+readsIncrementallyLike(SBMLReader& reader, const string& xml,
+                       size_t chunkSize)
+{
+  SBMLReader serial(reader);
+  serial.setNumThreads(1);
+  serial.setReadNotesAndAnnotationsLazily(false);
+
+  SBMLIncrementalReader incremental(reader);
+  for (size_t n = 0; n < xml.size(); n += chunkSize)
+  {
+    size_t length = min(chunkSize, xml.size() - n);
+    if (incremental.addChunk(xml.data() + n, length)
+        != LIBSBML_OPERATION_SUCCESS)
+    {
+      return false;
+    }
+  }
+
+  SBMLDocument* expected = serial.readSBMLFromString(xml);
+  SBMLDocument* actual   = incremental.finish();
+
+  return sameDocuments(expected, actual);
+}
+
+
+/*
+ * Returns true if the document read from @p xml by several threads is the
+ * same as the one read by a single thread.
+ */
+static bool
+readsLikeSerial(const string& xml)
+{
+  SBMLReader parallel;
+  parallel.setNumThreads(4);
+
+  return readsLike(parallel, xml);
+}
+
+
+START_TEST (test_ReadSBML_parallel_lists)
+{
+  string xml = largeModel(1500);
+
+#ifdef LIBSBML_WITH_PARALLEL_READING
+  ParallelListOfReader scan(xml.c_str(), false, 4);
+  fail_unless( scan.isActive() );
+#endif
+
+  SBMLReader reader;
+  reader.setNumThreads(4);
+  fail_unless( reader.getNumThreads() == 4 );
+
+  SBMLDocument* d = reader.readSBMLFromString(xml);
+  Model* m = d->getModel();
+
+  fail_unless( m != NULL );
+  fail_unless( m->getNumSpecies() == 2000 );
+  fail_unless( m->getNumReactions() == 500 );
+  fail_unless( m->getSpecies(1999)->getId() == "s1999" );
+  fail_unless( m->getSpecies(1999)->getParentSBMLObject()
+               == m->getListOfSpecies() );
+  fail_unless( m->getReaction(499)->getSBMLDocument() == d );
+  fail_unless( m->getReaction(499)->getKineticLaw()->getMath() != NULL );
+
+  /* the start tag of the species s1500 is on lines 8 + 2 * 1500 and 3009 */
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getError(0)->getErrorId() == AllowedAttributesOnSpecies );
+  fail_unless( d->getError(0)->getLine() == m->getSpecies(1500)->getLine() );
+  fail_unless( m->getSpecies(1500)->getLine() >= 3008 );
+  fail_unless( m->getSpecies(1500)->getLine() <= 3009 );
+
+  delete d;
+
+  fail_unless( readsLikeSerial(xml) );
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_parallel_lists_fallback)
+{
+  /* errors logged before the lists are also logged before the items */
+  fail_unless( readsLikeSerial(largeModel(1500, " unknown='1'")) );
+  fail_unless( readsLikeSerial(largeModel(10, " unknown='1'")) );
+
+  /* malformed items are reported as by a single thread */
+  string xml = largeModel(2000);
+  size_t pos = xml.find("<species id='s1600'");
+  xml.replace(pos, 8, "<species<");
+  fail_unless( readsLikeSerial(xml) );
+
+  xml = largeModel(2000);
+  pos = xml.find("</listOfReactants>", xml.find("id='r400'"));
+  xml.erase(pos, 18);
+  fail_unless( readsLikeSerial(xml) );
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_lazy_notes_annotations)
+{
+  string xml = largeModel(1500, "", true);
+
+  SBMLReader reader;
+  reader.setReadNotesAndAnnotationsLazily(true);
+  fail_unless( reader.getReadNotesAndAnnotationsLazily() );
+
+  SBMLDocument* d = reader.readSBMLFromString(xml);
+  Model* m = d->getModel();
+
+  fail_unless( m != NULL );
+  fail_unless( m->getNumSpecies() == 2000 );
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getError(0)->getErrorId() == AllowedAttributesOnSpecies );
+
+  Species* s = m->getSpecies(1999);
+  fail_unless( s->getId() == "s1999" );
+  fail_unless( s->getMetaId() == "_s1999" );
+  fail_unless( s->getNumCVTerms() == 1 );
+  fail_unless( s->getCVTerm(0)->getResourceURI(0)
+               == "http://identifiers.org/chebi/CHEBI:1999" );
+  fail_unless( s->isSetNotes() );
+  fail_unless( s->getNotesString().find("Species 1999 &amp; more")
+               != string::npos );
+
+  /* the positions are those of the original document */
+  fail_unless( s->getNotes()->getLine() == s->getLine() + 1 );
+  fail_unless( m->getReaction(0)->getAnnotation()->getLine()
+               == m->getReaction(0)->getLine() + 1 );
+
+  delete d;
+
+  fail_unless( readsLike(reader, xml) );
+
+  /* what is written is the same as for a document read at once */
+  d = reader.readSBMLFromString(xml);
+  SBMLDocument* expected = readSBMLFromString(xml.c_str());
+  char* e = expected->toSBML();
+  char* a = d->toSBML();
+  fail_unless( !strcmp(e, a) );
+  free(e);
+  free(a);
+  delete expected;
+  delete d;
+
+  /* and with the lists read in parts */
+  reader.setNumThreads(4);
+  fail_unless( readsLike(reader, xml) );
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_lazy_notes_annotations_errors)
+{
+  string xml = largeModel(2000, "", true);
+  xml.replace(xml.find("<p xmlns='http://www.w3.org/1999/xhtml'>Species 7 "),
+              40, "<p xmlns='http://www.w3.org/1999/xhtmm'>");
+
+  SBMLReader reader;
+  reader.setReadNotesAndAnnotationsLazily(true);
+
+  /* the errors in a note are logged when it is read */
+  SBMLDocument* d = reader.readSBMLFromString(xml);
+  fail_unless( d->getNumErrors() == 0 );
+  fail_unless( d->getModel()->getSpecies(6)->isSetNotes() );
+  fail_unless( d->getNumErrors() == 0 );
+  fail_unless( d->getModel()->getSpecies(7)->isSetNotes() );
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getError(0)->getErrorId() == NotesNotInXHTMLNamespace );
+  fail_unless( d->getError(0)->getLine()
+               == d->getModel()->getSpecies(7)->getLine() );
+  delete d;
+
+  /* and all of them before the document is checked */
+  d = reader.readSBMLFromString(xml);
+  d->setConsistencyChecks(LIBSBML_CAT_UNITS_CONSISTENCY, false);
+  d->checkConsistency();
+  fail_unless( d->getNumErrors(LIBSBML_SEV_ERROR) == 1 );
+  fail_unless( d->getErrorWithSeverity(0, LIBSBML_SEV_ERROR)->getErrorId()
+               == NotesNotInXHTMLNamespace );
+  delete d;
+
+  fail_unless( readsLike(reader, xml) );
+
+  /* elements of other namespaces are read at once */
+  xml = largeModel(2000, "", true);
+  xml.replace(xml.find("<annotation>"), 12,
+              "<annotation xmlns='http://other'>");
+  fail_unless( readsLike(reader, xml) );
+
+  /* as are the notes and annotations of a malformed document */
+  xml = largeModel(2000, "", true);
+  xml.erase(xml.find("</notes>", xml.find("Species 30 ")), 8);
+  fail_unless( readsLike(reader, xml) );
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_skipped_elements)
+{
+  const char* s = wrapXML
+  (
+    "<sbml xmlns='http://www.sbml.org/sbml/level3/version1/core'"
+    " level='3' version='1'> <model id='m'>"
+    "<notes><p xmlns='http://www.w3.org/1999/xhtml'>a model</p></notes>"
+    "<annotation>"
+    "  <tool:notes xmlns:tool='http://tool'>kept</tool:notes>"
+    "  <other:data xmlns:other='http://other'><other:notes/></other:data>"
+    "</annotation>"
+    "<listOfCompartments>"
+    "  <compartment id='c' constant='true'>"
+    "    <notes><p xmlns='http://www.w3.org/1999/xhtml'>c</p></notes>"
+    "  </compartment>"
+    "</listOfCompartments>"
+    "<listOfParameters>"
+    "  <parameter id='p' constant='false'/>"
+    "</listOfParameters>"
+    "<listOfRules>"
+    "  <assignmentRule variable='p'>"
+    "    <math xmlns='http://www.w3.org/1998/Math/MathML'>"
+    "      <semantics>"
+    "        <ci> c </ci>"
+    "        <annotation encoding='text'> c </annotation>"
+    "      </semantics>"
+    "    </math>"
+    "  </assignmentRule>"
+    "</listOfRules>"
+    "<listOfEvents>"
+    "  <event useValuesFromTriggerTime='true' unknown='1'/>"
+    "</listOfEvents>"
+    SBML_FOOTER
+  );
+
+  SBMLReader reader;
+  reader.addSkippedElement("notes");
+  reader.addSkippedElement("listOfEvents");
+  reader.addSkippedPackage("http://other");
+
+  SBMLDocument* d = reader.readSBMLFromString(s);
+  Model* m = d->getModel();
+
+  /* the event with an unknown attribute is not read */
+  fail_unless( d->getNumErrors() == 0 );
+  fail_unless( m != NULL );
+  fail_unless( m->getNumEvents() == 0 );
+  fail_unless( !m->isSetNotes() );
+  fail_unless( !m->getCompartment(0)->isSetNotes() );
+  fail_unless( m->getCompartment(0)->getId() == "c" );
+
+  /* elements of other namespaces are read, unless asked otherwise */
+  XMLNode* annotation = m->getAnnotation();
+  fail_unless( annotation != NULL );
+  fail_unless( annotation->getNumChildren() == 1 );
+  fail_unless( annotation->getChild(0).getName() == "notes" );
+
+  /* as is the MathML */
+  const ASTNode* math = m->getRule(0)->getMath();
+  fail_unless( math != NULL );
+  fail_unless( math->getNumSemanticsAnnotations() == 1 );
+  delete d;
+
+  reader.clearSkippedElements();
+  d = reader.readSBMLFromString(s);
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getModel()->getNumEvents() == 1 );
+  fail_unless( d->getModel()->isSetNotes() );
+  fail_unless( d->getModel()->getAnnotation()->getNumChildren() == 2 );
+  delete d;
+
+  /* with the lists read in parts, and the annotations lazily */
+  string xml = largeModel(1500, "", true);
+  reader.addSkippedElement("notes");
+  reader.addSkippedElement("listOfReactions");
+  reader.setNumThreads(4);
+  reader.setReadNotesAndAnnotationsLazily(true);
+
+  d = reader.readSBMLFromString(xml);
+  m = d->getModel();
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( m->getNumSpecies() == 2000 );
+  fail_unless( m->getNumReactions() == 0 );
+  fail_unless( !m->getSpecies(5)->isSetNotes() );
+  fail_unless( m->getSpecies(5)->getNumCVTerms() == 1 );
+  delete d;
+
+  fail_unless( readsLike(reader, xml) );
+
+  reader.addSkippedElement("listOfSpecies");
+  reader.addSkippedElement("annotation");
+  fail_unless( readsLike(reader, xml) );
+
+  d = reader.readSBMLFromString(xml);
+  fail_unless( d->getNumErrors() == 0 );
+  fail_unless( d->getModel()->getNumSpecies() == 0 );
+  fail_unless( d->getModel()->getNumCompartments() == 1 );
+  delete d;
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_incremental)
+{
+  const char* s = wrapXML
+  (
+    "<sbml xmlns='http://www.sbml.org/sbml/level3/version1/core'"
+    " level='3' version='1'> <model id='m'>"
+    "<notes><p xmlns='http://www.w3.org/1999/xhtml'>a &#233; model</p></notes>"
+    "<listOfCompartments>"
+    "  <compartment id='c\xc3\xa9' constant='true'/>"
+    "</listOfCompartments>"
+    SBML_FOOTER
+  );
+
+  SBMLReader reader;
+  fail_unless( readsIncrementallyLike(reader, s, 1) );
+  fail_unless( readsIncrementallyLike(reader, s, 1000) );
+
+  string xml = largeModel(1500, "", true);
+  fail_unless( readsIncrementallyLike(reader, xml, 7) );
+  fail_unless( readsIncrementallyLike(reader, xml, 65536) );
+
+  /* read while the chunks are added, when libSBML is built for it */
+  reader.setNumThreads(4);
+  reader.setReadNotesAndAnnotationsLazily(true);
+  fail_unless( readsIncrementallyLike(reader, xml, 7) );
+  fail_unless( readsIncrementallyLike(reader, xml, 1 << 20) );
+  fail_unless( readsIncrementallyLike(reader, xml, xml.size()) );
+
+  /* with elements left out */
+  reader.addSkippedElement("listOfReactions");
+  reader.addSkippedElement("annotation");
+  fail_unless( readsIncrementallyLike(reader, xml, 4096) );
+
+  SBMLIncrementalReader incremental(reader);
+  incremental.addChunk(xml.data(), xml.size());
+  SBMLDocument* d = incremental.finish();
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getModel()->getNumSpecies() == 2000 );
+  fail_unless( d->getModel()->getNumReactions() == 0 );
+  fail_unless( d->getModel()->getSpecies(5)->isSetNotes() );
+  fail_unless( !d->getModel()->getSpecies(5)->isSetAnnotation() );
+  delete d;
+
+  /* nothing can be added once finished */
+  fail_unless( incremental.finish() == NULL );
+  fail_unless( incremental.addChunk("<", 1) == LIBSBML_OPERATION_FAILED );
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_incremental_errors)
+{
+  SBMLReader reader;
+  string xml = largeModel(2000);
+
+  /* cut short, badly formed, and not SBML */
+  fail_unless( readsIncrementallyLike(reader, xml.substr(0, xml.size() / 2), 100) );
+  fail_unless( readsIncrementallyLike(reader, xml.substr(0, 20), 3) );
+
+  size_t n = xml.find("</listOfSpecies>");
+  string bad = xml.substr(0, n) + "</listOfSpecie>" + xml.substr(n + 16);
+  fail_unless( readsIncrementallyLike(reader, bad, 100) );
+
+  fail_unless( readsIncrementallyLike(reader,
+                 "<?xml version='1.0' encoding='UTF-8'?><model/>", 5) );
+
+  reader.setNumThreads(4);
+  fail_unless( readsIncrementallyLike(reader, xml.substr(0, xml.size() / 2), 100) );
+  fail_unless( readsIncrementallyLike(reader, bad, 100) );
+  fail_unless( readsIncrementallyLike(reader, bad, 1 << 23) );
+
+  /* nothing at all */
+  SBMLIncrementalReader empty;
+  SBMLDocument* d = empty.finish();
+  fail_unless( d != NULL );
+  fail_unless( d->getNumErrors() > 0 );
+  fail_unless( d->getModel() == NULL );
+  delete d;
+
+  /* the reading thread stops when a reader is destroyed before finishing,
+     and does not hold up the chunks added after an error */
+  {
+    SBMLIncrementalReader unfinished(reader);
+    unfinished.addChunk(xml.data(), xml.size() / 2);
+  }
+  {
+    SBMLIncrementalReader stopped(reader);
+    stopped.addChunk("<sbml><", 7);
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+      fail_unless( stopped.addChunk(xml.data(), xml.size())
+                   == LIBSBML_OPERATION_SUCCESS );
+    }
+  }
+}
+END_TEST
+
+
+START_TEST (test_ReadSBML_expectedAttributes_levels)
+{
+  /* the expected attributes of an element are cached for each level */
+  const char* l2 = wrapSBML_L2v1
+  (
+    "<listOfParameters>"
+    "  <parameter id='p' metaid='m' value='1'/>"
+    "</listOfParameters>"
+  );
+
+  const char* l1 = wrapSBML_L1v2
+  (
+    "<listOfCompartments>"
+    "  <compartment name='c'/>"
+    "</listOfCompartments>"
+    "<listOfParameters>"
+    "  <parameter name='p' metaid='m' value='1'/>"
+    "</listOfParameters>"
+  );
+
+  SBMLDocument* d = readSBMLFromString(l2);
+  fail_unless( d->getNumErrors() == 0 );
+  delete d;
+
+  d = readSBMLFromString(l1);
+  fail_unless( d->getNumErrors() == 1 );
+  fail_unless( d->getError(0)->getMessage().find("metaid") != string::npos );
+  delete d;
+
+  d = readSBMLFromString(l2);
+  fail_unless( d->getNumErrors() == 0 );
+  delete d;
+}
+END_TEST
+
+
 START_TEST(test_ReadSBML_bad_indents)
 {
   const char* valid=wrapXML
@@ -3014,6 +3603,14 @@ create_suite_ReadSBML (void)
   tcase_add_test(tcase, test_ReadSBML_bad_indents_2);
   tcase_add_test(tcase, test_ReadSBML_bad_indents_3);
   tcase_add_test(tcase, test_ReadSBML_bad_indents_4);
+  tcase_add_test(tcase, test_ReadSBML_expectedAttributes_levels);
+  tcase_add_test(tcase, test_ReadSBML_parallel_lists);
+  tcase_add_test(tcase, test_ReadSBML_parallel_lists_fallback);
+  tcase_add_test(tcase, test_ReadSBML_lazy_notes_annotations);
+  tcase_add_test(tcase, test_ReadSBML_lazy_notes_annotations_errors);
+  tcase_add_test(tcase, test_ReadSBML_skipped_elements);
+  tcase_add_test(tcase, test_ReadSBML_incremental);
+  tcase_add_test(tcase, test_ReadSBML_incremental_errors);
 
   suite_add_tcase(suite, tcase);
 
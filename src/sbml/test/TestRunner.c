@@ -174,6 +174,7 @@ Suite *create_suite_GetMultipleObjects            (void);
 Suite *create_suite_RemoveFromParent              (void);
 Suite *create_suite_RenameIDs                     (void);
 Suite *create_suite_SBMLTransforms                (void);
+Suite *create_suite_CompiledMath                  (void);
 
 Suite *create_suite_LevelCompatibility                (void);
 
@@ -325,6 +326,7 @@ main (int argc, char* argv[])
   srunner_add_suite( runner, create_suite_SyntaxChecker                 () );
   srunner_add_suite( runner, create_suite_SBMLConstructorException      () );
   srunner_add_suite( runner, create_suite_SBMLTransforms                () );
+  srunner_add_suite( runner, create_suite_CompiledMath                  () );
   srunner_add_suite( runner, create_suite_GetMultipleObjects            () );
   srunner_add_suite( runner, create_suite_LevelCompatibility            () );
   srunner_add_suite( runner, create_suite_SBase_IdName                   () );
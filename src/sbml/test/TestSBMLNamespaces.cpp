@@ -43,6 +43,7 @@
 #include <sbml/common/extern.h>
 
 #include <sbml/SBMLNamespaces.h>
+#include <sbml/Species.h>
 #include <sbml/xml/XMLNamespaces.h>
 
 #include <check.h>
@@ -262,6 +263,54 @@ START_TEST (test_SBMLNamespaces_invalid)
 END_TEST
 
 
+START_TEST (test_SBMLNamespaces_share)
+{
+  SBMLNamespaces l3v1(3, 1);
+  SBMLNamespaces l3v1Copy(3, 1);
+  SBMLNamespaces l3v2(3, 2);
+
+  SBMLNamespaces *shared = SBMLNamespaces::share(&l3v1);
+
+  fail_unless(shared != &l3v1);
+  fail_unless(shared->getNamespaces()->getURI(0) ==
+    "http://www.sbml.org/sbml/level3/version1/core");
+  fail_unless(SBMLNamespaces::share(&l3v1Copy) == shared);
+  fail_unless(SBMLNamespaces::share(shared) == shared);
+
+  SBMLNamespaces *other = SBMLNamespaces::share(&l3v2);
+  fail_unless(other != shared);
+  SBMLNamespaces::release(other);
+
+  l3v1Copy.addNamespace("http://www.sbml.org/test", "test");
+  other = SBMLNamespaces::share(&l3v1Copy);
+  fail_unless(other != shared);
+  SBMLNamespaces::release(other);
+
+  SBMLNamespaces *own = SBMLNamespaces::unshare(shared);
+  fail_unless(own != shared);
+  own->addNamespace("http://www.sbml.org/test", "test");
+  fail_unless(own->getNamespaces()->getLength() == 2);
+  fail_unless(shared->getNamespaces()->getLength() == 1);
+  fail_unless(SBMLNamespaces::unshare(own) == own);
+  delete own;
+
+  SBMLNamespaces::release(shared);
+  SBMLNamespaces::release(shared);
+
+  Species s1(&l3v1);
+  Species s2(&l3v1);
+
+  fail_unless(s1.getSBMLNamespaces() == s2.getSBMLNamespaces());
+
+  s1.getNamespaces()->add("http://www.sbml.org/test", "test");
+
+  fail_unless(s1.getSBMLNamespaces() != s2.getSBMLNamespaces());
+  fail_unless(s1.getNamespaces()->getLength() == 2);
+  fail_unless(s2.getNamespaces()->getLength() == 1);
+}
+END_TEST
+
+
 Suite *
 create_suite_SBMLNamespaces (void)
 {
@@ -279,6 +328,7 @@ create_suite_SBMLNamespaces (void)
   tcase_add_test(tcase, test_SBMLNamespaces_getURI);
   tcase_add_test(tcase, test_SBMLNamespaces_invalid);
   tcase_add_test(tcase, test_SBMLNamespaces_add_and_remove_namespaces);
+  tcase_add_test(tcase, test_SBMLNamespaces_share);
 
 
   suite_add_tcase(suite, tcase);
@@ -954,6 +954,52 @@ START_TEST(test_SBMLTransforms_evaluateAST_L2SpeciesReference)
 }
 END_TEST
 
+START_TEST (test_SBMLTransforms_replaceIA_withValues)
+{
+  std::string filename(TestDataDirectory);
+  SBMLDocument* d1 = readSBMLFromFile((filename + "initialAssignments.xml").c_str());
+  SBMLDocument* d2 = readSBMLFromFile((filename + "initialAssignments_species.xml").c_str());
+
+  fail_unless(d1->getModel() != NULL);
+  fail_unless(d2->getModel() != NULL);
+
+  /* each model keeps its values in a table of its own */
+  SBMLTransforms::IdValueMap values1;
+  SBMLTransforms::IdValueMap values2;
+
+  fail_unless(SBMLTransforms::expandInitialAssignments(d1->getModel(), values1));
+  fail_unless(SBMLTransforms::expandInitialAssignments(d2->getModel(), values2));
+
+  Model* m = d1->getModel();
+  fail_unless( m->getNumInitialAssignments() == 0 );
+  fail_unless( m->getCompartment(0)->getSize() == 25.0);
+  fail_unless( m->getParameter(1)->getValue() == 50);
+  fail_unless( values1["compartment"].first == 25.0);
+  fail_unless( values1["k2"].first == 50);
+  fail_unless( values1.find("k3") == values1.end());
+
+  m = d2->getModel();
+  fail_unless( m->getNumInitialAssignments() == 0 );
+  fail_unless( m->getParameter(2)->getValue() == 0.75);
+  fail_unless( values2["k3"].first == 0.75);
+
+  ASTNode* node = SBML_parseL3Formula("max(k1, k2) * compartment");
+  fail_unless(SBMLTransforms::evaluateASTNode(node, values1, d1->getModel()) == 1250);
+  delete node;
+
+  /* the values are also used inside package math */
+  std::map<std::string, double> values;
+  values["a"] = 3;
+  node = SBML_parseL3Formula("max(a, 2) + rem(a, 2)");
+  fail_unless(SBMLTransforms::evaluateASTNode(node, values) == 4);
+  delete node;
+
+  delete d1;
+  delete d2;
+}
+END_TEST
+
+
 Suite *
 create_suite_SBMLTransforms (void)
 {
@@ -968,6 +1014,7 @@ create_suite_SBMLTransforms (void)
   tcase_add_test(tcase, test_SBMLTransforms_evaluateAST_L2SpeciesReference);
   tcase_add_test(tcase, test_SBMLTransforms_replaceIA);
   tcase_add_test(tcase, test_SBMLTransforms_replaceIA_species);
+  tcase_add_test(tcase, test_SBMLTransforms_replaceIA_withValues);
   tcase_add_test(tcase, test_SBMLTransforms_evaluateL3V2AST);
   tcase_add_test(tcase, test_SBMLTransforms_evaluateL3V2ASTWithModel);
   tcase_add_test(tcase, test_SBMLTransforms_L3V2AssignmentNoMath);
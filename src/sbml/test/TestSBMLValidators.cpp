@@ -136,6 +136,125 @@ START_TEST (test_SBMLValidators_internal)
 END_TEST
 
 
+/*
+ * Returns a document whose consistency checks log warnings in several
+ * categories.
+ */
+static SBMLDocument*
+createDocumentWithWarnings()
+{
+  SBMLDocument* doc = new SBMLDocument(3, 1);
+  Model* m = doc->createModel();
+
+  Compartment* c = m->createCompartment();
+  c->setId("C");
+  c->setSize(1);
+  c->setConstant(true);
+
+  Species* s = m->createSpecies();
+  s->setId("S");
+  s->setCompartment("C");
+  s->setInitialAmount(1);
+  s->setHasOnlySubstanceUnits(false);
+  s->setBoundaryCondition(false);
+  s->setConstant(false);
+
+  Parameter* p = m->createParameter();
+  p->setId("k");
+  p->setValue(2);
+  p->setConstant(true);
+
+  Reaction* r = m->createReaction();
+  r->setId("R");
+  r->setReversible(false);
+  SpeciesReference* sr = r->createReactant();
+  sr->setSpecies("S");
+  sr->setConstant(true);
+  ASTNode* math = SBML_parseL3Formula("k * S");
+  r->createKineticLaw()->setMath(math);
+  delete math;
+
+  return doc;
+}
+
+
+/*
+ * Returns true if the two documents have logged the same errors.
+ */
+static bool
+haveSameErrors(const SBMLDocument* d1, const SBMLDocument* d2)
+{
+  if (d1->getNumErrors() != d2->getNumErrors()) return false;
+
+  for (unsigned int i = 0; i < d1->getNumErrors(); ++i)
+  {
+    if (d1->getError(i)->getErrorId() != d2->getError(i)->getErrorId()
+      || d1->getError(i)->getMessage() != d2->getError(i)->getMessage())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+START_TEST (test_SBMLValidators_parallel)
+{
+  SBMLDocument* doc = createDocumentWithWarnings();
+  SBMLDocument* copy = doc->clone();
+
+  // the failures are the same whether or not the validators of the
+  // different categories run concurrently
+  SBMLInternalValidator validator;
+  validator.setApplicableValidators(0x7f);
+  validator.setParallelValidation(false);
+  fail_unless(validator.getParallelValidation() == false);
+  validator.setDocument(doc);
+  unsigned int nerrors = validator.checkConsistency();
+
+  SBMLInternalValidator parallel;
+  parallel.setApplicableValidators(0x7f);
+  parallel.setParallelValidation(true);
+  parallel.setDocument(copy);
+  fail_unless(parallel.checkConsistency() == nerrors);
+
+  fail_unless(nerrors > 0);
+  fail_unless(haveSameErrors(doc, copy));
+
+  delete copy;
+  delete doc;
+}
+END_TEST
+
+
+START_TEST (test_SBMLValidators_fused)
+{
+  SBMLDocument* doc = createDocumentWithWarnings();
+  SBMLDocument* copy = doc->clone();
+
+  // the failures are the same whether or not the categories are checked
+  // in a single traversal
+  SBMLInternalValidator validator;
+  validator.setApplicableValidators(0x7f);
+  validator.setParallelValidation(false);
+  validator.setDocument(doc);
+  unsigned int nerrors = validator.checkConsistency();
+
+  SBMLInternalValidator fused;
+  fused.setApplicableValidators(0x7f);
+  fused.setFusedValidation(true);
+  fail_unless(fused.getFusedValidation() == true);
+  fused.setDocument(copy);
+  fail_unless(fused.checkConsistency() == nerrors);
+
+  fail_unless(nerrors > 0);
+  fail_unless(haveSameErrors(doc, copy));
+
+  delete copy;
+  delete doc;
+}
+END_TEST
+
 
 Suite *
 create_suite_SBMLValidatorAPI(void)
@@ -145,6 +264,8 @@ create_suite_SBMLValidatorAPI(void)
 
   tcase_add_test(tcase, test_SBMLValidators_create);
   tcase_add_test(tcase, test_SBMLValidators_internal);
+  tcase_add_test(tcase, test_SBMLValidators_parallel);
+  tcase_add_test(tcase, test_SBMLValidators_fused);
 
   suite_add_tcase(suite, tcase);
 
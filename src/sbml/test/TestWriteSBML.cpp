@@ -39,15 +39,19 @@
  * and also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
+#include <sbml/xml/XMLOutputBuffer.h>
 #include <sbml/xml/XMLOutputStream.h>
 #include <sbml/xml/XMLNode.h>
 #include <sbml/util/util.h>
 
 #include <sbml/SBMLTypes.h>
 #include <sbml/SBMLWriter.h>
+#include <sbml/compress/InputDecompressor.h>
 
 #include <check.h>
 
@@ -2939,6 +2943,308 @@ START_TEST (test_WriteSBML_locale)
 END_TEST
 
 
+/* a sink that fails once it has been given limit bytes */
+class FailingSink : public XMLOutputSink
+{
+public:
+  FailingSink (size_t limit) : mLimit(limit), mWritten(0) { }
+
+  virtual bool write (const char*, size_t length)
+  {
+    mWritten += length;
+    return mWritten <= mLimit;
+  }
+
+  size_t mLimit;
+  size_t mWritten;
+};
+
+
+START_TEST (test_WriteSBML_sinks)
+{
+  const char* file =
+    "../../../examples/sample-models/from-spec/level-2/enzymekinetics.xml";
+
+  SBMLDocument* d = readSBML(file);
+  fail_unless( d != NULL );
+
+  SBMLWriter  writer;
+  std::string expected = writeSBMLToStdString(d);
+  fail_unless( expected.size() > 1000 );
+
+  XMLMemorySink memory;
+  fail_unless( writer.writeSBML(d, memory) );
+  fail_unless( expected == memory.getBuffer() );
+  fail_unless( expected.size() == memory.getLength() );
+
+  char* released = memory.release();
+  fail_unless( expected == released );
+  fail_unless( memory.getLength() == 0 );
+  fail_unless( strcmp(memory.getBuffer(), "") == 0 );
+  free(released);
+
+  ostringstream stream;
+  fail_unless( writer.writeSBML(d, stream) );
+  fail_unless( expected == stream.str() );
+
+  const char* xmlfile = "test-sinks.xml";
+  fail_unless( writer.writeSBML(d, xmlfile) );
+
+  ifstream input(xmlfile);
+  ostringstream content;
+  content << input.rdbuf();
+  input.close();
+  fail_unless( expected == content.str() );
+  remove(xmlfile);
+
+  fail_unless( d->getNumErrors() == 0 );
+
+  FailingSink failing(100);
+  fail_unless( !writer.writeSBML(d, failing) );
+  fail_unless( d->getErrorLog()->contains(XMLFileOperationError) );
+
+  delete d;
+}
+END_TEST
+
+
+START_TEST (test_WriteSBML_outputBuffer)
+{
+  XMLMemorySink sink;
+
+  {
+    XMLOutputBuffer buffer(sink, 8);
+    std::ostream    stream(&buffer);
+
+    stream << "abc" << 'd';
+    fail_unless( sink.getLength() == 0 );
+
+    stream << "efghij";
+    fail_unless( sink.getLength() == 4 );
+
+    stream << "0123456789ABCDEF" << 'k';
+    stream.flush();
+    fail_unless( strcmp(sink.getBuffer(), "abcdefghij0123456789ABCDEFk") == 0 );
+
+    stream << "lmn";
+  }
+
+  fail_unless( strcmp(sink.getBuffer(), "abcdefghij0123456789ABCDEFklmn") == 0 );
+}
+END_TEST
+
+
+
+/*
+ * Returns a document whose lists of species and reactions are large enough
+ * to be written in parts, with notes, annotations and math.
+ */
+static SBMLDocument*
+largeDocument()
+{
+  SBMLDocument* d = new SBMLDocument(3, 2);
+  Model* m = d->createModel();
+  m->setId("m");
+
+  Compartment* c = m->createCompartment();
+  c->setId("c");
+  c->setConstant(true);
+
+  for (unsigned int i = 0; i < 1000; ++i)
+  {
+    ostringstream id;
+    id << "s" << i;
+
+    Species* s = m->createSpecies();
+    s->setId(id.str());
+    s->setCompartment("c");
+    s->setInitialAmount(i / 3.0);
+    s->setHasOnlySubstanceUnits(false);
+    s->setBoundaryCondition(false);
+    s->setConstant(false);
+
+    if (i % 7 == 0)
+    {
+      ostringstream resource;
+      resource << "http://identifiers.org/chebi/CHEBI:" << i;
+
+      s->setMetaId("_" + id.str());
+      s->setNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">"
+                  "Species &amp; more</p>");
+
+      CVTerm cv(BIOLOGICAL_QUALIFIER);
+      cv.setBiologicalQualifierType(BQB_IS);
+      cv.addResource(resource.str());
+      s->addCVTerm(&cv);
+    }
+  }
+
+  for (unsigned int i = 0; i < 300; ++i)
+  {
+    ostringstream id, reactant, product;
+    id << "r" << i;
+    reactant << "s" << i;
+    product << "s" << i + 1;
+
+    Reaction* r = m->createReaction();
+    r->setId(id.str());
+    r->setReversible(false);
+    r->createReactant()->setSpecies(reactant.str());
+    r->createProduct()->setSpecies(product.str());
+
+    KineticLaw* kl = r->createKineticLaw();
+    LocalParameter* k = kl->createLocalParameter();
+    k->setId("k");
+    k->setValue(0.1 * i);
+
+    ASTNode* math = SBML_parseL3Formula(("k * " + reactant.str() + " / (1 + "
+                                         + reactant.str() + ")").c_str());
+    kl->setMath(math);
+    delete math;
+  }
+
+  return d;
+}
+
+
+START_TEST (test_WriteSBML_parallel_lists)
+{
+  bool writeComment = XMLOutputStream::getWriteComment();
+  XMLOutputStream::setWriteComment(false);
+
+  SBMLDocument* d = largeDocument();
+
+  SBMLWriter serial;
+  SBMLWriter parallel;
+  fail_unless( parallel.getNumThreads() == 1 );
+
+  parallel.setNumThreads(4);
+  fail_unless( parallel.getNumThreads() == 4 );
+
+  std::string expected = serial.writeSBMLToStdString(d);
+  fail_unless( expected.size() > 100000 );
+  fail_unless( parallel.writeSBMLToStdString(d) == expected );
+
+  parallel.setNumThreads(0);
+  fail_unless( parallel.writeSBMLToStdString(d) == expected );
+
+  /* the notes and annotations not read yet are read before being written */
+  SBMLReader reader;
+  reader.setReadNotesAndAnnotationsLazily(true);
+
+  SBMLDocument* lazy  = reader.readSBMLFromString(expected);
+  SBMLDocument* eager = readSBMLFromString(expected.c_str());
+  parallel.setNumThreads(4);
+  fail_unless( parallel.writeSBMLToStdString(lazy) == expected );
+  fail_unless( lazy->getNumErrors() == eager->getNumErrors() );
+  fail_unless( lazy->getModel()->getSpecies(7)->isSetNotes() );
+
+  delete eager;
+  delete lazy;
+  delete d;
+
+  XMLOutputStream::setWriteComment(writeComment);
+}
+END_TEST
+
+
+START_TEST (test_WriteSBML_original_text)
+{
+  bool writeComment = XMLOutputStream::getWriteComment();
+  XMLOutputStream::setWriteComment(false);
+
+  SBMLDocument* d = largeDocument();
+  std::string expected = writeSBMLToStdString(d);
+  delete d;
+
+  SBMLReader reader;
+  fail_unless( reader.getKeepOriginalText() == false );
+
+  reader.setKeepOriginalText(true);
+  fail_unless( reader.getKeepOriginalText() == true );
+
+  /* a document not changed since it was read is written as it was */
+  SBMLDocument* kept  = reader.readSBMLFromString(expected);
+  SBMLDocument* eager = readSBMLFromString(expected.c_str());
+  fail_unless( kept->isSetOriginalText() );
+  fail_unless( !eager->isSetOriginalText() );
+  fail_unless( kept->getNumErrors() == eager->getNumErrors() );
+  fail_unless( kept->hasOriginalText() );
+  fail_unless( kept->getModel()->getSpecies(7)->hasOriginalText() );
+  fail_unless( writeSBMLToStdString(kept) == expected );
+
+  /* only what contains a changed object is written again */
+  kept->getModel()->getSpecies(5)->setInitialAmount(2.5);
+  eager->getModel()->getSpecies(5)->setInitialAmount(2.5);
+  fail_unless( !kept->hasOriginalText() );
+  fail_unless( !kept->getModel()->getListOfSpecies()->hasOriginalText() );
+  fail_unless( !kept->getModel()->getSpecies(5)->hasOriginalText() );
+  fail_unless( kept->getModel()->getSpecies(6)->hasOriginalText() );
+  fail_unless( kept->getModel()->getReaction(0)->hasOriginalText() );
+
+  std::string changed = writeSBMLToStdString(eager);
+  fail_unless( changed != expected );
+  fail_unless( writeSBMLToStdString(kept) == changed );
+
+  SBMLWriter parallel;
+  parallel.setNumThreads(4);
+  fail_unless( parallel.writeSBMLToStdString(kept) == changed );
+
+  /* so is what an annotation is changed through */
+  kept->getModel()->getSpecies(14)->getCVTerm(0)->addResource("urn:x");
+  eager->getModel()->getSpecies(14)->getCVTerm(0)->addResource("urn:x");
+  fail_unless( !kept->getModel()->getSpecies(14)->hasOriginalText() );
+  fail_unless( writeSBMLToStdString(kept) == writeSBMLToStdString(eager) );
+
+  kept->discardOriginalText();
+  fail_unless( !kept->isSetOriginalText() );
+  fail_unless( writeSBMLToStdString(kept) == writeSBMLToStdString(eager) );
+
+  delete eager;
+  delete kept;
+
+  /* the text of the objects unchanged is kept as it is */
+  const char* original =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<sbml xmlns=\"http://www.sbml.org/sbml/level3/version2/core\" "
+    "level=\"3\" version=\"2\">\n"
+    "  <model id=\"m\">\n"
+    "    <listOfParameters>\n"
+    "      <parameter   id='p1' value='1.0'   constant='true'></parameter>\n"
+    "      <parameter   id='p2' value='2.0'   constant='true'/>\n"
+    "    </listOfParameters>\n"
+    "  </model>\n"
+    "</sbml>\n";
+
+  kept = reader.readSBMLFromString(original);
+  fail_unless( writeSBMLToStdString(kept) == original );
+
+  kept->getModel()->getParameter(1)->setValue(3);
+  std::string written = writeSBMLToStdString(kept);
+  fail_unless( written.find("<parameter   id='p1' value='1.0'   "
+                            "constant='true'></parameter>")
+               != std::string::npos );
+  fail_unless( written.find("<parameter id=\"p2\" value=\"3\" "
+                            "constant=\"true\"/>") != std::string::npos );
+
+  /* copies are written again */
+  eager = readSBMLFromString(original);
+  eager->getModel()->getParameter(1)->setValue(3);
+
+  SBMLDocument* copy = kept->clone();
+  fail_unless( !copy->isSetOriginalText() );
+  fail_unless( !copy->getModel()->getParameter(0)->hasOriginalText() );
+  fail_unless( writeSBMLToStdString(copy) == writeSBMLToStdString(eager) );
+
+  delete copy;
+  delete eager;
+  delete kept;
+
+  XMLOutputStream::setWriteComment(writeComment);
+}
+END_TEST
+
+
 #ifdef USE_ZLIB
 START_TEST (test_WriteSBML_gzip)
 {
@@ -2980,8 +3286,16 @@ START_TEST (test_WriteSBML_gzip)
     char* dtos = d->toSBML();
     char* dgtos = dg->toSBML();
     fail_unless( strcmp(dtos, dgtos) == 0 );
-    safe_free(dtos);
     safe_free(dgtos);
+    safe_free(dtos);
+
+    /* the whole file decompressed at once */
+    dtos = writeSBMLToString(d);
+    char* content = InputDecompressor::getStringFromGzip(gzfile);
+    fail_unless( content != NULL );
+    fail_unless( strcmp(content, dtos) == 0 );
+    safe_free(content);
+    safe_free(dtos);
 
     delete d;
     delete dg;
@@ -3033,8 +3347,16 @@ START_TEST (test_WriteSBML_bzip2)
     char* dtos = d->toSBML();
     char* dgtos = dg->toSBML();
     fail_unless( strcmp(dtos, dgtos) == 0 );
-    safe_free(dtos);
     safe_free(dgtos);
+    safe_free(dtos);
+
+    /* the whole file decompressed at once */
+    dtos = writeSBMLToString(d);
+    char* content = InputDecompressor::getStringFromBzip2(bz2file);
+    fail_unless( content != NULL );
+    fail_unless( strcmp(content, dtos) == 0 );
+    safe_free(content);
+    safe_free(dtos);
 
     delete d;
     delete dg;
@@ -3085,8 +3407,16 @@ START_TEST (test_WriteSBML_zip)
     char* dtos = d->toSBML();
     char* dgtos = dg->toSBML();
     fail_unless( strcmp(dtos, dgtos) == 0 );
-    safe_free(dtos);
     safe_free(dgtos);
+    safe_free(dtos);
+
+    /* the whole file decompressed at once */
+    dtos = writeSBMLToString(d);
+    char* content = InputDecompressor::getStringFromZip(zipfile);
+    fail_unless( content != NULL );
+    fail_unless( strcmp(content, dtos) == 0 );
+    safe_free(content);
+    safe_free(dtos);
 
     delete d;
     delete dg;
@@ -3432,6 +3762,10 @@ create_suite_WriteSBML ()
   tcase_add_test( tcase, test_WriteSBML_INF     );
   tcase_add_test( tcase, test_WriteSBML_NegINF  );
   tcase_add_test( tcase, test_WriteSBML_locale  );
+  tcase_add_test( tcase, test_WriteSBML_sinks  );
+  tcase_add_test( tcase, test_WriteSBML_outputBuffer  );
+  tcase_add_test( tcase, test_WriteSBML_parallel_lists  );
+  tcase_add_test( tcase, test_WriteSBML_original_text  );
 
   // Compressed SBML
 #ifdef USE_ZLIB 
@@ -0,0 +1,308 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    IdIndex.cpp
+ * @brief   Lazily built lookup table from SIds to the objects holding them.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/util/IdIndex.h>
+#include <sbml/util/List.h>
+#include <sbml/util/MetaIdFilter.h>
+#include <sbml/SBase.h>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <atomic>
+#endif
+
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * Number of linear searches made after an invalidation before the index
+ * is rebuilt.
+ */
+static const unsigned int ID_INDEX_REBUILD_THRESHOLD = 4;
+
+
+/*
+ * Advanced by every change that may make an index out of date.
+ */
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+static std::atomic<unsigned long> sGeneration(0);
+#else
+static volatile unsigned long sGeneration = 0;
+#endif
+
+
+/*
+ * Number of ReadOnlyScope objects alive in the current thread.
+ */
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+static thread_local unsigned int sReadOnlyDepth = 0;
+#else
+static unsigned int sReadOnlyDepth = 0;
+#endif
+
+
+static unsigned long
+currentGeneration()
+{
+  return sGeneration;
+}
+
+
+IdIndex::IdIndex(bool metaIds)
+  : mMetaIds(metaIds)
+  , mHolders()
+  , mDuplicates()
+  , mValid(false)
+  , mGeneration(0)
+  , mStamp(0)
+  , mLookupGeneration(0)
+  , mLookupsSinceInvalidated(0)
+{
+}
+
+
+IdIndex::IdIndex(const IdIndex& orig)
+  : mMetaIds(orig.mMetaIds)
+  , mHolders()
+  , mDuplicates()
+  , mValid(false)
+  , mGeneration(0)
+  , mStamp(0)
+  , mLookupGeneration(0)
+  , mLookupsSinceInvalidated(0)
+{
+}
+
+
+IdIndex&
+IdIndex::operator=(const IdIndex& rhs)
+{
+  if (&rhs != this)
+  {
+    mMetaIds = rhs.mMetaIds;
+    mHolders.clear();
+    mDuplicates.clear();
+    mValid = false;
+    mStamp = 0;
+    mLookupsSinceInvalidated = 0;
+  }
+  return *this;
+}
+
+
+void
+IdIndex::invalidateAll()
+{
+  ++sGeneration;
+}
+
+
+IdIndex::ReadOnlyScope::ReadOnlyScope()
+{
+  ++sReadOnlyDepth;
+}
+
+
+IdIndex::ReadOnlyScope::~ReadOnlyScope()
+{
+  --sReadOnlyDepth;
+}
+
+
+bool
+IdIndex::isReadOnly()
+{
+  return sReadOnlyDepth > 0;
+}
+
+
+bool
+IdIndex::isValid() const
+{
+  return mValid && mGeneration == currentGeneration();
+}
+
+
+unsigned int
+IdIndex::getStamp() const
+{
+  return mStamp;
+}
+
+
+void
+IdIndex::invalidate()
+{
+  if (isReadOnly()) return;
+
+  mValid = false;
+  mLookupsSinceInvalidated = 0;
+}
+
+
+bool
+IdIndex::isWorthRebuilding()
+{
+  if (isReadOnly()) return false;
+
+  // only count the lookups made since the latest change anywhere
+  unsigned long generation = currentGeneration();
+  if (generation != mLookupGeneration)
+  {
+    mLookupGeneration = generation;
+    mLookupsSinceInvalidated = 0;
+  }
+  return ++mLookupsSinceInvalidated > ID_INDEX_REBUILD_THRESHOLD;
+}
+
+
+void
+IdIndex::reset(unsigned int stamp)
+{
+  mHolders.clear();
+  mDuplicates.clear();
+  mValid = true;
+  mGeneration = currentGeneration();
+  mStamp = stamp;
+}
+
+
+void
+IdIndex::add(const SBase* element, SBase* holder)
+{
+  const std::string& key = mMetaIds ? element->getMetaId() : element->getId();
+  if (key.empty()) return;
+
+  // insert() leaves an existing entry alone, so the first holder wins
+  if (!mHolders.insert(IdHolderMap::value_type(key, holder)).second
+      && mMetaIds)
+  {
+    mDuplicates.push_back(element);
+  }
+}
+
+
+void
+IdIndex::addSubtree(SBase* element, SBase* holder)
+{
+  if (element == NULL) return;
+
+  add(element, holder);
+
+  MetaIdFilter metaIdFilter;
+  List* children = element->getAllElements(mMetaIds ? &metaIdFilter : NULL);
+  if (children == NULL) return;
+
+  for (ListIterator it = children->begin(); it != children->end(); ++it)
+  {
+    add(static_cast<const SBase*>(*it), holder);
+  }
+  delete children;
+}
+
+
+void
+IdIndex::addElements(SBase* root)
+{
+  if (root == NULL) return;
+
+  add(root, root);
+
+  MetaIdFilter metaIdFilter;
+  List* children = root->getAllElements(mMetaIds ? &metaIdFilter : NULL);
+  if (children == NULL) return;
+
+  for (ListIterator it = children->begin(); it != children->end(); ++it)
+  {
+    add(static_cast<const SBase*>(*it), static_cast<SBase*>(*it));
+  }
+  delete children;
+}
+
+
+void
+IdIndex::insert(const std::string& id, SBase* holder)
+{
+  if (!isValid() || id.empty() || isReadOnly()) return;
+
+  mHolders.insert(IdHolderMap::value_type(id, holder));
+}
+
+
+void
+IdIndex::erase(const std::string& id, const SBase* holder)
+{
+  if (!isValid() || id.empty() || isReadOnly()) return;
+
+  IdHolderMap::iterator it = mHolders.find(id);
+  if (it != mHolders.end() && it->second == holder)
+  {
+    mHolders.erase(it);
+  }
+}
+
+
+SBase*
+IdIndex::getHolder(const std::string& id) const
+{
+  IdHolderMap::const_iterator it = mHolders.find(id);
+  return (it == mHolders.end()) ? NULL : it->second;
+}
+
+
+const std::vector<const SBase*>&
+IdIndex::getDuplicates() const
+{
+  return mDuplicates;
+}
+
+
+unsigned int
+IdIndex::size() const
+{
+  return (unsigned int)mHolders.size();
+}
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
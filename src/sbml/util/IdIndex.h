@@ -0,0 +1,262 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    IdIndex.h
+ * @brief   Lazily built lookup table from SIds or metaids to the objects
+ *          holding them.
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution
+ * and also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class IdIndex
+ * @sbmlbrief{core} Maps SIds or metaids to the objects that hold them.
+ *
+ * An IdIndex is used by ListOf and Model to answer getElementBySId()
+ * queries without walking their children.  Each id is mapped to a
+ * 'holder': the direct child of the indexing object whose subtree
+ * contains the element with that id.  The caller resolves the final
+ * element by asking the holder, which keeps the index small and lets
+ * every answer be checked against the live tree.  The ids are collected
+ * with SBase::getAllElements(), so an element it does not report (such
+ * as a ListOf object with no children) is not found through the index.
+ *
+ * SBMLDocument uses an index of metaids, built with addElements(), to
+ * answer getElementByMetaId() queries: there every element is its own
+ * holder.
+ *
+ * The index does not track changes itself.  Instead, every change that
+ * could make any index out of date (an id being set, an object being
+ * attached, removed or deleted) calls IdIndex::invalidateAll(), which
+ * advances a process-wide generation counter; an index is only valid
+ * while the counter has the value it had when the index was built.
+ * This never needs to follow a pointer to a parent object that may
+ * already have been deleted, at the price of invalidating the indexes
+ * of unrelated documents too.
+ *
+ * Rebuilding costs several times as much as one linear search, so an
+ * invalidated index is only rebuilt once a few lookups have been made
+ * without any further change; code that alternates between adding
+ * elements and looking up ids therefore keeps the cost of the plain
+ * search.
+ *
+ * Lookups therefore update the index they use.  Code that reads the same
+ * document from several threads at once creates a ReadOnlyScope in each
+ * of them: within it, no index is rebuilt, invalidated or edited, and
+ * an index that is out of date is simply not used.  The indexes should
+ * be brought up to date beforehand (see SBMLDocument::buildIdIndexes()).
+ */
+
+#ifndef IdIndex_h
+#define IdIndex_h
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <sbml/common/libsbml-namespace.h>
+#include <sbml/common/extern.h>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#include <unordered_map>
+#define LIBSBML_ID_INDEX_MAP std::unordered_map
+#else
+#include <map>
+#define LIBSBML_ID_INDEX_MAP std::map
+#endif
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class SBase;
+
+class LIBSBML_EXTERN IdIndex
+{
+public:
+
+  /**
+   * Creates an empty index of the SIds, or if @p metaIds is @c true, of
+   * the metaids of the elements added to it.
+   */
+  explicit IdIndex (bool metaIds = false);
+
+  /**
+   * Copies of an index start out invalid: the holders they refer to
+   * belong to the original object.
+   */
+  IdIndex (const IdIndex& orig);
+
+  IdIndex& operator= (const IdIndex& rhs);
+
+
+  /**
+   * Marks every index as out of date.
+   */
+  static void invalidateAll ();
+
+
+  /**
+   * While an object of this class exists, the indexes used by the
+   * current thread are left unchanged (see isReadOnly()).
+   */
+  class LIBSBML_EXTERN ReadOnlyScope
+  {
+  public:
+    ReadOnlyScope ();
+    ~ReadOnlyScope ();
+
+  private:
+    ReadOnlyScope (const ReadOnlyScope&);
+    ReadOnlyScope& operator= (const ReadOnlyScope&);
+  };
+
+
+  /**
+   * Returns @c true if the current thread is within a ReadOnlyScope.
+   * invalidate(), insert() and erase() then do nothing, and
+   * isWorthRebuilding() returns @c false, so that an index is never
+   * rebuilt by a lookup.
+   */
+  static bool isReadOnly ();
+
+
+  /**
+   * Returns @c true if this index has been built, and neither it nor
+   * all indexes have been invalidated since.
+   */
+  bool isValid () const;
+
+
+  /**
+   * Returns the stamp recorded by the last call to reset().
+   */
+  unsigned int getStamp () const;
+
+
+  /**
+   * Marks this index as out of date.
+   */
+  void invalidate ();
+
+
+  /**
+   * To be called for each lookup made while this index is invalid.
+   * Returns @c true once enough lookups have been made since it was
+   * invalidated for a rebuild to pay off; until then the caller should
+   * fall back to a linear search.
+   */
+  bool isWorthRebuilding ();
+
+
+  /**
+   * Empties this index and marks it as valid, ready to be repopulated;
+   * the caller may record a @p stamp (such as its number of children)
+   * with which to detect changes made behind its back.
+   */
+  void reset (unsigned int stamp = 0);
+
+
+  /**
+   * Adds the id of @p element, and the ids of all the elements below it,
+   * mapping each of them to @p holder.  Ids already present keep the
+   * holder they were first added with, so that duplicated ids resolve
+   * to the same object as a depth-first search would find.
+   */
+  void addSubtree (SBase* element, SBase* holder);
+
+
+  /**
+   * Adds @p root and every element below it, each mapped to itself.
+   */
+  void addElements (SBase* root);
+
+
+  /**
+   * Maps @p id to @p holder, unless the index is out of date or @p id is
+   * already present.
+   */
+  void insert (const std::string& id, SBase* holder);
+
+
+  /**
+   * Removes @p id from this index if it is mapped to @p holder.
+   */
+  void erase (const std::string& id, const SBase* holder);
+
+
+  /**
+   * For an index of metaids, returns the elements that were added while
+   * their metaid was already present, in the order in which they were
+   * added since the last reset().  (Shared SIds, such as those of local
+   * parameters, are common and are not recorded.)
+   */
+  const std::vector<const SBase*>& getDuplicates () const;
+
+
+  /**
+   * Returns the holder for the given @p id, or @c NULL if no object with
+   * this id was present when the index was built.
+   */
+  SBase* getHolder (const std::string& id) const;
+
+
+  /**
+   * Returns the number of ids in this index.
+   */
+  unsigned int size () const;
+
+
+private:
+
+  void add (const SBase* element, SBase* holder);
+
+  typedef LIBSBML_ID_INDEX_MAP<std::string, SBase*> IdHolderMap;
+
+  bool                        mMetaIds;
+  IdHolderMap                 mHolders;
+  std::vector<const SBase*>   mDuplicates;
+  bool          mValid;
+  unsigned long mGeneration;
+  unsigned int  mStamp;
+  unsigned long mLookupGeneration;
+  unsigned int  mLookupsSinceInvalidated;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* IdIndex_h */
+/** @endcond */
@@ -51,8 +51,8 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  */
 List::List ():
     size(0)
-  , head(NULL)
-  , tail(NULL)
+  , offset(0)
+  , items()
 {
 }
 
@@ -60,8 +60,8 @@ List::List ():
 /*
  * Destroys the given List.
  *
- * This function does not delete List items.  It destroys only the List and
- * its constituent ListNodes (if any).
+ * This function does not delete List items.  It destroys only the List
+ * itself.
  *
  * Presumably, you either i) have pointers to the individual list items
  * elsewhere in your program and you want to keep them around for awhile
@@ -70,19 +70,6 @@ List::List ():
  */
 List::~List ()
 {
-  ListNode *node;
-  ListNode *temp;
-
-
-  node = head;
-
-  while (node != NULL)
-  {
-    temp = node;
-    node = node->next;
-
-    delete temp;
-  }
 }
 
 
@@ -94,20 +81,7 @@ List::add (void *item)
 {
   if (item == NULL) return;
 
-  ListNode* node = new ListNode(item);
-
-
-  if (head == NULL)
-  {
-    head = node;
-    tail = node;
-  }
-  else
-  {
-    tail->next = node;
-    tail       = node;
-  }
-
+  items.push_back(item);
   size++;
 }
 
@@ -127,18 +101,16 @@ unsigned int
 List::countIf (ListItemPredicate predicate) const
 {
   unsigned int count = 0;
-  ListNode     *node = head;
 
   if (predicate == NULL) return 0;
 
-  while (node != NULL)
+  void** item = first();
+  for (unsigned int n = 0; n < size; ++n)
   {
-    if (predicate(node->item) != 0)
+    if (predicate(item[n]) != 0)
     {
       count++;
     }
-
-    node = node->next;
   }
 
   return count;
@@ -161,23 +133,18 @@ List::countIf (ListItemPredicate predicate) const
 void *
 List::find (const void *item1, ListItemComparator comparator) const
 {
-  void     *item2  = NULL;
-  ListNode *node   = head;
-
   if (comparator == NULL) return NULL;
 
-  while (node != NULL)
+  void** item = first();
+  for (unsigned int n = 0; n < size; ++n)
   {
-    if (comparator(item1, node->item) == 0)
+    if (comparator(item1, item[n]) == 0)
     {
-      item2 = node->item;
-      break;
+      return item[n];
     }
-
-    node = node->next;
   }
 
-  return item2;
+  return NULL;
 }
 
 
@@ -194,18 +161,16 @@ List *
 List::findIf (ListItemPredicate predicate) const
 {
   List     *result = new List();  
-  ListNode *node   = head;
 
   if (predicate == NULL) return result;
 
-  while (node != NULL)
+  void** item = first();
+  for (unsigned int n = 0; n < size; ++n)
   {
-    if (predicate(node->item) != 0)
+    if (predicate(item[n]) != 0)
     {
-      result->add(node->item);
+      result->add(item[n]);
     }
-
-    node = node->next;
   }
 
   return result;
@@ -218,32 +183,12 @@ List::findIf (ListItemPredicate predicate) const
 void *
 List::get (unsigned int n) const
 {
-  ListNode* node = head;
-
-
   if (n >= size)
   {
     return NULL;
   }
 
-  /**
-   * Special case to retreive last item in the list without a full list
-   * traversal.
-   */
-  if (n == (size - 1))
-  {
-    node = tail;
-  }
-  else
-  {
-    /* Point node to the nth item. */
-    while (n-- > 0)
-    {
-      node = node->next;
-    }
-  }
-
-  return node->item;
+  return first()[n];
 }
 
 
@@ -253,18 +198,13 @@ List::get (unsigned int n) const
 void
 List::prepend (void *item)
 {
-  ListNode* node = new ListNode(item);
-
-
-  if (head == NULL)
+  if (offset > 0)
   {
-    head = node;
-    tail = node;
+    items[--offset] = item;
   }
   else
   {
-    node->next = head;
-    head       = node;
+    items.insert(items.begin(), item);
   }
 
   size++;
@@ -278,64 +218,40 @@ List::prepend (void *item)
 void *
 List::remove (unsigned int n)
 {
-  void*     item;
-  ListNode* prev;
-  ListNode* temp;
-  ListNode* next;
-
-
   if (n >= size)
   {
     return NULL;
   }
 
-  /**
-   * temp = node to be removed
-   * prev = node before temp (or NULL if temp == list->head)
-   * next = node after  temp (or NULL if temp == list->tail)
-   */
-  prev = NULL;
-  temp = head;
-  next = temp->next;
-
-  /**
-   * Point temp to nth item.
-   */
-  while (n-- > 0)
-  {
-    prev = temp;
-    temp = temp->next;
-    next = temp->next;
-  }
+  void* item = first()[n];
 
-  /**
-   * If the first item in the list is being removed, only list->head needs
-   * to be updated to remove temp.  Otherwise, prev->next must "forget"
-   * about temp and point to next instead.
-   */
-  if (head == temp)
+  if (n == 0)
   {
-    head = next;
+    /**
+     * Lists are usually emptied from the front, so rather than shifting
+     * the remaining items, leave a free slot before them; these are only
+     * reclaimed once they outnumber the items.
+     */
+    offset++;
+    size--;
+
+    if (size == 0)
+    {
+      items.clear();
+      offset = 0;
+    }
+    else if (offset > size)
+    {
+      items.erase(items.begin(), items.begin() + offset);
+      offset = 0;
+    }
   }
   else
   {
-    prev->next = next;
+    items.erase(items.begin() + offset + n);
+    size--;
   }
 
-  /**
-   * Regardless of the restructuring above, if the last item in the list
-   * has been removed, update list->tail.
-   */
-  if (tail == temp)
-  {
-    tail = prev;
-  }
-
-  item = temp->item;
-  delete temp;
-
-  size--;
-
   return item;
 }
 
@@ -352,29 +268,42 @@ List::getSize () const
 void
 List::transferFrom(List* list)
 {
-  if (list==NULL) return;
-  if (list->head == NULL) return;
-  if (head==NULL) {
-    head = list->head;
-    tail = list->tail;
+  if (list==NULL || list == this) return;
+  if (list->size == 0) return;
+
+  if (size == 0)
+  {
+    items.swap(list->items);
+    offset = list->offset;
     size = list->size;
   }
-  else {
-    tail->next = list->head;
-    tail = list->tail;
+  else
+  {
+    void** item = list->first();
+    items.insert(items.end(), item, item + list->size);
     size += list->size;
   }
-  list->head = NULL;
-  list->tail = NULL;
+
+  list->items.clear();
+  list->offset = 0;
   list->size = 0;
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+void** 
+List::first() const
+{
+  return items.empty() ? NULL : const_cast<void**>(&items[0]) + offset;
+}
+/** @endcond */
+
+
 /** @cond doxygenLibsbmlInternal */
 ListIterator 
 List::begin() 
 { 
-  return ListIterator(head); 
+  return ListIterator(first()); 
 }
 /** @endcond */
 
@@ -383,7 +312,8 @@ List::begin()
 ListIterator 
 List::end() 
 { 
-  return ListIterator(0); 
+  void** item = first();
+  return ListIterator(item == NULL ? NULL : item + size); 
 }
 /** @endcond */
 
@@ -394,13 +324,10 @@ List::deleteListAndChildrenWith(List* list, ListDeleteItemFunc delteFunc)
 {
   if (list == NULL || delteFunc == NULL) return;
   
-  ListNode     *node = list->head;
-
-  while (node != NULL)
+  void** item = list->first();
+  for (unsigned int n = 0; n < list->size; ++n)
   {
-    delteFunc(node->item);
-
-    node = node->next;
+    delteFunc(item[n]);
   }
 
   delete list;
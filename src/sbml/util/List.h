@@ -49,6 +49,10 @@
  * classes more extensively.  At some point in the future, this List class
  * may be removed in favor of using standard C++ classes.
  *
+ * The items of a List are stored contiguously, so that get() takes
+ * constant time and iterating over a list is cache friendly; removing
+ * the first item, as is done when emptying a list, is constant time too.
+ *
  * This class is distinct from ListOf because the latter is derived from
  * the SBML SBase class, whereas this List class is not.  ListOf can only
  * be used when a list is actually intended to implement an SBML ListOfX
@@ -62,6 +66,10 @@
 #include <sbml/common/extern.h>
 #include <string.h>
 
+#ifdef __cplusplus
+#include <vector>
+#endif
+
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 /**
@@ -124,8 +132,10 @@ class ListIterator;
  *
  * @htmlinclude not-sbml-warning.html
  *
- * This class implements the children of the List class, storing the 
- * item itself, and a pointer to the next item in the list.
+ * This class used to implement the children of the List class, storing
+ * the item itself, and a pointer to the next item in the list.  Lists now
+ * store their items contiguously; the class is only kept for the C API
+ * functions ListNode_create() and ListNode_free().
  */
 class LIBSBML_EXTERN ListNode
 {
@@ -144,24 +154,24 @@ public:
 
 class LIBSBML_EXTERN ListIterator
 {
-	/* Helper class to provide pointer like facilities around a node */
+	/* Helper class to provide pointer like facilities around an item */
 	friend class List;
 
-  ListNode* position; //The node oriented with this instance of ListIterator.
+  void** position; //The item oriented with this instance of ListIterator.
 	
-	ListIterator(ListNode* _pNode) : position(_pNode) {}
+	ListIterator(void** _pItem) : position(_pItem) {}
 
 public:
 	
-  void operator++(){ position = position->next; }
+  void operator++(){ ++position; }
 	
-  void operator++(int){ position = position->next; }
+  void operator++(int){ ++position; }
 
 	bool operator!=(ListIterator rval){ return !(position == rval.position); }
 	
   bool operator==(ListIterator rval){ return (position == rval.position); }
 
-	void * operator*(){	return position->getItem(); }
+	void * operator*(){	return *position; }
 
 };
 /** @endcond */
@@ -184,7 +194,7 @@ public:
    * Destroys this List object.
    *
    * This function does not delete List items.  It destroys only the List
-   * and its constituent ListNodes (if any).
+   * itself.
    *
    * Presumably, you either i) have pointers to the individual list items
    * elsewhere in your program and you want to keep them around for awhile
@@ -313,7 +323,8 @@ public:
   unsigned int getSize () const;
 
   /**
-   * Merge this elements of the second list into this list (by pointing the last ListNode to the first ListNode in the supplied List).
+   * Moves the elements of the second list to the end of this list, leaving
+   * the second list empty.
    *
    */
   void transferFrom(List* list);
@@ -340,9 +351,14 @@ public:
 
 protected:
   /** @cond doxygenLibsbmlInternal */
-  unsigned int size;
-  ListNode*    head;
-  ListNode*    tail;
+  /**
+   * Returns a pointer to the first item of this List.
+   */
+  void** first () const;
+
+  unsigned int        size;
+  unsigned int        offset;   // number of unused slots before the first item
+  std::vector<void*>  items;
 
   /** @endcond */
 };
@@ -320,6 +320,94 @@ START_TEST (test_util_isInf)
 }
 END_TEST
 
+START_TEST (test_util_formatDouble)
+{
+  char s[32];
+
+
+  fail_unless( util_formatDouble(s, 0.1, 1) == 3 );
+  fail_unless( !strcmp(s, "0.1") );
+
+  util_formatDouble(s, 1.0 / 3, 1);
+  fail_unless( !strcmp(s, "0.3333333333333333") );
+  fail_unless( strtod(s, NULL) == 1.0 / 3 );
+
+  util_formatDouble(s, 1.0 / 3, 0);
+  fail_unless( !strcmp(s, "0.333333333333333") );
+
+  util_formatDouble(s, 1000, 1);
+  fail_unless( !strcmp(s, "1000") );
+
+  util_formatDouble(s, 1e-5, 1);
+  fail_unless( !strcmp(s, "1e-05") );
+
+  util_formatDouble(s, -2.5e23, 1);
+  fail_unless( !strcmp(s, "-2.5e+23") );
+
+  util_formatDouble(s, 1e23, 1);
+  fail_unless( !strcmp(s, "1e+23") );
+
+  util_formatDouble(s, 123456789012345680.0, 1);
+  fail_unless( !strcmp(s, "1.2345678901234568e+17") );
+
+  util_formatDouble(s, 4.9406564584124654e-324, 1);
+  fail_unless( !strcmp(s, "5e-324") );
+
+  util_formatDouble(s, 1.7976931348623157e308, 1);
+  fail_unless( !strcmp(s, "1.7976931348623157e+308") );
+
+  util_formatDouble(s, util_NegZero(), 1);
+  fail_unless( !strcmp(s, "-0") );
+
+  util_formatDouble(s, util_NaN(), 1);
+  fail_unless( !strcmp(s, "NaN") );
+
+  util_formatDouble(s, util_NegInf(), 0);
+  fail_unless( !strcmp(s, "-INF") );
+
+  setlocale(LC_ALL, "de_DE");
+
+  util_formatDouble(s, 3.25, 1);
+  fail_unless( !strcmp(s, "3.25") );
+
+  util_formatDouble(s, 3.25, 0);
+  fail_unless( !strcmp(s, "3.25") );
+
+  setlocale(LC_ALL, "C");
+}
+END_TEST
+
+
+START_TEST (test_util_formatDouble_roundTrip)
+{
+  char   s[32];
+  char   t[32];
+  double d = 0.7;
+  int    i;
+
+
+  for (i = 0; i < 10000; ++i)
+  {
+    d = d * 3.7 + 1.0 / (i + 3);
+    if (d > 1e300) d /= 1e299;
+
+    util_formatDouble(s, d, 1);
+    fail_unless( strtod(s, NULL) == d );
+
+    /* the same as before for the values 15 digits are enough for */
+    sprintf(t, "%.15g", d);
+    if (strtod(t, NULL) == d)
+    {
+      fail_unless( !strcmp(s, t) );
+    }
+
+    util_formatDouble(s, d, 0);
+    fail_unless( !strcmp(s, t) );
+  }
+}
+END_TEST
+
+
 START_TEST (test_util_accessWithNULL)
 {
   fail_unless ( util_bsearchStringsI(NULL, NULL, 0, 0) == 1 );
@@ -366,6 +454,8 @@ create_suite_util (void)
   tcase_add_test( tcase, test_util_PosInf             );
   tcase_add_test( tcase, test_util_NegZero            );
   tcase_add_test( tcase, test_util_isInf              );
+  tcase_add_test( tcase, test_util_formatDouble       );
+  tcase_add_test( tcase, test_util_formatDouble_roundTrip );
   tcase_add_test( tcase, test_util_accessWithNULL     );
   tcase_add_test( tcase, test_util_operationReturn    );
 
@@ -55,6 +55,7 @@
 #if defined CYGWIN
 #include <cstdlib>
 #endif
+#include <cstring>
 
 #include <sbml/common/common.h>
 #include <sbml/common/libsbml-package.h>
@@ -159,6 +160,493 @@ c_locale_strtod (const char *nptr, char **endptr)
 }
 
 
+/*
+ * The shortest digits of a double are found with the Grisu2 algorithm of
+ * Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+ * with Integers" (PLDI 2010).  It works on 64-bit integers only, and finds
+ * digits that read back exactly as the double, which in all but rare cases
+ * are also the fewest digits that do.
+ */
+typedef unsigned long long DiyFpWord;
+
+
+/* a floating-point number f * 2^e with a 64-bit significand */
+struct DiyFp
+{
+  DiyFpWord f;
+  int       e;
+
+  DiyFp (DiyFpWord f_, int e_) : f(f_), e(e_) { }
+};
+
+
+static const DiyFpWord kHiddenBit = 0x0010000000000000ULL;
+static const DiyFpWord kFractionMask = 0x000FFFFFFFFFFFFFULL;
+
+
+static DiyFp
+diyFpMinus (const DiyFp& a, const DiyFp& b)
+{
+  return DiyFp(a.f - b.f, a.e);
+}
+
+
+static DiyFp
+diyFpMultiply (const DiyFp& a, const DiyFp& b)
+{
+  const DiyFpWord M32 = 0xFFFFFFFFULL;
+  const DiyFpWord ah  = a.f >> 32;
+  const DiyFpWord al  = a.f & M32;
+  const DiyFpWord bh  = b.f >> 32;
+  const DiyFpWord bl  = b.f & M32;
+  const DiyFpWord hh  = ah * bh;
+  const DiyFpWord lh  = al * bh;
+  const DiyFpWord hl  = ah * bl;
+  const DiyFpWord ll  = al * bl;
+
+  DiyFpWord middle = (ll >> 32) + (hl & M32) + (lh & M32);
+  middle += 1U << 31; /* rounds */
+
+  return DiyFp(hh + (hl >> 32) + (lh >> 32) + (middle >> 32), a.e + b.e + 64);
+}
+
+
+static DiyFp
+diyFpNormalize (DiyFp x)
+{
+  while ((x.f & 0x8000000000000000ULL) == 0)
+  {
+    x.f <<= 1;
+    x.e--;
+  }
+
+  return x;
+}
+
+
+/* 10^k for k = -348, -340, ..., 340, normalized and rounded */
+static const DiyFpWord kCachedPowersF[] =
+{
+  0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+  0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+  0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+  0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+  0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+  0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+  0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+  0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+  0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+  0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+  0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+  0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+  0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+  0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+  0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+  0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+  0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+  0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+  0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+  0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+  0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+  0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+  0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+  0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+  0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+  0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+  0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+  0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+  0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+static const short kCachedPowersE[] =
+{
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+  -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+  -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+  -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+  -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+  109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+  375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+  641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+  907, 933, 960, 986, 1013, 1039, 1066
+};
+
+
+/*
+ * Returns a cached power of ten c = 10^-k such that the exponent of
+ * c * 2^e is in [-60, -32], and sets k.
+ */
+static DiyFp
+getCachedPower (int e, int& k)
+{
+  double dk = (-61 - e) * 0.30102999566398114 + 347;
+  int    ik = (int)dk;
+  if (dk - ik > 0.0) ik++;
+
+  unsigned int index = (unsigned int)((ik >> 3) + 1);
+  k = -(-348 + (int)(index << 3));
+
+  return DiyFp(kCachedPowersF[index], kCachedPowersE[index]);
+}
+
+
+static void
+grisuRound (char* digits, int length, DiyFpWord delta, DiyFpWord rest,
+            DiyFpWord tenKappa, DiyFpWord distance)
+{
+  while (rest < distance && delta - rest >= tenKappa &&
+         (rest + tenKappa < distance ||
+          distance - rest > rest + tenKappa - distance))
+  {
+    digits[length - 1]--;
+    rest += tenKappa;
+  }
+}
+
+
+static int
+countDecimalDigits (unsigned int n)
+{
+  int count = 1;
+
+  while (n >= 10)
+  {
+    n /= 10;
+    count++;
+  }
+
+  return count;
+}
+
+
+/*
+ * Generates the digits of w, as few as needed to stay within delta of the
+ * upper boundary high, and adds the exponent of the last one to k.  Sets
+ * close if fewer digits missed that by less than the error of the
+ * boundaries, so that they could have been enough after all.
+ */
+static int
+generateDigits (const DiyFp& w, const DiyFp& high, DiyFpWord delta,
+                char* digits, int& k, bool& close)
+{
+  static const DiyFpWord kPow10[] =
+  {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+  };
+
+  const DiyFp     one(1ULL << -high.e, high.e);
+  const DiyFpWord distance = diyFpMinus(high, w).f;
+
+  unsigned int p1 = (unsigned int)(high.f >> -one.e);
+  DiyFpWord    p2 = high.f & (one.f - 1);
+  int          kappa  = countDecimalDigits(p1);
+  int          length = 0;
+  DiyFpWord    unit   = 1;
+
+  close = false;
+
+  while (kappa > 0)
+  {
+    unsigned int divisor = (unsigned int)kPow10[kappa - 1];
+    unsigned int d = p1 / divisor;
+    p1 %= divisor;
+
+    if (d != 0 || length != 0) digits[length++] = (char)('0' + d);
+    kappa--;
+
+    DiyFpWord rest = ((DiyFpWord)p1 << -one.e) + p2;
+    if (rest <= delta)
+    {
+      k += kappa;
+      grisuRound(digits, length, delta, rest,
+                 kPow10[kappa] << -one.e, distance);
+      return length;
+    }
+
+    const DiyFpWord tenKappa = kPow10[kappa] << -one.e;
+    if (length != 0 &&
+        (rest - delta <= 8 * unit || tenKappa - rest <= 8 * unit))
+    {
+      close = true;
+    }
+  }
+
+  for (;;)
+  {
+    p2    *= 10;
+    delta *= 10;
+    unit  *= 10;
+
+    char d = (char)(p2 >> -one.e);
+    if (d != 0 || length != 0) digits[length++] = (char)('0' + d);
+
+    p2 &= one.f - 1;
+    kappa--;
+
+    if (p2 < delta)
+    {
+      k += kappa;
+      int index = -kappa;
+      grisuRound(digits, length, delta, p2, one.f,
+                 distance * (index < 20 ? kPow10[index] : 0));
+      return length;
+    }
+
+    if (length != 0 &&
+        (p2 - delta <= 8 * unit || one.f - p2 <= 8 * unit))
+    {
+      close = true;
+    }
+  }
+}
+
+
+/*
+ * Writes the shortest digits of the finite, positive value into digits,
+ * with no trailing zeros, sets k to the exponent of the last digit and
+ * returns the number of digits, at most 17.  Sets close if fewer digits
+ * could do, see generateDigits().
+ */
+static int
+grisu2 (double value, char* digits, int& k, bool& close)
+{
+  DiyFpWord bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const int biasedE = (int)((bits >> 52) & 0x7FF);
+  DiyFp v(bits & kFractionMask, -1074);
+  if (biasedE != 0)
+  {
+    v.f += kHiddenBit;
+    v.e  = biasedE - 1075;
+  }
+
+  /* the boundaries halfway to the neighbouring doubles */
+  DiyFp high = DiyFp((v.f << 1) + 1, v.e - 1);
+  while ((high.f & (kHiddenBit << 1)) == 0)
+  {
+    high.f <<= 1;
+    high.e--;
+  }
+  high.f <<= 64 - 52 - 2;
+  high.e  -= 64 - 52 - 2;
+
+  DiyFp low = (v.f == kHiddenBit) ? DiyFp((v.f << 2) - 1, v.e - 2)
+                                  : DiyFp((v.f << 1) - 1, v.e - 1);
+  low.f <<= low.e - high.e;
+  low.e   = high.e;
+
+  const DiyFp c = getCachedPower(high.e, k);
+  const DiyFp w = diyFpMultiply(diyFpNormalize(v), c);
+
+  DiyFp scaledHigh = diyFpMultiply(high, c);
+  DiyFp scaledLow  = diyFpMultiply(low, c);
+  scaledHigh.f--;
+  scaledLow.f++;
+
+  int length = generateDigits(w, scaledHigh, scaledHigh.f - scaledLow.f,
+                              digits, k, close);
+
+  while (length > 1 && digits[length - 1] == '0')
+  {
+    length--;
+    k++;
+  }
+
+  return length;
+}
+
+
+/*
+ * Writes into rounded the first places digits, rounded up if roundUp is
+ * true, followed by the exponent of the last one.  The digits are given
+ * to strtod() as an integer and an exponent, which does not depend on the
+ * locale.  Returns the exponent.
+ */
+static int
+writeRounded (char* rounded, const char* digits, int places, int k,
+              bool roundUp)
+{
+  memcpy(rounded, digits, places);
+
+  if (roundUp)
+  {
+    int i = places - 1;
+    while (i >= 0 && rounded[i] == '9')
+    {
+      rounded[i--] = '0';
+    }
+
+    if (i >= 0)
+    {
+      rounded[i]++;
+    }
+    else
+    {
+      rounded[0] = '1';
+      k++;
+    }
+  }
+
+  sprintf(rounded + places, "e%d", k);
+  return k;
+}
+
+
+/*
+ * Grisu2 may give 16 or 17 digits where fewer would do, for values like
+ * 1e23 close to a short decimal.  Such a decimal is one of the digits
+ * rounded to 15 or 16 places, which is kept if strtod() reads it back as
+ * value.
+ */
+static int
+shortenDigits (double value, char* digits, int length, int& k)
+{
+  for (int places = LIBSBML_DOUBLE_PRECISION; places < length; ++places)
+  {
+    const bool nearestUp = digits[places] >= '5';
+
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+      char rounded[32];
+      int  roundedK = writeRounded(rounded, digits, places,
+                                   k + length - places,
+                                   attempt == 0 ? nearestUp : !nearestUp);
+
+      if (strtod(rounded, NULL) == value)
+      {
+        int roundedLength = places;
+        while (roundedLength > 1 && rounded[roundedLength - 1] == '0')
+        {
+          roundedLength--;
+          roundedK++;
+        }
+
+        memcpy(digits, rounded, roundedLength);
+        k = roundedK;
+        return roundedLength;
+      }
+    }
+  }
+
+  return length;
+}
+
+
+LIBSBML_EXTERN
+int
+util_formatDouble (char *str, double value, int shortest)
+{
+  char* s = str;
+
+  if (value != value)
+  {
+    strcpy(str, "NaN");
+    return 3;
+  }
+  else if (value - value != 0)
+  {
+    strcpy(str, value > 0 ? "INF" : "-INF");
+    return value > 0 ? 3 : 4;
+  }
+  else if (!shortest)
+  {
+    int length = sprintf(str, "%.*g", LIBSBML_DOUBLE_PRECISION, value);
+
+    /* undoes the decimal point of the locale, which is a single char */
+    const char point = localeconv()->decimal_point[0];
+    if (point != '.')
+    {
+      for (int i = 0; i < length; ++i)
+      {
+        if (str[i] == point) str[i] = '.';
+      }
+    }
+
+    return length;
+  }
+
+  if (value < 0 || (value == 0 && 1 / value < 0))
+  {
+    *s++  = '-';
+    value = -value;
+  }
+
+  if (value == 0)
+  {
+    *s++ = '0';
+    *s   = '\0';
+    return (int)(s - str);
+  }
+
+  char digits[20];
+  int  k;
+  bool close;
+  int  length   = grisu2(value, digits, k, close);
+  if (close && length > LIBSBML_DOUBLE_PRECISION)
+  {
+    length = shortenDigits(value, digits, length, k);
+  }
+
+  int  exponent = length + k - 1;
+
+  /* the choice between the forms of printf("%.15g") */
+  int  precision = length > LIBSBML_DOUBLE_PRECISION ?
+                   length : LIBSBML_DOUBLE_PRECISION;
+
+  if (exponent < -4 || exponent >= precision)
+  {
+    *s++ = digits[0];
+    if (length > 1)
+    {
+      *s++ = '.';
+      memcpy(s, digits + 1, length - 1);
+      s += length - 1;
+    }
+
+    *s++ = 'e';
+    *s++ = exponent < 0 ? '-' : '+';
+    if (exponent < 0) exponent = -exponent;
+    if (exponent >= 100) *s++ = (char)('0' + exponent / 100);
+    *s++ = (char)('0' + exponent / 10 % 10);
+    *s++ = (char)('0' + exponent % 10);
+  }
+  else if (exponent >= 0)
+  {
+    if (length <= exponent + 1)
+    {
+      memcpy(s, digits, length);
+      s += length;
+      for (int i = length; i <= exponent; ++i) *s++ = '0';
+    }
+    else
+    {
+      memcpy(s, digits, exponent + 1);
+      s += exponent + 1;
+      *s++ = '.';
+      memcpy(s, digits + exponent + 1, length - exponent - 1);
+      s += length - exponent - 1;
+    }
+  }
+  else
+  {
+    *s++ = '0';
+    *s++ = '.';
+    for (int i = -1; i > exponent; --i) *s++ = '0';
+    memcpy(s, digits, length);
+    s += length;
+  }
+
+  *s = '\0';
+  return (int)(s - str);
+}
+
+
 LIBSBML_EXTERN
 FILE *
 safe_fopen (const char *filename, const char *mode)
@@ -112,6 +112,23 @@ double
 c_locale_strtod (const char *nptr, char **endptr);
 
 
+/**
+ * Writes @p value into @p str, which must have room for 32 characters, as
+ * printf("%.15g") would in the "C" locale, or as "NaN", "INF" or "-INF".
+ *
+ * If @p shortest is nonzero, the value is written with as many significant
+ * digits as strtod() needs to read it back exactly, up to 17, instead of
+ * always rounding it to 15.  For normal values that 15 digits are enough
+ * for, this is the same as printf("%.15g").
+ *
+ * @return the number of characters written, not counting the terminating
+ * NUL.
+ */
+LIBSBML_EXTERN
+int
+util_formatDouble (char *str, double value, int shortest);
+
+
 /**
  * Attempts to open filename for the given access mode and return a pointer
  * to it.  If the filename could not be opened, prints an error message and
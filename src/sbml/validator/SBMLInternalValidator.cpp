@@ -70,6 +70,16 @@
 #include <sbml/AlgebraicRule.h>
 #include <sbml/AssignmentRule.h>
 #include <sbml/RateRule.h>
+#include <sbml/SBO.h>
+#include <sbml/util/IdIndex.h>
+
+#if defined(LIBSBML_WITH_PARALLEL_VALIDATION) && \
+    ((__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900))
+#define LIBSBML_VALIDATE_CONCURRENTLY 1
+#include <atomic>
+#include <exception>
+#include <thread>
+#endif
 
 
 
@@ -78,10 +88,189 @@ using namespace std;
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Runs the validators used by checkConsistency().
+ *
+ * The validators passed to add() become pending.  When the result of a
+ * pending validator is asked for with validate(), all the pending
+ * validators are run at once: in a single traversal of the document if
+ * the run is fused, or else each on a thread of its own if the run is
+ * concurrent.  Otherwise validate() simply runs the validator it is given.
+ */
+class ConsistencyRun
+{
+public:
+
+  ConsistencyRun (SBMLDocument& doc, bool concurrent, bool fused)
+    : mDocument(doc)
+    , mConcurrent(false)
+    , mFused(fused)
+  {
+#ifdef LIBSBML_VALIDATE_CONCURRENTLY
+    mConcurrent = !fused && concurrent
+                  && std::thread::hardware_concurrency() > 1;
+#else
+    (void)concurrent;
+#endif
+  }
+
+
+  void add (Validator& validator)
+  {
+    validator.init();
+    if (mConcurrent || mFused)
+    {
+      mPending.push_back(&validator);
+    }
+  }
+
+
+  unsigned int validate (Validator& validator)
+  {
+    if (find(mPending.begin(), mPending.end(), &validator) != mPending.end())
+    {
+      if (mFused)
+      {
+        runFused();
+      }
+#ifdef LIBSBML_VALIDATE_CONCURRENTLY
+      else
+      {
+        runPending();
+      }
+#endif
+    }
+
+    map<const Validator*, unsigned int>::const_iterator it =
+      mErrors.find(&validator);
+
+    return (it != mErrors.end()) ? it->second : validator.validate(mDocument);
+  }
+
+
+private:
+
+  void runFused ()
+  {
+    vector<Validator*> pending;
+    pending.swap(mPending);
+
+    Validator::validate(mDocument, pending);
+    for (size_t n = 0; n < pending.size(); ++n)
+    {
+      mErrors[pending[n]] = (unsigned int)pending[n]->getFailures().size();
+    }
+  }
+
+
+#ifdef LIBSBML_VALIDATE_CONCURRENTLY
+  /*
+   * Lookups update the indexes of the ids of the document and the
+   * formula units data of the model is computed on first use, so both are
+   * brought up to date before the document is shared between threads.
+   */
+  void prepareDocument ()
+  {
+    bool needsUnits = false;
+    for (size_t n = 0; n < mPending.size(); ++n)
+    {
+      unsigned int category = mPending[n]->getCategory();
+      needsUnits = needsUnits
+                   || category == LIBSBML_CAT_UNITS_CONSISTENCY
+                   || category == LIBSBML_CAT_MODELING_PRACTICE
+                   || category == LIBSBML_CAT_OVERDETERMINED_MODEL;
+    }
+
+    Model* m = mDocument.getModel();
+    if (needsUnits && m != NULL && !m->isPopulatedListFormulaUnitsData())
+    {
+      m->populateListFormulaUnitsData();
+    }
+
+    mDocument.buildIdIndexes();
+
+    /* the SBO tree is loaded by the first query */
+    SBO::isQuantitativeParameter(0);
+  }
+
+
+  void runPending ()
+  {
+    prepareDocument();
+
+    vector<unsigned int> errors(mPending.size(), 0);
+    vector<std::exception_ptr> exceptions(mPending.size());
+    std::atomic<size_t> next(0);
+
+    auto work = [&]()
+    {
+      IdIndex::ReadOnlyScope readOnly;
+      for (size_t n = next++; n < mPending.size(); n = next++)
+      {
+        try
+        {
+          errors[n] = mPending[n]->validate(mDocument);
+        }
+        catch (...)
+        {
+          exceptions[n] = std::current_exception();
+        }
+      }
+    };
+
+    /* this thread takes its share of the validators too */
+    vector<std::thread> threads;
+    for (size_t t = 1; t < mPending.size(); ++t)
+    {
+      try
+      {
+        threads.push_back(std::thread(work));
+      }
+      catch (const std::exception&)
+      {
+        break;
+      }
+    }
+    work();
+    for (size_t t = 0; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
+
+    vector<Validator*> pending;
+    pending.swap(mPending);
+    for (size_t n = 0; n < pending.size(); ++n)
+    {
+      if (exceptions[n])
+      {
+        std::rethrow_exception(exceptions[n]);
+      }
+      mErrors[pending[n]] = errors[n];
+    }
+  }
+#endif
+
+
+  SBMLDocument&                        mDocument;
+  bool                                 mConcurrent;
+  bool                                 mFused;
+  vector<Validator*>                   mPending;
+  map<const Validator*, unsigned int>  mErrors;
+};
+/** @endcond */
+
+
 SBMLInternalValidator::SBMLInternalValidator() 
   : SBMLValidator()
   , mApplicableValidators(0)
   , mApplicableValidatorsForConversion(0)
+#ifdef LIBSBML_VALIDATE_CONCURRENTLY
+  , mParallelValidation(true)
+#else
+  , mParallelValidation(false)
+#endif
+  , mFusedValidation(false)
 {
 
 }
@@ -91,6 +280,8 @@ SBMLInternalValidator::SBMLInternalValidator(const SBMLInternalValidator& orig)
   : SBMLValidator(orig)
   , mApplicableValidators(orig.mApplicableValidators)
   , mApplicableValidatorsForConversion(orig.mApplicableValidatorsForConversion)
+  , mParallelValidation(orig.mParallelValidation)
+  , mFusedValidation(orig.mFusedValidation)
 {
 }
 
@@ -350,6 +541,10 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
   else
   {
     doc = getDocument();
+
+    /* notes and annotations left to be read when first used are read now,
+     * so that their errors are known before the validators run */
+    doc->readDeferredElements(true);
   }
 
   /* calls each specified validator in turn 
@@ -371,12 +566,27 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
     return 0;
   }
 
+  /* the validators may be run concurrently or in a single traversal,
+   * in two batches since unit checks may crash if there have been math
+   * errors; their failures are logged below in the same order either way */
+  ConsistencyRun run(*doc, mParallelValidation, mFusedValidation);
+
+  IdentifierConsistencyValidator id_validator;
+  ConsistencyValidator validator;
+  SBOConsistencyValidator sbo_validator;
+  MathMLConsistencyValidator math_validator;
+  UnitConsistencyValidator unit_validator;
+  OverdeterminedValidator over_validator;
+  ModelingPracticeValidator practice_validator;
+
+  if (id)   run.add(id_validator);
+  if (sbml) run.add(validator);
+  if (sbo)  run.add(sbo_validator);
+  if (math) run.add(math_validator);
 
   if (id)
   {
-    IdentifierConsistencyValidator id_validator;
-    id_validator.init();
-    nerrors = id_validator.validate(*doc);
+    nerrors = run.validate(id_validator);
     if (nerrors > 0) 
     {
       unsigned int origNum = log->getNumErrors();
@@ -431,9 +641,7 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
 
   if (sbml)
   {
-    ConsistencyValidator validator;
-    validator.init();
-    nerrors = validator.validate(*doc);
+    nerrors = run.validate(validator);
     total_errors += nerrors;
     if (nerrors > 0) 
     {
@@ -450,9 +658,7 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
 
   if (sbo)
   {
-    SBOConsistencyValidator sbo_validator;
-    sbo_validator.init();
-    nerrors = sbo_validator.validate(*doc);
+    nerrors = run.validate(sbo_validator);
     total_errors += nerrors;
     if (nerrors > 0) 
     {
@@ -469,9 +675,7 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
 
   if (math)
   {
-    MathMLConsistencyValidator math_validator;
-    math_validator.init();
-    nerrors = math_validator.validate(*doc);
+    nerrors = run.validate(math_validator);
     total_errors += nerrors;
     if (nerrors > 0) 
     {
@@ -486,11 +690,13 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
   }
 
 
+  if (units)    run.add(unit_validator);
+  if (over)     run.add(over_validator);
+  if (practice) run.add(practice_validator);
+
   if (units)
   {
-    UnitConsistencyValidator unit_validator;
-    unit_validator.init();
-    nerrors = unit_validator.validate(*doc);
+    nerrors = run.validate(unit_validator);
     total_errors += nerrors;
     if (nerrors > 0) 
     {
@@ -509,9 +715,7 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
    * changed this as would have bailed */
   if (over)
   {
-    OverdeterminedValidator over_validator;
-    over_validator.init();
-    nerrors = over_validator.validate(*doc);
+    nerrors = run.validate(over_validator);
     total_errors += nerrors;
     if (nerrors > 0) 
     {
@@ -528,9 +732,7 @@ SBMLInternalValidator::checkConsistency (bool writeDocument)
 
   if (practice)
   {
-    ModelingPracticeValidator practice_validator;
-    practice_validator.init();
-    nerrors = practice_validator.validate(*doc);
+    nerrors = run.validate(practice_validator);
     if (nerrors > 0) 
     {
       unsigned int errorsAdded = 0;
@@ -810,6 +1012,38 @@ SBMLInternalValidator::setConversionValidators(unsigned char appl)
   mApplicableValidatorsForConversion = appl;
 }
 
+
+void
+SBMLInternalValidator::setParallelValidation(bool parallel)
+{
+#ifdef LIBSBML_VALIDATE_CONCURRENTLY
+  mParallelValidation = parallel;
+#else
+  (void)parallel;
+#endif
+}
+
+
+bool
+SBMLInternalValidator::getParallelValidation() const
+{
+  return mParallelValidation;
+}
+
+
+void
+SBMLInternalValidator::setFusedValidation(bool fused)
+{
+  mFusedValidation = fused;
+}
+
+
+bool
+SBMLInternalValidator::getFusedValidation() const
+{
+  return mFusedValidation;
+}
+
 unsigned int 
   SBMLInternalValidator::validate()
 {
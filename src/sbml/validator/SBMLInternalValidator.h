@@ -465,6 +465,56 @@ public:
   void setConversionValidators(unsigned char appl);
 
 
+  /**
+   * Sets whether checkConsistency() may run the validators of the enabled
+   * categories concurrently.
+   *
+   * This is only possible if libSBML was built with the option
+   * @c WITH_PARALLEL_VALIDATION, in which case it is the default.  The
+   * validators are then run on separate threads, the failures they
+   * report are logged in the same order as when they are run one after
+   * the other, and the document must not be changed by another thread
+   * meanwhile.
+   *
+   * @param parallel @c true to allow the validators to run concurrently,
+   * @c false to run them one after the other.
+   */
+  void setParallelValidation(bool parallel);
+
+
+  /**
+   * Returns @c true if checkConsistency() runs the validators of the
+   * enabled categories concurrently (see setParallelValidation()).
+   */
+  bool getParallelValidation() const;
+
+
+  /**
+   * Sets whether checkConsistency() applies the constraints of the
+   * enabled categories in a single traversal of the document.
+   *
+   * The categories are still checked in two batches (the identifier,
+   * general, SBO and MathML checks, then the others, only if the former
+   * did not stop checkConsistency()), and each failure is attributed to
+   * its category and logged in the same order as when the categories are
+   * checked one after the other.  The constraints of a category whose
+   * failures are not logged because of errors found in an earlier one
+   * are applied all the same.  A fused traversal is not run concurrently
+   * (see setParallelValidation()).
+   *
+   * @param fused @c true to check the categories of a batch in a single
+   * traversal, @c false to traverse the document for each category.
+   */
+  void setFusedValidation(bool fused);
+
+
+  /**
+   * Returns @c true if checkConsistency() checks the enabled categories
+   * in a single traversal (see setFusedValidation()).
+   */
+  bool getFusedValidation() const;
+
+
   /**
    * Constructor.
    */
@@ -509,6 +559,8 @@ protected:
   /** @cond doxygenLibsbmlInternal */
   unsigned char mApplicableValidators;
   unsigned char mApplicableValidatorsForConversion;
+  bool mParallelValidation;
+  bool mFusedValidation;
 
   /** @endcond */
 
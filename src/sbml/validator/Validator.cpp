@@ -116,6 +116,16 @@ public:
     constraints.push_back(c);
   }
 
+  /*
+   * Adds the Constraints of the given ConstraintSet to this one, after
+   * those already present.
+   */
+  void add (const ConstraintSet<T>& other)
+  {
+    constraints.insert(constraints.end(),
+                       other.constraints.begin(), other.constraints.end());
+  }
+
   /*
    * Applies all Constraints in this ConstraintSet to the given SBML object
    * of type T.  Constraint violations are logged to Validator.
@@ -194,6 +204,7 @@ struct ValidatorConstraints
 
   ~ValidatorConstraints ();
   void add (VConstraint* c);
+  void add (const ValidatorConstraints& other);
 };
 
 /*
@@ -217,6 +228,44 @@ ValidatorConstraints::~ValidatorConstraints ()
 }
 
 
+/*
+ * Adds the Constraints of other to the matching ConstraintSets, after
+ * those already present.  They remain owned by other.
+ */
+void
+ValidatorConstraints::add (const ValidatorConstraints& other)
+{
+  mSBMLDocument             .add(other.mSBMLDocument);
+  mModel                    .add(other.mModel);
+  mFunctionDefinition       .add(other.mFunctionDefinition);
+  mUnitDefinition           .add(other.mUnitDefinition);
+  mUnit                     .add(other.mUnit);
+  mCompartment              .add(other.mCompartment);
+  mSpecies                  .add(other.mSpecies);
+  mParameter                .add(other.mParameter);
+  mRule                     .add(other.mRule);
+  mAlgebraicRule            .add(other.mAlgebraicRule);
+  mAssignmentRule           .add(other.mAssignmentRule);
+  mRateRule                 .add(other.mRateRule);
+  mReaction                 .add(other.mReaction);
+  mKineticLaw               .add(other.mKineticLaw);
+  mSimpleSpeciesReference   .add(other.mSimpleSpeciesReference);
+  mSpeciesReference         .add(other.mSpeciesReference);
+  mModifierSpeciesReference .add(other.mModifierSpeciesReference);
+  mStoichiometryMath        .add(other.mStoichiometryMath);
+  mEvent                    .add(other.mEvent);
+  mEventAssignment          .add(other.mEventAssignment);
+  mInitialAssignment        .add(other.mInitialAssignment);
+  mConstraint               .add(other.mConstraint);
+  mTrigger                  .add(other.mTrigger);
+  mDelay                    .add(other.mDelay);
+  mCompartmentType          .add(other.mCompartmentType);
+  mSpeciesType              .add(other.mSpeciesType);
+  mPriority                 .add(other.mPriority);
+  mLocalParameter           .add(other.mLocalParameter);
+}
+
+
 /*
  * Adds the given Contraint to the appropriate ConstraintSet.
  */
@@ -435,36 +484,38 @@ ValidatorConstraints::add (VConstraint* c)
  * appropriate visit() method for the object visited.
  *
  * A ValidatingVisitor overrides each visit method to validate the given
- * SBML object.
+ * SBML object.  The constraints it applies may come from several
+ * Validators, each of which logs the failures of its own constraints.
  */
 class ValidatingVisitor: public SBMLVisitor
 {
 public:
 
-  ValidatingVisitor (Validator& validator, const Model& model) : v(validator), m(model) { }
+  ValidatingVisitor (ValidatorConstraints& constraints, const Model& model)
+    : c(constraints), m(model) { }
 
   using SBMLVisitor::visit;
 
   void visit (const SBMLDocument& x)
   {
-    v.mConstraints->mSBMLDocument.applyTo(m, x);
+    c.mSBMLDocument.applyTo(m, x);
   }
 
 
   void visit (const Model& x)
   {
-    v.mConstraints->mModel.applyTo(m, x);
+    c.mModel.applyTo(m, x);
   }
 
 
   void visit (const KineticLaw& x)
   {
-    v.mConstraints->mKineticLaw.applyTo(m, x);
+    c.mKineticLaw.applyTo(m, x);
   }
 
   void visit (const Priority& x)
   {
-    v.mConstraints->mPriority.applyTo(m, x);
+    c.mPriority.applyTo(m, x);
   }
 
 
@@ -479,8 +530,8 @@ public:
 
   bool visit (const FunctionDefinition& x)
   {
-    v.mConstraints->mFunctionDefinition.applyTo(m, x);
-    return !v.mConstraints->mFunctionDefinition.empty();
+    c.mFunctionDefinition.applyTo(m, x);
+    return !c.mFunctionDefinition.empty();
   }
 
 
@@ -493,32 +544,32 @@ public:
 
   bool visit (const UnitDefinition& x)
   {
-    v.mConstraints->mUnitDefinition.applyTo(m, x);
+    c.mUnitDefinition.applyTo(m, x);
 
     return
-      !v.mConstraints->mUnitDefinition.empty() ||
-      !v.mConstraints->mUnit          .empty();
+      !c.mUnitDefinition.empty() ||
+      !c.mUnit          .empty();
   }
 
 
   bool visit (const Unit& x)
   {
-    v.mConstraints->mUnit.applyTo(m, x);
-    return !v.mConstraints->mUnit.empty();
+    c.mUnit.applyTo(m, x);
+    return !c.mUnit.empty();
   }
 
 
   bool visit (const Compartment &x)
   {
-    v.mConstraints->mCompartment.applyTo(m, x);
-    return !v.mConstraints->mCompartment.empty();
+    c.mCompartment.applyTo(m, x);
+    return !c.mCompartment.empty();
   }
 
 
   bool visit (const Species& x)
   {
-    v.mConstraints->mSpecies.applyTo(m, x);
-    return !v.mConstraints->mSpecies.empty();
+    c.mSpecies.applyTo(m, x);
+    return !c.mSpecies.empty();
   }
 
 
@@ -530,8 +581,8 @@ public:
     }
     else
     {
-      v.mConstraints->mParameter.applyTo(m, x);
-      return !v.mConstraints->mParameter.empty();
+      c.mParameter.applyTo(m, x);
+      return !c.mParameter.empty();
     }
 
   }
@@ -539,7 +590,7 @@ public:
 
   bool visit (const Rule& x)
   {
-    v.mConstraints->mRule.applyTo(m, x);
+    c.mRule.applyTo(m, x);
     return true;
   }
 
@@ -547,7 +598,7 @@ public:
   bool visit (const AlgebraicRule& x)
   {
     visit( static_cast<const Rule&>(x) );
-    v.mConstraints->mAlgebraicRule.applyTo(m, x);
+    c.mAlgebraicRule.applyTo(m, x);
 
     return true;
   }
@@ -556,7 +607,7 @@ public:
   bool visit (const AssignmentRule& x)
   {
     visit( static_cast<const Rule&>(x) );
-    v.mConstraints->mAssignmentRule.applyTo(m, x);
+    c.mAssignmentRule.applyTo(m, x);
 
     return true;
   }
@@ -565,7 +616,7 @@ public:
   bool visit (const RateRule& x)
   {
     visit( static_cast<const Rule&>(x) );
-    v.mConstraints->mRateRule.applyTo(m, x);
+    c.mRateRule.applyTo(m, x);
 
     return true;
   }
@@ -573,14 +624,14 @@ public:
 
   bool visit (const Reaction& x)
   {
-    v.mConstraints->mReaction.applyTo(m, x);
+    c.mReaction.applyTo(m, x);
     return true;
   }
 
 
   bool visit (const SimpleSpeciesReference& x)
   {
-    v.mConstraints->mSimpleSpeciesReference.applyTo(m, x);
+    c.mSimpleSpeciesReference.applyTo(m, x);
     return true;
   }
 
@@ -588,97 +639,97 @@ public:
   bool visit (const SpeciesReference& x)
   {
     visit( static_cast<const SimpleSpeciesReference&>(x) );
-    v.mConstraints->mSpeciesReference.applyTo(m, x);
+    c.mSpeciesReference.applyTo(m, x);
 
     return
-      !v.mConstraints->mSimpleSpeciesReference.empty() ||
-      !v.mConstraints->mSpeciesReference      .empty();
+      !c.mSimpleSpeciesReference.empty() ||
+      !c.mSpeciesReference      .empty();
   }
 
 
   bool visit (const ModifierSpeciesReference& x)
   {
     visit( static_cast<const SimpleSpeciesReference&>(x) );
-    v.mConstraints->mModifierSpeciesReference.applyTo(m, x);
+    c.mModifierSpeciesReference.applyTo(m, x);
 
     return
-      !v.mConstraints->mSimpleSpeciesReference  .empty() ||
-      !v.mConstraints->mModifierSpeciesReference.empty();
+      !c.mSimpleSpeciesReference  .empty() ||
+      !c.mModifierSpeciesReference.empty();
   }
 
   bool visit(const StoichiometryMath& x)
   {
-    v.mConstraints->mStoichiometryMath.applyTo(m, x);
+    c.mStoichiometryMath.applyTo(m, x);
 
     return
-      !v.mConstraints->mStoichiometryMath.empty();
+      !c.mStoichiometryMath.empty();
   }
 
 
 
   bool visit (const Event& x)
   {
-    v.mConstraints->mEvent.applyTo(m, x);
+    c.mEvent.applyTo(m, x);
 
     return
-      !v.mConstraints->mEvent          .empty() ||
-      !v.mConstraints->mEventAssignment.empty();
+      !c.mEvent          .empty() ||
+      !c.mEventAssignment.empty();
   }
 
 
   bool visit (const EventAssignment& x)
   {
-    v.mConstraints->mEventAssignment.applyTo(m, x);
-    return !v.mConstraints->mEventAssignment.empty();
+    c.mEventAssignment.applyTo(m, x);
+    return !c.mEventAssignment.empty();
   }
 
   bool visit (const InitialAssignment& x)
   {
-    v.mConstraints->mInitialAssignment.applyTo(m, x);
-    return !v.mConstraints->mInitialAssignment.empty();
+    c.mInitialAssignment.applyTo(m, x);
+    return !c.mInitialAssignment.empty();
   }
 
   bool visit (const Constraint& x)
   {
-    v.mConstraints->mConstraint.applyTo(m, x);
-    return !v.mConstraints->mConstraint.empty();
+    c.mConstraint.applyTo(m, x);
+    return !c.mConstraint.empty();
   }
 
   bool visit (const Trigger& x)
   {
-    v.mConstraints->mTrigger.applyTo(m, x);
-    return !v.mConstraints->mTrigger.empty();
+    c.mTrigger.applyTo(m, x);
+    return !c.mTrigger.empty();
   }
 
   bool visit (const Delay& x)
   {
-    v.mConstraints->mDelay.applyTo(m, x);
-    return !v.mConstraints->mDelay.empty();
+    c.mDelay.applyTo(m, x);
+    return !c.mDelay.empty();
   }
 
   bool visit (const CompartmentType& x)
   {
-    v.mConstraints->mCompartmentType.applyTo(m, x);
-    return !v.mConstraints->mCompartmentType.empty();
+    c.mCompartmentType.applyTo(m, x);
+    return !c.mCompartmentType.empty();
   }
 
   bool visit (const SpeciesType& x)
   {
-    v.mConstraints->mSpeciesType.applyTo(m, x);
-    return !v.mConstraints->mSpeciesType.empty();
+    c.mSpeciesType.applyTo(m, x);
+    return !c.mSpeciesType.empty();
   }
 
   bool visit (const LocalParameter& x)
   {
-    v.mConstraints->mLocalParameter.applyTo(m, x);
-    return !v.mConstraints->mLocalParameter.empty();
+    c.mLocalParameter.applyTo(m, x);
+    return !c.mLocalParameter.empty();
   }
 
 protected:
 
   /** @cond doxygenLibsbmlInternal */
-  Validator&   v;
-  const Model& m;
+  ValidatorConstraints& c;
+  const Model&          m;
   /** @endcond */
 };
 
@@ -860,22 +911,70 @@ private:
 unsigned int
 Validator::validate (const SBMLDocument& d)
 {
+  std::vector<Validator*> validators(1, this);
+  return validate(d, validators);
+}
+
+
+/*
+ * Validates the given SBMLDocument with each of the given Validators in
+ * a single traversal.  Each Validator logs the failures of its own
+ * constraints.
+ *
+ * @return the total number of validation errors that occurred.
+ */
+unsigned int
+Validator::validate (const SBMLDocument& d,
+                     const std::vector<Validator*>& validators)
+{
+  if (validators.empty()) return 0;
+
   Model* m = const_cast<SBMLDocument&>(d).getModel();
 
   if (m != NULL)
   {
-    if (this->getCategory() == LIBSBML_CAT_UNITS_CONSISTENCY)
+    ValidatorConstraints fused;
+
+    for (size_t n = 0; n < validators.size(); ++n)
     {
-      /* create list of formula units for validation */
-      if (!m->isPopulatedListFormulaUnitsData())
+      if (validators[n]->getCategory() == LIBSBML_CAT_UNITS_CONSISTENCY)
       {
-        m->populateListFormulaUnitsData();
+        /* create list of formula units for validation */
+        if (!m->isPopulatedListFormulaUnitsData())
+        {
+          m->populateListFormulaUnitsData();
+        }
+      }
+
+      if (validators.size() > 1)
+      {
+        fused.add(*validators[n]->mConstraints);
       }
     }
-    ValidatingVisitor vv(*this, *m);
+
+    ValidatingVisitor vv(validators.size() > 1 ? fused
+                                               : *validators[0]->mConstraints,
+                         *m);
     d.accept(vv);
   }
 
+  unsigned int total = 0;
+  for (size_t n = 0; n < validators.size(); ++n)
+  {
+    validators[n]->filterFailures();
+    total += (unsigned int)validators[n]->mFailures.size();
+  }
+
+  return total;
+}
+
+
+/*
+ * Removes the failures that are not reliable given the others.
+ */
+void
+Validator::filterFailures ()
+{
   if (this->getCategory() == LIBSBML_CAT_SBO_CONSISTENCY
       && mFailures.size() > 1)
   {
@@ -905,8 +1004,6 @@ Validator::validate (const SBMLDocument& d)
       //remove_if(mFailures.begin(), mFailures.end(), DontMatchId(99701));
     }
   }
-
-  return (unsigned int)mFailures.size();
 }
 
 
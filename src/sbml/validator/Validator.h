@@ -75,6 +75,7 @@
 /** @cond doxygenLibsbmlInternal */
 #include <list>
 #include <string>
+#include <vector>
 /** @endcond */
 
 
@@ -192,6 +193,27 @@ public:
    */
   virtual unsigned int validate (const std::string& filename);
 
+
+  /**
+   * Validates the given SBML document with each of the given validators,
+   * in a single traversal of the document.
+   *
+   * The constraints of all the validators are applied to each object of
+   * the document in turn, and each validator logs the failures of its own
+   * constraints, in the order in which it would log them if it validated
+   * the document by itself.  Validators that override
+   * validate(const SBMLDocument& d) must not be passed to this method.
+   *
+   * @param d the SBMLDocument object to be validated.
+   * @param validators the validators to apply, initialized with init().
+   *
+   * @return the total number of validation failures that occurred.  The
+   * objects describing the actual failures can be retrieved using
+   * getFailures() on each validator.
+   */
+  static unsigned int validate (const SBMLDocument& d,
+                                const std::vector<Validator*>& validators);
+
     /** @cond doxygenLibsbmlInternal */
 
     unsigned int getConsistencyLevel();
@@ -202,15 +224,20 @@ public:
 
 protected:
   /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Removes the failures that are not reliable given the others; called
+   * once the document has been traversed.
+   */
+  void filterFailures ();
+
+
   ValidatorConstraints* mConstraints;
   std::list<SBMLError>  mFailures;
   unsigned int          mCategory;
   unsigned int          mConsistencyLevel;
   unsigned int          mConsistencyVersion;
 
-
-  friend class ValidatingVisitor;
-
   /** @endcond */
 };
 
@@ -44,7 +44,7 @@
 #include "UniqueMetaId.h"
 #include <sbml/SBMLDocument.h>
 #include <sbml/ModifierSpeciesReference.h>
-#include <sbml/util/MetaIdFilter.h>
+#include <sbml/util/IdIndex.h>
 
 /** @cond doxygenIgnored */
 using namespace std;
@@ -61,7 +61,10 @@ static const char* PREAMBLE =
 /*
  * Creates a new UniqueMetaId with the given constraint id.
  */
-UniqueMetaId::UniqueMetaId (unsigned int id, Validator& v) : TConstraint<Model>(id, v)
+UniqueMetaId::UniqueMetaId (unsigned int id, Validator& v) : 
+  TConstraint<Model>(id, v)
+  , mMetaIdIndex(NULL)
+  , mOwnIndex(true)
 {
 }
 
@@ -135,26 +138,8 @@ UniqueMetaId::logIdConflict (const std::string& id, const SBase& object)
 void
 UniqueMetaId::reset ()
 {
-  mMetaIdObjectMap.clear();
-}
-
-
-/*
- * Checks that the id associated with the given object is unique.  If it
- * is not, logIdConflict is called.
- */
-void
-UniqueMetaId::doCheckMetaId (const SBase& object)
-{ 
-  if (object.isSetMetaId())
-  {
-    const string& id = object.getMetaId();
-
-    if (mMetaIdObjectMap.insert( make_pair(id, &object) ).second == false)
-    {
-      logIdConflict(id, object);
-    }
-  }
+  mMetaIdIndex = NULL;
+  mOwnIndex.reset();
 }
 
 
@@ -168,10 +153,11 @@ UniqueMetaId::doCheckMetaId (const SBase& object)
 const string
 UniqueMetaId::getMessage (const string& id, const SBase& object)
 {
-  IdObjectMap::iterator iter = mMetaIdObjectMap.find(id);
+  const SBase* found = 
+    (mMetaIdIndex != NULL) ? mMetaIdIndex->getHolder(id) : NULL;
 
 
-  if (iter == mMetaIdObjectMap.end())
+  if (found == NULL)
   {
     return
       "Internal (but non-fatal) Validator error in "
@@ -181,7 +167,7 @@ UniqueMetaId::getMessage (const string& id, const SBase& object)
 
 
   ostringstream oss_msg;
-  const SBase&  previous = *(iter->second);
+  const SBase&  previous = *found;
 
 
   //oss_msg << getPreamble();
@@ -215,19 +201,26 @@ UniqueMetaId::getMessage (const string& id, const SBase& object)
 void
 UniqueMetaId::doCheck (const Model& m)
 {
-  /* check any metaid on the sbml container */
-  doCheckMetaId(*m.getSBMLDocument());
-
-  MetaIdFilter * midFilter = new MetaIdFilter();
+  /* the index of the metaids of the document records, in document order,
+   * every element whose metaid was already taken (starting with the
+   * metaid on the sbml container) */
   SBMLDocument * d = const_cast <SBMLDocument*>(&(*m.getSBMLDocument()));
-  List * allElements = d->getAllElements(midFilter);
+  if (IdIndex::isReadOnly())
+  {
+    mOwnIndex.reset();
+    mOwnIndex.addElements(d);
+    mMetaIdIndex = &mOwnIndex;
+  }
+  else
+  {
+    mMetaIdIndex = &(d->rebuildMetaIdIndex());
+  }
 
-  for (ListIterator iter = allElements->begin(); iter != allElements->end(); ++iter)
+  const std::vector<const SBase*>& duplicates = mMetaIdIndex->getDuplicates();
+  for (unsigned int n = 0; n < duplicates.size(); ++n)
   {
-    doCheckMetaId(*(static_cast<SBase*>(*iter)));
+    logIdConflict(duplicates[n]->getMetaId(), *duplicates[n]);
   }
-  delete midFilter;
-  delete allElements;
   reset();
 }
 
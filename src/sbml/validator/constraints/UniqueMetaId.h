@@ -53,6 +53,7 @@
 #include <map>
 
 #include <sbml/validator/VConstraint.h>
+#include <sbml/util/IdIndex.h>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
@@ -168,13 +169,6 @@ protected:
    */
   virtual void check_ (const Model& m, const Model& object);
 
-  /**
-   * Checks that the id associated with the given object is unique.  If it
-   * is not, logFailure is called.
-   */
-  void doCheckMetaId (const SBase& object);
-
-
   /**
    * Returns a non-owning character pointer to the typename of the given SBase 
    * @p object, as constructed from its typecode and package.
@@ -190,8 +184,11 @@ protected:
   void logIdConflict (const std::string& id, const SBase& object);
 
 
-  typedef std::map<std::string, const SBase*> IdObjectMap;
-  IdObjectMap mMetaIdObjectMap;
+  const IdIndex* mMetaIdIndex;
+
+  /* used instead of the index of the document while other threads
+   * may be reading it */
+  IdIndex mOwnIndex;
 };
 
 LIBSBML_CPP_NAMESPACE_END
@@ -220,11 +220,24 @@ void
 ExpatHandler::startElement (const XML_Char* name, const XML_Char** attrs)
 {
   const XMLTriple       triple    ( name  );
-  const ExpatAttributes attributes( attrs, name );
-  const XMLToken        element   ( triple, attributes, mNamespaces,
+
+  if (mHandler.skipStartElement(triple.getName().c_str(),
+                                triple.getURI().c_str()))
+  {
+    mNamespaces.clear();
+    return;
+  }
+
+  ExpatAttributes       attributes( attrs, name );
+  XMLToken              element   ( triple, XMLAttributes(), XMLNamespaces(),
 			            getLine(), getColumn() );
 
-  mHandler.startElement(element);
+  //
+  // The attributes and the namespaces declared since the last start
+  // element are only needed for this token, so they are moved into it.
+  //
+  element.swapAttributes(attributes, mNamespaces);
+  mHandler.takeStartElement(element);
   mNamespaces.clear();
 }
 
@@ -277,10 +290,12 @@ ExpatHandler::endDocument ()
 void
 ExpatHandler::endElement (const XML_Char* name)
 {
+  if (mHandler.skipEndElement()) return;
+
   const XMLTriple  triple ( name );
-  const XMLToken   element( triple, getLine(), getColumn() );
+  XMLToken         element( triple, getLine(), getColumn() );
 
-  mHandler.endElement(element);
+  mHandler.takeEndElement(element);
 }
 
 
@@ -293,8 +308,10 @@ ExpatHandler::endElement (const XML_Char* name)
 void
 ExpatHandler::characters (const XML_Char* chars, int length)
 {
+  if (mHandler.isSkipping()) return;
+
   XMLToken data( string(chars, length) );
-  mHandler.characters(data);
+  mHandler.takeCharacters(data);
 }
 
 
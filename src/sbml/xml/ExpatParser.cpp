@@ -43,11 +43,13 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <climits>
 #include <iostream>
 #include <sstream>
 #include <cstring>
 
 #include <sbml/xml/XMLFileBuffer.h>
+#include <sbml/xml/XMLMappedFileBuffer.h>
 #include <sbml/xml/XMLMemoryBuffer.h>
 #include <sbml/xml/XMLErrorLog.h>
 
@@ -168,6 +170,7 @@ ExpatParser::ExpatParser (XMLHandler& handler) :
  , mHandler( mParser, handler )
  , mBuffer ( NULL )
  , mSource ( NULL )
+ , mOwnsSource ( true )
 {
   if (mParser != NULL) mBuffer = XML_GetBuffer(mParser, BUFFER_SIZE);
 }
@@ -179,7 +182,7 @@ ExpatParser::ExpatParser (XMLHandler& handler) :
 ExpatParser::~ExpatParser ()
 {
   XML_ParserFree(mParser);
-  delete mSource;
+  if (mOwnsSource) delete mSource;
 }
 
 
@@ -269,6 +272,8 @@ bool
 ExpatParser::parseFirst (const char* content, bool isFile)
 {
   if ( error() ) return false;
+
+  mOwnsSource = true;
  
   if (content == NULL) return false;
   
@@ -276,7 +281,18 @@ ExpatParser::parseFirst (const char* content, bool isFile)
   {
     try
     {
-      mSource = new XMLFileBuffer(content);
+      //
+      // Regular files are mapped into memory, so that their content can be
+      // given to the parser without being read or copied; compressed and
+      // other files are read through a stream.
+      //
+      mSource = new XMLMappedFileBuffer(content);
+
+      if ( mSource->error() )
+      {
+        delete mSource;
+        mSource = new XMLFileBuffer(content);
+      }
     }
     catch ( ZlibNotLinked& )
     {
@@ -323,6 +339,27 @@ ExpatParser::parseFirst (const char* content, bool isFile)
 }
 
 
+/**
+ * Begins a progressive parse of the content of source, which is read as
+ * the parse goes and must outlive it.
+ */
+bool
+ExpatParser::parseFirstFrom (XMLBuffer& source)
+{
+  if ( error() ) return false;
+
+  mSource     = &source;
+  mOwnsSource = false;
+
+  if ( !mSource->error() )
+  {
+    mHandler.startDocument();
+  }
+
+  return true;
+}
+
+
 /**
  * Parses the next chunk of XML content.
  *
@@ -334,35 +371,58 @@ ExpatParser::parseNext ()
 {
   if ( error() ) return false;
 
-  mBuffer = XML_GetBuffer(mParser, BUFFER_SIZE);
+  //
+  // Content held in memory is given to the parser where it is, a chunk
+  // of getChunkSize() bytes at a time; other content is copied into the
+  // buffer of the parser first.
+  //
+  unsigned int chunk = getChunkSize();
+  if (chunk == 0 || chunk > INT_MAX) chunk = INT_MAX;
+
+  const char*       data = mSource->readInPlace(chunk);
+  int               bytes;
+  int               done;
+  enum XML_Status   status;
 
-  if ( mBuffer == NULL )
+  if (data != NULL)
+  {
+    bytes  = (int)chunk;
+    done   = (bytes == 0);
+    status = XML_Parse(mParser, data, bytes, done);
+  }
+  else
   {
-    // See if Expat logged an error.  There are only two things that
-    // XML_GetErrorCode will report: parser state errors and "out of memory".
-    // So we check for the first and default to the out-of-memory case.
+    mBuffer = XML_GetBuffer(mParser, BUFFER_SIZE);
 
-    switch ( XML_GetErrorCode(mParser) )
+    if ( mBuffer == NULL )
     {
-    case XML_ERROR_SUSPENDED:
-    case XML_ERROR_FINISHED:
-      reportError(InternalXMLParserError);
-      break;
-
-    default:
-      reportError(XMLOutOfMemory);
-      break;
+      // See if Expat logged an error.  There are only two things that
+      // XML_GetErrorCode will report: parser state errors and "out of memory".
+      // So we check for the first and default to the out-of-memory case.
+
+      switch ( XML_GetErrorCode(mParser) )
+      {
+      case XML_ERROR_SUSPENDED:
+      case XML_ERROR_FINISHED:
+        reportError(InternalXMLParserError);
+        break;
+
+      default:
+        reportError(XMLOutOfMemory);
+        break;
+      }
+
+      return false;
     }
 
-    return false;
+    bytes  = mSource->copyTo(mBuffer, BUFFER_SIZE);
+    done   = (bytes == 0);
+    status = XML_ParseBuffer(mParser, bytes, done);
   }
 
-  int bytes = mSource->copyTo(mBuffer, BUFFER_SIZE);
-  int done  = (bytes == 0);
-
-  // Attempt to parse the content, checking for the Expat return status.
+  // Check the Expat return status.
 
-  if ( XML_ParseBuffer(mParser, bytes, done) == XML_STATUS_ERROR )
+  if ( status == XML_STATUS_ERROR )
   {
     reportError(translateError(XML_GetErrorCode(mParser)), "",
 		XML_GetCurrentLineNumber(mParser),
@@ -399,8 +459,9 @@ ExpatParser::parseNext ()
 void
 ExpatParser::parseReset ()
 {
-  delete mSource;
-  mSource = 0;
+  if (mOwnsSource) delete mSource;
+  mSource     = 0;
+  mOwnsSource = true;
 }
 
 LIBSBML_CPP_NAMESPACE_END
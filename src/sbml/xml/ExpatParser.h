@@ -123,6 +123,16 @@ public:
   virtual void parseReset ();
 
 
+  /**
+   * Begins a progressive parse of the content of @p source, which is read
+   * as the parse goes and must outlive it.
+   *
+   * @return @c true if the first step of the progressive parse was
+   * successful, @c false otherwise.
+   */
+  virtual bool parseFirstFrom (XMLBuffer& source);
+
+
   /**
    * Returns the current column position of the parser.
    *
@@ -153,6 +163,7 @@ protected:
   ExpatHandler  mHandler;
   void*         mBuffer;
   XMLBuffer*    mSource;
+  bool          mOwnsSource;
 
 
 private:
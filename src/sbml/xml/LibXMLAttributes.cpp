@@ -61,9 +61,9 @@ LibXMLAttributes::LibXMLAttributes (  const xmlChar** attributes
 
   for (unsigned int n = 0; n < size; ++n)
   {
-    const string name    = LibXMLTranscode( attributes[5 * n]     );
-    const string prefix  = LibXMLTranscode( attributes[5 * n + 1] );
-    const string uri     = LibXMLTranscode( attributes[5 * n + 2], true );
+    const XMLTriple triple( LibXMLTranscode( attributes[5 * n]     ).intern(),
+                            LibXMLTranscode( attributes[5 * n + 2], true ).intern(),
+                            LibXMLTranscode( attributes[5 * n + 1] ).intern() );
 
     const xmlChar* start = attributes[5 * n + 3];
     const xmlChar* end   = attributes[5 * n + 4];
@@ -71,7 +71,7 @@ LibXMLAttributes::LibXMLAttributes (  const xmlChar** attributes
 
     const string value   =  LibXMLTranscode((length > 0) ? start : 0, true, length);
 
-    mNames .push_back( XMLTriple(name, uri, prefix) );
+    mNames .push_back( triple );
     mValues.push_back( value );
   }
 
@@ -79,12 +79,14 @@ x_start_element (  void*           user_data
                  , int             num_defaulted
                  , const xmlChar** attributes )
 {
-  const LibXMLAttributes attrs(attributes, localname,
-			       (unsigned int)(num_attributes + num_defaulted));
-  const LibXMLNamespaces xmlns(namespaces, (unsigned int)num_namespaces);
+  LibXMLHandler* handler = static_cast<LibXMLHandler*>(user_data);
+  if (handler->skipStartElement(localname, uri)) return;
 
-  static_cast<LibXMLHandler*>(user_data)->
-    startElement(localname, prefix, uri, attrs, xmlns);
+  LibXMLAttributes attrs(attributes, localname,
+			 (unsigned int)(num_attributes + num_defaulted));
+  LibXMLNamespaces xmlns(namespaces, (unsigned int)num_namespaces);
+
+  handler->startElement(localname, prefix, uri, attrs, xmlns);
 }
 
 
@@ -236,18 +238,35 @@ void
 LibXMLHandler::startElement (  const xmlChar*           localname
                              , const xmlChar*           prefix
                              , const xmlChar*           uri
-                             , const LibXMLAttributes&  attributes
-                             , const LibXMLNamespaces&  namespaces )
+                             , LibXMLAttributes&        attributes
+                             , LibXMLNamespaces&        namespaces )
 {
-  const string nsuri    = LibXMLTranscode( uri       );
-  const string name     = LibXMLTranscode( localname );
-  const string nsprefix = LibXMLTranscode( prefix    );
-
-  const XMLTriple  triple ( name, nsuri, nsprefix );
-  const XMLToken   element( triple, attributes, namespaces,
+  const XMLTriple  triple ( LibXMLTranscode( localname ).intern(),
+                            LibXMLTranscode( uri       ).intern(),
+                            LibXMLTranscode( prefix    ).intern() );
+  XMLToken         element( triple, XMLAttributes(), XMLNamespaces(),
                             getLine(), getColumn() );
 
-  mHandler.startElement(element);
+  //
+  // The attributes and namespaces are only needed for this token, so they
+  // are moved into it rather than copied.
+  //
+  element.swapAttributes(attributes, namespaces);
+  mHandler.takeStartElement(element);
+}
+
+
+/**
+ * Asked at the start of an element, before its attributes and namespaces
+ * are made.
+ *
+ * @return true if the element is left out of the document.
+ */
+bool
+LibXMLHandler::skipStartElement (const xmlChar* localname, const xmlChar* uri)
+{
+  return mHandler.skipStartElement(reinterpret_cast<const char*>(localname),
+                                   reinterpret_cast<const char*>(uri));
 }
 
 
@@ -263,14 +282,14 @@ LibXMLHandler::endElement (  const xmlChar*   localname
                            , const xmlChar*   prefix
                            , const xmlChar*   uri )
 {
-  const string nsuri    = LibXMLTranscode( uri       );
-  const string name     = LibXMLTranscode( localname );
-  const string nsprefix = LibXMLTranscode( prefix    );
+  if (mHandler.skipEndElement()) return;
 
-  const XMLTriple  triple ( name, nsuri, nsprefix );
-  const XMLToken   element( triple, getLine(), getColumn() );
+  const XMLTriple  triple ( LibXMLTranscode( localname ).intern(),
+                            LibXMLTranscode( uri       ).intern(),
+                            LibXMLTranscode( prefix    ).intern() );
+  XMLToken         element( triple, getLine(), getColumn() );
 
-  mHandler.endElement(element);
+  mHandler.takeEndElement(element);
 }
 
 
@@ -293,8 +312,10 @@ LibXMLHandler::endDocument ()
 void
 LibXMLHandler::characters (const xmlChar* chars, int length)
 {
+  if (mHandler.isSkipping()) return;
+
   XMLToken data( LibXMLTranscode(chars, length) );
-  mHandler.characters(data);
+  mHandler.takeCharacters(data);
 }
 
 
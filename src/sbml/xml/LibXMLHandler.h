@@ -97,17 +97,33 @@ public:
    * @param  uri         The URI of the namespace for this element
    * @param  namespaces  The namespace definitions for this element
    * @param  attributes  The specified or defaulted attributes
+   *
+   * The attributes and namespaces are moved into the XMLToken passed on
+   * to the XMLHandler, so they are left empty.
    */
   void startElement
   (
      const xmlChar*           localname
    , const xmlChar*           prefix
    , const xmlChar*           uri
-   , const LibXMLAttributes&  attributes
-   , const LibXMLNamespaces&  namespaces
+   , LibXMLAttributes&        attributes
+   , LibXMLNamespaces&        namespaces
   );
 
 
+  /**
+   * Asked at the start of an element, before its attributes and
+   * namespaces are made.
+   *
+   * @param  localname  The local part of the element name
+   * @param  uri        The URI of the namespace for this element
+   *
+   * @return @c true if the element is left out of the document (see
+   * XMLHandler::skipStartElement()).
+   */
+  bool skipStartElement (const xmlChar* localname, const xmlChar* uri);
+
+
   /**
    * Receive notification of the end of an element.
    *
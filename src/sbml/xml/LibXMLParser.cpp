@@ -47,6 +47,7 @@
 #include <libxml/xmlerror.h>
 
 #include <sbml/xml/XMLFileBuffer.h>
+#include <sbml/xml/XMLMappedFileBuffer.h>
 #include <sbml/xml/XMLMemoryBuffer.h>
 
 #include <sbml/xml/LibXMLHandler.h>
@@ -61,6 +62,13 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 static const int BUFFER_SIZE = 8192;
 
+/*
+ * The largest chunk of content held in memory given to libxml2 at a time:
+ * it reports content that it cannot parse within 10 MB of lookahead as
+ * not well-formed, unless its safety limits are lifted (XML_PARSE_HUGE).
+ */
+static const unsigned int MAX_CHUNK_SIZE = 1024 * 1024;
+
 /*
  * Table mapping libXML error codes to ours.  The error code numbers are not
  * contiguous, hence the table has to map pairs of numbers rather than
@@ -247,6 +255,7 @@ LibXMLParser::LibXMLParser (XMLHandler& handler) :
  , mHandler( handler               )
  , mBuffer ( new char[BUFFER_SIZE] )
  , mSource ( NULL                  )
+ , mOwnsSource ( true )
 {
   xmlSAXHandler* sax  = LibXMLHandler::getInternalHandler();
   void*          data = static_cast<void*>(&mHandler);
@@ -263,7 +272,7 @@ LibXMLParser::~LibXMLParser ()
 {
   xmlFreeParserCtxt(mParser);
   delete [] mBuffer;
-  delete    mSource;
+  if (mOwnsSource) delete mSource;
 }
 
 
@@ -346,6 +355,8 @@ bool
 LibXMLParser::parseFirst (const char* content, bool isFile)
 {
   if ( error() ) return false;
+
+  mOwnsSource = true;
   
   if (content == NULL) return false;
   
@@ -353,7 +364,18 @@ LibXMLParser::parseFirst (const char* content, bool isFile)
   {
     try
     {
-      mSource = new XMLFileBuffer(content);
+      //
+      // Regular files are mapped into memory, so that their content can be
+      // given to the parser without being read or copied; compressed and
+      // other files are read through a stream.
+      //
+      mSource = new XMLMappedFileBuffer(content);
+
+      if ( mSource->error() )
+      {
+        delete mSource;
+        mSource = new XMLFileBuffer(content);
+      }
     }
     catch ( ZlibNotLinked& )
     {
@@ -401,6 +423,27 @@ LibXMLParser::parseFirst (const char* content, bool isFile)
 }
 
 
+/**
+ * Begins a progressive parse of the content of source, which is read as
+ * the parse goes and must outlive it.
+ */
+bool
+LibXMLParser::parseFirstFrom (XMLBuffer& source)
+{
+  if ( error() ) return false;
+
+  mSource     = &source;
+  mOwnsSource = false;
+
+  if ( !mSource->error() )
+  {
+    mHandler.startDocument();
+  }
+
+  return true;
+}
+
+
 /**
  * Parses the next chunk of XML content.
  *
@@ -412,7 +455,27 @@ LibXMLParser::parseNext ()
 {
   if ( error() ) return false;
 
-  int bytes = (int)mSource->copyTo(mBuffer, BUFFER_SIZE);
+  //
+  // Content held in memory is given to the parser where it is, a chunk
+  // of getChunkSize() bytes at a time; other content is copied into
+  // mBuffer first.
+  //
+  unsigned int chunk = getChunkSize();
+  if (chunk == 0 || chunk > MAX_CHUNK_SIZE) chunk = MAX_CHUNK_SIZE;
+
+  const char* data = mSource->readInPlace(chunk);
+  int bytes;
+
+  if (data != NULL)
+  {
+    bytes = (int)chunk;
+  }
+  else
+  {
+    bytes = (int)mSource->copyTo(mBuffer, BUFFER_SIZE);
+    data  = mBuffer;
+  }
+
   int done  = (bytes == 0);
 
   if ( mSource->error() )
@@ -422,7 +485,7 @@ LibXMLParser::parseNext ()
     return false;
   }
 
-  if ( xmlParseChunk(mParser, mBuffer, bytes, done) )
+  if ( xmlParseChunk(mParser, data, bytes, done) )
   {
     xmlErrorPtr libxmlError = xmlGetLastError();
 
@@ -455,8 +518,9 @@ LibXMLParser::parseReset ()
 {
   xmlCtxtResetPush(mParser, 0, 0, 0, 0);
 
-  delete mSource;
-  mSource = NULL;
+  if (mOwnsSource) delete mSource;
+  mSource     = NULL;
+  mOwnsSource = true;
 }
 
 
@@ -137,6 +137,16 @@ public:
   virtual void parseReset ();
 
 
+  /**
+   * Begins a progressive parse of the content of @p source, which is read
+   * as the parse goes and must outlive it.
+   *
+   * @return @c true if the first step of the progressive parse was
+   * successful, @c false otherwise.
+   */
+  virtual bool parseFirstFrom (XMLBuffer& source);
+
+
 protected:
 
   /**
@@ -149,6 +159,7 @@ protected:
   LibXMLHandler   mHandler;
   char*           mBuffer;
   XMLBuffer*      mSource;
+  bool            mOwnsSource;
 
 
 private:
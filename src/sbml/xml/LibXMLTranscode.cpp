@@ -42,6 +42,7 @@
  * ---------------------------------------------------------------------- -->*/
 
 #include <sbml/xml/LibXMLTranscode.h>
+#include <sbml/xml/XMLStringPool.h>
 
 using namespace std;
 
@@ -99,6 +100,25 @@ LibXMLTranscode::operator string ()
   }
 }
 
+
+const string*
+LibXMLTranscode::intern ()
+{
+  if (mBuffer == NULL)
+  {
+    return XMLStringPool::getEmpty();
+  }
+  else if (mReplaceNCR)
+  {
+    return XMLStringPool::intern( static_cast<string>(*this) );
+  }
+  else
+  {
+    return (mLen == -1) ? XMLStringPool::intern(mBuffer)
+                        : XMLStringPool::intern(mBuffer, (size_t)mLen);
+  }
+}
+
 LIBSBML_CPP_NAMESPACE_END
 
 /** @endcond */
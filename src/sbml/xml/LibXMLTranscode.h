@@ -70,6 +70,12 @@ public:
 
   operator std::string ();
 
+  /**
+   * Returns the transcoded string as interned by XMLStringPool, without
+   * making a copy of it when it is already in the pool.
+   */
+  const std::string* intern ();
+
 private:
 
   const char* mBuffer;
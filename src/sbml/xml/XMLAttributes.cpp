@@ -39,6 +39,7 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <algorithm>
 #include <cerrno>
 #include <clocale>
 #include <cstdlib>
@@ -50,6 +51,7 @@
 #include <sbml/xml/XMLAttributes.h>
 /** @cond doxygenLibsbmlInternal */
 #include <sbml/xml/XMLOutputStream.h>
+#include <sbml/xml/XMLStringPool.h>
 #include <sbml/util/util.h>
 /** @endcond */
 
@@ -130,6 +132,21 @@ XMLAttributes::clone () const
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Exchanges the content of this XMLAttributes set with that of other.
+ */
+void
+XMLAttributes::swap (XMLAttributes& other)
+{
+  mNames      .swap(other.mNames);
+  mValues     .swap(other.mValues);
+  mElementName.swap(other.mElementName);
+  std::swap(mLog, other.mLog);
+}
+/** @endcond */
+
+
 
 /*
  * Adds an attribute (a name/value pair) to this XMLAttributes set.  
@@ -268,9 +285,14 @@ XMLAttributes::clear()
 int
 XMLAttributes::getIndex (const std::string& name) const
 {
+  // the names are interned: only a name found in the pool can be that of
+  // an attribute, and then it is the same string
+  const std::string* interned = XMLStringPool::find(name);
+  if (interned == NULL) return -1;
+
   for (int index = 0; index < getLength(); ++index)
   {
-    if (getName(index) == name) return index;
+    if (&mNames[(size_t)index].getName() == interned) return index;
   }
   
   return -1;
@@ -286,9 +308,17 @@ XMLAttributes::getIndex (const std::string& name) const
 int
 XMLAttributes::getIndex (const std::string& name, const std::string& uri) const
 {
+  const std::string* internedName = XMLStringPool::find(name);
+  const std::string* internedURI  = XMLStringPool::find(uri);
+  if (internedName == NULL || internedURI == NULL) return -1;
+
   for (int index = 0; index < getLength(); ++index)
   {
-    if ( (getName(index) == name) && (getURI(index) == uri) ) return index;
+    const XMLTriple& triple = mNames[(size_t)index];
+    if (&triple.getName() == internedName && &triple.getURI() == internedURI)
+    {
+      return index;
+    }
   }
   
   return -1;
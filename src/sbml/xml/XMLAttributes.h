@@ -294,6 +294,19 @@ public:
   XMLAttributes* clone () const;
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Exchanges the content of this XMLAttributes with that of @p other, without
+   * copying the names and values.
+   */
+  void swap (XMLAttributes& other);
+  /** @endcond */
+
+#endif
+
+
   /**
    * Adds an attribute to this list of attributes.
    *
@@ -41,6 +41,8 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <cstddef>
+
 #include <sbml/xml/XMLBuffer.h>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
@@ -60,5 +62,16 @@ XMLBuffer::~XMLBuffer ()
 {
 }
 
+
+/*
+ * Returns a pointer to the next bytes of the content held in memory, or
+ * NULL when the content is not held in memory.
+ */
+const char*
+XMLBuffer::readInPlace (unsigned int& /*bytes*/)
+{
+  return NULL;
+}
+
 LIBSBML_CPP_NAMESPACE_END
 /** @endcond */
@@ -77,6 +77,19 @@ public:
   virtual bool error () = 0;
 
 
+  /**
+   * Returns a pointer to at most @p bytes bytes of the content of this
+   * XMLBuffer, and moves past them, for buffers that hold their content
+   * in memory.  On return, @p bytes is the number of bytes available at
+   * the pointer (@c 0 at the end of the content); they remain valid for
+   * the lifetime of this XMLBuffer.
+   *
+   * By default, returns NULL and leaves @p bytes unchanged, in which case
+   * the content has to be read with copyTo().
+   */
+  virtual const char* readInPlace (unsigned int& bytes);
+
+
 protected:
 
   XMLBuffer ();
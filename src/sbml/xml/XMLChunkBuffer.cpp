@@ -0,0 +1,219 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLChunkBuffer.cpp
+ * @brief   XMLChunkBuffer implements the XMLBuffer interface for content received in chunks
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+
+#include <algorithm>
+#include <cstring>
+#include <sbml/xml/XMLChunkBuffer.h>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <condition_variable>
+#include <mutex>
+#define LIBSBML_CHUNK_BUFFER_SYNC
+#endif
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * Lets append() and copyTo() be called from different threads.  Without
+ * it, all the chunks have to be added before the content is read.
+ */
+#ifdef LIBSBML_CHUNK_BUFFER_SYNC
+struct XMLChunkBuffer::Sync
+{
+  std::mutex              mutex;
+  std::condition_variable changed;
+};
+
+#define XML_CHUNK_BUFFER_LOCK std::unique_lock<std::mutex> lock(mSync->mutex)
+#define XML_CHUNK_BUFFER_WAIT mSync->changed.wait(lock)
+#define XML_CHUNK_BUFFER_NOTIFY mSync->changed.notify_all()
+#else
+struct XMLChunkBuffer::Sync
+{
+};
+
+#define XML_CHUNK_BUFFER_LOCK
+#define XML_CHUNK_BUFFER_WAIT break
+#define XML_CHUNK_BUFFER_NOTIFY
+#endif
+
+
+/*
+ * Creates an empty XMLChunkBuffer.
+ */
+XMLChunkBuffer::XMLChunkBuffer (size_t maxBuffered) :
+   mOffset     ( 0           )
+ , mBuffered   ( 0           )
+ , mMaxBuffered( maxBuffered )
+ , mClosed     ( false       )
+ , mAbandoned  ( false       )
+ , mSync       ( new Sync()  )
+{
+}
+
+
+/*
+ * Destroys this XMLChunkBuffer.
+ */
+XMLChunkBuffer::~XMLChunkBuffer ()
+{
+  delete mSync;
+}
+
+
+/*
+ * Adds a copy of the given bytes to the end of the content.  A chunk
+ * larger than the maximum is accepted once everything before it has been
+ * read, so that append() cannot wait forever.
+ */
+bool
+XMLChunkBuffer::append (const char* data, size_t length)
+{
+  XML_CHUNK_BUFFER_LOCK;
+
+  while (!mClosed && !mAbandoned && mMaxBuffered > 0 && mBuffered > 0
+         && mBuffered + length > mMaxBuffered)
+  {
+    XML_CHUNK_BUFFER_WAIT;
+  }
+
+  if (mClosed || mAbandoned) return false;
+  if (length == 0 || data == NULL) return true;
+
+  mChunks.push_back(string(data, length));
+  mBuffered += length;
+
+  XML_CHUNK_BUFFER_NOTIFY;
+  return true;
+}
+
+
+/*
+ * Marks the end of the content.
+ */
+void
+XMLChunkBuffer::close ()
+{
+  XML_CHUNK_BUFFER_LOCK;
+
+  mClosed = true;
+  XML_CHUNK_BUFFER_NOTIFY;
+}
+
+
+/*
+ * Frees the chunks not read yet; nothing more will be read.
+ */
+void
+XMLChunkBuffer::abandon ()
+{
+  XML_CHUNK_BUFFER_LOCK;
+
+  mAbandoned = true;
+  mChunks.clear();
+  mOffset   = 0;
+  mBuffered = 0;
+  XML_CHUNK_BUFFER_NOTIFY;
+}
+
+
+/*
+ * Copies at most nbytes from this XMLChunkBuffer to the memory pointed
+ * to by destination.  The chunks are freed as soon as they have been
+ * read.
+ *
+ * @return the number of bytes actually copied (0 at the end of the
+ * content).
+ */
+unsigned int
+XMLChunkBuffer::copyTo (void* destination, unsigned int bytes)
+{
+  if (destination == NULL || bytes == 0) return 0;
+
+  XML_CHUNK_BUFFER_LOCK;
+
+  while (mChunks.empty() && !mClosed && !mAbandoned)
+  {
+    XML_CHUNK_BUFFER_WAIT;
+  }
+
+  char*        to     = static_cast<char*>(destination);
+  unsigned int copied = 0;
+
+  while (copied < bytes && !mChunks.empty())
+  {
+    const string& chunk = mChunks.front();
+    size_t n = min(chunk.size() - mOffset, size_t(bytes - copied));
+
+    memcpy(to + copied, chunk.data() + mOffset, n);
+    copied    += (unsigned int) n;
+    mOffset   += n;
+    mBuffered -= n;
+
+    if (mOffset == chunk.size())
+    {
+      mChunks.pop_front();
+      mOffset = 0;
+    }
+  }
+
+  if (copied > 0) XML_CHUNK_BUFFER_NOTIFY;
+  return copied;
+}
+
+
+/*
+ * Returns @c false: chunks added to this XMLChunkBuffer are always read
+ * successfully.
+ */
+bool
+XMLChunkBuffer::error ()
+{
+  return false;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+/** @endcond */
@@ -0,0 +1,139 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLChunkBuffer.h
+ * @brief   XMLChunkBuffer implements the XMLBuffer interface for content received in chunks
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+
+#ifndef XMLChunkBuffer_h
+#define XMLChunkBuffer_h
+
+#include <sbml/xml/XMLBuffer.h>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class LIBLAX_EXTERN XMLChunkBuffer : public XMLBuffer
+{
+public:
+
+  /**
+   * Creates an empty XMLChunkBuffer.  The content is added to it chunk by
+   * chunk with append(), until close() is called.
+   *
+   * If @p maxBuffered is not @c 0, append() waits while more than
+   * @p maxBuffered bytes are held that have not been read yet; this is
+   * only useful when the content is read by another thread.
+   */
+  XMLChunkBuffer (size_t maxBuffered = 0);
+
+
+  /**
+   * Destroys this XMLChunkBuffer.
+   */
+  virtual ~XMLChunkBuffer ();
+
+
+  /**
+   * Adds a copy of the @p length bytes at @p data to the end of the
+   * content.
+   *
+   * @return @c false if nothing can be added anymore, because close() or
+   * abandon() has been called, @c true otherwise.
+   */
+  bool append (const char* data, size_t length);
+
+
+  /**
+   * Marks the end of the content: once the chunks added so far have been
+   * read, copyTo() returns @c 0.
+   */
+  void close ();
+
+
+  /**
+   * Tells this XMLChunkBuffer that nothing more will be read from it: the
+   * chunks not read yet are freed, and append() returns @c false instead
+   * of waiting.
+   */
+  void abandon ();
+
+
+  /**
+   * Copies at most nbytes from this XMLChunkBuffer to the memory pointed
+   * to by destination, waiting for a chunk to be added if there is none
+   * to read and close() has not been called.
+   *
+   * @return the number of bytes actually copied (0 at the end of the
+   * content).
+   */
+  virtual unsigned int copyTo (void* destination, unsigned int bytes);
+
+
+  /**
+   * Returns @c false: chunks added to this XMLChunkBuffer are always read
+   * successfully.
+   */
+  virtual bool error ();
+
+
+private:
+
+  XMLChunkBuffer (const XMLChunkBuffer&);
+  XMLChunkBuffer& operator= (const XMLChunkBuffer&);
+
+
+  struct Sync;
+
+  std::deque<std::string>  mChunks;
+  size_t                   mOffset;
+  size_t                   mBuffered;
+  size_t                   mMaxBuffered;
+  bool                     mClosed;
+  bool                     mAbandoned;
+  Sync*                    mSync;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* XMLChunkBuffer_h */
+/** @endcond */
@@ -0,0 +1,138 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementFilter.cpp
+ * @brief   Chooses the elements the XML parsers leave out
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <cstring>
+
+#include <sbml/xml/XMLElementFilter.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+void
+XMLElementFilter::addElement (const string& name, const string& uriPrefix)
+{
+  Element element;
+  element.name      = name;
+  element.uriPrefix = uriPrefix;
+  mElements.push_back(element);
+}
+
+
+void
+XMLElementFilter::addNamespace (const string& uri)
+{
+  mNamespaces.push_back(uri);
+}
+
+
+void
+XMLElementFilter::clear ()
+{
+  mElements.clear();
+  mNamespaces.clear();
+}
+
+
+bool
+XMLElementFilter::isEmpty () const
+{
+  return mElements.empty() && mNamespaces.empty();
+}
+
+
+bool
+XMLElementFilter::hasNamespaces () const
+{
+  return !mNamespaces.empty();
+}
+
+
+bool
+XMLElementFilter::hasElement (const char* name, size_t length) const
+{
+  for (size_t n = 0; n < mElements.size(); ++n)
+  {
+    const string& s = mElements[n].name;
+    if (s.size() == length && s.compare(0, length, name, length) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Called for every start tag read while nothing is being left out, so it
+ * only compares the names with those of the few elements and namespaces
+ * asked for, without making strings of them.
+ */
+bool
+XMLElementFilter::skips (const char* name, const char* uri) const
+{
+  if (uri == NULL) uri = "";
+
+  for (size_t n = 0; n < mNamespaces.size(); ++n)
+  {
+    if (strcmp(uri, mNamespaces[n].c_str()) == 0) return true;
+  }
+
+  for (size_t n = 0; n < mElements.size(); ++n)
+  {
+    const Element& e = mElements[n];
+
+    if (strcmp(name, e.name.c_str()) == 0
+        && strncmp(uri, e.uriPrefix.c_str(), e.uriPrefix.size()) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+/** @endcond */
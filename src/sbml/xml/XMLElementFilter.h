@@ -0,0 +1,121 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementFilter.h
+ * @brief   Chooses the elements the XML parsers leave out
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#ifndef XMLElementFilter_h
+#define XMLElementFilter_h
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sbml/xml/XMLExtern.h>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * The elements an XMLHandler leaves out of a document, by name or by
+ * namespace.  The parsers ask before making the token of the start of an
+ * element, and no tokens are made for an element that is left out or for
+ * anything inside it.
+ */
+class LIBLAX_EXTERN XMLElementFilter
+{
+public:
+
+  /*
+   * Leaves out the elements named @p name whose namespace URI starts with
+   * @p uriPrefix, or in any namespace if @p uriPrefix is empty.
+   */
+  void addElement (const std::string& name, const std::string& uriPrefix = "");
+
+
+  /*
+   * Leaves out the elements in the namespace @p uri.
+   */
+  void addNamespace (const std::string& uri);
+
+
+  void clear ();
+
+
+  bool isEmpty () const;
+
+
+  /*
+   * Returns true if elements are left out by namespace.
+   */
+  bool hasNamespaces () const;
+
+
+  /*
+   * Returns true if elements named @p name, of @p length characters, may be
+   * left out, whatever their namespace.
+   */
+  bool hasElement (const char* name, size_t length) const;
+
+
+  /*
+   * Returns true if the element named @p name in the namespace @p uri, or
+   * in no namespace if @p uri is NULL, is left out.
+   */
+  bool skips (const char* name, const char* uri) const;
+
+
+protected:
+
+  struct Element
+  {
+    std::string name;
+    std::string uriPrefix;
+  };
+
+  std::vector<Element>      mElements;
+  std::vector<std::string>  mNamespaces;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* XMLElementFilter_h */
+/** @endcond */
@@ -0,0 +1,372 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementScanner.cpp
+ * @brief   Finds where the elements of a document start and end
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <cctype>
+#include <cstring>
+
+#include <sbml/xml/XMLElementScanner.h>
+#include <sbml/util/util.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+bool
+XMLElementScanner::Tag::hasName (const char* s) const
+{
+  return nameLength == strlen(s) && strncmp(name, s, nameLength) == 0;
+}
+
+
+bool
+XMLElementScanner::Tag::hasNamePrefix (const char* s) const
+{
+  return nameLength > strlen(s) && strncmp(name, s, strlen(s)) == 0;
+}
+
+
+bool
+XMLElementScanner::Tag::hasPrefix () const
+{
+  return name != qname;
+}
+
+
+string
+XMLElementScanner::Tag::getQName () const
+{
+  return string(qname, qnameLength);
+}
+
+
+XMLElementScanner::XMLElementScanner (const char* content, size_t length)
+  : mContent (content)
+  , mLength  (length)
+  , mOffset  (0)
+  , mFailed  (false)
+{
+}
+
+
+bool
+XMLElementScanner::failed () const
+{
+  return mFailed;
+}
+
+
+size_t
+XMLElementScanner::offset () const
+{
+  return mOffset;
+}
+
+
+/*
+ * Skips the byte order mark and the XML declaration.
+ */
+bool
+XMLElementScanner::skipProlog ()
+{
+  if (startsWith("\xEF\xBB\xBF")) mOffset += 3;
+
+  if (!startsWith("<?xml") || mOffset + 5 >= mLength
+      || !isspace((unsigned char)mContent[mOffset + 5]))
+  {
+    return true;
+  }
+
+  size_t end = find(mOffset, "?>");
+  if (end == mLength) return fail();
+
+  string declaration(mContent + mOffset, end - mOffset);
+  mOffset = end + 2;
+
+  // columns are counted in UTF-8 characters
+  size_t encoding = declaration.find("encoding");
+  if (encoding == string::npos) return true;
+
+  size_t begin = declaration.find_first_of("\"'", encoding);
+  if (begin == string::npos) return fail();
+
+  size_t close = declaration.find(declaration[begin], begin + 1);
+  if (close == string::npos) return fail();
+
+  string value = declaration.substr(begin + 1, close - begin - 1);
+  return (strcmp_insensitive(value.c_str(), "UTF-8") == 0) || fail();
+}
+
+
+/*
+ * Moves to the start tag of the next child of the element being scanned.
+ */
+bool
+XMLElementScanner::nextChild (Tag& tag)
+{
+  while (!mFailed)
+  {
+    const char* next = static_cast<const char*>(
+      memchr(mContent + mOffset, '<', mLength - mOffset));
+    if (next == NULL) return fail();
+
+    mOffset = (size_t)(next - mContent);
+
+    if      (startsWith("<!--"))      skipPast("-->");
+    else if (startsWith("<![CDATA[")) skipPast("]]>");
+    else if (startsWith("<?"))        skipPast("?>");
+    else if (startsWith("<!"))        return fail();
+    else if (startsWith("</"))
+    {
+      skipPast(">");
+      return false;
+    }
+    else
+    {
+      return readStartTag(tag);
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Skips the content and end tag of the element whose start tag has just
+ * been read.
+ */
+bool
+XMLElementScanner::skipElement (const Tag& tag)
+{
+  unsigned int depth = tag.empty ? 0 : 1;
+  Tag child;
+
+  while (depth > 0)
+  {
+    if (nextChild(child))
+    {
+      if (!child.empty) ++depth;
+    }
+    else if (mFailed)
+    {
+      return false;
+    }
+    else
+    {
+      --depth;
+    }
+  }
+
+  return true;
+}
+
+
+/*
+ * Reads the attribute of tag at or after offset.
+ */
+bool
+XMLElementScanner::nextAttribute (const Tag& tag, size_t& offset,
+                                  Attribute& attribute) const
+{
+  size_t n = offset;
+  while (n < tag.end && isspace((unsigned char)mContent[n])) ++n;
+
+  size_t begin = n;
+  while (n < tag.end && !strchr(" \t\r\n=/>", mContent[n])) ++n;
+  if (n == begin) return false;
+
+  attribute.qname       = mContent + begin;
+  attribute.qnameLength = n - begin;
+
+  while (n < tag.end && mContent[n] != '"' && mContent[n] != '\'') ++n;
+  if (n == tag.end) return false;
+
+  const char* close = static_cast<const char*>(
+    memchr(mContent + n + 1, mContent[n], tag.end - n - 1));
+  if (close == NULL) return false;
+
+  attribute.value       = mContent + n + 1;
+  attribute.valueLength = (size_t)(close - attribute.value);
+
+  offset = (size_t)(close - mContent) + 1;
+  return true;
+}
+
+
+/*
+ * @return the position of the start of a document.
+ */
+XMLElementScanner::Position
+XMLElementScanner::startOf ()
+{
+  Position position = { 0, 1, 1 };
+  return position;
+}
+
+
+/*
+ * Moves position forward to offset to of the given content.
+ */
+void
+XMLElementScanner::advance (const char* content, size_t length, size_t to,
+                            Position& position)
+{
+  for (size_t n = position.offset; n < to; ++n)
+  {
+    unsigned char c = (unsigned char)content[n];
+
+    if (c == '\n' || (c == '\r' && (n + 1 == length || content[n + 1] != '\n')))
+    {
+      ++position.line;
+      position.column = 1;
+    }
+    else if (c != '\r' && (c & 0xC0) != 0x80)
+    {
+      ++position.column;
+    }
+  }
+
+  position.offset = to;
+}
+
+
+bool
+XMLElementScanner::fail ()
+{
+  mFailed = true;
+  return false;
+}
+
+
+bool
+XMLElementScanner::startsWith (const char* s) const
+{
+  size_t length = strlen(s);
+  return mLength - mOffset >= length
+      && memcmp(mContent + mOffset, s, length) == 0;
+}
+
+
+/*
+ * @return the offset of the first s at or after from, or the length of
+ * the content if there is none.
+ */
+size_t
+XMLElementScanner::find (size_t from, const char* s) const
+{
+  size_t length = strlen(s);
+
+  while (from + length <= mLength)
+  {
+    const char* next = static_cast<const char*>(
+      memchr(mContent + from, s[0], mLength - from));
+    if (next == NULL) break;
+
+    from = (size_t)(next - mContent);
+    if (from + length <= mLength && memcmp(next, s, length) == 0)
+    {
+      return from;
+    }
+    ++from;
+  }
+
+  return mLength;
+}
+
+
+void
+XMLElementScanner::skipPast (const char* s)
+{
+  size_t end = find(mOffset + 2, s);
+
+  if (end == mLength) fail();
+  else                mOffset = end + strlen(s);
+}
+
+
+bool
+XMLElementScanner::readStartTag (Tag& tag)
+{
+  size_t n = mOffset + 1;
+  while (n < mLength && !strchr(" \t\r\n/>", mContent[n])) ++n;
+  if (n == mOffset + 1 || n == mLength) return fail();
+
+  tag.qname       = mContent + mOffset + 1;
+  tag.qnameLength = n - mOffset - 1;
+
+  const char* colon = static_cast<const char*>(
+    memchr(tag.qname, ':', tag.qnameLength));
+  tag.name       = (colon != NULL) ? colon + 1 : tag.qname;
+  tag.nameLength = tag.qnameLength - (size_t)(tag.name - tag.qname);
+
+  // a '>' may occur in the value of an attribute
+  char quote = 0;
+  for (; n < mLength; ++n)
+  {
+    char c = mContent[n];
+    if (quote != 0)
+    {
+      if (c == quote) quote = 0;
+    }
+    else if (c == '"' || c == '\'')
+    {
+      quote = c;
+    }
+    else if (c == '>')
+    {
+      break;
+    }
+  }
+  if (n == mLength) return fail();
+
+  tag.begin = mOffset;
+  tag.end   = n + 1;
+  tag.empty = (mContent[n - 1] == '/');
+  mOffset   = n + 1;
+
+  return true;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
@@ -0,0 +1,189 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementScanner.h
+ * @brief   Finds where the elements of a document start and end
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#ifndef XMLElementScanner_h
+#define XMLElementScanner_h
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <string>
+
+#include <sbml/xml/XMLExtern.h>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * Finds where the elements of a document start and end, and nothing more,
+ * for the readers that cut a document up before giving it to the XML
+ * parser.  Anything it need not understand, such as a document type
+ * declaration or an encoding other than UTF-8, makes it fail, and the
+ * document is then read as usual.  Documents that are not well-formed are
+ * left to the XML parser to report.
+ */
+class LIBLAX_EXTERN XMLElementScanner
+{
+public:
+
+  /* a start tag */
+  struct Tag
+  {
+    size_t      begin;        /* the start tag is [begin, end) */
+    size_t      end;
+    const char* qname;
+    size_t      qnameLength;
+    const char* name;         /* the name without its prefix */
+    size_t      nameLength;
+    bool        empty;
+
+    bool hasName (const char* s) const;
+
+    bool hasNamePrefix (const char* s) const;
+
+    bool hasPrefix () const;
+
+    std::string getQName () const;
+  };
+
+
+  /* an attribute of a start tag */
+  struct Attribute
+  {
+    const char* qname;
+    size_t      qnameLength;
+    const char* value;        /* the value without its quotes */
+    size_t      valueLength;
+  };
+
+
+  /*
+   * A position in a document, counted as the XML parsers do: a carriage
+   * return followed by a line feed is a single line break, and columns are
+   * counted in characters.
+   */
+  struct Position
+  {
+    size_t       offset;
+    unsigned int line;
+    unsigned int column;
+  };
+
+
+  XMLElementScanner (const char* content, size_t length);
+
+
+  bool failed () const;
+
+
+  size_t offset () const;
+
+
+  /*
+   * Skips the byte order mark and the XML declaration.
+   */
+  bool skipProlog ();
+
+
+  /*
+   * Moves to the start tag of the next child of the element being
+   * scanned, skipping text, comments, CDATA sections and processing
+   * instructions.  Returns false when it meets the end tag of the element
+   * instead, or fails.
+   */
+  bool nextChild (Tag& tag);
+
+
+  /*
+   * Skips the content and end tag of the element whose start tag has just
+   * been read.
+   */
+  bool skipElement (const Tag& tag);
+
+
+  /*
+   * Reads the attribute of @p tag at or after @p offset, which starts
+   * right after the name of the tag, and moves @p offset past it.
+   * Returns false when there are no more attributes.
+   */
+  bool nextAttribute (const Tag& tag, size_t& offset,
+                      Attribute& attribute) const;
+
+
+  /*
+   * Returns the position of the start of a document.
+   */
+  static Position startOf ();
+
+
+  /*
+   * Moves @p position forward to the offset @p to of the given content.
+   */
+  static void advance (const char* content, size_t length, size_t to,
+                       Position& position);
+
+
+private:
+
+  bool fail ();
+
+  bool startsWith (const char* s) const;
+
+  size_t find (size_t from, const char* s) const;
+
+  void skipPast (const char* s);
+
+  bool readStartTag (Tag& tag);
+
+
+  const char* mContent;
+  size_t      mLength;
+  size_t      mOffset;
+  bool        mFailed;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* XMLElementScanner_h */
+
+/** @endcond */
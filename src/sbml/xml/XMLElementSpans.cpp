@@ -0,0 +1,120 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementSpans.cpp
+ * @brief   Where each element of a document starts and ends
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <sbml/xml/XMLElementSpans.h>
+#include <sbml/xml/XMLElementScanner.h>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+/*
+ * Scans the content for its elements.
+ */
+XMLElementSpans::XMLElementSpans (const char* content, size_t length)
+  : mFailed (true)
+{
+  XMLElementScanner scanner(content, length);
+  XMLElementScanner::Tag tag;
+
+  if (content == NULL || !scanner.skipProlog() || !scanner.nextChild(tag))
+  {
+    return;
+  }
+
+  // the elements whose end tag is still to come
+  vector<size_t> open;
+
+  while (true)
+  {
+    Span span = { tag.begin, tag.end };
+    mSpans.push_back(span);
+
+    if (!tag.empty)
+    {
+      open.push_back(mSpans.size() - 1);
+    }
+
+    while (!open.empty() && !scanner.nextChild(tag))
+    {
+      if (scanner.failed())
+      {
+        mSpans.clear();
+        return;
+      }
+
+      mSpans[open.back()].end = scanner.offset();
+      open.pop_back();
+    }
+
+    if (open.empty()) break;
+  }
+
+  mFailed = false;
+}
+
+
+bool
+XMLElementSpans::failed () const
+{
+  return mFailed;
+}
+
+
+size_t
+XMLElementSpans::size () const
+{
+  return mSpans.size();
+}
+
+
+const XMLElementSpans::Span&
+XMLElementSpans::get (size_t n) const
+{
+  return mSpans[n];
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
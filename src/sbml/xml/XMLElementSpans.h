@@ -0,0 +1,102 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLElementSpans.h
+ * @brief   Where each element of a document starts and ends
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#ifndef XMLElementSpans_h
+#define XMLElementSpans_h
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <vector>
+
+#include <sbml/xml/XMLExtern.h>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * Where each element of a document starts and ends, in the order of their
+ * start tags, which is the order the XML parser reports them in.  This
+ * lets the text of the elements be found again from their start tokens
+ * (see XMLInputStream::setElementSpans()).  Documents that
+ * XMLElementScanner cannot scan have no spans.
+ */
+class LIBLAX_EXTERN XMLElementSpans
+{
+public:
+
+  /* an element, from its start tag to its end tag, is [begin, end) */
+  struct Span
+  {
+    size_t begin;
+    size_t end;
+  };
+
+
+  XMLElementSpans (const char* content, size_t length);
+
+
+  bool failed () const;
+
+
+  size_t size () const;
+
+
+  /*
+   * Returns the span of the element with the @p n th start tag of the
+   * document, counting from 0.
+   */
+  const Span& get (size_t n) const;
+
+
+private:
+
+  std::vector<Span> mSpans;
+  bool              mFailed;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* XMLElementSpans_h */
+
+/** @endcond */
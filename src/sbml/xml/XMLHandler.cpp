@@ -41,6 +41,7 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <sbml/xml/XMLElementFilter.h>
 #include <sbml/xml/XMLHandler.h>
 #include <sbml/xml/XMLToken.h>
 
@@ -52,6 +53,8 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  * Creates a new XMLHandler.
  */
 XMLHandler::XMLHandler ()
+  : mElementFilter (NULL)
+  , mSkipDepth     (0)
 {
 }
 
@@ -59,7 +62,9 @@ XMLHandler::XMLHandler ()
 /**
  * Copy Constructor
  */
-XMLHandler::XMLHandler (const XMLHandler&)
+XMLHandler::XMLHandler (const XMLHandler& orig)
+  : mElementFilter (orig.mElementFilter)
+  , mSkipDepth     (0)
 {
 }
 
@@ -70,7 +75,13 @@ XMLHandler::XMLHandler (const XMLHandler&)
 XMLHandler&
 XMLHandler::operator=(const XMLHandler& rhs)
 {
-    return *this;
+  if (&rhs != this)
+  {
+    mElementFilter = rhs.mElementFilter;
+    mSkipDepth     = 0;
+  }
+
+  return *this;
 }
 
     
@@ -154,5 +165,110 @@ XMLHandler::characters (const XMLToken& )
 {
 }
 
+
+/*
+ * Receive notification of the start of an element, in a token whose
+ * content may be taken by the handler.
+ *
+ * By default, calls startElement().
+ */
+void
+XMLHandler::takeStartElement (XMLToken& element)
+{
+  startElement(element);
+}
+
+
+/*
+ * Receive notification of the end of an element, in a token whose
+ * content may be taken by the handler.
+ *
+ * By default, calls endElement().
+ */
+void
+XMLHandler::takeEndElement (XMLToken& element)
+{
+  endElement(element);
+}
+
+
+/*
+ * Receive notification of character data, in a token whose content may
+ * be taken by the handler.
+ *
+ * By default, calls characters().
+ */
+void
+XMLHandler::takeCharacters (XMLToken& data)
+{
+  characters(data);
+}
+
+
+/*
+ * Sets the elements left out of the document.
+ */
+void
+XMLHandler::setElementFilter (const XMLElementFilter* filter)
+{
+  mElementFilter = filter;
+  mSkipDepth     = 0;
+}
+
+
+/*
+ * @return the elements left out of the document, or NULL.
+ */
+const XMLElementFilter*
+XMLHandler::getElementFilter () const
+{
+  return mElementFilter;
+}
+
+
+/*
+ * @return true if the element starting is left out.
+ */
+bool
+XMLHandler::skipStartElement (const char* name, const char* uri)
+{
+  if (mSkipDepth > 0)
+  {
+    ++mSkipDepth;
+    return true;
+  }
+
+  if (mElementFilter != NULL && mElementFilter->skips(name, uri))
+  {
+    mSkipDepth = 1;
+    return true;
+  }
+
+  return false;
+}
+
+
+/*
+ * @return true if the element ending is left out.
+ */
+bool
+XMLHandler::skipEndElement ()
+{
+  if (mSkipDepth == 0) return false;
+
+  --mSkipDepth;
+  return true;
+}
+
+
+/*
+ * @return true while inside an element that is left out.
+ */
+bool
+XMLHandler::isSkipping () const
+{
+  return mSkipDepth > 0;
+}
+
 LIBSBML_CPP_NAMESPACE_END
 /** @endcond */
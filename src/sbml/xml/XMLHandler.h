@@ -57,6 +57,7 @@
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
+class XMLElementFilter;
 class XMLToken;
 
 class LIBLAX_EXTERN XMLHandler
@@ -145,6 +146,81 @@ public:
    * to take specific actions for each chunk of character data.
    */
   virtual void characters (const XMLToken& data);
+
+
+  /**
+   * Receive notification of the start of an element, in a token whose
+   * content the handler may take instead of copying it, leaving the
+   * token in an unspecified state.
+   *
+   * By default, calls startElement().  The parsers call this method
+   * rather than startElement(), so that a handler that keeps the tokens
+   * does not need to copy them.
+   */
+  virtual void takeStartElement (XMLToken& element);
+
+
+  /**
+   * Receive notification of the end of an element, in a token whose
+   * content the handler may take (see takeStartElement()).
+   *
+   * By default, calls endElement().
+   */
+  virtual void takeEndElement (XMLToken& element);
+
+
+  /**
+   * Receive notification of character data inside an element, in a token
+   * whose content the handler may take (see takeStartElement()).
+   *
+   * By default, calls characters().
+   */
+  virtual void takeCharacters (XMLToken& data);
+
+
+  /**
+   * Sets the elements left out of the document, or none if @p filter is
+   * @c NULL.  The filter is not copied and must outlive the parsing.
+   */
+  void setElementFilter (const XMLElementFilter* filter);
+
+
+  /**
+   * Returns the elements left out of the document, or @c NULL.
+   */
+  const XMLElementFilter* getElementFilter () const;
+
+
+  /**
+   * Called by the parsers at the start of an element named @p name in the
+   * namespace @p uri, before they make a token of it.
+   *
+   * @return @c true if the element is left out, either by the filter or
+   * because it is inside an element that is, in which case the parser
+   * makes no token of it.
+   */
+  bool skipStartElement (const char* name, const char* uri);
+
+
+  /**
+   * Called by the parsers at the end of an element.
+   *
+   * @return @c true if the element is left out.
+   */
+  bool skipEndElement ();
+
+
+  /**
+   * Returns @c true while the parser is inside an element that is left
+   * out, so that it makes no token of the character data.
+   */
+  bool isSkipping () const;
+
+
+protected:
+
+  const XMLElementFilter* mElementFilter;
+  unsigned int            mSkipDepth;
 };
 
 LIBSBML_CPP_NAMESPACE_END
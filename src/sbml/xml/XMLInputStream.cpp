@@ -45,6 +45,7 @@
 #include <sbml/xml/XMLParser.h>
 
 #include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLElementSpans.h>
 
 using namespace std;
 
@@ -65,6 +66,10 @@ XMLInputStream::XMLInputStream (  const char*   content
    mIsError ( false )
  , mParser  ( XMLParser::create( mTokenizer, library) )
  , mSBMLns  ( NULL )
+ , mItemsReader ( NULL )
+ , mDeferredReader ( NULL )
+ , mSpans ( NULL )
+ , mNumStarts ( 0 )
 {
   // if the content points to nothing throw an exception ??
   //if (content == NULL)
@@ -77,6 +82,28 @@ XMLInputStream::XMLInputStream (  const char*   content
     mIsError = true; 
 }
 
+/*
+ * Creates a new XMLInputStream reading the content of the given
+ * XMLBuffer as it becomes available.
+ */
+XMLInputStream::XMLInputStream (  XMLBuffer&          source
+                                , const std::string&  library
+                                , XMLErrorLog*        errorLog ) :
+   mIsError ( false )
+ , mParser  ( XMLParser::create( mTokenizer, library) )
+ , mSBMLns  ( NULL )
+ , mItemsReader ( NULL )
+ , mDeferredReader ( NULL )
+ , mSpans ( NULL )
+ , mNumStarts ( 0 )
+{
+  if ( !isGood() ) return;
+  if ( errorLog != NULL ) setErrorLog(errorLog);
+  if (!mParser->parseFirstFrom(source))
+    mIsError = true;
+}
+
+
  /**
  * Copy Constructor, made private so as to notify users, that copying an input stream is not supported. 
  */
@@ -84,6 +111,10 @@ XMLInputStream::XMLInputStream (  const char*   content
    : mIsError(true)   
    , mParser(NULL)
    , mSBMLns(NULL)
+   , mItemsReader(NULL)
+   , mDeferredReader(NULL)
+   , mSpans(NULL)
+   , mNumStarts(0)
  {
  }
 
@@ -191,7 +222,13 @@ XMLToken
 XMLInputStream::next ()
 {
   queueToken();
-  return mTokenizer.hasNext() ? mTokenizer.next() : XMLToken();
+  if (!mTokenizer.hasNext()) return XMLToken();
+
+  if (mSpans == NULL) return mTokenizer.next();
+
+  XMLToken token = mTokenizer.next();
+  if (token.isStart()) ++mNumStarts;
+  return token;
 }
 
 
@@ -250,6 +287,29 @@ XMLInputStream::requeueToken ()
 }
 
 
+/*
+ * Runs mParser until the end of the element being read has been queued.
+ * The tokens are looked at only once as they are queued, so that the
+ * lookahead functions below need to scan the queue once instead of after
+ * every chunk parsed.
+ */
+bool
+XMLInputStream::requeueToEndOfElement ()
+{
+  size_t scanned = 0;
+  unsigned int depth = 0;
+  bool requeued = false;
+
+  while (mTokenizer.isEndOfElementQueued(scanned, depth) == false
+         && requeueToken() == true)
+  {
+    requeued = true;
+  }
+
+  return requeued;
+}
+
+
 /*
  * Sets the XMLErrorLog this stream will use to log errors.
  */
@@ -322,6 +382,11 @@ XMLInputStream::determineNumberChildren(const std::string elementName)
   bool valid = false;
   unsigned int num = this->mTokenizer.determineNumberChildren(valid, elementName);
 
+  if (valid == false && requeueToEndOfElement() == true)
+  {
+    num = this->mTokenizer.determineNumberChildren(valid, elementName);
+  }
+
   bool canReQ = true;
   while (canReQ == true && isGood() == true && valid == false)
   {
@@ -344,6 +409,12 @@ XMLInputStream::determineNumSpecificChildren(const std::string& childName,
   unsigned int num = this->mTokenizer.determineNumSpecificChildren(valid, 
                                                        childName, container);
 
+  if (valid == false && requeueToEndOfElement() == true && isGood() == true)
+  {
+    num = this->mTokenizer.determineNumSpecificChildren(valid, 
+                                                       childName, container);
+  }
+
   while (isGood() == true && valid == false)
   {
     requeueToken();
@@ -380,6 +451,91 @@ XMLInputStream::containsChild(const std::string& childName,
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Makes the elements read from the given position of the content onwards
+ * report their positions as if that place were at toLine and toColumn.
+ */
+void
+XMLInputStream::addRelocation (unsigned int line, unsigned int column,
+                               unsigned int toLine, unsigned int toColumn)
+{
+  mTokenizer.addRelocation(line, column, toLine, toColumn);
+}
+
+
+void
+XMLInputStream::setListOfItemsReader (ListOfItemsReader* reader)
+{
+  mItemsReader = reader;
+}
+
+
+ListOfItemsReader*
+XMLInputStream::getListOfItemsReader () const
+{
+  return mItemsReader;
+}
+
+
+void
+XMLInputStream::setDeferredElementReader (DeferredElementReader* reader)
+{
+  mDeferredReader = reader;
+}
+
+
+DeferredElementReader*
+XMLInputStream::getDeferredElementReader () const
+{
+  return mDeferredReader;
+}
+
+
+void
+XMLInputStream::setElementFilter (const XMLElementFilter* filter)
+{
+  mTokenizer.setElementFilter(filter);
+}
+
+
+const XMLElementFilter*
+XMLInputStream::getElementFilter () const
+{
+  return mTokenizer.getElementFilter();
+}
+
+
+void
+XMLInputStream::setElementSpans (const XMLElementSpans* spans)
+{
+  mSpans     = spans;
+  mNumStarts = 0;
+}
+
+
+bool
+XMLInputStream::getElementSpan (size_t& begin, size_t& end) const
+{
+  if (mSpans == NULL || mNumStarts == 0 || mNumStarts > mSpans->size())
+  {
+    return false;
+  }
+
+  begin = mSpans->get(mNumStarts - 1).begin;
+  end   = mSpans->get(mNumStarts - 1).end;
+  return true;
+}
+
+
+size_t
+XMLInputStream::getNumElementsStarted () const
+{
+  return mNumStarts;
+}
+/** @endcond */
+
+
 LIBLAX_EXTERN
 XMLInputStream_t *
 XMLInputStream_create (const char* content, int isFile, const char *library)
@@ -129,8 +129,13 @@
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
+class XMLBuffer;
 class XMLErrorLog;
 class XMLParser;
+class ListOfItemsReader;
+class DeferredElementReader;
+class XMLElementFilter;
+class XMLElementSpans;
 
 
 class LIBLAX_EXTERN XMLInputStream
@@ -159,6 +164,27 @@ public:
                   , XMLErrorLog*       errorLog = NULL );
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Creates a new XMLInputStream reading the content of @p source as it
+   * becomes available, which must outlive the stream.
+   *
+   * @param source the XMLBuffer the content is read from.
+   *
+   * @param library the name of the parser library to use.
+   *
+   * @param errorLog the XMLErrorLog object to use.
+   */
+  XMLInputStream (  XMLBuffer&         source
+                  , const std::string& library
+                  , XMLErrorLog*       errorLog );
+  /** @endcond */
+
+#endif  /* !SWIG */
+
+
   /**
    * Destroys this XMLInputStream.
    */
@@ -385,6 +411,98 @@ public:
   bool containsChild(const std::string& childName,
                                             const std::string& container);
 
+
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Makes the elements read from the given @p line and @p column of the
+   * content onwards report their positions as if that place were at
+   * @p toLine and @p toColumn.
+   *
+   * This is used when the content is put together from pieces of a
+   * document, so that the positions of the elements are those in the
+   * original document.  Relocations must be added in the order of the
+   * content, before anything is read from the stream.
+   */
+  void addRelocation (unsigned int line, unsigned int column,
+                      unsigned int toLine, unsigned int toColumn);
+
+
+  /**
+   * Sets the object that SBase::read() lets read the children of the
+   * elements read from this stream, when the items of lists are read
+   * separately (see ParallelListOfReader).
+   */
+  void setListOfItemsReader (ListOfItemsReader* reader);
+
+
+  /**
+   * Returns the object set with setListOfItemsReader(), or @c NULL.
+   */
+  ListOfItemsReader* getListOfItemsReader () const;
+
+
+  /**
+   * Sets the object that SBase::read() lets read the placeholders left in
+   * the place of the <code>&lt;notes&gt;</code> and
+   * <code>&lt;annotation&gt;</code> elements to be read later (see
+   * DeferredElementReader).
+   */
+  void setDeferredElementReader (DeferredElementReader* reader);
+
+
+  /**
+   * Returns the object set with setDeferredElementReader(), or @c NULL.
+   */
+  DeferredElementReader* getDeferredElementReader () const;
+
+
+  /**
+   * Sets the elements the parser leaves out of this stream, with all they
+   * contain, or none if @p filter is @c NULL.  No tokens are made for
+   * them.  Must be called before anything is read from the stream, and
+   * @p filter must outlive it.
+   */
+  void setElementFilter (const XMLElementFilter* filter);
+
+
+  /**
+   * Returns the object set with setElementFilter(), or @c NULL.
+   */
+  const XMLElementFilter* getElementFilter () const;
+
+
+  /**
+   * Sets where the elements of the content start and end, so that the
+   * text of the element last started can be found with
+   * getElementSpan().  Must be called before anything is read from the
+   * stream, and @p spans must outlive it.
+   */
+  void setElementSpans (const XMLElementSpans* spans);
+
+
+  /**
+   * Sets @p begin and @p end to where, in the content, the element whose
+   * start token was last returned by next() starts and ends.
+   *
+   * @return @c false if no spans have been set or no element has been
+   * started.
+   */
+  bool getElementSpan (size_t& begin, size_t& end) const;
+
+
+  /**
+   * Returns the number of start tokens returned by next() since
+   * setElementSpans() was called, which is the number of spans once the
+   * whole content has been read.
+   */
+  size_t getNumElementsStarted () const;
+
+  /** @endcond */
+
+#endif  /* !SWIG */
+
 private:
   /** @cond doxygenLibsbmlInternal */
   /**
@@ -420,6 +538,14 @@ protected:
   bool requeueToken ();
 
 
+  /**
+   * Runs mParser until the end of the element being read has been queued
+   * by mTokenizer, the end of the document is reached or a fatal error
+   * occurs.  Returns true if any token was queued.
+   */
+  bool requeueToEndOfElement ();
+
+
   bool mIsError;
 
   XMLToken     mEOF;
@@ -428,6 +554,13 @@ protected:
 
   SBMLNamespaces* mSBMLns;
 
+  ListOfItemsReader* mItemsReader;
+
+  DeferredElementReader* mDeferredReader;
+
+  const XMLElementSpans* mSpans;
+  size_t                 mNumStarts;
+
   /** @endcond */
 };
 
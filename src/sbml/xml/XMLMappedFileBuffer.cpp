@@ -0,0 +1,219 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLMappedFileBuffer.cpp
+ * @brief   XMLMappedFileBuffer implements the XMLBuffer interface for
+ *          files mapped into memory
+ *
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <climits>
+#include <cstring>
+
+#if defined (WIN32) && !defined (CYGWIN)
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#endif
+
+#include <sbml/xml/XMLMappedFileBuffer.h>
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * @return true if filename ends with suffix.
+ */
+static bool
+hasSuffix (const string& filename, const char* suffix)
+{
+  size_t length = strlen(suffix);
+
+  return filename.length() >= length
+      && filename.compare(filename.length() - length, length, suffix) == 0;
+}
+
+
+/*
+ * Maps the given file into memory, unless it is compressed, is not a
+ * regular file, is empty or is too large to be given to the parsers.
+ */
+XMLMappedFileBuffer::XMLMappedFileBuffer (const string& filename) :
+   mData  ( NULL )
+ , mLength( 0    )
+ , mOffset( 0    )
+{
+  // compressed files are read through the decompressing streams of
+  // XMLFileBuffer
+  if (hasSuffix(filename, ".gz") || hasSuffix(filename, ".bz2")
+      || hasSuffix(filename, ".zip"))
+  {
+    return;
+  }
+
+#if defined (WIN32) && !defined (CYGWIN)
+
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE) return;
+
+  LARGE_INTEGER size;
+  if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &size)
+      && size.QuadPart > 0 && size.QuadPart <= INT_MAX)
+  {
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL)
+    {
+      mData = static_cast<const char*>(
+                MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      if (mData != NULL) mLength = (unsigned int)size.QuadPart;
+
+      // the view keeps the mapping, and the file, open
+      CloseHandle(mapping);
+    }
+  }
+
+  CloseHandle(file);
+
+#else
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat status;
+  if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode)
+      && status.st_size > 0 && status.st_size <= INT_MAX)
+  {
+    void* data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE,
+                      fd, 0);
+    if (data != MAP_FAILED)
+    {
+#ifdef MADV_SEQUENTIAL
+      madvise(data, (size_t)status.st_size, MADV_SEQUENTIAL);
+#endif
+      mData   = static_cast<const char*>(data);
+      mLength = (unsigned int)status.st_size;
+    }
+  }
+
+  // the mapping stays valid once the file is closed
+  close(fd);
+
+#endif
+}
+
+
+/*
+ * Destroys this XMLMappedFileBuffer and unmaps the underlying file.
+ */
+XMLMappedFileBuffer::~XMLMappedFileBuffer ()
+{
+  if (mData == NULL) return;
+
+#if defined (WIN32) && !defined (CYGWIN)
+  UnmapViewOfFile(mData);
+#else
+  munmap(const_cast<char*>(mData), mLength);
+#endif
+}
+
+
+/*
+ * Copies at most nbytes from this XMLMappedFileBuffer to the memory
+ * pointed to by destination.
+ *
+ * @return the number of bytes actually copied (may be 0).
+ */
+unsigned int
+XMLMappedFileBuffer::copyTo (void* destination, unsigned int bytes)
+{
+  const char* data = readInPlace(bytes);
+  if (data == NULL) return 0;
+
+  memcpy(destination, data, bytes);
+  return bytes;
+}
+
+
+/*
+ * @return true if the file could not be mapped into memory, false
+ * otherwise.
+ */
+bool
+XMLMappedFileBuffer::error ()
+{
+  return (mData == NULL);
+}
+
+
+/*
+ * Returns a pointer to at most bytes bytes of the mapped file, and moves
+ * past them.
+ */
+const char*
+XMLMappedFileBuffer::readInPlace (unsigned int& bytes)
+{
+  if (mData == NULL) return NULL;
+
+  if (mOffset >= mLength) bytes = 0;
+  else if (bytes > mLength - mOffset) bytes = mLength - mOffset;
+
+  const char* data = mData + mOffset;
+  mOffset += bytes;
+
+  return data;
+}
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
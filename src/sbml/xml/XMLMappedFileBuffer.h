@@ -0,0 +1,120 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLMappedFileBuffer.h
+ * @brief   XMLMappedFileBuffer implements the XMLBuffer interface for
+ *          files mapped into memory
+ *
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#ifndef XMLMappedFileBuffer_h
+#define XMLMappedFileBuffer_h
+
+#ifdef __cplusplus
+
+#include <string>
+
+#include <sbml/xml/XMLBuffer.h>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class XMLMappedFileBuffer : public XMLBuffer
+{
+public:
+
+  /**
+   * Creates a XMLBuffer based on the given file, which is mapped into
+   * memory so that its content can be given to the parser without being
+   * read or copied.
+   *
+   * Only regular, uncompressed files can be mapped: error() returns
+   * @c true for any other file (including a compressed one, or a file
+   * too large to be mapped), which should then be read with an
+   * XMLFileBuffer instead.
+   */
+  XMLMappedFileBuffer (const std::string& filename);
+
+
+  /**
+   * Destroys this XMLMappedFileBuffer and unmaps the underlying file.
+   */
+  virtual ~XMLMappedFileBuffer ();
+
+
+  /**
+   * Copies at most nbytes from this XMLMappedFileBuffer to the memory
+   * pointed to by destination.
+   *
+   * @return the number of bytes actually copied (may be 0).
+   */
+  virtual unsigned int copyTo (void* destination, unsigned int bytes);
+
+
+  /**
+   * Returns @c true if the file could not be mapped into memory,
+   * @c false otherwise.
+   */
+  virtual bool error ();
+
+
+  /**
+   * Returns a pointer to at most @p bytes bytes of the mapped file, and
+   * moves past them; @p bytes is set to the number of bytes available at
+   * the pointer.
+   */
+  virtual const char* readInPlace (unsigned int& bytes);
+
+
+private:
+
+  XMLMappedFileBuffer ();
+  XMLMappedFileBuffer (const XMLMappedFileBuffer&);
+  XMLMappedFileBuffer& operator= (const XMLMappedFileBuffer&);
+
+  const char*   mData;
+  unsigned int  mLength;
+  unsigned int  mOffset;
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* XMLMappedFileBuffer_h */
+
+/** @endcond */
@@ -108,5 +108,24 @@ XMLMemoryBuffer::error ()
 }
 
 
+/*
+ * Returns a pointer to at most bytes bytes of the content, and moves past
+ * them.
+ */
+const char*
+XMLMemoryBuffer::readInPlace (unsigned int& bytes)
+{
+  if (mBuffer == NULL) return NULL;
+
+  if (mOffset >= mLength) bytes = 0;
+  else if (bytes > mLength - mOffset) bytes = mLength - mOffset;
+
+  const char* data = mBuffer + mOffset;
+  mOffset += bytes;
+
+  return data;
+}
+
+
 LIBSBML_CPP_NAMESPACE_END
 /** @endcond */
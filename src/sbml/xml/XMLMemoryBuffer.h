@@ -86,6 +86,14 @@ public:
   virtual bool error ();
 
 
+  /**
+   * Returns a pointer to at most @p bytes bytes of the content of this
+   * XMLMemoryBuffer, and moves past them; @p bytes is set to the number
+   * of bytes available at the pointer.
+   */
+  virtual const char* readInPlace (unsigned int& bytes);
+
+
 private:
 
   XMLMemoryBuffer ();
@@ -41,6 +41,7 @@
 
 /** @cond doxygenLibsbmlInternal */
 #include <sbml/xml/XMLOutputStream.h>
+#include <sbml/xml/XMLStringPool.h>
 #include <sbml/util/util.h>
 /** @endcond */
 
@@ -109,6 +110,26 @@ XMLNamespaces::clone () const
   return new XMLNamespaces(*this);
 }
 
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Exchanges the content of this XMLNamespaces list with that of other.
+ */
+void
+XMLNamespaces::swap (XMLNamespaces& other)
+{
+  mNamespaces.swap(other.mNamespaces);
+}
+
+
+bool
+XMLNamespaces::isIdentical (const XMLNamespaces& other) const
+{
+  // the prefixes and URIs are interned, so their addresses are compared
+  return mNamespaces == other.mNamespaces;
+}
+/** @endcond */
+
 /*
  * Appends an XML namespace prefix/URI pair to this list of namespace
  * declarations.
@@ -149,7 +170,8 @@ XMLNamespaces::add (const std::string& uri, const std::string prefix)
     if ( prefix.empty()    ) removeDefault();
     if ( hasPrefix(prefix) ) remove(prefix);
 
-    mNamespaces.push_back( make_pair(prefix, uri) );
+    mNamespaces.push_back( make_pair(XMLStringPool::intern(prefix),
+                                     XMLStringPool::intern(uri)) );
     return LIBSBML_OPERATION_SUCCESS;
   }
 }
@@ -217,9 +239,14 @@ XMLNamespaces::clear ()
 int
 XMLNamespaces::getIndex (const std::string& uri) const
 {
+  // the URIs are interned: only a URI found in the pool can be declared
+  // here, and then it is the same string
+  const std::string* interned = XMLStringPool::find(uri);
+  if (interned == NULL) return -1;
+
   for (int index = 0; index < getLength(); ++index)
   {
-    if (getURI(index) == uri) return index;
+    if (mNamespaces[(size_t)index].second == interned) return index;
   }
   
   return -1;
@@ -242,9 +269,12 @@ XMLNamespaces::containsUri(const std::string& uri) const
 int
 XMLNamespaces::getIndexByPrefix (const std::string& prefix) const
 {
+  const std::string* interned = XMLStringPool::find(prefix);
+  if (interned == NULL) return -1;
+
   for (int index = 0; index < getLength(); ++index)
   {
-     if (getPrefix(index) == prefix) return index;
+     if (mNamespaces[(size_t)index].first == interned) return index;
   }
   
   return -1;
@@ -279,7 +309,7 @@ XMLNamespaces::getNumNamespaces () const
 std::string
 XMLNamespaces::getPrefix (int index) const
 {
-  return (index < 0 || index >= getLength()) ? std::string() : mNamespaces[index].first;
+  return (index < 0 || index >= getLength()) ? std::string() : *mNamespaces[index].first;
 }
 
 
@@ -302,7 +332,7 @@ XMLNamespaces::getPrefix (const std::string& uri) const
 std::string
 XMLNamespaces::getURI (int index) const
 {
-  return (index < 0 || index >= getLength()) ? std::string() : mNamespaces[index].second;
+  return (index < 0 || index >= getLength()) ? std::string() : *mNamespaces[index].second;
 }
 
 
@@ -314,12 +344,7 @@ XMLNamespaces::getURI (int index) const
 std::string
 XMLNamespaces::getURI (const std::string prefix) const
 {
-  for (int index = 0; index < getLength(); ++index)
-  {
-    if (getPrefix(index) == prefix) return getURI(index);
-  }
-  
-  return std::string();
+  return getURI( getIndexByPrefix(prefix) );
 }
 
 
@@ -359,9 +384,14 @@ bool XMLNamespaces::hasPrefix(const std::string& prefix) const
  */
 bool XMLNamespaces::hasNS(const std::string& uri, const std::string& prefix) const
 {
-  for (int i= 0; i < getLength(); ++i)
+  const std::string* internedURI    = XMLStringPool::find(uri);
+  const std::string* internedPrefix = XMLStringPool::find(prefix);
+  if (internedURI == NULL || internedPrefix == NULL) return false;
+
+  for (size_t i = 0; i < mNamespaces.size(); ++i)
   {
-     if ( (getURI(i) == uri) && (getPrefix(i) == prefix) ) 
+     if ( mNamespaces[i].second == internedURI
+       && mNamespaces[i].first  == internedPrefix ) 
        return true;
   }
 
@@ -380,7 +410,7 @@ XMLNamespaces::removeDefault ()
 
   for (i = mNamespaces.begin(); i != mNamespaces.end(); ++i)
   {
-    if (i->first.empty())
+    if (i->first->empty())
     {
       mNamespaces.erase(i);
       break;
@@ -127,6 +127,26 @@ public:
   XMLNamespaces* clone () const;
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Exchanges the content of this XMLNamespaces with that of @p other, without
+   * copying the prefixes and URIs.
+   */
+  void swap (XMLNamespaces& other);
+
+
+  /**
+   * Returns @c true if this XMLNamespaces has the same prefixes and URIs
+   * as @p other, in the same order.
+   */
+  bool isIdentical (const XMLNamespaces& other) const;
+  /** @endcond */
+
+#endif
+
+
   /**
    * Appends an XML namespace prefix and URI pair to this list of namespace
    * declarations.
@@ -420,7 +440,8 @@ protected:
 
   bool containIdenticalSetNS(XMLNamespaces* rhs);
 
-  typedef std::pair<std::string, std::string> PrefixURIPair;
+  /* the prefix and URI, interned by XMLStringPool */
+  typedef std::pair<const std::string*, const std::string*> PrefixURIPair;
   std::vector<PrefixURIPair> mNamespaces;
 
   /** @endcond */
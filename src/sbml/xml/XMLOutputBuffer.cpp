@@ -0,0 +1,352 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLOutputBuffer.cpp
+ * @brief   Buffers the output of an XMLOutputStream for a sink
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#if defined (WIN32) && !defined (CYGWIN)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+#include <sbml/xml/XMLOutputBuffer.h>
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+XMLOutputSink::XMLOutputSink ()
+{
+}
+
+
+XMLOutputSink::~XMLOutputSink ()
+{
+}
+
+
+bool
+XMLOutputSink::flush ()
+{
+  return true;
+}
+
+
+XMLFileDescriptorSink::XMLFileDescriptorSink (int fd, bool closeOnDelete)
+  : mFd(fd)
+  , mCloseOnDelete(closeOnDelete)
+{
+}
+
+
+/*
+ * The file is opened in text mode on Windows, as std::ofstream does, so
+ * that the line ends written are the same.
+ */
+XMLFileDescriptorSink::XMLFileDescriptorSink (const std::string& filename)
+  : mFd(-1)
+  , mCloseOnDelete(true)
+{
+#if defined (WIN32) && !defined (CYGWIN)
+  mFd = _open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_TEXT,
+              _S_IREAD | _S_IWRITE);
+#else
+  mFd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+#endif
+}
+
+
+XMLFileDescriptorSink::~XMLFileDescriptorSink ()
+{
+  close();
+}
+
+
+bool
+XMLFileDescriptorSink::isOpen () const
+{
+  return mFd >= 0;
+}
+
+
+bool
+XMLFileDescriptorSink::close ()
+{
+  if (!mCloseOnDelete || mFd < 0) return true;
+
+#if defined (WIN32) && !defined (CYGWIN)
+  bool result = _close(mFd) == 0;
+#else
+  bool result = ::close(mFd) == 0;
+#endif
+
+  mFd = -1;
+  return result;
+}
+
+
+bool
+XMLFileDescriptorSink::write (const char* data, size_t length)
+{
+  if (mFd < 0) return false;
+
+  while (length > 0)
+  {
+    const size_t chunk = (length < (size_t)INT_MAX) ? length : INT_MAX;
+
+#if defined (WIN32) && !defined (CYGWIN)
+    int written = _write(mFd, data, (unsigned int)chunk);
+#else
+    ssize_t written = ::write(mFd, data, chunk);
+#endif
+
+    if (written < 0 && errno == EINTR) continue;
+    if (written <= 0) return false;
+
+    data   += written;
+    length -= (size_t)written;
+  }
+
+  return true;
+}
+
+
+XMLMemorySink::XMLMemorySink ()
+  : mBuffer(NULL)
+  , mLength(0)
+  , mCapacity(0)
+{
+}
+
+
+XMLMemorySink::~XMLMemorySink ()
+{
+  free(mBuffer);
+}
+
+
+/*
+ * Makes room for length more bytes and the terminating NUL, at least
+ * doubling the capacity so that the content is copied a few times only.
+ */
+bool
+XMLMemorySink::reserve (size_t length)
+{
+  if (mCapacity - mLength > length) return true;
+
+  size_t capacity = (mCapacity > 0) ? mCapacity : 4096;
+  while (capacity - mLength <= length)
+  {
+    capacity *= 2;
+  }
+
+  char* buffer = static_cast<char*>(realloc(mBuffer, capacity));
+  if (buffer == NULL) return false;
+
+  mBuffer   = buffer;
+  mCapacity = capacity;
+  return true;
+}
+
+
+bool
+XMLMemorySink::write (const char* data, size_t length)
+{
+  if (!reserve(length)) return false;
+
+  memcpy(mBuffer + mLength, data, length);
+  mLength += length;
+  mBuffer[mLength] = '\0';
+
+  return true;
+}
+
+
+const char*
+XMLMemorySink::getBuffer () const
+{
+  return (mBuffer != NULL) ? mBuffer : "";
+}
+
+
+size_t
+XMLMemorySink::getLength () const
+{
+  return mLength;
+}
+
+
+char*
+XMLMemorySink::release ()
+{
+  char* buffer = mBuffer;
+
+  if (buffer == NULL)
+  {
+    buffer = static_cast<char*>(malloc(1));
+    if (buffer != NULL) buffer[0] = '\0';
+  }
+
+  mBuffer   = NULL;
+  mLength   = 0;
+  mCapacity = 0;
+
+  return buffer;
+}
+
+
+XMLOStreamSink::XMLOStreamSink (std::ostream& stream)
+  : mStream(stream)
+{
+}
+
+
+bool
+XMLOStreamSink::write (const char* data, size_t length)
+{
+  mStream.write(data, (streamsize)length);
+  return !mStream.fail();
+}
+
+
+bool
+XMLOStreamSink::flush ()
+{
+  mStream.flush();
+  return !mStream.fail();
+}
+
+
+const size_t XMLOutputBuffer::DEFAULT_SIZE = 256 * 1024;
+
+
+XMLOutputBuffer::XMLOutputBuffer (XMLOutputSink& sink, size_t size)
+  : mSink(sink)
+  , mBuffer(NULL)
+  , mSize(size > 0 ? size : 1)
+{
+  mBuffer = new char[mSize];
+  setp(mBuffer, mBuffer + mSize);
+}
+
+
+XMLOutputBuffer::~XMLOutputBuffer ()
+{
+  flushBuffer();
+  delete [] mBuffer;
+}
+
+
+/*
+ * Passes the content of the buffer on to the sink and empties it.
+ */
+bool
+XMLOutputBuffer::flushBuffer ()
+{
+  const size_t length = (size_t)(pptr() - pbase());
+  setp(mBuffer, mBuffer + mSize);
+
+  return length == 0 || mSink.write(mBuffer, length);
+}
+
+
+XMLOutputBuffer::int_type
+XMLOutputBuffer::overflow (int_type c)
+{
+  if (!flushBuffer()) return traits_type::eof();
+
+  if (traits_type::eq_int_type(c, traits_type::eof()))
+  {
+    return traits_type::not_eof(c);
+  }
+
+  *pptr() = traits_type::to_char_type(c);
+  pbump(1);
+
+  return c;
+}
+
+
+/*
+ * Runs of characters that do not fit are written to the sink directly
+ * once the buffer is flushed, if they are at least as large as the buffer.
+ */
+streamsize
+XMLOutputBuffer::xsputn (const char* s, streamsize n)
+{
+  if (n <= epptr() - pptr())
+  {
+    memcpy(pptr(), s, (size_t)n);
+    pbump((int)n);
+    return n;
+  }
+
+  if (!flushBuffer()) return 0;
+
+  if ((size_t)n >= mSize)
+  {
+    return mSink.write(s, (size_t)n) ? n : 0;
+  }
+
+  memcpy(pptr(), s, (size_t)n);
+  pbump((int)n);
+  return n;
+}
+
+
+int
+XMLOutputBuffer::sync ()
+{
+  return (flushBuffer() && mSink.flush()) ? 0 : -1;
+}
+
+LIBSBML_CPP_NAMESPACE_END
+/** @endcond */
@@ -0,0 +1,268 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLOutputBuffer.h
+ * @brief   Buffers the output of an XMLOutputStream for a sink
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class XMLOutputSink
+ * @sbmlbrief{core} Receives the output of an XMLOutputBuffer.
+ *
+ * An XMLOutputBuffer collects what is written to it and passes it on to
+ * its sink in large blocks.  The sinks provided write to a file
+ * descriptor (XMLFileDescriptorSink), to memory (XMLMemorySink) or to
+ * another std::ostream (XMLOStreamSink), such as the compressed streams
+ * opened by OutputCompressor.  Other destinations are added by deriving
+ * from XMLOutputSink.
+ */
+
+
+#ifndef XMLOutputBuffer_h
+#define XMLOutputBuffer_h
+
+#include <sbml/xml/XMLExtern.h>
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class LIBLAX_EXTERN XMLOutputSink
+{
+public:
+
+  virtual ~XMLOutputSink ();
+
+
+  /**
+   * Writes the @p length bytes at @p data.
+   *
+   * @return @c false if they could not all be written.
+   */
+  virtual bool write (const char* data, size_t length) = 0;
+
+
+  /**
+   * Passes on what has been written so far, if the sink holds any of it
+   * back.  By default, does nothing.
+   *
+   * @return @c false on failure.
+   */
+  virtual bool flush ();
+
+
+protected:
+
+  XMLOutputSink ();
+
+
+private:
+
+  XMLOutputSink (const XMLOutputSink&);
+  XMLOutputSink& operator= (const XMLOutputSink&);
+};
+
+
+class LIBLAX_EXTERN XMLFileDescriptorSink : public XMLOutputSink
+{
+public:
+
+  /**
+   * Writes to the file descriptor @p fd, which is closed by the
+   * destructor if @p closeOnDelete is @c true.
+   */
+  XMLFileDescriptorSink (int fd, bool closeOnDelete = false);
+
+
+  /**
+   * Creates or truncates the file @p filename and writes to it.  On
+   * failure, isOpen() returns @c false.
+   */
+  XMLFileDescriptorSink (const std::string& filename);
+
+
+  virtual ~XMLFileDescriptorSink ();
+
+
+  /**
+   * Returns @c true if the file descriptor could be opened.
+   */
+  bool isOpen () const;
+
+
+  /**
+   * Closes the file descriptor, if it is owned by this sink.
+   *
+   * @return @c false if closing failed, which can mean that not all of
+   * the content has reached the file.
+   */
+  bool close ();
+
+
+  virtual bool write (const char* data, size_t length);
+
+
+protected:
+
+  int  mFd;
+  bool mCloseOnDelete;
+};
+
+
+class LIBLAX_EXTERN XMLMemorySink : public XMLOutputSink
+{
+public:
+
+  /**
+   * Creates an empty XMLMemorySink.
+   */
+  XMLMemorySink ();
+
+
+  virtual ~XMLMemorySink ();
+
+
+  virtual bool write (const char* data, size_t length);
+
+
+  /**
+   * Returns the content written so far, followed by a NUL character.
+   * The pointer is valid until the next call to write() or release().
+   */
+  const char* getBuffer () const;
+
+
+  /**
+   * Returns the number of bytes written so far.
+   */
+  size_t getLength () const;
+
+
+  /**
+   * Returns the content written so far, followed by a NUL character, and
+   * leaves this sink empty.  The content is owned by the caller, and is
+   * freed with free().
+   */
+  char* release ();
+
+
+protected:
+
+  bool reserve (size_t length);
+
+  char*  mBuffer;
+  size_t mLength;
+  size_t mCapacity;
+};
+
+
+class LIBLAX_EXTERN XMLOStreamSink : public XMLOutputSink
+{
+public:
+
+  /**
+   * Writes to @p stream, which has to outlive this sink.
+   */
+  XMLOStreamSink (std::ostream& stream);
+
+
+  virtual bool write (const char* data, size_t length);
+
+  virtual bool flush ();
+
+
+protected:
+
+  std::ostream& mStream;
+};
+
+
+class LIBLAX_EXTERN XMLOutputBuffer : public std::streambuf
+{
+public:
+
+  /**
+   * The size of the buffer by default, 256 KB.
+   */
+  static const size_t DEFAULT_SIZE;
+
+
+  /**
+   * Creates a buffer of @p size bytes for @p sink, which has to outlive
+   * it.  An std::ostream created on this buffer writes to the sink.
+   */
+  XMLOutputBuffer (XMLOutputSink& sink, size_t size = DEFAULT_SIZE);
+
+
+  /**
+   * Passes the content still in the buffer on to the sink, and destroys
+   * this buffer.
+   */
+  virtual ~XMLOutputBuffer ();
+
+
+protected:
+
+  virtual int_type overflow (int_type c);
+
+  virtual std::streamsize xsputn (const char* s, std::streamsize n);
+
+  virtual int sync ();
+
+  bool flushBuffer ();
+
+  XMLOutputSink& mSink;
+  char*          mBuffer;
+  size_t         mSize;
+
+
+private:
+
+  XMLOutputBuffer (const XMLOutputBuffer&);
+  XMLOutputBuffer& operator= (const XMLOutputBuffer&);
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* XMLOutputBuffer_h */
+/** @endcond */
@@ -46,6 +46,7 @@
 #include <fstream>
 
 #include <cstdio>
+#include <cstring>
 #include <sbml/xml/XMLTriple.h>
 #include <sbml/xml/XMLOutputStream.h>
 #include <sbml/xml/XMLAttributes.h>
@@ -185,6 +186,66 @@ bool hasPredefinedEntity(const std::string &chars, size_t index)
 }   
 
 
+/*
+ * Returns true if c has to be escaped when written as text or as the
+ * value of an attribute.
+ */
+static inline bool
+isSpecialChar(char c)
+{
+  return c == '&' || c == '<' || c == '>' || c == '"' || c == '\'';
+}
+
+
+/*
+ * Returns true if any of the bytes of word is c.
+ *
+ * A byte of word ^ (ones * c) is zero where word has c; subtracting one
+ * from each byte sets the high bit of the zero bytes, which were clear in
+ * the word itself (a borrow can only mark the bytes above a zero byte).
+ */
+static inline bool
+hasByte(size_t word, unsigned char c)
+{
+  const size_t ones  = ~(size_t)0 / 255;
+  const size_t highs = ones * 0x80;
+  const size_t x     = word ^ (ones * c);
+
+  return ((x - ones) & ~x & highs) != 0;
+}
+
+
+/*
+ * Returns the position of the first character of chars, from index up to
+ * length, that has to be escaped, or length if there is none.  Most text
+ * has none, so the characters are looked at a word at a time.
+ */
+static size_t
+findSpecialChar(const char* chars, size_t index, size_t length)
+{
+  while (index + sizeof(size_t) <= length)
+  {
+    size_t word;
+    memcpy(&word, chars + index, sizeof(word));
+
+    if (hasByte(word, '&') || hasByte(word, '<') || hasByte(word, '>')
+        || hasByte(word, '"') || hasByte(word, '\''))
+    {
+      break;
+    }
+
+    index += sizeof(size_t);
+  }
+
+  while (index < length && !isSpecialChar(chars[index]))
+  {
+    ++index;
+  }
+
+  return index;
+}
+
+
 // boolean indicating whether the comment on the top of the file is
 // written (enabled by default)
 bool XMLOutputStream::mWriteComment = true;
@@ -193,6 +254,10 @@ bool XMLOutputStream::mWriteComment = true;
 // of writing (enabled by default)
 bool XMLOutputStream::mWriteTimestamp = true;
 
+// boolean indicating whether doubles are written with the fewest digits
+// that read back the same, rather than with 15 (enabled by default)
+bool XMLOutputStream::mWriteShortestDoubles = true;
+
 // the name of the library writing the file (i.e: libSBML)
 std::string XMLOutputStream::mLibraryName = "libSBML";
 
@@ -212,6 +277,8 @@ XMLOutputStream::XMLOutputStream (const XMLOutputStream& other)
   , mInText(other.mInText)
   , mSkipNextIndent(other.mSkipNextIndent)
   , mNextAmpersandIsRef(other.mNextAmpersandIsRef)
+  , mItemsWriter(other.mItemsWriter)
+  , mOriginalText(other.mOriginalText)
   , mStringStream(other.mStringStream)
 {
 }
@@ -243,6 +310,8 @@ XMLOutputStream::XMLOutputStream (  std::ostream&       stream
  , mSkipNextIndent ( false    )
  , mNextAmpersandIsRef( false )
  , mSBMLns (NULL)
+ , mItemsWriter (NULL)
+ , mOriginalText (NULL)
 {
 
   unsetStringStream();
@@ -784,29 +853,54 @@ bool XMLOutputStream::getStringStream()
 void
 XMLOutputStream::writeIndent (bool isEnd)
 {
+  static const char spaces[] = "                                        "
+                               "                                        ";
+
   if (mDoIndent)
   {
-    if (mIndent > 0 || isEnd) mStream << endl;
-    for (unsigned int n = 0; n < mIndent; ++n) mStream << ' ' << ' ';
+    // the lines are not flushed one by one, as endl would
+    if (mIndent > 0 || isEnd) mStream << '\n';
+
+    for (size_t n = 2 * (size_t)mIndent; n > 0; )
+    {
+      size_t length = (n < sizeof(spaces) - 1) ? n : sizeof(spaces) - 1;
+      mStream.write(spaces, (streamsize)length);
+      n -= length;
+    }
   }
 }
 
 
 /*
- * Outputs the given characters to the underlying stream.
+ * Outputs the given characters to the underlying stream.  The runs of
+ * characters that need no escaping are written at once.
  */
 void
 XMLOutputStream::writeChars (const std::string& chars)
 {
-  for (size_t i=0; i < chars.length(); i++)
+  const char*  data   = chars.data();
+  const size_t length = chars.length();
+  size_t       start  = 0;
+
+  while (start < length)
   {
-    const char& c = chars.at(i);
+    size_t i = findSpecialChar(data, start, length);
+
+    if (i > start)
+    {
+      mStream.write(data + start, (streamsize)(i - start));
+    }
+
+    if (i == length) break;
+
+    const char& c = data[i];
     if ( c == '&' && 
         (LIBSBML_CPP_NAMESPACE ::hasCharacterReference(chars, i) || 
          LIBSBML_CPP_NAMESPACE ::hasPredefinedEntity(chars,i)) )
       mNextAmpersandIsRef = true;
 
     *this << c;
+    start = i + 1;
   }
 }
 
@@ -882,26 +976,11 @@ XMLOutputStream::writeValue (const bool& value)
 void
 XMLOutputStream::writeValue (const double& value)
 {
-  mStream << '=' << '"';
-
-  if (value != value)
-  {
-    mStream << "NaN";
-  }
-  else if (value == numeric_limits<double>::infinity())
-  {
-    mStream << "INF";
-  }
-  else if (value == - numeric_limits<double>::infinity())
-  {
-    mStream << "-INF";
-  }
-  else
-  {
-    mStream.precision(LIBSBML_DOUBLE_PRECISION);
-    mStream <<   value;
-  }
+  char buffer[32];
+  int  length = util_formatDouble(buffer, value, mWriteShortestDoubles);
 
+  mStream << '=' << '"';
+  mStream.write(buffer, length);
   mStream << '"';
 }
 
@@ -1054,7 +1133,10 @@ XMLOutputStream::operator<< (const double& value)
     mStream << '>';
   }
 
-  mStream << value;
+  char buffer[32];
+  int  length = util_formatDouble(buffer, value, mWriteShortestDoubles);
+
+  mStream.write(buffer, length);
 
   return *this;
 }
@@ -1145,6 +1227,16 @@ void XMLOutputStream::setWriteTimestamp(bool writeTimestamp)
   mWriteTimestamp = writeTimestamp;
 }
 
+bool XMLOutputStream::getWriteShortestDoubles()
+{
+  return mWriteShortestDoubles;
+}
+
+void XMLOutputStream::setWriteShortestDoubles(bool writeShortestDoubles)
+{
+  mWriteShortestDoubles = writeShortestDoubles;
+}
+
 string XMLOutputStream::getLibraryName()
 {
   return mLibraryName;
@@ -1175,6 +1267,129 @@ void XMLOutputStream::setIndent(unsigned int indent)
   mIndent = indent;
 }
 
+
+bool
+XMLOutputStream::State::operator== (const State& other) const
+{
+  return inStart            == other.inStart
+      && doIndent           == other.doIndent
+      && indent             == other.indent
+      && inText             == other.inText
+      && skipNextIndent     == other.skipNextIndent
+      && nextAmpersandIsRef == other.nextAmpersandIsRef;
+}
+
+
+bool
+XMLOutputStream::State::operator!= (const State& other) const
+{
+  return !(*this == other);
+}
+
+
+/*
+ * Returns the state of this stream.
+ */
+XMLOutputStream::State
+XMLOutputStream::getState () const
+{
+  State state;
+
+  state.inStart            = mInStart;
+  state.doIndent           = mDoIndent;
+  state.indent             = mIndent;
+  state.inText             = mInText;
+  state.skipNextIndent     = mSkipNextIndent;
+  state.nextAmpersandIsRef = mNextAmpersandIsRef;
+
+  return state;
+}
+
+
+/*
+ * Sets the state of this stream.
+ */
+void
+XMLOutputStream::setState (const State& state)
+{
+  mInStart            = state.inStart;
+  mDoIndent           = state.doIndent;
+  mIndent             = state.indent;
+  mInText             = state.inText;
+  mSkipNextIndent     = state.skipNextIndent;
+  mNextAmpersandIsRef = state.nextAmpersandIsRef;
+}
+
+
+/*
+ * Writes characters formatted by another stream as they are.
+ */
+void
+XMLOutputStream::writeFormatted (const char* data, size_t length)
+{
+  mStream.write(data, (streamsize)length);
+}
+
+
+void
+XMLOutputStream::setListOfItemsWriter (ListOfItemsWriter* writer)
+{
+  mItemsWriter = writer;
+}
+
+
+ListOfItemsWriter*
+XMLOutputStream::getListOfItemsWriter () const
+{
+  return mItemsWriter;
+}
+
+
+void
+XMLOutputStream::setOriginalText (const std::string* text)
+{
+  mOriginalText = text;
+}
+
+
+const std::string*
+XMLOutputStream::getOriginalText () const
+{
+  return mOriginalText;
+}
+
+
+/*
+ * Writes an element of the original text as it is.
+ */
+void
+XMLOutputStream::writeOriginalText (size_t begin, size_t end)
+{
+  if (mOriginalText == NULL || begin >= end || end > mOriginalText->size())
+  {
+    return;
+  }
+
+  if (mInStart)
+  {
+    mStream << '>';
+    upIndent();
+  }
+
+  mInStart = false;
+
+  if (mInText && mSkipNextIndent)
+  {
+    mSkipNextIndent = false;
+  }
+  else
+  {
+    writeIndent();
+  }
+
+  mStream.write(mOriginalText->data() + begin, (streamsize)(end - begin));
+}
+
 XMLOutputStream::~XMLOutputStream()
 {
   if (mSBMLns != NULL) 
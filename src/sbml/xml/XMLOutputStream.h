@@ -243,6 +243,7 @@ on yyyy-MM-dd HH:mm with libSBML version <libsbml version>. -->
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class XMLTriple;
+class ListOfItemsWriter;
 
 
 class LIBLAX_EXTERN XMLOutputStream
@@ -748,6 +749,22 @@ on yyyy-MM-dd HH:mm with libSBML version <libsbml version>. -->
    */
   static void setWriteTimestamp(bool writeTimestamp);
 
+  /**
+   * @return a boolean, whether the output stream will write floating-point
+   * values with the fewest digits that read back as the same value, up to
+   * 17. (Enabled by default.)
+   */
+  static bool getWriteShortestDoubles();
+  /**
+   * sets a flag, whether the output stream will write floating-point
+   * values with the fewest digits that read back as the same value, up to
+   * 17.  When disabled, values are rounded to 15 significant digits, as
+   * earlier versions of libSBML did. (Enabled by default.)
+   *
+   * @param writeShortestDoubles the flag.
+   */
+  static void setWriteShortestDoubles(bool writeShortestDoubles);
+
 
   /**
    * @return the name of the library to be used in comments ('libSBML' by default).
@@ -777,6 +794,86 @@ on yyyy-MM-dd HH:mm with libSBML version <libsbml version>. -->
   /** @cond doxygenLibsbmlInternal */
   unsigned int getIndent();
   void setIndent(unsigned int indent);
+
+#ifndef SWIG
+
+  /**
+   * What decides how the next element or text written to a stream is
+   * formatted: whether a start tag is still open, whether text has just
+   * been written, and the indentation.
+   */
+  struct State
+  {
+    bool          inStart;
+    bool          doIndent;
+    unsigned int  indent;
+    bool          inText;
+    bool          skipNextIndent;
+    bool          nextAmpersandIsRef;
+
+    bool operator== (const State& other) const;
+    bool operator!= (const State& other) const;
+  };
+
+
+  /**
+   * Returns the state of this stream (see State).
+   */
+  State getState () const;
+
+
+  /**
+   * Sets the state of this stream, so that what it writes next is
+   * formatted as it would be on the stream that @p state was taken from.
+   */
+  void setState (const State& state);
+
+
+  /**
+   * Writes @p length characters of @p data, formatted by another stream,
+   * as they are.  The state of this stream is left unchanged; it is up to
+   * the caller to set it to that of the other stream afterwards.
+   */
+  void writeFormatted (const char* data, size_t length);
+
+
+  /**
+   * Sets the object that ListOf::writeElements() lets write the items of
+   * the lists written to this stream, when they are written separately
+   * (see ParallelListOfWriter).
+   */
+  void setListOfItemsWriter (ListOfItemsWriter* writer);
+
+
+  /**
+   * Returns the object set with setListOfItemsWriter(), or @c NULL.
+   */
+  ListOfItemsWriter* getListOfItemsWriter () const;
+
+
+  /**
+   * Sets the text of the document being written, as it was read, whose
+   * elements can be written as they were with writeOriginalText(), or
+   * @c NULL.  The @p text must outlive this stream.
+   */
+  void setOriginalText (const std::string* text);
+
+
+  /**
+   * Returns the text set with setOriginalText(), or @c NULL.
+   */
+  const std::string* getOriginalText () const;
+
+
+  /**
+   * Writes the element found from @p begin to @p end in the original text
+   * as it is, in the place of a whole element: the start tag of the
+   * parent is ended and the element is indented as startElement() would,
+   * and the stream is then left as it is after endElement().
+   */
+  void writeOriginalText (size_t begin, size_t end);
+
+#endif /* !SWIG */
   /** @endcond */
 
 private:
@@ -888,6 +985,10 @@ protected:
 
   SBMLNamespaces* mSBMLns;
 
+  ListOfItemsWriter* mItemsWriter;
+
+  const std::string* mOriginalText;
+
   // boolean indicating whether the comment on the top of the file is
   // written (enabled by default)
   static bool mWriteComment;
@@ -896,6 +997,10 @@ protected:
   // of writing (enabled by default)
   static bool mWriteTimestamp;
 
+  // boolean indicating whether doubles are written with the fewest digits
+  // that read back the same, rather than with 15 (enabled by default)
+  static bool mWriteShortestDoubles;
+
   // the name of the library writing the file (i.e: libSBML)
   static std::string mLibraryName;
 
@@ -56,6 +56,7 @@
 #include <sbml/xml/XercesParser.h>
 #endif
 
+#include <sbml/xml/XMLBuffer.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLParser.h>
 
@@ -63,6 +64,13 @@ using namespace std;
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
+/*
+ * The number of bytes of content held in memory given to the XML library
+ * at a time, 0 for all of it.
+ */
+static unsigned int sChunkSize = 8192;
+
+
 /*
  * Creates a new XMLParser.  The parser will notify the given XMLHandler
  * of parse events and errors.
@@ -111,6 +119,26 @@ XMLParser::create (XMLHandler& handler, const string library)
 }
 
 
+/*
+ * Begins a progressive parse of the content of source, read into memory
+ * first by default.
+ */
+bool
+XMLParser::parseFirstFrom (XMLBuffer& source)
+{
+  char chunk[8192];
+  unsigned int bytes;
+
+  mContent.clear();
+  while ((bytes = source.copyTo(chunk, sizeof(chunk))) > 0)
+  {
+    mContent.append(chunk, bytes);
+  }
+
+  return !source.error() && parseFirst(mContent.c_str(), false);
+}
+
+
 /*
  * @return an XMLErrorLog which can be used to log XML parse errors and
  * other validation errors (and messages).
@@ -140,5 +168,27 @@ XMLParser::setErrorLog (XMLErrorLog* log)
 }
 
 
+/*
+ * Sets the number of bytes of content held in memory given to the XML
+ * library at a time.
+ */
+void
+XMLParser::setChunkSize (unsigned int bytes)
+{
+  sChunkSize = bytes;
+}
+
+
+/*
+ * Returns the number of bytes of content held in memory given to the XML
+ * library at a time.
+ */
+unsigned int
+XMLParser::getChunkSize ()
+{
+  return sChunkSize;
+}
+
+
 LIBSBML_CPP_NAMESPACE_END
 /** @endcond */
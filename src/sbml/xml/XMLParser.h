@@ -60,6 +60,7 @@
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
+class XMLBuffer;
 class XMLErrorLog;
 class XMLHandler;
 
@@ -143,6 +144,22 @@ public:
   virtual void parseReset () = 0;
 
 
+  /**
+   * Begins a progressive parse of the content of @p source, as
+   * parseFirst() does for a file or a string.  The parser reads from
+   * @p source as it goes, without taking it over, so @p source must
+   * outlive the parse.
+   *
+   * By default, all of the content of @p source is read first, and
+   * parsed from memory; the parsers that can read from a buffer as they
+   * go do so instead.
+   *
+   * @return @c true if the first step of the progressive parse was
+   * successful, @c false otherwise.
+   */
+  virtual bool parseFirstFrom (XMLBuffer& source);
+
+
   /**
    * Returns the current column position of the parser.  Must be overridden by child classes.
    *
@@ -179,6 +196,32 @@ public:
   int setErrorLog (XMLErrorLog* log);
 
 
+  /**
+   * Sets the number of bytes of content the parsers give the underlying
+   * XML library at a time when the content is held in memory, that is
+   * when parsing a string or a regular file, which is mapped into memory.
+   * Larger chunks mean fewer calls into the library, but more tokens
+   * queued at once, which makes reading slower on the whole; @c 0 gives
+   * it all of the content in a single call.  The default is 8 kB, which
+   * is also the size of the chunks read from other files.
+   *
+   * libxml2 is given at most 1 MB at a time, as it does not accept larger
+   * chunks without lifting its safety limits.
+   *
+   * The setting applies to the parses started after the call.
+   */
+  static void setChunkSize (unsigned int bytes);
+
+
+  /**
+   * Returns the number of bytes of content the parsers give the
+   * underlying XML library at a time when the content is held in memory.
+   *
+   * @see setChunkSize()
+   */
+  static unsigned int getChunkSize ();
+
+
 protected:
   /**
    * Creates a new XMLParser.  The parser will notify the given XMLHandler
@@ -190,6 +233,9 @@ protected:
   XMLParser ();
 
   XMLErrorLog* mErrorLog;
+
+  /* the content read by the default parseFirstFrom() */
+  std::string  mContent;
 };
 
 
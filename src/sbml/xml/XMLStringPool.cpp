@@ -0,0 +1,224 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLStringPool.cpp
+ * @brief   Interned names, namespace URIs and prefixes of the XML layer.
+ *
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->*/
+
+#include <cstring>
+
+#include <sbml/xml/XMLStringPool.h>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#include <mutex>
+#define LIBSBML_XML_STRING_POOL_LOCKED
+#endif
+
+using namespace std;
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+/*
+ * The pool is an open-addressing hash table whose capacity is a power of
+ * two, kept at most half full.  It is made of plain pointers that are
+ * zero-initialized before any constructor runs, so that strings can be
+ * interned by the constructors of static objects.
+ */
+struct XMLStringPoolEntry
+{
+  size_t        hash;
+  const string* str;
+};
+
+static XMLStringPoolEntry* sEntries  = NULL;
+static size_t              sCapacity = 0;
+static size_t              sCount    = 0;
+
+#ifdef LIBSBML_XML_STRING_POOL_LOCKED
+static std::mutex sMutex;
+#define XML_STRING_POOL_LOCK std::lock_guard<std::mutex> lock(sMutex)
+#else
+#define XML_STRING_POOL_LOCK
+#endif
+
+
+/*
+ * @return the FNV-1a hash of the length characters at s.
+ */
+static size_t
+hashOf (const char* s, size_t length)
+{
+  size_t hash = 2166136261u;
+
+  for (size_t n = 0; n < length; ++n)
+  {
+    hash ^= (unsigned char) s[n];
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+
+/*
+ * @return the slot of the table holding the length characters at s, or
+ * the empty slot where they would be added.
+ */
+static XMLStringPoolEntry&
+slotOf (const char* s, size_t length, size_t hash)
+{
+  const size_t mask = sCapacity - 1;
+
+  for (size_t n = hash & mask; ; n = (n + 1) & mask)
+  {
+    XMLStringPoolEntry& entry = sEntries[n];
+
+    if (entry.str == NULL
+        || (entry.hash == hash && entry.str->size() == length
+            && memcmp(entry.str->data(), s, length) == 0))
+    {
+      return entry;
+    }
+  }
+}
+
+
+/*
+ * Doubles the capacity of the table.
+ */
+static void
+grow ()
+{
+  XMLStringPoolEntry* entries  = sEntries;
+  const size_t        capacity = sCapacity;
+
+  sCapacity = (capacity == 0) ? 1024 : 2 * capacity;
+  sEntries  = new XMLStringPoolEntry[sCapacity];
+  memset(sEntries, 0, sCapacity * sizeof(XMLStringPoolEntry));
+
+  for (size_t n = 0; n < capacity; ++n)
+  {
+    if (entries[n].str != NULL)
+    {
+      slotOf(entries[n].str->data(), entries[n].str->size(),
+             entries[n].hash) = entries[n];
+    }
+  }
+
+  delete [] entries;
+}
+
+
+const string*
+XMLStringPool::intern (const char* s, size_t length)
+{
+  if (length == 0) return getEmpty();
+
+  const size_t hash = hashOf(s, length);
+
+  XML_STRING_POOL_LOCK;
+
+  if (2 * (sCount + 1) > sCapacity)
+  {
+    grow();
+  }
+
+  XMLStringPoolEntry& entry = slotOf(s, length, hash);
+
+  if (entry.str == NULL)
+  {
+    entry.hash = hash;
+    entry.str  = new string(s, length);
+    ++sCount;
+  }
+
+  return entry.str;
+}
+
+
+const string*
+XMLStringPool::intern (const string& s)
+{
+  return intern(s.data(), s.size());
+}
+
+
+const string*
+XMLStringPool::intern (const char* s)
+{
+  return (s == NULL) ? getEmpty() : intern(s, strlen(s));
+}
+
+
+const string*
+XMLStringPool::find (const string& s)
+{
+  if (s.empty()) return getEmpty();
+
+  const size_t hash = hashOf(s.data(), s.size());
+
+  XML_STRING_POOL_LOCK;
+
+  if (sCount == 0) return NULL;
+
+  return slotOf(s.data(), s.size(), hash).str;
+}
+
+
+const string*
+XMLStringPool::getEmpty ()
+{
+  /* never deleted, as the strings of the table are not */
+  static const string* empty = new string();
+
+  return empty;
+}
+
+
+unsigned int
+XMLStringPool::getSize ()
+{
+  XML_STRING_POOL_LOCK;
+
+  return (unsigned int) sCount;
+}
+
+LIBSBML_CPP_NAMESPACE_END
+
+/** @endcond */
@@ -0,0 +1,129 @@
+/**
+ * @cond doxygenLibsbmlInternal
+ *
+ * @file    XMLStringPool.h
+ * @brief   Interned names, namespace URIs and prefixes of the XML layer.
+ *
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML.  Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2020 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *     3. University College London, London, UK
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *     3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *  
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ *     Pasadena, CA, USA 
+ *  
+ * Copyright (C) 2002-2005 jointly by the following organizations: 
+ *     1. California Institute of Technology, Pasadena, CA, USA
+ *     2. Japan Science and Technology Agency, Japan
+ * 
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation.  A copy of the license agreement is provided
+ * in the file named "LICENSE.txt" included with this software distribution and
+ * also available online as http://sbml.org/software/libsbml/license.html
+ * ---------------------------------------------------------------------- -->
+ *
+ * @class XMLStringPool
+ * @sbmlbrief{core} Interns the names, namespace URIs and prefixes of the
+ * XML layer.
+ *
+ * The same few hundred element names, attribute names and namespace URIs
+ * occur over and over in SBML documents.  XMLTriple and XMLNamespaces keep
+ * them as pointers to a single copy of each string, held by this pool, so
+ * that copying a triple does not allocate memory and two interned strings
+ * are equal if and only if they are at the same address.
+ *
+ * The pool is shared by the whole process and only ever grows: the strings
+ * it holds are never freed, so a pointer returned by intern() remains valid
+ * until the process exits.  When libSBML is built with a C++11 compiler,
+ * the pool can be used from several threads at once.
+ */
+
+#ifndef XMLStringPool_h
+#define XMLStringPool_h
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <string>
+
+#include <sbml/xml/XMLExtern.h>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class LIBLAX_EXTERN XMLStringPool
+{
+public:
+
+  /**
+   * Returns the interned copy of the given string, adding it to the pool
+   * if it is not there yet.
+   */
+  static const std::string* intern (const std::string& s);
+
+
+  /**
+   * Returns the interned copy of the @p length characters at @p s, adding
+   * it to the pool if it is not there yet.
+   */
+  static const std::string* intern (const char* s, size_t length);
+
+
+  /**
+   * Returns the interned copy of the null-terminated string @p s, or of
+   * the empty string if @p s is @c NULL.
+   */
+  static const std::string* intern (const char* s);
+
+
+  /**
+   * Returns the interned copy of the given string, or @c NULL if it is
+   * not in the pool (in which case no interned string is equal to it).
+   */
+  static const std::string* find (const std::string& s);
+
+
+  /**
+   * Returns the interned empty string.
+   */
+  static const std::string* getEmpty ();
+
+
+  /**
+   * Returns the number of strings in the pool.
+   */
+  static unsigned int getSize ();
+
+
+private:
+
+  XMLStringPool ();
+  XMLStringPool (const XMLStringPool&);
+  XMLStringPool& operator= (const XMLStringPool&);
+};
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+
+#endif  /* XMLStringPool_h */
+
+/** @endcond */
@@ -39,6 +39,7 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <algorithm>
 #include <sstream>
 
 /** @cond doxygenLibsbmlInternal */
@@ -222,6 +223,39 @@ XMLToken::clone () const
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Exchanges the content of this XMLToken with that of other.
+ */
+void
+XMLToken::swap (XMLToken& other)
+{
+  mTriple    .swap(other.mTriple);
+  mAttributes.swap(other.mAttributes);
+  mNamespaces.swap(other.mNamespaces);
+  mChars     .swap(other.mChars);
+
+  std::swap(mIsStart, other.mIsStart);
+  std::swap(mIsEnd  , other.mIsEnd);
+  std::swap(mIsText , other.mIsText);
+  std::swap(mLine   , other.mLine);
+  std::swap(mColumn , other.mColumn);
+}
+
+
+/*
+ * Exchanges the attributes and namespace declarations of this XMLToken
+ * with the given ones.
+ */
+void
+XMLToken::swapAttributes (XMLAttributes& attributes, XMLNamespaces& namespaces)
+{
+  mAttributes.swap(attributes);
+  mNamespaces.swap(namespaces);
+}
+/** @endcond */
+
+
 /*
  * Appends characters to this XML text content.
  */
@@ -1128,12 +1162,13 @@ XMLToken::isEnd () const
 bool
 XMLToken::isEndFor (const XMLToken& element) const
 {
+  // the names and URIs are interned, so they are compared by address
   return
-    isEnd()                        &&
-    !isStart()                     &&
-    element.isStart()              &&
-    element.getName() == getName() &&
-    element.getURI () == getURI ();
+    isEnd()                          &&
+    !isStart()                       &&
+    element.isStart()                &&
+    &element.getName() == &getName() &&
+    &element.getURI () == &getURI ();
 }
 
 
@@ -272,6 +272,26 @@ public:
   XMLToken* clone () const;
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Exchanges the content of this XMLToken with that of @p other, without
+   * copying its name, attributes, namespaces or characters.
+   */
+  void swap (XMLToken& other);
+
+
+  /**
+   * Exchanges the attributes and namespace declarations of this XMLToken
+   * with @p attributes and @p namespaces, without copying them.
+   */
+  void swapAttributes (XMLAttributes& attributes, XMLNamespaces& namespaces);
+  /** @endcond */
+
+#endif
+
+
   /**
    * Returns the attributes of the XML element represented by this token.
    *
@@ -1169,6 +1189,9 @@ public:
   friend
   XMLOutputStream& operator<< (XMLOutputStream& stream, const XMLToken& token);
 
+  /* the tokenizer may report a token at another position */
+  friend class XMLTokenizer;
+
   /** @endcond */
 
 #endif  /* !SWIG */
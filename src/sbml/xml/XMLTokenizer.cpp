@@ -57,6 +57,7 @@ XMLTokenizer::XMLTokenizer () :
    mInChars( false )
  , mInStart( false )
  , mEOFSeen( false )
+ , mNextRelocation( 0 )
 {
 }
 
@@ -72,6 +73,8 @@ XMLTokenizer::XMLTokenizer (const XMLTokenizer& other)
   , mVersion(other.mVersion)
   , mCurrent(other.mCurrent)
   , mTokens(other.mTokens)
+  , mRelocations(other.mRelocations)
+  , mNextRelocation(other.mNextRelocation)
 {
 }
 
@@ -90,6 +93,8 @@ XMLTokenizer::operator=(const XMLTokenizer& rhs)
     mVersion = rhs.mVersion;
     mCurrent = rhs.mCurrent;
     mTokens = rhs.mTokens;
+    mRelocations = rhs.mRelocations;
+    mNextRelocation = rhs.mNextRelocation;
   }
 
   return *this;
@@ -158,7 +163,8 @@ XMLTokenizer::isEOF () const
 XMLToken
 XMLTokenizer::next ()
 {
-  XMLToken token( peek() );
+  XMLToken token;
+  token.swap( mTokens.front() );
   mTokens.pop_front();
 
   return token;
@@ -214,20 +220,8 @@ XMLTokenizer::XML (const string& version, const string& encoding)
 void
 XMLTokenizer::startElement (const XMLToken& element)
 {
-
-  if (mInChars || mInStart)
-  {
-    mInChars = false;
-    mTokens.push_back( mCurrent );
-  }
-
-  //
-  // We delay pushing element onto mTokens until we see either an end
-  // elment (in which case we can collapse start and end elements into a
-  // single token) or the beginning of character data.
-  //
-  mInStart = true;
-  mCurrent = element;
+  XMLToken copy(element);
+  takeStartElement(copy);
 }
 
 
@@ -246,37 +240,87 @@ XMLTokenizer::endDocument ()
  */
 void
 XMLTokenizer::endElement (const XMLToken& element)
+{
+  XMLToken copy(element);
+  takeEndElement(copy);
+}
+
+
+/*
+ * Receive notification of character data inside an element.
+ */
+void
+XMLTokenizer::characters (const XMLToken& data)
+{
+  XMLToken copy(data);
+  takeCharacters(copy);
+}
+
+
+/*
+ * Receive notification of the start of an element, taking the content of
+ * the token.
+ */
+void
+XMLTokenizer::takeStartElement (XMLToken& element)
+{
+
+  if (mInChars || mInStart)
+  {
+    mInChars = false;
+    pushCurrent();
+  }
+
+  //
+  // We delay pushing element onto mTokens until we see either an end
+  // elment (in which case we can collapse start and end elements into a
+  // single token) or the beginning of character data.
+  //
+  mInStart = true;
+  mCurrent.swap(element);
+}
+
+
+/*
+ * Receive notification of the end of an element, taking the content of
+ * the token.
+ */
+void
+XMLTokenizer::takeEndElement (XMLToken& element)
 {
   if (mInChars)
   {
     mInChars = false;
-    mTokens.push_back( mCurrent );
+    pushCurrent();
   }
 
   if (mInStart)
   {
     mInStart = false;
     mCurrent.setEnd();
-    mTokens.push_back( mCurrent );
+    pushCurrent();
   }
   else
   {
-    mTokens.push_back(element);
+    mTokens.push_back( XMLToken() );
+    mTokens.back().swap(element);
+    relocate( mTokens.back() );
   }
 }
 
 
 /*
- * Receive notification of character data inside an element.
+ * Receive notification of character data inside an element, taking the
+ * content of the token.
  */
 void
-XMLTokenizer::characters (const XMLToken& data)
+XMLTokenizer::takeCharacters (XMLToken& data)
 {
 
   if (mInStart)
   {
     mInStart = false;
-    mTokens.push_back( mCurrent );
+    pushCurrent();
   }
 
   if (mInChars)
@@ -286,7 +330,63 @@ XMLTokenizer::characters (const XMLToken& data)
   else
   {
     mInChars = true;
-    mCurrent = data;
+    mCurrent.swap(data);
+  }
+}
+
+
+/*
+ * Moves the current token to the end of the queue, without copying it.
+ */
+void
+XMLTokenizer::pushCurrent ()
+{
+  mTokens.push_back( XMLToken() );
+  mTokens.back().swap(mCurrent);
+  relocate( mTokens.back() );
+}
+
+
+/*
+ * Makes the tokens found from the given position onwards report their
+ * positions as if that place were at toLine and toColumn.
+ */
+void
+XMLTokenizer::addRelocation (unsigned int line, unsigned int column,
+                             unsigned int toLine, unsigned int toColumn)
+{
+  Relocation relocation = { line, column, toLine, toColumn };
+  mRelocations.push_back(relocation);
+}
+
+
+/*
+ * Applies the relocation in force at the position of token, if any.
+ */
+void
+XMLTokenizer::relocate (XMLToken& token)
+{
+  if (mRelocations.empty()) return;
+
+  while (mNextRelocation < mRelocations.size()
+         && (token.mLine > mRelocations[mNextRelocation].line
+             || (token.mLine == mRelocations[mNextRelocation].line
+                 && token.mColumn >= mRelocations[mNextRelocation].column)))
+  {
+    ++mNextRelocation;
+  }
+
+  if (mNextRelocation == 0) return;
+
+  const Relocation& r = mRelocations[mNextRelocation - 1];
+  if (token.mLine == r.line)
+  {
+    token.mColumn = r.toColumn + (token.mColumn - r.column);
+    token.mLine   = r.toLine;
+  }
+  else
+  {
+    token.mLine = r.toLine + (token.mLine - r.line);
   }
 }
 
@@ -317,12 +417,12 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
   // need to count the number of starts
 
   unsigned int index = 0;
-  XMLToken firstUnread = mTokens.at(index);
-  while (firstUnread.isText() && index < size - 1)
+  const XMLToken* firstUnread = &mTokens.at(index);
+  while (firstUnread->isText() && index < size - 1)
   {
     // skip any text
     index++;
-    firstUnread = mTokens.at(index);
+    firstUnread = &mTokens.at(index);
   }
 
 
@@ -336,12 +436,12 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
   // and the error gets logged elsewhere
   if (closingTag == "apply")
   {
-    std::string firstName = firstUnread.getName();
+    std::string firstName = firstUnread->getName();
 
     if (firstName != "ci" && firstName != "csymbol")
     {
-      if (firstUnread.isStart() != true 
-        || (firstUnread.isStart() == true &&  firstUnread.isEnd() != true))
+      if (firstUnread->isStart() != true 
+        || (firstUnread->isStart() == true &&  firstUnread->isEnd() != true))
       {
         valid = true;
         return numChildren;
@@ -358,25 +458,25 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
   unsigned int depth = 0;
   std::string name;
   bool cleanBreak = false;
-  XMLToken next = mTokens.at(index);
+  const XMLToken* next = &mTokens.at(index);
   while (index < size-2)
   {
     // skip any text elements
-    while(next.isText() == true && index < size-1)
+    while(next->isText() == true && index < size-1)
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
-    if (next.isEnd() == true && next.getName() == closingTag)
+    if (next->isEnd() == true && next->getName() == closingTag)
     {
       valid = true;
       break;
     }
     // iterate to first start element
-    while (next.isStart() == false && index < size-1)
+    while (next->isStart() == false && index < size-1)
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
     // check we have not reached the end
@@ -388,7 +488,7 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
     }
 
     // record the name of the start element
-    name = next.getName();
+    name = next->getName();
     numChildren++;
 
  //   index++;
@@ -398,12 +498,12 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
       numChildren = 0;
       break;
     }
-    else if (next.isEnd() == false)
+    else if (next->isEnd() == false)
     {
       index++;
       if (index < size)
       {
-        next = mTokens.at(index);
+        next = &mTokens.at(index);
       }
       else
       {
@@ -416,12 +516,12 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
     cleanBreak = false;
     while (index < size-1)
     {
-      if (next.isStart() == true && next.isEnd() == false && next.getName() == name)
+      if (next->isStart() == true && next->isEnd() == false && next->getName() == name)
       {
         depth++;
       }
 
-      if (next.isEnd() == true && next.getName() == name)
+      if (next->isEnd() == true && next->getName() == name)
       {
         if (depth == 0)
         {
@@ -435,13 +535,13 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
       }
 
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
     index++;
     if (index < size)
     {
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
   } 
 
@@ -449,7 +549,7 @@ XMLTokenizer::determineNumberChildren(bool & valid, const std::string element)
   // but the loop hits before it can record that it was valid
   if (valid == false && cleanBreak == true)
   {
-  if (index >= size-2 && next.isEnd() == true && next.getName() == closingTag)
+  if (index >= size-2 && next->isEnd() == true && next->getName() == closingTag)
   {
       valid = true;
   }
@@ -478,48 +578,48 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
   std::string prevName = "";
   std::string rogueTag = "";
   
-  XMLToken next = mTokens.at(index);
-  name = next.getName();
-  if (next.isStart() == true && next.isEnd() == true && 
+  const XMLToken* next = &mTokens.at(index);
+  name = next->getName();
+  if (next->isStart() == true && next->isEnd() == true && 
     name == qualifier && index < size)
   {
     numQualifiers++;
     index++;
-    next = mTokens.at(index);
+    next = &mTokens.at(index);
   }
   bool cleanBreak = false;
 
   while (index < size-2)
   {
     // skip any text elements
-    while(next.isText() == true && index < size-1)
+    while(next->isText() == true && index < size-1)
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
-    if (next.isEnd() == true)
+    if (next->isEnd() == true)
     {
-      if (next.getName() == container)
+      if (next->getName() == container)
       {
         valid = true;
         break;
       }
-      //else if (!rogueTag.empty() && next.getName() == rogueTag)
+      //else if (!rogueTag.empty() && next->getName() == rogueTag)
       //{
       //  index++;
-      //  next = mTokens.at(index);
+      //  next = &mTokens.at(index);
       //  break;
       //}
     }
     // iterate to first start element
-    while (next.isStart() == false && index < size-1)
+    while (next->isStart() == false && index < size-1)
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
-    if (next.isStart() == true && next.isEnd() == true)
+    if (next->isStart() == true && next->isEnd() == true)
     {
       if (qualifier.empty() == true)
       {
@@ -531,7 +631,7 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
       index++;
       if (index < size)
       {
-        next = mTokens.at(index);
+        next = &mTokens.at(index);
         continue;
       }
     }
@@ -544,7 +644,7 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
     }
 
     // record the name of the start element
-    name = next.getName();
+    name = next->getName();
 
     // need to deal with the weird situation where someone has used a tag
     // after the piece but before the next correct element
@@ -556,7 +656,7 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
     //    {
     //      rogueTag = name;
     //      index++;
-    //      next = mTokens.at(index);
+    //      next = &mTokens.at(index);
     //      continue;
     //    }
     //  }
@@ -576,7 +676,7 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
     else
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
     // iterate to the end of </name>
@@ -584,12 +684,12 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
     cleanBreak = false;
     while (index < size-1)
     {
-      if (next.isStart() == true && next.getName() == name)
+      if (next->isStart() == true && next->getName() == name)
       {
         depth++;
       }
 
-      if (next.isEnd() == true && next.getName() == name)
+      if (next->isEnd() == true && next->getName() == name)
       {
         if (depth == 0)
         {
@@ -605,7 +705,7 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
       index++;
       if (index < size)
       {
-        next = mTokens.at(index);
+        next = &mTokens.at(index);
       }
     }
 
@@ -613,14 +713,14 @@ XMLTokenizer::determineNumSpecificChildren(bool & valid,
     index++;
     if (index < size)
     {
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
   }  
 
   // we might have hit the end of the loop and the end of the correct tag
   if (valid == false && cleanBreak == true)
   {
-    if (index >= size-2 && next.isEnd() == true && next.getName() == container)
+    if (index >= size-2 && next->isEnd() == true && next->getName() == container)
     {
         valid = true;
     }
@@ -648,19 +748,19 @@ XMLTokenizer::containsChild(bool & valid,
   //unsigned int depth = 0;
   std::string name;
   
-  XMLToken next = mTokens.at(index);
-  name = next.getName();
+  const XMLToken* next = &mTokens.at(index);
+  name = next->getName();
 
   while (index < size-2)
   {
     // skip any text elements
-    while(next.isText() == true && index < size-1)
+    while(next->isText() == true && index < size-1)
     {
       index++;
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
 
-    if (next.getName() == qualifier)
+    if (next->getName() == qualifier)
     {
       valid = true;
       return true;
@@ -669,7 +769,7 @@ XMLTokenizer::containsChild(bool & valid,
     index++;
     if (index < size)
     {
-      next = mTokens.at(index);
+      next = &mTokens.at(index);
     }
   }  
 
@@ -682,6 +782,43 @@ XMLTokenizer::containsChild(bool & valid,
   return false;
 }
 
+/*
+ * Continues a lookahead over the queued tokens from @p scanned, the
+ * number of tokens already looked at, with @p depth the number of
+ * elements opened and not yet closed among them.  Returns true once the
+ * end of the element enclosing the first queued token has been queued,
+ * so that a scan of the queue started again from the beginning only
+ * needs to be done when it can succeed.
+ */
+bool
+XMLTokenizer::isEndOfElementQueued(size_t& scanned, unsigned int& depth) const
+{
+  size_t size = mTokens.size();
+
+  while (scanned < size)
+  {
+    const XMLToken& token = mTokens[scanned];
+    scanned++;
+
+    if (token.isStart() == true && token.isEnd() == false)
+    {
+      depth++;
+    }
+    else if (token.isEnd() == true && token.isStart() == false)
+    {
+      if (depth == 0)
+      {
+        return true;
+      }
+
+      depth--;
+    }
+  }
+
+  return false;
+}
+
+
 
 
 LIBSBML_CPP_NAMESPACE_END
@@ -53,6 +53,7 @@
 #ifdef __cplusplus
 
 #include <deque>
+#include <vector>
 
 #include <sbml/xml/XMLExtern.h>
 #include <sbml/xml/XMLHandler.h>
@@ -186,8 +187,52 @@ public:
   virtual void characters (const XMLToken& data);
 
 
+  /**
+   * Receive notification of the start of an element, taking the content
+   * of the token instead of copying it.
+   */
+  virtual void takeStartElement (XMLToken& element);
+
+
+  /**
+   * Receive notification of the end of an element, taking the content
+   * of the token instead of copying it.
+   */
+  virtual void takeEndElement (XMLToken& element);
+
+
+  /**
+   * Receive notification of character data inside an element, taking the
+   * content of the token instead of copying it.
+   */
+  virtual void takeCharacters (XMLToken& data);
+
+
+  /**
+   * Makes the tokens found from the given @p line and @p column of the
+   * document onwards report their positions as if that place were at
+   * @p toLine and @p toColumn, for documents put together from pieces of
+   * another.  Relocations must be added in the order of the document,
+   * before the tokens they apply to are queued.
+   */
+  void addRelocation (unsigned int line, unsigned int column,
+                      unsigned int toLine, unsigned int toColumn);
+
+
 protected:
 
+  /**
+   * Moves the current token to the end of the queue of tokens, leaving
+   * the current token empty.
+   */
+  void pushCurrent ();
+
+
+  /**
+   * Applies the relocation in force at the position of token, if any.
+   */
+  void relocate (XMLToken& token);
+
   unsigned int determineNumberChildren(bool & valid, 
                                        const std::string element = "");
 
@@ -197,6 +242,8 @@ protected:
   bool containsChild(bool & valid, 
                const std::string& qualifier,  const std::string& container);
 
+  bool isEndOfElementQueued(size_t& scanned, unsigned int& depth) const;
+
   bool mInChars;
   bool mInStart;
   bool mEOFSeen;
@@ -207,6 +254,19 @@ protected:
   XMLToken             mCurrent;
   std::deque<XMLToken> mTokens;
 
+  struct Relocation
+  {
+    unsigned int line;
+    unsigned int column;
+    unsigned int toLine;
+    unsigned int toColumn;
+  };
+
+  /* tokens are queued in the order of the document, so the relocation
+   * in force only ever moves forward */
+  std::vector<Relocation> mRelocations;
+  size_t                  mNextRelocation;
+
   friend class XMLInputStream;
 
 };
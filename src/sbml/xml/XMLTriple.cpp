@@ -39,10 +39,13 @@
  * also available online as http://sbml.org/software/libsbml/license.html
  * ---------------------------------------------------------------------- -->*/
 
+#include <algorithm>
+
 #include <sbml/xml/XMLTriple.h>
 #include <sbml/util/util.h>
 #include <sbml/xml/XMLAttributes.h>
 #include <sbml/xml/XMLConstructorException.h>
+#include <sbml/xml/XMLStringPool.h>
 
 /** @cond doxygenIgnored */
 using namespace std;
@@ -55,6 +58,9 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  * Creates a new empty XMLTriple.
  */
 XMLTriple::XMLTriple ()
+ : mName   ( XMLStringPool::getEmpty() )
+ , mURI    ( XMLStringPool::getEmpty() )
+ , mPrefix ( XMLStringPool::getEmpty() )
 {
 }
 
@@ -65,11 +71,26 @@ XMLTriple::XMLTriple ()
 XMLTriple::XMLTriple (  const std::string&  name
                       , const std::string&  uri
                       , const std::string&  prefix ) 
- : mName   ( name )
- , mURI    ( uri  )
+ : mName   ( XMLStringPool::intern(name)   )
+ , mURI    ( XMLStringPool::intern(uri)    )
+ , mPrefix ( XMLStringPool::intern(prefix) )
+{
+}
+
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Creates a new XMLTriple from strings interned by XMLStringPool.
+ */
+XMLTriple::XMLTriple (  const std::string*  name
+                      , const std::string*  uri
+                      , const std::string*  prefix )
+ : mName   ( name   )
+ , mURI    ( uri    )
  , mPrefix ( prefix )
 {
 }
+/** @endcond */
 
 
 /*
@@ -81,7 +102,11 @@ XMLTriple::XMLTriple (  const std::string&  name
  *   uri sepchar name sepchar prefix
  */
 XMLTriple::XMLTriple (const std::string& triplet, const char sepchar)
+ : mName   ( XMLStringPool::getEmpty() )
+ , mURI    ( XMLStringPool::getEmpty() )
+ , mPrefix ( XMLStringPool::getEmpty() )
 { 
+  const char* data = triplet.data();
 
   string::size_type start = 0;
   string::size_type pos   = triplet.find(sepchar, start);
@@ -89,24 +114,25 @@ XMLTriple::XMLTriple (const std::string& triplet, const char sepchar)
 
   if (pos != string::npos)
   {
-    mURI = triplet.substr(start, pos);
+    mURI = XMLStringPool::intern(data + start, pos);
 
     start = pos + 1;
     pos   = triplet.find(sepchar, start);
 
     if (pos != string::npos)
     {
-      mName   = triplet.substr(start, pos - start);
-      mPrefix = triplet.substr(pos + 1);
+      mName   = XMLStringPool::intern(data + start, pos - start);
+      mPrefix = XMLStringPool::intern(data + pos + 1,
+                                      triplet.size() - pos - 1);
     }
     else
     {
-      mName = triplet.substr(start);
+      mName = XMLStringPool::intern(data + start, triplet.size() - start);
     }
   }
   else
   {
-    mName = triplet;
+    mName = XMLStringPool::intern(triplet);
   }
 }
 
@@ -155,13 +181,27 @@ XMLTriple::clone () const
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Exchanges the content of this XMLTriple with that of other.
+ */
+void
+XMLTriple::swap (XMLTriple& other)
+{
+  std::swap(mName,   other.mName);
+  std::swap(mURI,    other.mURI);
+  std::swap(mPrefix, other.mPrefix);
+}
+/** @endcond */
+
+
 /*
  * @return a string, the name from this XMLTriple.
  */
 const std::string&
 XMLTriple::getName () const
 {
-  return mName;
+  return *mName;
 }
 
 
@@ -171,7 +211,7 @@ XMLTriple::getName () const
 const std::string& 
 XMLTriple::getPrefix () const
 {
-  return mPrefix;
+  return *mPrefix;
 }
 
 
@@ -181,7 +221,7 @@ XMLTriple::getPrefix () const
 const std::string&
 XMLTriple::getURI () const
 {
-  return mURI;
+  return *mURI;
 }
 
 
@@ -191,7 +231,7 @@ XMLTriple::getURI () const
 const std::string 
 XMLTriple::getPrefixedName () const
 {
-  return mPrefix + ((mPrefix != "") ? ":" : "") + mName;
+  return *mPrefix + ((*mPrefix != "") ? ":" : "") + *mName;
 }
 
 
@@ -215,9 +255,10 @@ XMLTriple::isEmpty () const
  */
 bool operator==(const XMLTriple& lhs, const XMLTriple& rhs)
 {
-  if (lhs.getName()   != rhs.getName()  ) return false;
-  if (lhs.getURI()    != rhs.getURI()   ) return false;
-  if (lhs.getPrefix() != rhs.getPrefix()) return false;
+  // the strings are interned, so equal strings are at the same address
+  if (&lhs.getName()   != &rhs.getName()  ) return false;
+  if (&lhs.getURI()    != &rhs.getURI()   ) return false;
+  if (&lhs.getPrefix() != &rhs.getPrefix()) return false;
 
   return true;
 }
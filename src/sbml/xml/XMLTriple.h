@@ -136,6 +136,21 @@ public:
   XMLTriple (const std::string& triplet, const char sepchar = ' ');
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Creates a new XMLTriple object from strings returned by
+   * XMLStringPool::intern(), without looking them up again.
+   */
+  XMLTriple (  const std::string*  name
+             , const std::string*  uri
+             , const std::string*  prefix );
+  /** @endcond */
+
+#endif
+
+
   /**
    * Copy constructor; creates a copy of this XMLTriple object.
    *
@@ -166,6 +181,19 @@ public:
   XMLTriple* clone () const;
 
 
+#ifndef SWIG
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Exchanges the content of this XMLTriple with that of @p other, without
+   * copying the strings.
+   */
+  void swap (XMLTriple& other);
+  /** @endcond */
+
+#endif
+
+
   /**
    * Returns the @em name portion of this XMLTriple object.
    *
@@ -211,9 +239,10 @@ public:
 
 private:
   /** @cond doxygenLibsbmlInternal */
-  std::string  mName;
-  std::string  mURI;
-  std::string  mPrefix;
+  /* interned by XMLStringPool */
+  const std::string*  mName;
+  const std::string*  mURI;
+  const std::string*  mPrefix;
 
   /** @endcond */
 };
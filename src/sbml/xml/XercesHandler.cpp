@@ -139,15 +139,22 @@ XercesHandler::startElement (  const XMLCh* const  uri
 {
   const string nsuri  = XercesTranscode( uri       );
   const string name   = XercesTranscode( localname );
+  if (mHandler.skipStartElement(name.c_str(), nsuri.c_str())) return;
+
   const string prefix = getPrefix( XercesTranscode(qname) );
 
   const XMLTriple         triple    ( name, nsuri, prefix );
-  const XercesAttributes  attributes( attrs, name );
-  const XercesNamespaces  namespaces( attrs );
-  const XMLToken          element   ( triple, attributes, namespaces,
+  XercesAttributes        attributes( attrs, name );
+  XercesNamespaces        namespaces( attrs );
+  XMLToken                element   ( triple, XMLAttributes(), XMLNamespaces(),
                                       getLine(), getColumn() );
 
-  mHandler.startElement(element);
+  //
+  // The attributes and namespaces are only needed for this token, so they
+  // are moved into it rather than copied.
+  //
+  element.swapAttributes(attributes, namespaces);
+  mHandler.takeStartElement(element);
 }
 
 
@@ -173,14 +180,16 @@ XercesHandler::endElement (  const XMLCh* const  uri
                            , const XMLCh* const  localname
                            , const XMLCh* const  qname )
 {
+  if (mHandler.skipEndElement()) return;
+
   const string nsuri  = XercesTranscode( uri       );
   const string name   = XercesTranscode( localname );
   const string prefix = getPrefix( XercesTranscode(qname) );
 
   const XMLTriple  triple ( name, nsuri, prefix );
-  const XMLToken   element( triple, getLine(), getColumn() );
+  XMLToken         element( triple, getLine(), getColumn() );
 
-  mHandler.endElement(element);
+  mHandler.takeEndElement(element);
 }
 
 
@@ -194,10 +203,12 @@ void
 XercesHandler::characters (  const XMLCh* const  chars
                            , const XercesSize_t  length )
 {
+  if (mHandler.isSkipping()) return;
+
   const string   transcoded = XercesTranscode(chars);
-  const XMLToken data(transcoded);
+  XMLToken       data(transcoded);
 
-  mHandler.characters(transcoded);
+  mHandler.takeCharacters(data);
 }
 
 
@@ -50,18 +50,20 @@
 #include <xercesc/framework/LocalFileInputSource.hpp>
 #include <xercesc/framework/MemBufInputSource.hpp>
 #include <xercesc/parsers/SAX2XMLReaderImpl.hpp>
+#include <xercesc/sax/InputSource.hpp>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/util/BinInputStream.hpp>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <xercesc/util/XercesDefs.hpp>
 
 #include <sbml/xml/XMLHandler.h>
 #include <sbml/xml/XMLErrorLog.h>
+#include <sbml/xml/XMLFileBuffer.h>
 
 #include <sbml/xml/XercesTranscode.h>
 #include <sbml/xml/XercesParser.h>
 
 #include <sbml/compress/CompressCommon.h>
-#include <sbml/compress/InputDecompressor.h>
 
 #include <sbml/common/common.h>
 
@@ -359,6 +361,75 @@ protected:
 };
 
 
+/**
+ * XMLBufferInputStream lets Xerces read from an XMLBuffer, such as the
+ * XMLFileBuffer that decompresses a file as it is read, a block at a time.
+ */
+class XMLBufferInputStream : public BinInputStream
+{
+public:
+
+  XMLBufferInputStream (XMLBuffer& buffer) : mBuffer(buffer), mPos(0) { }
+  virtual ~XMLBufferInputStream () { }
+
+#if XERCES_VERSION_MAJOR <= 2
+  virtual unsigned int curPos () const { return mPos; }
+#else
+  virtual XMLFilePos curPos () const { return mPos; }
+  virtual const XMLCh* getContentType () const { return NULL; }
+#endif
+
+  virtual XercesSize_t readBytes (  XMLByte* const      toFill
+                                  , const XercesSize_t  maxToRead )
+  {
+    unsigned int bytes = (maxToRead > 0x40000000) ?
+                         0x40000000 : (unsigned int) maxToRead;
+
+    bytes = mBuffer.copyTo(toFill, bytes);
+    mPos += bytes;
+
+    return bytes;
+  }
+
+protected:
+
+  XMLBuffer&    mBuffer;
+  XercesSize_t  mPos;
+};
+
+
+/**
+ * XMLBufferInputSource is a Xerces InputSource reading from an XMLBuffer,
+ * which it deletes if it is adopted.
+ */
+class XMLBufferInputSource : public InputSource
+{
+public:
+
+  XMLBufferInputSource (XMLBuffer* buffer, bool adopt) :
+      InputSource("FromBuffer")
+    , mBuffer(buffer)
+    , mAdopt (adopt)
+  {
+  }
+
+  virtual ~XMLBufferInputSource ()
+  {
+    if (mAdopt) delete mBuffer;
+  }
+
+  virtual BinInputStream* makeStream () const
+  {
+    return new XMLBufferInputStream(*mBuffer);
+  }
+
+protected:
+
+  XMLBuffer*  mBuffer;
+  bool        mAdopt;
+};
+
+
 /**
  * Creates a new XercesParser.  The parser will notify the given XMLHandler
  * of parse events and errors.
@@ -429,29 +500,12 @@ XercesParser::createSource (const char* content, bool isFile)
           ( string::npos != filename.find(".bz2", filename.length() - 4) ) 
        )
     {
-      char* xmlstring = NULL;
+      // compressed files are decompressed as they are parsed, a block
+      // at a time, rather than read into memory first
+      XMLFileBuffer* buffer = NULL;
       try
       {
-         // open a gzip file
-         if ( string::npos != filename.find(".gz", filename.length() - 3) )
-         {
-           xmlstring = InputDecompressor::getStringFromGzip(filename);
-         }
-         // open a bz2 file
-         else if ( string::npos != filename.find(".bz2", filename.length() - 4) )
-         {
-           xmlstring = InputDecompressor::getStringFromBzip2(filename);
-         }
-         // open a zip file
-         else if ( string::npos != filename.find(".zip", filename.length() - 4) )
-         {
-           xmlstring = InputDecompressor::getStringFromZip(filename);
-         }
-      }
-      catch(const char* error)
-      {
-        reportError(XMLFileUnreadable, error, 0, 0);
-        return source;
+        buffer = new XMLFileBuffer(filename);
       }
       catch ( ZlibNotLinked& )
       {
@@ -471,22 +525,21 @@ XercesParser::createSource (const char* content, bool isFile)
         reportError(XMLFileUnreadable, oss.str(), 0, 0);
         return source;
       }
- 
-      if ( xmlstring == NULL || strlen(xmlstring) == 0)
+
+      if ( buffer->error() )
       {
-         reportError(XMLOutOfMemory, "The given compressed file can't be read into a string", 0, 0);
-         return source;
+        reportError(XMLFileUnreadable, content, 0, 0);
+        delete buffer;
+        return source;
       }
 
-      unsigned int   size   = strlen(xmlstring);
-      const XMLByte* bytes  = reinterpret_cast<const XMLByte*>(xmlstring);
-
       try
       {
-        source = new MemBufInputSource(bytes, size, "FromString", true); 
+        source = new XMLBufferInputSource(buffer, true);
       }
       catch (...)
       {
+        delete buffer;
       }
 
       if ( source == NULL ) reportError(XMLOutOfMemory, content, 0, 0);
@@ -570,11 +623,33 @@ XercesParser::parse (const char* content, bool isFile, bool isProgressive)
 {
   if ( error() ) return false;
 
+  InputSource* source = NULL;
+
+  try
+  {
+    source = createSource(content, isFile);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return parseSource(source, isProgressive);
+}
+
+
+/**
+ * @return true if the parse of source, which this parser takes over, was
+ * successful, false otherwise.
+ */
+bool
+XercesParser::parseSource (InputSource* source, bool isProgressive)
+{
   bool result = true;
 
   try
   {
-    mSource = createSource(content, isFile);
+    mSource = source;
 
     if (mSource != NULL)
     {
@@ -653,6 +728,31 @@ XercesParser::parseFirst (const char* content, bool isFile)
 }
 
 
+/**
+ * Begins a progressive parse of the content of source, which is read as
+ * the parse goes and must outlive it.
+ */
+bool
+XercesParser::parseFirstFrom (XMLBuffer& source)
+{
+  if ( error() ) return false;
+
+  InputSource* input = NULL;
+
+  try
+  {
+    input = new XMLBufferInputSource(&source, false);
+  }
+  catch (...)
+  {
+    reportError(XMLOutOfMemory, "", 0, 0);
+    return false;
+  }
+
+  return parseSource(input, true);
+}
+
+
 /**
  * Parses the next chunk of XML content.
  *
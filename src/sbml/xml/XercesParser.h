@@ -124,6 +124,16 @@ public:
   virtual void parseReset();
 
 
+  /**
+   * Begins a progressive parse of the content of @p source, which is read
+   * as the parse goes and must outlive it.
+   *
+   * @return true if the first step of the progressive parse was
+   * successful, false otherwise.
+   */
+  virtual bool parseFirstFrom (XMLBuffer& source);
+
+
   /**
    * @return the current column position of the parser.
    */
@@ -150,6 +160,13 @@ protected:
   bool parse (const char* content, bool isFile, bool isProgressive);
 
 
+  /**
+   * @return true if the parse of @p source, which this parser takes over,
+   * was successful, false otherwise.
+   */
+  bool parseSource (xercesc::InputSource* source, bool isProgressive);
+
+
   /**
    * Creates a Xerces-C++ InputSource appropriate to the given XML content.
    */
@@ -179,6 +179,30 @@ START_TEST ( test_Triple_clone )
 }
 END_TEST
 
+
+START_TEST ( test_Triple_sharedStrings )
+{
+  XMLTriple t("sarah", "http://foo.org/", "bar");
+  XMLTriple t2("http://foo.org/ sarah bar");
+  XMLTriple t3("sarah", "http://foo.org/", "");
+
+  fail_unless (&t.getName()   == &t2.getName());
+  fail_unless (&t.getURI()    == &t2.getURI());
+  fail_unless (&t.getPrefix() == &t2.getPrefix());
+  fail_unless (t == t2);
+
+  fail_unless (&t.getName()   == &t3.getName());
+  fail_unless (&t.getPrefix() != &t3.getPrefix());
+  fail_unless (!(t == t3));
+
+  XMLNamespaces ns;
+  ns.add("http://foo.org/", "bar");
+
+  fail_unless (ns.getIndex("http://foo.org/") == 0);
+  fail_unless (ns.getIndex("http://bar.org/") == -1);
+}
+END_TEST
+
 START_TEST (test_Token_copyConstructor)
 {
   XMLTriple *t = new XMLTriple("sarah", "http://foo.org/", "bar");
@@ -267,6 +291,47 @@ START_TEST (test_Token_clone)
 }
 END_TEST
 
+START_TEST (test_Token_swap)
+{
+  XMLTriple t("sarah", "http://foo.org/", "bar");
+  XMLAttributes attr;
+  attr.add("id", "s1");
+  XMLNamespaces ns;
+  ns.add("http://foo.org/", "bar");
+
+  XMLToken token(t, attr, ns, 3, 4);
+  XMLToken token2("some text", 5, 6);
+
+  token.swap(token2);
+
+  fail_unless(token.isText() == 1);
+  fail_unless(token.getCharacters() == "some text");
+  fail_unless(token.getName().empty());
+  fail_unless(token.getAttributesLength() == 0);
+  fail_unless(token.getLine() == 5);
+  fail_unless(token.getColumn() == 6);
+
+  fail_unless(token2.isStart() == 1);
+  fail_unless(token2.getName() == "sarah");
+  fail_unless(token2.getURI() == "http://foo.org/");
+  fail_unless(token2.getPrefix() == "bar");
+  fail_unless(token2.getAttrValue("id") == "s1");
+  fail_unless(token2.getNamespacesLength() == 1);
+  fail_unless(token2.getCharacters().empty());
+  fail_unless(token2.getLine() == 3);
+  fail_unless(token2.getColumn() == 4);
+
+  XMLAttributes attr2;
+  XMLNamespaces ns2;
+  token2.swapAttributes(attr2, ns2);
+
+  fail_unless(token2.getAttributesLength() == 0);
+  fail_unless(token2.getNamespacesLength() == 0);
+  fail_unless(attr2.getValue("id") == "s1");
+  fail_unless(ns2.getURI("bar") == "http://foo.org/");
+}
+END_TEST
+
 START_TEST (test_Node_copyConstructor)
 {
   XMLAttributes *att = new XMLAttributes();
@@ -395,9 +460,11 @@ create_suite_CopyAndClone (void)
   tcase_add_test( tcase, test_Triple_copyConstructor );
   tcase_add_test( tcase, test_Triple_assignmentOperator );
   tcase_add_test( tcase, test_Triple_clone );
+  tcase_add_test( tcase, test_Triple_sharedStrings );
   tcase_add_test( tcase, test_Token_copyConstructor );
   tcase_add_test( tcase, test_Token_assignmentOperator );
   tcase_add_test( tcase, test_Token_clone );
+  tcase_add_test( tcase, test_Token_swap );
   tcase_add_test( tcase, test_Node_copyConstructor );
   tcase_add_test( tcase, test_Node_assignmentOperator );
   tcase_add_test( tcase, test_Node_clone );
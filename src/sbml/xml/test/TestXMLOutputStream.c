@@ -236,6 +236,95 @@ START_TEST (test_XMLOutputStream_PredefinedEntity)
 }
 END_TEST
 
+START_TEST (test_XMLOutputStream_longChars)
+{
+  XMLOutputStream_t *stream = XMLOutputStream_createAsString("", 0);
+  XMLOutputStream_startElement(stream, "testlong");
+  XMLOutputStream_writeAttributeChars(stream, "plain",
+    "a plain run of characters longer than several words");
+  XMLOutputStream_writeAttributeChars(stream, "mixed",
+    "abcdefgh<ijklmno&amp;pqrstuvw\"xyz01234'5678>9&#x41;abcdefg&");
+  XMLOutputStream_writeChars(stream, "0123456&#65;&&<<>>abcdefghijklmnop&lt");
+  XMLOutputStream_endElement(stream, "testlong");
+
+  const char * expected = "<testlong plain=\"a plain run of characters longer than several words\" mixed=\"abcdefgh&lt;ijklmno&amp;pqrstuvw&quot;xyz01234&apos;5678&gt;9&#x41;abcdefg&amp;\">0123456&#65;&amp;&amp;&lt;&lt;&gt;&gt;abcdefghijklmnop&amp;lt</testlong>";
+  const char * s = XMLOutputStream_getString(stream);
+
+  fail_unless(!strcmp(s,expected));
+
+  safe_free((void*)(s));
+
+  XMLOutputStream_free(stream);
+
+}
+END_TEST
+
+START_TEST (test_XMLOutputStream_deepIndent)
+{
+  char expected[10000];
+  char * p = expected;
+  unsigned int i, n;
+  XMLOutputStream_t *stream = XMLOutputStream_createAsString("", 0);
+
+  for (i = 0; i < 50; ++i)
+  {
+    XMLOutputStream_startElement(stream, "e");
+  }
+  XMLOutputStream_startEndElement(stream, "e");
+  for (i = 0; i < 50; ++i)
+  {
+    XMLOutputStream_endElement(stream, "e");
+  }
+
+  for (i = 0; i <= 50; ++i)
+  {
+    if (i > 0) *p++ = '\n';
+    for (n = 0; n < 2 * i; ++n) *p++ = ' ';
+    strcpy(p, i < 50 ? "<e>" : "<e/>");
+    p += strlen(p);
+  }
+  for (i = 50; i > 0; --i)
+  {
+    *p++ = '\n';
+    for (n = 0; n < 2 * (i - 1); ++n) *p++ = ' ';
+    strcpy(p, "</e>");
+    p += strlen(p);
+  }
+
+  const char * s = XMLOutputStream_getString(stream);
+
+  fail_unless(!strcmp(s,expected));
+
+  safe_free((void*)(s));
+
+  XMLOutputStream_free(stream);
+
+}
+END_TEST
+
+START_TEST (test_XMLOutputStream_doubles)
+{
+  XMLOutputStream_t *stream = XMLOutputStream_createAsString("", 0);
+  XMLOutputStream_startElement(stream, "e");
+  XMLOutputStream_writeAttributeDouble(stream, "a", 0.1 + 0.2);
+  XMLOutputStream_writeAttributeDouble(stream, "b", 6.02214076e23);
+  XMLOutputStream_writeAttributeDouble(stream, "c", -1e-300);
+  XMLOutputStream_writeAttributeDouble(stream, "d", util_NegInf());
+  XMLOutputStream_writeDouble(stream, 1.0 / 3);
+  XMLOutputStream_endElement(stream, "e");
+
+  const char * expected = "<e a=\"0.30000000000000004\" b=\"6.02214076e+23\" c=\"-1e-300\" d=\"-INF\">0.3333333333333333\n</e>";
+  const char * s = XMLOutputStream_getString(stream);
+
+  fail_unless(!strcmp(s,expected));
+
+  safe_free((void*)(s));
+
+  XMLOutputStream_free(stream);
+
+}
+END_TEST
+
 START_TEST (test_XMLOutputStream_accessWithNULL)
 {
   fail_unless( XMLOutputStream_createAsStdout(NULL, 0) == NULL );
@@ -302,6 +391,9 @@ create_suite_XMLOutputStream (void)
   tcase_add_test( tcase, test_XMLOutputStream_Elements  );
   tcase_add_test( tcase, test_XMLOutputStream_CharacterReference );
   tcase_add_test( tcase, test_XMLOutputStream_PredefinedEntity );
+  tcase_add_test( tcase, test_XMLOutputStream_longChars );
+  tcase_add_test( tcase, test_XMLOutputStream_deepIndent );
+  tcase_add_test( tcase, test_XMLOutputStream_doubles );
 
   suite_add_tcase(suite, tcase);
 